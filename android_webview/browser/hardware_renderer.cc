@@ -166,6 +166,11 @@ void HardwareRenderer::CommitFrame() {
   // physical pixels and set our browser CC device_scale_factor to 1, so this
   // suppresses the transform.
   committed_frame_->delegated_frame_data->device_scale_factor = 1.0f;
+
+  // Unpack the frame into the layer tree now, during the sync pass, so that
+  // the draw pass does not spend its budget on it. This requires no GL and
+  // CommitFrame runs on the same thread as DrawGL.
+  SetFrameData();
 }
 
 void HardwareRenderer::SetFrameData() {
@@ -210,11 +215,10 @@ void HardwareRenderer::DrawGL(bool stencil_enabled,
   if (last_egl_context_ != current_context)
     DLOG(WARNING) << "EGLContextChanged";
 
-  SetFrameData();
-  if (shared_renderer_state_->ForceCommitOnRT()) {
+  // Frames are normally consumed by CommitFrame() in the sync pass; only a
+  // forced commit still needs to be picked up here.
+  if (shared_renderer_state_->ForceCommitOnRT())
     CommitFrame();
-    SetFrameData();
-  }
 
   gfx::Transform transform(gfx::Transform::kSkipInitialization);
   transform.matrix().setColMajorf(draw_info->transform);
@@ -20,6 +20,8 @@ namespace thunks {
 static GetAllocatorWasteSizeFunction g_get_allocator_waste_size_function = NULL;
 static GetStatsFunction g_get_stats_function = NULL;
 static ReleaseFreeMemoryFunction g_release_free_memory_function = NULL;
+static AllocationObserverFunction g_allocation_observer_function = NULL;
+static FreeObserverFunction g_free_observer_function = NULL;
 
 void SetGetAllocatorWasteSizeFunction(
     GetAllocatorWasteSizeFunction get_allocator_waste_size_function) {
@@ -47,6 +49,20 @@ ReleaseFreeMemoryFunction GetReleaseFreeMemoryFunction() {
   return g_release_free_memory_function;
 }
 
+void SetAllocationObserverFunctions(
+    AllocationObserverFunction allocation_observer_function,
+    FreeObserverFunction free_observer_function) {
+  g_allocation_observer_function = allocation_observer_function;
+  g_free_observer_function = free_observer_function;
+}
+
+void GetAllocationObserverFunctions(
+    AllocationObserverFunction* allocation_observer_function,
+    FreeObserverFunction* free_observer_function) {
+  *allocation_observer_function = g_allocation_observer_function;
+  *free_observer_function = g_free_observer_function;
+}
+
 }  // namespace thunks
 }  // namespace allocator
 }  // namespace base
@@ -29,6 +29,20 @@ void SetReleaseFreeMemoryFunction(
     ReleaseFreeMemoryFunction release_free_memory_function);
 ReleaseFreeMemoryFunction GetReleaseFreeMemoryFunction();
 
+// Unlike the extensions above, the observer functions flow the other way:
+// base registers them and the allocator implementation invokes them, via its
+// malloc hooks, on every allocation and free (a realloc is reported as a free
+// followed by an allocation).  Either function may be NULL, and observers
+// must tolerate being called on any thread.
+typedef void (*AllocationObserverFunction)(const void* address, size_t size);
+typedef void (*FreeObserverFunction)(const void* address);
+void SetAllocationObserverFunctions(
+    AllocationObserverFunction allocation_observer_function,
+    FreeObserverFunction free_observer_function);
+void GetAllocationObserverFunctions(
+    AllocationObserverFunction* allocation_observer_function,
+    FreeObserverFunction* free_observer_function);
+
 }  // namespace thunks
 }  // namespace allocator
 }  // namespace base
@@ -482,8 +482,10 @@
         'debug/crash_logging_unittest.cc',
         'debug/debugger_unittest.cc',
         'debug/leak_tracker_unittest.cc',
+        'debug/long_task_watchdog_unittest.cc',
         'debug/proc_maps_linux_unittest.cc',
         'debug/stack_trace_unittest.cc',
+        'debug/task_allocation_profiler_unittest.cc',
         'debug/task_annotator_unittest.cc',
         'debug/trace_event_argument_unittest.cc',
         'debug/trace_event_memory_unittest.cc',
@@ -539,6 +541,7 @@
         'mac/scoped_sending_event_unittest.mm',
         'md5_unittest.cc',
         'memory/aligned_memory_unittest.cc',
+        'memory/arena_unittest.cc',
         'memory/discardable_memory_manager_unittest.cc',
         'memory/discardable_memory_unittest.cc',
         'memory/discardable_shared_memory_unittest.cc',
@@ -548,6 +551,7 @@
         'memory/scoped_ptr_unittest.cc',
         'memory/scoped_ptr_unittest.nc',
         'memory/scoped_vector_unittest.cc',
+        'memory/shared_memory_pool_unittest.cc',
         'memory/shared_memory_unittest.cc',
         'memory/singleton_unittest.cc',
         'memory/weak_ptr_unittest.cc',
@@ -610,6 +614,7 @@
         'strings/stringprintf_unittest.cc',
         'strings/string_number_conversions_unittest.cc',
         'strings/string_piece_unittest.cc',
+        'strings/string_builder_unittest.cc',
         'strings/string_split_unittest.cc',
         'strings/string_tokenizer_unittest.cc',
         'strings/string_util_unittest.cc',
@@ -655,6 +660,7 @@
         'timer/hi_res_timer_manager_unittest.cc',
         'timer/mock_timer_unittest.cc',
         'timer/timer_unittest.cc',
+        'timer/timing_wheel_unittest.cc',
         'tools_sanity_unittest.cc',
         'tracked_objects_unittest.cc',
         'tuple_unittest.cc',
@@ -4,16 +4,204 @@
 
 #include "base/base64.h"
 
+#include "base/cpu.h"
+#include "build/build_config.h"
 #include "third_party/modp_b64/modp_b64.h"
 
+// Vectorized kernels. x86 builds target SSE2, so the SSSE3 kernels are
+// compiled with a per-function target attribute (or unconditionally with
+// MSVC, whose intrinsics don't need one) and selected at runtime via
+// base::CPU. On ARM the kernels are compiled in whenever the build already
+// targets NEON.
+#if defined(ARCH_CPU_X86_FAMILY) && !defined(OS_NACL) && \
+    (defined(__clang__) || defined(__GNUC__) || defined(_MSC_VER))
+#define BASE64_USE_SIMD 1
+#define BASE64_USE_SSSE3 1
+#include <tmmintrin.h>
+#if defined(_MSC_VER)
+#define BASE64_TARGET_SSSE3
+#else
+#define BASE64_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+#elif defined(ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON__)
+#define BASE64_USE_SIMD 1
+#define BASE64_USE_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace base {
 
+namespace {
+
+#if defined(BASE64_USE_SSSE3)
+
+// Maps 6-bit values already laid out one per byte to base64 characters.
+// The index built below is 0 for 26..51, 1..10 for 52..61, 11 for 62,
+// 12 for 63 and 13 for 0..25; the table holds the offset to add for each.
+BASE64_TARGET_SSSE3
+inline __m128i EncodeLookupSSSE3(__m128i indices) {
+  __m128i lut_index = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  lut_index = _mm_or_si128(lut_index, _mm_and_si128(less, _mm_set1_epi8(13)));
+  const __m128i shift_lut =
+      _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                    '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  return _mm_add_epi8(indices, _mm_shuffle_epi8(shift_lut, lut_index));
+}
+
+// Encodes 12-byte chunks of |src| into 16 base64 characters each. Only
+// consumes input while at least 16 readable bytes remain (the vector load
+// reads 4 bytes past the chunk). Returns the number of input bytes consumed.
+BASE64_TARGET_SSSE3
+size_t Base64EncodeSSSE3(char* dst, const char* src, size_t len) {
+  size_t consumed = 0;
+  while (len - consumed >= 16) {
+    __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + consumed));
+    // Spread the 12 input bytes over the four 32-bit lanes as
+    // [b1 b0 b2 b1] so each lane holds one 3-byte group.
+    in = _mm_shuffle_epi8(
+        in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    // Isolate the four 6-bit fields of each group and shift them into
+    // separate bytes with two multiplies.
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     EncodeLookupSSSE3(indices));
+    consumed += 12;
+    dst += 16;
+  }
+  return consumed;
+}
+
+// Decodes 16-character blocks of |src| into 12 bytes each, stopping at the
+// first block containing a character outside the base64 alphabet (including
+// '=' padding, which the scalar tail handles). Writes 16 bytes per block, of
+// which the last 4 are scratch; the caller guarantees the slack. Returns the
+// number of input characters consumed.
+BASE64_TARGET_SSSE3
+size_t Base64DecodeSSSE3(char* dst, const char* src, size_t len) {
+  // Nibble-indexed class masks: a character is valid iff the bit sets for
+  // its high and low nibble don't intersect.
+  const __m128i lut_lo =
+      _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                    0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m128i lut_hi =
+      _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  // Offset to add, indexed by high nibble ('/' gets its own slot at 1).
+  const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                         0, 0, 0, 0, 0, 0, 0, 0);
+  size_t consumed = 0;
+  // Keep at least 8 characters for the scalar tail so '=' padding and the
+  // output slack are handled there.
+  while (len - consumed >= 24) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + consumed));
+    const __m128i hi_nibbles =
+        _mm_and_si128(_mm_srli_epi16(in, 4), _mm_set1_epi8(0x0f));
+    const __m128i lo_nibbles = _mm_and_si128(in, _mm_set1_epi8(0x0f));
+    const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+    const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+    if (_mm_movemask_epi8(
+            _mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128()))) {
+      break;  // Invalid or padding character; let the scalar code decide.
+    }
+    const __m128i eq_2f = _mm_cmpeq_epi8(in, _mm_set1_epi8(0x2f));
+    const __m128i roll =
+        _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2f, hi_nibbles));
+    const __m128i values = _mm_add_epi8(in, roll);
+    // Pack the four 6-bit values of each lane into 3 bytes.
+    const __m128i merged =
+        _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i out = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+    out = _mm_shuffle_epi8(out, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14,
+                                              13, 12, -1, -1, -1, -1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), out);
+    consumed += 16;
+    dst += 12;
+  }
+  return consumed;
+}
+
+bool HasSSSE3() {
+  static bool has_ssse3 = CPU().has_ssse3();
+  return has_ssse3;
+}
+
+#endif  // defined(BASE64_USE_SSSE3)
+
+#if defined(BASE64_USE_NEON)
+
+// Encodes 48-byte chunks of |src| into 64 base64 characters each, using
+// deinterleaving loads to split the 3-byte groups across registers. Returns
+// the number of input bytes consumed.
+size_t Base64EncodeNEON(char* dst, const char* src, size_t len) {
+  size_t consumed = 0;
+  while (len - consumed >= 48) {
+    const uint8x16x3_t in =
+        vld3q_u8(reinterpret_cast<const uint8_t*>(src + consumed));
+    uint8x16x4_t sextets;
+    sextets.val[0] = vshrq_n_u8(in.val[0], 2);
+    sextets.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[0], vdupq_n_u8(3)), 4),
+                              vshrq_n_u8(in.val[1], 4));
+    sextets.val[2] =
+        vorrq_u8(vshlq_n_u8(vandq_u8(in.val[1], vdupq_n_u8(0xf)), 2),
+                 vshrq_n_u8(in.val[2], 6));
+    sextets.val[3] = vandq_u8(in.val[2], vdupq_n_u8(0x3f));
+    for (int i = 0; i < 4; ++i) {
+      const uint8x16_t v = sextets.val[i];
+      // Select the alphabet offset per range; the additions wrap mod 256.
+      uint8x16_t offset = vdupq_n_u8('A');
+      offset = vbslq_u8(vcgtq_u8(v, vdupq_n_u8(25)), vdupq_n_u8('a' - 26),
+                        offset);
+      offset = vbslq_u8(vcgtq_u8(v, vdupq_n_u8(51)),
+                        vdupq_n_u8(static_cast<uint8_t>('0' - 52)), offset);
+      offset = vbslq_u8(vceqq_u8(v, vdupq_n_u8(62)),
+                        vdupq_n_u8(static_cast<uint8_t>('+' - 62)), offset);
+      offset = vbslq_u8(vceqq_u8(v, vdupq_n_u8(63)),
+                        vdupq_n_u8(static_cast<uint8_t>('/' - 63)), offset);
+      sextets.val[i] = vaddq_u8(v, offset);
+    }
+    vst4q_u8(reinterpret_cast<uint8_t*>(dst), sextets);
+    consumed += 48;
+    dst += 64;
+  }
+  return consumed;
+}
+
+#endif  // defined(BASE64_USE_NEON)
+
+}  // namespace
+
 void Base64Encode(const StringPiece& input, std::string* output) {
   std::string temp;
   temp.resize(modp_b64_encode_len(input.size()));  // makes room for null byte
 
+  const char* src = input.data();
+  size_t remaining = input.size();
+  size_t output_size = 0;
+#if defined(BASE64_USE_SSSE3)
+  if (HasSSSE3()) {
+    size_t consumed = Base64EncodeSSSE3(&(temp[0]), src, remaining);
+    src += consumed;
+    remaining -= consumed;
+    output_size += (consumed / 3) * 4;
+  }
+#elif defined(BASE64_USE_NEON)
+  {
+    size_t consumed = Base64EncodeNEON(&(temp[0]), src, remaining);
+    src += consumed;
+    remaining -= consumed;
+    output_size += (consumed / 3) * 4;
+  }
+#endif
   // modp_b64_encode_len() returns at least 1, so temp[0] is safe to use.
-  size_t output_size = modp_b64_encode(&(temp[0]), input.data(), input.size());
+  output_size += modp_b64_encode(&(temp[output_size]), src, remaining);
 
   temp.resize(output_size);  // strips off null byte
   output->swap(temp);
@@ -23,11 +211,22 @@ bool Base64Decode(const StringPiece& input, std::string* output) {
   std::string temp;
   temp.resize(modp_b64_decode_len(input.size()));
 
+  const char* src = input.data();
+  size_t remaining = input.size();
+  size_t output_size = 0;
+#if defined(BASE64_USE_SSSE3)
+  if (HasSSSE3() && remaining) {
+    size_t consumed = Base64DecodeSSSE3(&(temp[0]), src, remaining);
+    src += consumed;
+    remaining -= consumed;
+    output_size += (consumed / 4) * 3;
+  }
+#endif
   // does not null terminate result since result is binary data!
-  size_t input_size = input.size();
-  size_t output_size = modp_b64_decode(&(temp[0]), input.data(), input_size);
-  if (output_size == MODP_B64_ERROR)
+  size_t tail_size = modp_b64_decode(&(temp[output_size]), src, remaining);
+  if (tail_size == MODP_B64_ERROR)
     return false;
+  output_size += tail_size;
 
   temp.resize(output_size);
   output->swap(temp);
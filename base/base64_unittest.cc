@@ -24,6 +24,29 @@ TEST(Base64Test, Basic) {
   EXPECT_EQ(kText, decoded);
 }
 
+// Inputs large enough to exercise the vectorized paths, with lengths around
+// the block boundaries so the scalar tail handling is covered too.
+TEST(Base64Test, LongInputs) {
+  for (size_t size = 40; size <= 80; ++size) {
+    std::string text;
+    for (size_t i = 0; i < size; ++i)
+      text.push_back(static_cast<char>(i * 89 + 17));
+
+    std::string encoded;
+    std::string decoded;
+    Base64Encode(text, &encoded);
+    EXPECT_TRUE(Base64Decode(encoded, &decoded));
+    EXPECT_EQ(text, decoded) << "size " << size;
+  }
+
+  // An invalid character late in a long input must still be rejected.
+  std::string encoded;
+  Base64Encode(std::string(60, 'a'), &encoded);
+  encoded[encoded.size() - 2] = '!';
+  std::string decoded;
+  EXPECT_FALSE(Base64Decode(encoded, &decoded));
+}
+
 TEST(Base64Test, InPlace) {
   const std::string kText = "hello world";
   const std::string kBase64Text = "aGVsbG8gd29ybGQ=";
@@ -13,6 +13,7 @@
 #include "base/containers/hash_tables.h"
 #include "base/logging.h"
 #include "base/memory/manual_constructor.h"
+#include "base/strings/string_piece.h"
 
 namespace base {
 
@@ -124,6 +125,20 @@ struct has_key_equal {
 };
 template <typename M> const bool has_key_equal<M>::value;
 
+// Converts the key used for a heterogeneous lookup (see the find()
+// overloads below) to the map's key_type for the NormalMap fallback. The
+// BasicStringPiece overload is what makes string-keyed maps usable with a
+// StringPiece lookup key, which has no conversion to std::string: the
+// bytes are copied here, once, rather than on every comparison.
+template <typename KeyType, typename LookupKey>
+inline KeyType ToKey(const LookupKey& key) {
+  return KeyType(key);
+}
+template <typename KeyType>
+inline KeyType ToKey(const BasicStringPiece<KeyType>& key) {
+  return key.as_string();
+}
+
 // Base template used for map types that do NOT have an M::key_equal member,
 // e.g., std::map<>. These maps have a strict weak ordering comparator rather
 // than an equality functor, so equality will be implemented in terms of that
@@ -134,8 +149,12 @@ template <typename M> const bool has_key_equal<M>::value;
 template <typename M, bool has_key_equal_value>
 struct select_equal_key {
   struct equal_key {
+    // |right| is templated so that lookups can be done with any type the
+    // comparator accepts alongside key_type, e.g. a StringPiece against
+    // std::string keys.
+    template <typename LookupKey>
     bool operator()(const typename M::key_type& left,
-                    const typename M::key_type& right) {
+                    const LookupKey& right) {
       // Implements equality in terms of a strict weak ordering comparator.
       typename M::key_compare comp;
       return !comp(left, right) && !comp(right, left);
@@ -152,7 +171,8 @@ struct select_equal_key {
 template <typename KeyType, typename ValueType>
 struct select_equal_key< std::map<KeyType, ValueType>, false> {
   struct equal_key {
-    bool operator()(const KeyType& left, const KeyType& right) {
+    template <typename LookupKey>
+    bool operator()(const KeyType& left, const LookupKey& right) {
       return left == right;
     }
   };
@@ -160,7 +180,8 @@ struct select_equal_key< std::map<KeyType, ValueType>, false> {
 template <typename KeyType, typename ValueType>
 struct select_equal_key< base::hash_map<KeyType, ValueType>, false> {
   struct equal_key {
-    bool operator()(const KeyType& left, const KeyType& right) {
+    template <typename LookupKey>
+    bool operator()(const KeyType& left, const LookupKey& right) {
       return left == right;
     }
   };
@@ -411,6 +432,42 @@ class SmallMap {
     }
   }
 
+  // find() for a key of a different type than key_type, e.g. a StringPiece
+  // or string literal against std::string keys. While the map is backed by
+  // the array the comparisons run directly against |key|, so no temporary
+  // key_type is constructed; EqualKey must be callable with a (key_type,
+  // LookupKey) pair. Once the map has degraded to NormalMap the key is
+  // converted once for NormalMap::find().
+  template <typename LookupKey>
+  iterator find(const LookupKey& key) {
+    key_equal compare;
+    if (size_ >= 0) {
+      for (int i = 0; i < size_; i++) {
+        if (compare(array_[i]->first, key)) {
+          return iterator(array_ + i);
+        }
+      }
+      return iterator(array_ + size_);
+    } else {
+      return iterator(map()->find(internal::ToKey<key_type>(key)));
+    }
+  }
+
+  template <typename LookupKey>
+  const_iterator find(const LookupKey& key) const {
+    key_equal compare;
+    if (size_ >= 0) {
+      for (int i = 0; i < size_; i++) {
+        if (compare(array_[i]->first, key)) {
+          return const_iterator(array_ + i);
+        }
+      }
+      return const_iterator(array_ + size_);
+    } else {
+      return const_iterator(map()->find(internal::ToKey<key_type>(key)));
+    }
+  }
+
   // Invalidates iterators.
   data_type& operator[](const key_type& key) {
     key_equal compare;
@@ -459,6 +516,33 @@ class SmallMap {
     }
   }
 
+  // Invalidates iterators. Moves |x| into the map rather than copying it,
+  // which matters when the mapped type is expensive to copy.
+  std::pair<iterator, bool> insert(value_type&& x) {
+    key_equal compare;
+
+    if (size_ >= 0) {
+      for (int i = 0; i < size_; i++) {
+        if (compare(array_[i]->first, x.first)) {
+          return std::make_pair(iterator(array_ + i), false);
+        }
+      }
+      if (size_ == kArraySize) {
+        ConvertToRealMap();  // Invalidates all iterators!
+        std::pair<typename NormalMap::iterator, bool> ret =
+            map_->insert(std::move(x));
+        return std::make_pair(iterator(ret.first), ret.second);
+      } else {
+        array_[size_].InitFromMove(std::move(x));
+        return std::make_pair(iterator(array_ + size_++), true);
+      }
+    } else {
+      std::pair<typename NormalMap::iterator, bool> ret =
+          map_->insert(std::move(x));
+      return std::make_pair(iterator(ret.first), ret.second);
+    }
+  }
+
   // Invalidates iterators.
   template <class InputIterator>
   void insert(InputIterator f, InputIterator l) {
@@ -535,6 +619,13 @@ class SmallMap {
     return (find(key) == end()) ? 0 : 1;
   }
 
+  // count() for a key of a different type than key_type; see the find()
+  // overload above.
+  template <typename LookupKey>
+  size_t count(const LookupKey& key) const {
+    return (find(key) == end()) ? 0 : 1;
+  }
+
   size_t size() const {
     if (size_ >= 0) {
       return static_cast<size_t>(size_);
@@ -593,7 +684,7 @@ class SmallMap {
     ManualConstructor<value_type> temp_array[kArraySize];
 
     for (int i = 0; i < kArraySize; i++) {
-      temp_array[i].Init(*array_[i]);
+      temp_array[i].InitFromMove(std::move(*array_[i]));
       array_[i].Destroy();
     }
 
@@ -603,7 +694,7 @@ class SmallMap {
 
     // Insert elements into it.
     for (int i = 0; i < kArraySize; i++) {
-      map_->insert(*temp_array[i]);
+      map_->insert(std::move(*temp_array[i]));
       temp_array[i].Destroy();
     }
   }
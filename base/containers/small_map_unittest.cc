@@ -9,9 +9,12 @@
 #include <algorithm>
 #include <functional>
 #include <map>
+#include <string>
+#include <utility>
 
 #include "base/containers/hash_tables.h"
 #include "base/logging.h"
+#include "base/strings/string_piece.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace base {
@@ -401,6 +404,85 @@ TEST(SmallMap, NonHashMap) {
   EXPECT_EQ(iter->second, 90);
 }
 
+TEST(SmallMap, HeterogeneousFind) {
+  SmallMap<std::map<std::string, int> > m;
+  m["host"] = 1;
+  m["cookie"] = 2;
+  EXPECT_FALSE(m.UsingFullMap());
+
+  // Lookups with a StringPiece or a string literal must not need a
+  // temporary std::string while the map is in array mode.
+  EXPECT_EQ(1, m.find(StringPiece("host"))->second);
+  EXPECT_EQ(2, m.find("cookie")->second);
+  EXPECT_TRUE(m.find(StringPiece("missing")) == m.end());
+  EXPECT_EQ(1u, m.count(StringPiece("host")));
+  EXPECT_EQ(0u, m.count("missing"));
+
+  // The same lookups once the map has degraded to std::map.
+  m["a"] = 3;
+  m["b"] = 4;
+  m["c"] = 5;
+  EXPECT_TRUE(m.UsingFullMap());
+  EXPECT_EQ(1, m.find(StringPiece("host"))->second);
+  EXPECT_EQ(2, m.find("cookie")->second);
+  EXPECT_TRUE(m.find(StringPiece("missing")) == m.end());
+  EXPECT_EQ(1u, m.count(StringPiece("host")));
+  EXPECT_EQ(0u, m.count("missing"));
+
+  const SmallMap<std::map<std::string, int> >& const_m = m;
+  EXPECT_EQ(3, const_m.find(StringPiece("a"))->second);
+}
+
+namespace {
+
+// Counts how often it is copied; moving leaves the counter behind.
+struct CopyCounter {
+  CopyCounter() : copies(NULL) {}
+  explicit CopyCounter(int* copies) : copies(copies) {}
+  CopyCounter(const CopyCounter& other) : copies(other.copies) {
+    if (copies)
+      ++*copies;
+  }
+  CopyCounter(CopyCounter&& other) : copies(other.copies) {
+    other.copies = NULL;
+  }
+  CopyCounter& operator=(const CopyCounter& other) {
+    copies = other.copies;
+    if (copies)
+      ++*copies;
+    return *this;
+  }
+
+  int* copies;
+};
+
+}  // anonymous namespace
+
+TEST(SmallMap, MoveInsert) {
+  int copies = 0;
+  SmallMap<std::map<int, CopyCounter> > m;
+
+  // Filling the array should move the values in, not copy them.
+  for (int i = 0; i < 4; ++i)
+    m.insert(std::make_pair(i, CopyCounter(&copies)));
+  EXPECT_FALSE(m.UsingFullMap());
+  EXPECT_EQ(0, copies);
+
+  // Converting to the real map moves the array entries as well.
+  for (int i = 4; i < 8; ++i)
+    m.insert(std::make_pair(i, CopyCounter(&copies)));
+  EXPECT_TRUE(m.UsingFullMap());
+  EXPECT_EQ(8u, m.size());
+  EXPECT_EQ(0, copies);
+
+  // Inserting a duplicate key must leave the value alone.
+  SmallMap<std::map<int, CopyCounter> >::value_type dup(3,
+                                                        CopyCounter(&copies));
+  EXPECT_FALSE(m.insert(std::move(dup)).second);
+  EXPECT_TRUE(dup.second.copies != NULL);
+  EXPECT_EQ(0, copies);
+}
+
 TEST(SmallMap, DefaultEqualKeyWorks) {
   // If these tests compile, they pass. The EXPECT calls are only there to avoid
   // unused variable warnings.
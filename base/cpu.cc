@@ -45,6 +45,7 @@ CPU::CPU()
     has_avx_(false),
     has_avx_hardware_(false),
     has_aesni_(false),
+    has_sha_(false),
     has_non_stop_time_stamp_counter_(false),
     has_broken_neon_(false),
     cpu_vendor_("unknown") {
@@ -64,7 +65,7 @@ void __cpuid(int cpu_info[4], int info_type) {
     "cpuid\n"
     "xchg %%edi, %%ebx\n"
     : "=a"(cpu_info[0]), "=D"(cpu_info[1]), "=c"(cpu_info[2]), "=d"(cpu_info[3])
-    : "a"(info_type)
+    : "a"(info_type), "c"(0)
   );
 }
 
@@ -74,7 +75,7 @@ void __cpuid(int cpu_info[4], int info_type) {
   __asm__ volatile (
     "cpuid \n\t"
     : "=a"(cpu_info[0]), "=b"(cpu_info[1]), "=c"(cpu_info[2]), "=d"(cpu_info[3])
-    : "a"(info_type)
+    : "a"(info_type), "c"(0)
   );
 }
 
@@ -246,6 +247,17 @@ void CPU::Initialize() {
     has_aesni_ = (cpu_info[2] & 0x02000000) != 0;
   }
 
+  // Interpret structured extended feature flags (leaf 7, sub-leaf 0). The
+  // |__cpuid| wrappers above clear ecx, which selects the sub-leaf.
+  if (num_ids >= 7) {
+#if defined(_MSC_VER)
+    __cpuidex(cpu_info, 7, 0);
+#else
+    __cpuid(cpu_info, 7);
+#endif
+    has_sha_ = (cpu_info[1] & 0x20000000) != 0;
+  }
+
   // Get the brand string of the cpu.
   __cpuid(cpu_info, 0x80000000);
   const int parameter_end = 0x80000004;
@@ -53,6 +53,9 @@ class BASE_EXPORT CPU {
   // to workaround a bug in NSS but |has_avx()| is what you want.
   bool has_avx_hardware() const { return has_avx_hardware_; }
   bool has_aesni() const { return has_aesni_; }
+  // has_sha returns true when the Intel SHA extensions (SHA-1/SHA-256
+  // instructions) are available.
+  bool has_sha() const { return has_sha_; }
   bool has_non_stop_time_stamp_counter() const {
     return has_non_stop_time_stamp_counter_;
   }
@@ -85,6 +88,7 @@ class BASE_EXPORT CPU {
   bool has_avx_;
   bool has_avx_hardware_;
   bool has_aesni_;
+  bool has_sha_;
   bool has_non_stop_time_stamp_counter_;
   bool has_broken_neon_;
   std::string cpu_vendor_;
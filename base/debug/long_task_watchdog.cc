@@ -0,0 +1,108 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/debug/long_task_watchdog.h"
+
+#include <set>
+
+#include "base/lazy_instance.h"
+#include "base/logging.h"
+#include "base/pending_task.h"
+
+namespace base {
+namespace debug {
+
+namespace {
+
+// All live watchdogs, for GetEntriesForAllThreads().  Watchdogs are few and
+// long-lived, so a lock around a set is plenty.
+struct WatchdogRegistry {
+  Lock lock;
+  std::set<LongTaskWatchdog*> watchdogs;
+};
+
+LazyInstance<WatchdogRegistry>::Leaky g_registry = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+LongTaskWatchdog::Entry::Entry() {
+}
+
+LongTaskWatchdog::Entry::~Entry() {
+}
+
+LongTaskWatchdog::LongTaskWatchdog(const std::string& thread_name,
+                                   TimeDelta threshold,
+                                   size_t capacity)
+    : thread_name_(thread_name),
+      threshold_(threshold),
+      capacity_(capacity),
+      next_index_(0) {
+  DCHECK_GT(capacity, 0u);
+  WatchdogRegistry* registry = g_registry.Pointer();
+  AutoLock auto_lock(registry->lock);
+  registry->watchdogs.insert(this);
+}
+
+LongTaskWatchdog::~LongTaskWatchdog() {
+  WatchdogRegistry* registry = g_registry.Pointer();
+  AutoLock auto_lock(registry->lock);
+  registry->watchdogs.erase(this);
+}
+
+void LongTaskWatchdog::WillProcessTask(const PendingTask& pending_task) {
+  RunningTask running_task;
+  running_task.start_time = TimeTicks::Now();
+  running_tasks_.push_back(running_task);
+}
+
+void LongTaskWatchdog::DidProcessTask(const PendingTask& pending_task) {
+  DCHECK(!running_tasks_.empty());
+  const TimeDelta total_duration =
+      TimeTicks::Now() - running_tasks_.back().start_time;
+  const TimeDelta run_duration =
+      total_duration - running_tasks_.back().excluded_duration;
+  running_tasks_.pop_back();
+  if (!running_tasks_.empty())
+    running_tasks_.back().excluded_duration += total_duration;
+  if (run_duration < threshold_)
+    return;
+
+  AutoLock auto_lock(lock_);
+  Entry* entry;
+  if (entries_.size() < capacity_) {
+    entries_.push_back(Entry());
+    entry = &entries_.back();
+  } else {
+    // The buffer is full; recycle the oldest slot.
+    entry = &entries_[next_index_];
+    next_index_ = (next_index_ + 1) % capacity_;
+  }
+  entry->thread_name = thread_name_;
+  entry->posted_from =
+      tracked_objects::LocationSnapshot(pending_task.posted_from);
+  entry->run_duration = run_duration;
+  entry->end_time = Time::Now();
+}
+
+void LongTaskWatchdog::GetEntries(std::vector<Entry>* entries) const {
+  AutoLock auto_lock(lock_);
+  // Once the buffer has wrapped, |next_index_| is the oldest entry.
+  for (size_t i = 0; i < entries_.size(); ++i)
+    entries->push_back(entries_[(next_index_ + i) % entries_.size()]);
+}
+
+// static
+void LongTaskWatchdog::GetEntriesForAllThreads(std::vector<Entry>* entries) {
+  WatchdogRegistry* registry = g_registry.Pointer();
+  AutoLock auto_lock(registry->lock);
+  for (std::set<LongTaskWatchdog*>::const_iterator it =
+           registry->watchdogs.begin();
+       it != registry->watchdogs.end(); ++it) {
+    (*it)->GetEntries(entries);
+  }
+}
+
+}  // namespace debug
+}  // namespace base
@@ -0,0 +1,100 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_DEBUG_LONG_TASK_WATCHDOG_H_
+#define BASE_DEBUG_LONG_TASK_WATCHDOG_H_
+
+#include <string>
+#include <vector>
+
+#include "base/base_export.h"
+#include "base/basictypes.h"
+#include "base/location.h"
+#include "base/message_loop/message_loop.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
+
+namespace base {
+namespace debug {
+
+// A task observer that records every task on the watched message loop whose
+// run time exceeds a threshold, keeping the most recent offenders in a
+// bounded ring buffer.  The recorded posting site answers "what ran long"
+// for stalls on instrumented threads without a debugger attached.
+//
+// The watchdog must be added to and removed from a message loop on that
+// loop's own thread, like any TaskObserver.  The ring buffer may be read
+// from any thread.
+class BASE_EXPORT LongTaskWatchdog : public MessageLoop::TaskObserver {
+ public:
+  // One recorded over-threshold task.
+  struct BASE_EXPORT Entry {
+    Entry();
+    ~Entry();
+
+    // Name of the thread the task ran on.
+    std::string thread_name;
+
+    // Where the task was posted from.
+    tracked_objects::LocationSnapshot posted_from;
+
+    // How long the task ran.
+    TimeDelta run_duration;
+
+    // Wall-clock time at which the task finished, for correlating entries
+    // with external reports of jank.
+    Time end_time;
+  };
+
+  // Tasks running at least |threshold| are recorded; the newest |capacity|
+  // entries are retained.  The watchdog registers itself for retrieval via
+  // GetEntriesForAllThreads() until it is destroyed.
+  LongTaskWatchdog(const std::string& thread_name,
+                   TimeDelta threshold,
+                   size_t capacity);
+  ~LongTaskWatchdog() override;
+
+  // MessageLoop::TaskObserver:
+  void WillProcessTask(const PendingTask& pending_task) override;
+  void DidProcessTask(const PendingTask& pending_task) override;
+
+  // Appends this watchdog's recorded tasks to |entries|, oldest first.  May
+  // be called from any thread.
+  void GetEntries(std::vector<Entry>* entries) const;
+
+  // Appends the recorded tasks of every live watchdog in the process to
+  // |entries|.  May be called from any thread.
+  static void GetEntriesForAllThreads(std::vector<Entry>* entries);
+
+ private:
+  const std::string thread_name_;
+  const TimeDelta threshold_;
+  const size_t capacity_;
+
+  // One stack frame per task currently being processed on the watched
+  // thread.  This is a stack because a task that spins a nested message loop
+  // observes inner tasks before its own DidProcessTask(); the wallclock time
+  // of the inner tasks is excluded from the outer task so that jank is
+  // charged to the task that actually ran long, as TaskStopwatch does for
+  // tracked_objects.  Only accessed on the watched thread.
+  struct RunningTask {
+    TimeTicks start_time;
+    TimeDelta excluded_duration;
+  };
+  std::vector<RunningTask> running_tasks_;
+
+  // Ring buffer of recorded tasks, written on the watched thread and read
+  // from arbitrary threads under |lock_|.  |next_index_| is where the next
+  // entry will be written once |entries_| has grown to |capacity_|.
+  mutable Lock lock_;
+  std::vector<Entry> entries_;
+  size_t next_index_;
+
+  DISALLOW_COPY_AND_ASSIGN(LongTaskWatchdog);
+};
+
+}  // namespace debug
+}  // namespace base
+
+#endif  // BASE_DEBUG_LONG_TASK_WATCHDOG_H_
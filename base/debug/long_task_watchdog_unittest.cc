@@ -0,0 +1,117 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/debug/long_task_watchdog.h"
+
+#include <vector>
+
+#include "base/bind.h"
+#include "base/bind_helpers.h"
+#include "base/pending_task.h"
+#include "base/threading/platform_thread.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+namespace debug {
+namespace {
+
+const size_t kTestCapacity = 4;
+
+class LongTaskWatchdogTest : public testing::Test {
+ protected:
+  // Simulates running |pending_task| on the watched loop, sleeping for
+  // |duration| between the observer calls.
+  void RunTask(LongTaskWatchdog* watchdog,
+               const PendingTask& pending_task,
+               TimeDelta duration) {
+    watchdog->WillProcessTask(pending_task);
+    if (duration > TimeDelta())
+      PlatformThread::Sleep(duration);
+    watchdog->DidProcessTask(pending_task);
+  }
+};
+
+TEST_F(LongTaskWatchdogTest, RecordsTasksOverThreshold) {
+  LongTaskWatchdog watchdog("TestThread", TimeDelta(), kTestCapacity);
+  PendingTask pending_task(FROM_HERE, Bind(&DoNothing));
+  const int line_posted_from = __LINE__ - 1;
+  RunTask(&watchdog, pending_task, TimeDelta());
+
+  std::vector<LongTaskWatchdog::Entry> entries;
+  watchdog.GetEntries(&entries);
+  ASSERT_EQ(1u, entries.size());
+  EXPECT_EQ("TestThread", entries[0].thread_name);
+  EXPECT_EQ(line_posted_from, entries[0].posted_from.line_number);
+  EXPECT_GE(entries[0].run_duration, TimeDelta());
+  EXPECT_FALSE(entries[0].end_time.is_null());
+}
+
+TEST_F(LongTaskWatchdogTest, IgnoresTasksUnderThreshold) {
+  LongTaskWatchdog watchdog(
+      "TestThread", TimeDelta::FromMinutes(1), kTestCapacity);
+  PendingTask pending_task(FROM_HERE, Bind(&DoNothing));
+  RunTask(&watchdog, pending_task, TimeDelta());
+
+  std::vector<LongTaskWatchdog::Entry> entries;
+  watchdog.GetEntries(&entries);
+  EXPECT_TRUE(entries.empty());
+}
+
+TEST_F(LongTaskWatchdogTest, RingBufferKeepsNewestEntries) {
+  LongTaskWatchdog watchdog("TestThread", TimeDelta(), kTestCapacity);
+  for (size_t i = 0; i < kTestCapacity + 2; ++i) {
+    PendingTask pending_task(
+        tracked_objects::Location(
+            "Function", "file.cc", static_cast<int>(i), NULL),
+        Bind(&DoNothing));
+    RunTask(&watchdog, pending_task, TimeDelta());
+  }
+
+  std::vector<LongTaskWatchdog::Entry> entries;
+  watchdog.GetEntries(&entries);
+  ASSERT_EQ(kTestCapacity, entries.size());
+  // The two oldest entries (lines 0 and 1) were overwritten, and the
+  // survivors come back oldest first.
+  for (size_t i = 0; i < kTestCapacity; ++i)
+    EXPECT_EQ(static_cast<int>(i + 2), entries[i].posted_from.line_number);
+}
+
+TEST_F(LongTaskWatchdogTest, NestedTasksAreTimedIndependently) {
+  LongTaskWatchdog watchdog(
+      "TestThread", TimeDelta::FromMilliseconds(5), kTestCapacity);
+  PendingTask outer(
+      tracked_objects::Location("Outer", "file.cc", 1, NULL),
+      Bind(&DoNothing));
+  PendingTask inner(
+      tracked_objects::Location("Inner", "file.cc", 2, NULL),
+      Bind(&DoNothing));
+
+  // A fast outer task spins a nested loop that runs a slow inner task; only
+  // the inner task should be recorded.
+  watchdog.WillProcessTask(outer);
+  RunTask(&watchdog, inner, TimeDelta::FromMilliseconds(10));
+  watchdog.DidProcessTask(outer);
+
+  std::vector<LongTaskWatchdog::Entry> entries;
+  watchdog.GetEntries(&entries);
+  ASSERT_EQ(1u, entries.size());
+  EXPECT_EQ("Inner", entries[0].posted_from.function_name);
+}
+
+TEST_F(LongTaskWatchdogTest, GetEntriesForAllThreadsCoversAllWatchdogs) {
+  LongTaskWatchdog ui_watchdog("UI", TimeDelta(), kTestCapacity);
+  LongTaskWatchdog io_watchdog("IO", TimeDelta(), kTestCapacity);
+  PendingTask pending_task(FROM_HERE, Bind(&DoNothing));
+  RunTask(&ui_watchdog, pending_task, TimeDelta());
+  RunTask(&io_watchdog, pending_task, TimeDelta());
+
+  std::vector<LongTaskWatchdog::Entry> entries;
+  LongTaskWatchdog::GetEntriesForAllThreads(&entries);
+  ASSERT_EQ(2u, entries.size());
+  EXPECT_NE(entries[0].thread_name, entries[1].thread_name);
+}
+
+}  // namespace
+}  // namespace debug
+}  // namespace base
@@ -0,0 +1,206 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/debug/task_allocation_profiler.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include "base/allocator/allocator_extension_thunks.h"
+#include "base/lazy_instance.h"
+#include "base/synchronization/lock.h"
+#include "base/threading/thread_local.h"
+
+namespace base {
+namespace debug {
+
+namespace {
+
+// Running tallies for one posting site.
+struct SiteStats {
+  SiteStats() : live_bytes(0), live_count(0), total_bytes(0), total_count(0) {}
+
+  uint64 live_bytes;
+  uint64 live_count;
+  uint64 total_bytes;
+  uint64 total_count;
+};
+
+// What is remembered about each live allocation, so that its eventual free
+// (possibly on another thread, outside any task) can be credited back to the
+// site that made it.
+struct LiveAllocation {
+  tracked_objects::Location posted_from;
+  size_t size;
+};
+
+// All attribution state, behind a single lock.  Allocations are keyed by
+// address; sites by Location, whose comparison is cheap pointer/int ordering
+// since the underlying strings are compile-time atoms.
+struct ProfilerState {
+  Lock lock;
+  std::map<const void*, LiveAllocation> live_allocations;
+  std::map<tracked_objects::Location, SiteStats> sites;
+};
+
+LazyInstance<ProfilerState>::Leaky g_state = LAZY_INSTANCE_INITIALIZER;
+
+// The posted_from of the task the current thread is running, if any.
+LazyInstance<ThreadLocalPointer<const tracked_objects::Location> >::Leaky
+    g_current_task = LAZY_INSTANCE_INITIALIZER;
+
+// Set while a thread is updating profiler state, so that the profiler's own
+// map insertions and deletions are not themselves observed (which would
+// deadlock on |lock| and recurse without bound).
+LazyInstance<ThreadLocalBoolean>::Leaky g_in_profiler =
+    LAZY_INSTANCE_INITIALIZER;
+
+// Read without synchronization on every observed allocation, in the same way
+// tracked_objects reads its status; writes happen under |g_state|'s lock.
+bool g_enabled = false;
+
+class ScopedProfilerReentrancyGuard {
+ public:
+  ScopedProfilerReentrancyGuard() { g_in_profiler.Pointer()->Set(true); }
+  ~ScopedProfilerReentrancyGuard() { g_in_profiler.Pointer()->Set(false); }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(ScopedProfilerReentrancyGuard);
+};
+
+bool SiteHasMoreLiveBytes(
+    const std::pair<tracked_objects::Location, SiteStats>& site1,
+    const std::pair<tracked_objects::Location, SiteStats>& site2) {
+  return site1.second.live_bytes > site2.second.live_bytes;
+}
+
+}  // namespace
+
+AllocationSiteSnapshot::AllocationSiteSnapshot()
+    : live_bytes(0), live_count(0), total_bytes(0), total_count(0) {
+}
+
+AllocationSiteSnapshot::~AllocationSiteSnapshot() {
+}
+
+// static
+void TaskAllocationProfiler::Enable() {
+  // Force creation of the lazy instances while we are not yet observing
+  // allocations, so the observers never construct them re-entrantly.
+  ProfilerState* state = g_state.Pointer();
+  g_current_task.Get();
+  g_in_profiler.Get();
+
+  AutoLock auto_lock(state->lock);
+  if (g_enabled)
+    return;
+  allocator::thunks::SetAllocationObserverFunctions(
+      &TaskAllocationProfiler::OnAllocation, &TaskAllocationProfiler::OnFree);
+  g_enabled = true;
+}
+
+// static
+void TaskAllocationProfiler::Disable() {
+  // The observer functions stay registered; they become no-ops.
+  AutoLock auto_lock(g_state.Pointer()->lock);
+  g_enabled = false;
+}
+
+// static
+bool TaskAllocationProfiler::IsEnabled() {
+  AutoLock auto_lock(g_state.Pointer()->lock);
+  return g_enabled;
+}
+
+// static
+void TaskAllocationProfiler::GetTopAllocationSites(
+    size_t max_sites,
+    std::vector<AllocationSiteSnapshot>* sites) {
+  sites->clear();
+  std::vector<std::pair<tracked_objects::Location, SiteStats> > ranked;
+  {
+    ScopedProfilerReentrancyGuard guard;
+    ProfilerState* state = g_state.Pointer();
+    AutoLock auto_lock(state->lock);
+    ranked.assign(state->sites.begin(), state->sites.end());
+  }
+  std::sort(ranked.begin(), ranked.end(), &SiteHasMoreLiveBytes);
+  if (ranked.size() > max_sites)
+    ranked.resize(max_sites);
+
+  sites->resize(ranked.size());
+  for (size_t i = 0; i < ranked.size(); ++i) {
+    AllocationSiteSnapshot* snapshot = &(*sites)[i];
+    snapshot->posted_from = tracked_objects::LocationSnapshot(ranked[i].first);
+    snapshot->live_bytes = ranked[i].second.live_bytes;
+    snapshot->live_count = ranked[i].second.live_count;
+    snapshot->total_bytes = ranked[i].second.total_bytes;
+    snapshot->total_count = ranked[i].second.total_count;
+  }
+}
+
+// static
+void TaskAllocationProfiler::Reset() {
+  ScopedProfilerReentrancyGuard guard;
+  ProfilerState* state = g_state.Pointer();
+  AutoLock auto_lock(state->lock);
+  state->live_allocations.clear();
+  state->sites.clear();
+}
+
+// static
+void TaskAllocationProfiler::OnAllocation(const void* address, size_t size) {
+  if (!g_enabled || g_in_profiler.Pointer()->Get())
+    return;
+  const tracked_objects::Location* posted_from =
+      g_current_task.Pointer()->Get();
+  if (!posted_from)
+    return;
+
+  ScopedProfilerReentrancyGuard guard;
+  ProfilerState* state = g_state.Pointer();
+  AutoLock auto_lock(state->lock);
+  LiveAllocation* allocation = &state->live_allocations[address];
+  allocation->posted_from = *posted_from;
+  allocation->size = size;
+  SiteStats* stats = &state->sites[*posted_from];
+  stats->live_bytes += size;
+  ++stats->live_count;
+  stats->total_bytes += size;
+  ++stats->total_count;
+}
+
+// static
+void TaskAllocationProfiler::OnFree(const void* address) {
+  if (!g_enabled || g_in_profiler.Pointer()->Get())
+    return;
+
+  ScopedProfilerReentrancyGuard guard;
+  ProfilerState* state = g_state.Pointer();
+  AutoLock auto_lock(state->lock);
+  std::map<const void*, LiveAllocation>::iterator found =
+      state->live_allocations.find(address);
+  if (found == state->live_allocations.end()) {
+    // Allocated before the profiler was enabled, or outside of any task.
+    return;
+  }
+  SiteStats* stats = &state->sites[found->second.posted_from];
+  stats->live_bytes -= found->second.size;
+  --stats->live_count;
+  state->live_allocations.erase(found);
+}
+
+ScopedTaskAllocationContext::ScopedTaskAllocationContext(
+    const tracked_objects::Location& posted_from)
+    : previous_(g_current_task.Pointer()->Get()) {
+  g_current_task.Pointer()->Set(&posted_from);
+}
+
+ScopedTaskAllocationContext::~ScopedTaskAllocationContext() {
+  g_current_task.Pointer()->Set(previous_);
+}
+
+}  // namespace debug
+}  // namespace base
@@ -0,0 +1,100 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_DEBUG_TASK_ALLOCATION_PROFILER_H_
+#define BASE_DEBUG_TASK_ALLOCATION_PROFILER_H_
+
+#include <vector>
+
+#include "base/base_export.h"
+#include "base/basictypes.h"
+#include "base/location.h"
+
+namespace base {
+namespace debug {
+
+// Accumulated heap activity attributed to a single task posting site (the
+// posted_from location of the tasks during which the allocations were made).
+struct BASE_EXPORT AllocationSiteSnapshot {
+  AllocationSiteSnapshot();
+  ~AllocationSiteSnapshot();
+
+  tracked_objects::LocationSnapshot posted_from;
+
+  // Bytes and allocations attributed to the site that have not yet been
+  // freed.  A site that keeps growing here is holding on to its memory.
+  uint64 live_bytes;
+  uint64 live_count;
+
+  // Cumulative tallies since the profiler was enabled, including memory that
+  // has since been freed.  A large total with small live values indicates
+  // churn rather than a leak.
+  uint64 total_bytes;
+  uint64 total_count;
+};
+
+// Attributes heap allocations to the posted_from location of the task that
+// was running on the allocating thread, much as tracked_objects attributes
+// run counts and durations.  Unlike the memory infrastructure in
+// base/debug/trace_event, the data is available whenever the profiler is
+// enabled and can be polled at any time, without a tracing session.
+//
+// The profiler receives its per-allocation callbacks through the observer
+// functions in base/allocator/allocator_extension_thunks, and learns the
+// current task from the scoped context that TaskAnnotator establishes around
+// every task it runs.  Allocations made on a thread while no task is running
+// there are not recorded.  Each observed allocation takes a process-wide lock,
+// so enabling the profiler is cheap to ship but not free to run; it is meant
+// for diagnosis, not for permanent activation on end-user machines.
+class BASE_EXPORT TaskAllocationProfiler {
+ public:
+  // Installs the allocator observers and starts attributing allocations.
+  // Enabling an already-enabled profiler is a no-op.
+  static void Enable();
+
+  // Stops recording.  Data accumulated so far is retained and can still be
+  // read with GetTopAllocationSites() until Reset() is called.
+  static void Disable();
+
+  static bool IsEnabled();
+
+  // Fills |sites| with at most |max_sites| posting sites, those owning the
+  // most live (not yet freed) bytes first.  Any prior contents of |sites| are
+  // discarded.  May be called from any thread, whether or not the profiler is
+  // currently enabled.
+  static void GetTopAllocationSites(size_t max_sites,
+                                    std::vector<AllocationSiteSnapshot>* sites);
+
+  // Discards all attribution data.
+  static void Reset();
+
+ private:
+  // Observer functions registered with base::allocator::thunks.
+  static void OnAllocation(const void* address, size_t size);
+  static void OnFree(const void* address);
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(TaskAllocationProfiler);
+};
+
+// Makes |posted_from| the allocation attribution context of the current
+// thread for this object's lifetime, restoring the previous context on
+// destruction.  Instantiated by TaskAnnotator around each task it runs;
+// instances nest when a task spins a nested message loop.  The referenced
+// location must outlive the scope.
+class BASE_EXPORT ScopedTaskAllocationContext {
+ public:
+  explicit ScopedTaskAllocationContext(
+      const tracked_objects::Location& posted_from);
+  ~ScopedTaskAllocationContext();
+
+ private:
+  const tracked_objects::Location* previous_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedTaskAllocationContext);
+};
+
+}  // namespace debug
+}  // namespace base
+
+#endif  // BASE_DEBUG_TASK_ALLOCATION_PROFILER_H_
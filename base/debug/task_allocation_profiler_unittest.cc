@@ -0,0 +1,158 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/debug/task_allocation_profiler.h"
+
+#include <vector>
+
+#include "base/allocator/allocator_extension_thunks.h"
+#include "base/location.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+namespace debug {
+namespace {
+
+class TaskAllocationProfilerTest : public testing::Test {
+ public:
+  void SetUp() override {
+    TaskAllocationProfiler::Enable();
+    // Drive the profiler through the same observer functions the allocator
+    // would call, using addresses that are never really allocated.
+    allocator::thunks::GetAllocationObserverFunctions(&allocation_observer_,
+                                                      &free_observer_);
+    ASSERT_TRUE(allocation_observer_);
+    ASSERT_TRUE(free_observer_);
+  }
+
+  void TearDown() override {
+    TaskAllocationProfiler::Disable();
+    TaskAllocationProfiler::Reset();
+  }
+
+ protected:
+  allocator::thunks::AllocationObserverFunction allocation_observer_;
+  allocator::thunks::FreeObserverFunction free_observer_;
+  char dummy_memory_[16];
+};
+
+TEST_F(TaskAllocationProfilerTest, AttributesToRunningTask) {
+  tracked_objects::Location location(
+      "Function", "file.cc", 42, reinterpret_cast<void*>(0x1));
+  {
+    ScopedTaskAllocationContext context(location);
+    allocation_observer_(&dummy_memory_[0], 100);
+    allocation_observer_(&dummy_memory_[1], 20);
+  }
+
+  std::vector<AllocationSiteSnapshot> sites;
+  TaskAllocationProfiler::GetTopAllocationSites(10, &sites);
+  ASSERT_EQ(1u, sites.size());
+  EXPECT_EQ("file.cc", sites[0].posted_from.file_name);
+  EXPECT_EQ("Function", sites[0].posted_from.function_name);
+  EXPECT_EQ(42, sites[0].posted_from.line_number);
+  EXPECT_EQ(120u, sites[0].live_bytes);
+  EXPECT_EQ(2u, sites[0].live_count);
+  EXPECT_EQ(120u, sites[0].total_bytes);
+  EXPECT_EQ(2u, sites[0].total_count);
+}
+
+TEST_F(TaskAllocationProfilerTest, FreeCreditsTheAllocatingSite) {
+  {
+    ScopedTaskAllocationContext context(FROM_HERE);
+    allocation_observer_(&dummy_memory_[0], 100);
+    allocation_observer_(&dummy_memory_[1], 20);
+  }
+  // The free happens outside the task that allocated, as is common.
+  free_observer_(&dummy_memory_[0]);
+
+  std::vector<AllocationSiteSnapshot> sites;
+  TaskAllocationProfiler::GetTopAllocationSites(10, &sites);
+  ASSERT_EQ(1u, sites.size());
+  EXPECT_EQ(20u, sites[0].live_bytes);
+  EXPECT_EQ(1u, sites[0].live_count);
+  EXPECT_EQ(120u, sites[0].total_bytes);
+  EXPECT_EQ(2u, sites[0].total_count);
+}
+
+TEST_F(TaskAllocationProfilerTest, IgnoresAllocationsOutsideTasks) {
+  allocation_observer_(&dummy_memory_[0], 100);
+  // Frees of never-recorded allocations must not confuse the tallies.
+  free_observer_(&dummy_memory_[1]);
+
+  std::vector<AllocationSiteSnapshot> sites;
+  TaskAllocationProfiler::GetTopAllocationSites(10, &sites);
+  EXPECT_TRUE(sites.empty());
+}
+
+TEST_F(TaskAllocationProfilerTest, RanksSitesByLiveBytes) {
+  tracked_objects::Location small_site(
+      "Small", "small.cc", 1, reinterpret_cast<void*>(0x1));
+  tracked_objects::Location large_site(
+      "Large", "large.cc", 2, reinterpret_cast<void*>(0x2));
+  {
+    ScopedTaskAllocationContext context(small_site);
+    allocation_observer_(&dummy_memory_[0], 10);
+  }
+  {
+    ScopedTaskAllocationContext context(large_site);
+    allocation_observer_(&dummy_memory_[1], 1000);
+  }
+
+  std::vector<AllocationSiteSnapshot> sites;
+  TaskAllocationProfiler::GetTopAllocationSites(10, &sites);
+  ASSERT_EQ(2u, sites.size());
+  EXPECT_EQ("Large", sites[0].posted_from.function_name);
+  EXPECT_EQ("Small", sites[1].posted_from.function_name);
+
+  // A tighter limit keeps only the largest sites.
+  TaskAllocationProfiler::GetTopAllocationSites(1, &sites);
+  ASSERT_EQ(1u, sites.size());
+  EXPECT_EQ("Large", sites[0].posted_from.function_name);
+}
+
+TEST_F(TaskAllocationProfilerTest, NestedContextsRestoreOuterTask) {
+  tracked_objects::Location outer(
+      "Outer", "outer.cc", 1, reinterpret_cast<void*>(0x1));
+  tracked_objects::Location inner(
+      "Inner", "inner.cc", 2, reinterpret_cast<void*>(0x2));
+  {
+    ScopedTaskAllocationContext outer_context(outer);
+    {
+      ScopedTaskAllocationContext inner_context(inner);
+      allocation_observer_(&dummy_memory_[0], 10);
+    }
+    allocation_observer_(&dummy_memory_[1], 20);
+  }
+
+  std::vector<AllocationSiteSnapshot> sites;
+  TaskAllocationProfiler::GetTopAllocationSites(10, &sites);
+  ASSERT_EQ(2u, sites.size());
+  EXPECT_EQ("Outer", sites[0].posted_from.function_name);
+  EXPECT_EQ(20u, sites[0].live_bytes);
+  EXPECT_EQ("Inner", sites[1].posted_from.function_name);
+  EXPECT_EQ(10u, sites[1].live_bytes);
+}
+
+TEST_F(TaskAllocationProfilerTest, DisableStopsRecording) {
+  {
+    ScopedTaskAllocationContext context(FROM_HERE);
+    allocation_observer_(&dummy_memory_[0], 100);
+    TaskAllocationProfiler::Disable();
+    allocation_observer_(&dummy_memory_[1], 20);
+  }
+
+  std::vector<AllocationSiteSnapshot> sites;
+  TaskAllocationProfiler::GetTopAllocationSites(10, &sites);
+  ASSERT_EQ(1u, sites.size());
+  EXPECT_EQ(100u, sites[0].live_bytes);
+
+  TaskAllocationProfiler::Reset();
+  TaskAllocationProfiler::GetTopAllocationSites(10, &sites);
+  EXPECT_TRUE(sites.empty());
+}
+
+}  // namespace
+}  // namespace debug
+}  // namespace base
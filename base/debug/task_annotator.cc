@@ -5,6 +5,7 @@
 #include "base/debug/task_annotator.h"
 
 #include "base/debug/alias.h"
+#include "base/debug/task_allocation_profiler.h"
 #include "base/debug/trace_event.h"
 #include "base/pending_task.h"
 #include "base/tracked_objects.h"
@@ -60,7 +61,12 @@ void TaskAnnotator::RunTask(const char* queue_function,
   const void* program_counter = pending_task.posted_from.program_counter();
   debug::Alias(&program_counter);
 
-  pending_task.task.Run();
+  {
+    // Attribute heap allocations made while the task runs to its posting
+    // site, for TaskAllocationProfiler.
+    ScopedTaskAllocationContext allocation_context(pending_task.posted_from);
+    pending_task.task.Run();
+  }
 
   stopwatch.Stop();
   tracked_objects::ThreadData::TallyRunOnNamedThreadIfTracking(
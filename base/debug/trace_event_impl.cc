@@ -16,6 +16,7 @@
 #include "base/format_macros.h"
 #include "base/json/string_escape.h"
 #include "base/lazy_instance.h"
+#include "base/memory/aligned_memory.h"
 #include "base/memory/singleton.h"
 #include "base/message_loop/message_loop.h"
 #include "base/process/process_metrics.h"
@@ -405,6 +406,16 @@ class AutoThreadLocalBoolean {
 
 }  // namespace
 
+// static
+void* TraceBufferChunk::operator new(size_t size) {
+  return AlignedAlloc(size, 64);
+}
+
+// static
+void TraceBufferChunk::operator delete(void* ptr) {
+  AlignedFree(ptr);
+}
+
 void TraceBufferChunk::Reset(uint32 new_seq) {
   for (size_t i = 0; i < next_free_; ++i)
     chunk_[i].Reset();
@@ -1120,13 +1131,15 @@ TraceEvent* TraceLog::ThreadLocalEventBuffer::AddTraceEvent(
     TraceEventHandle* handle) {
   CheckThisIsCurrentBuffer();
 
-  if (chunk_ && chunk_->IsFull()) {
-    AutoLock lock(trace_log_->lock_);
-    FlushWhileLocked();
-    chunk_.reset();
-  }
-  if (!chunk_) {
+  if (!chunk_ || chunk_->IsFull()) {
+    // Return the full chunk and take a fresh one under a single lock
+    // acquisition; this handoff is the only place the fast path ever touches
+    // the global lock.
     AutoLock lock(trace_log_->lock_);
+    if (chunk_) {
+      FlushWhileLocked();
+      chunk_.reset();
+    }
     chunk_ = trace_log_->logged_events_->GetChunk(&chunk_index_);
     trace_log_->CheckIfBufferIsFullWhileLocked();
   }
@@ -13,6 +13,7 @@
 #include "base/atomicops.h"
 #include "base/base_export.h"
 #include "base/callback.h"
+#include "base/compiler_specific.h"
 #include "base/containers/hash_tables.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/ref_counted_memory.h"
@@ -202,11 +203,16 @@ class BASE_EXPORT TraceBufferChunk {
 
   scoped_ptr<TraceBufferChunk> Clone() const;
 
+  // Chunks are allocated cache-line-aligned (see the operator new below) so
+  // that concurrent threads filling their own chunks never share a line.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
+
   static const size_t kTraceBufferChunkSize = 64;
 
  private:
   size_t next_free_;
-  TraceEvent chunk_[kTraceBufferChunkSize];
+  ALIGNAS(64) TraceEvent chunk_[kTraceBufferChunkSize];
   uint32 seq_;
 };
 
@@ -244,6 +244,30 @@ class BASE_EXPORT File {
   // platforms. Returns the number of bytes written, or -1 on error.
   int WriteAtCurrentPosNoBestEffort(const char* data, int size);
 
+  // A contiguous memory range used for vectored I/O. See ReadScatter() and
+  // WriteGather().
+  struct MemoryRange {
+    char* data;
+    size_t size;
+  };
+  struct ConstMemoryRange {
+    const char* data;
+    size_t size;
+  };
+
+  // Reads from the file starting at the given offset into the |count| ranges
+  // of |ranges|, in order, using a single system call where the platform
+  // supports it. Returns the total number of bytes read, or -1 on error.
+  // Makes a best effort to fill every range, like Read().
+  int ReadScatter(int64 offset, const MemoryRange* ranges, size_t count);
+
+  // Writes the |count| ranges of |ranges| to the file starting at the given
+  // offset, in order, using a single system call where the platform supports
+  // it. Returns the total number of bytes written, or -1 on error. Makes a
+  // best effort to write all data, like Write(). Ignores the offset and
+  // writes to the end of the file if the file was opened with FLAG_APPEND.
+  int WriteGather(int64 offset, const ConstMemoryRange* ranges, size_t count);
+
   // Returns the current size of this file, or a negative number on failure.
   int64 GetLength();
 
@@ -6,9 +6,13 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#include <vector>
+
 #include "base/files/file_path.h"
 #include "base/files/file_posix_hooks_internal.h"
 #include "base/logging.h"
@@ -411,6 +415,124 @@ int File::WriteAtCurrentPosNoBestEffort(const char* data, int size) {
   return HANDLE_EINTR(write(file_.get(), data, size));
 }
 
+int File::ReadScatter(int64 offset, const MemoryRange* ranges, size_t count) {
+  base::ThreadRestrictions::AssertIOAllowed();
+  DCHECK(IsValid());
+  if (count == 0)
+    return 0;
+
+#if defined(OS_LINUX)
+  // preadv() is not available in bionic until API level 21, so Android uses
+  // the fallback below.
+  if (count <= IOV_MAX) {
+    std::vector<struct iovec> iov(count);
+    for (size_t i = 0; i < count; ++i) {
+      iov[i].iov_base = ranges[i].data;
+      iov[i].iov_len = ranges[i].size;
+    }
+
+    int bytes_read = 0;
+    int rv;
+    struct iovec* remaining_iov = &iov[0];
+    size_t remaining_count = count;
+    for (;;) {
+      rv = HANDLE_EINTR(preadv(file_.get(), remaining_iov, remaining_count,
+                               offset + bytes_read));
+      if (rv <= 0)
+        break;
+
+      bytes_read += rv;
+      // Skip the ranges that were completely filled and trim the first
+      // partially filled one so a short read restarts where it stopped.
+      size_t consumed = rv;
+      while (remaining_count > 0 && consumed >= remaining_iov->iov_len) {
+        consumed -= remaining_iov->iov_len;
+        ++remaining_iov;
+        --remaining_count;
+      }
+      if (remaining_count == 0)
+        break;
+      remaining_iov->iov_base =
+          static_cast<char*>(remaining_iov->iov_base) + consumed;
+      remaining_iov->iov_len -= consumed;
+    }
+    return bytes_read ? bytes_read : rv;
+  }
+#endif
+
+  // Fall back to one read per range.
+  int bytes_read = 0;
+  for (size_t i = 0; i < count; ++i) {
+    int rv = Read(offset + bytes_read, ranges[i].data,
+                  static_cast<int>(ranges[i].size));
+    if (rv < 0)
+      return bytes_read ? bytes_read : rv;
+    bytes_read += rv;
+    if (rv < static_cast<int>(ranges[i].size))
+      break;
+  }
+  return bytes_read;
+}
+
+int File::WriteGather(int64 offset,
+                      const ConstMemoryRange* ranges,
+                      size_t count) {
+  base::ThreadRestrictions::AssertIOAllowed();
+  DCHECK(IsValid());
+  if (count == 0)
+    return 0;
+
+#if defined(OS_LINUX)
+  // In append mode the kernel writes at the end of the file regardless of the
+  // offset, matching what Write() does via WriteAtCurrentPos().
+  if (count <= IOV_MAX) {
+    std::vector<struct iovec> iov(count);
+    for (size_t i = 0; i < count; ++i) {
+      iov[i].iov_base = const_cast<char*>(ranges[i].data);
+      iov[i].iov_len = ranges[i].size;
+    }
+
+    int bytes_written = 0;
+    int rv;
+    struct iovec* remaining_iov = &iov[0];
+    size_t remaining_count = count;
+    for (;;) {
+      rv = HANDLE_EINTR(pwritev(file_.get(), remaining_iov, remaining_count,
+                                offset + bytes_written));
+      if (rv <= 0)
+        break;
+
+      bytes_written += rv;
+      size_t consumed = rv;
+      while (remaining_count > 0 && consumed >= remaining_iov->iov_len) {
+        consumed -= remaining_iov->iov_len;
+        ++remaining_iov;
+        --remaining_count;
+      }
+      if (remaining_count == 0)
+        break;
+      remaining_iov->iov_base =
+          static_cast<char*>(remaining_iov->iov_base) + consumed;
+      remaining_iov->iov_len -= consumed;
+    }
+    return bytes_written ? bytes_written : rv;
+  }
+#endif
+
+  // Fall back to one write per range.
+  int bytes_written = 0;
+  for (size_t i = 0; i < count; ++i) {
+    int rv = Write(offset + bytes_written, ranges[i].data,
+                   static_cast<int>(ranges[i].size));
+    if (rv < 0)
+      return bytes_written ? bytes_written : rv;
+    bytes_written += rv;
+    if (rv < static_cast<int>(ranges[i].size))
+      break;
+  }
+  return bytes_written;
+}
+
 int64 File::GetLength() {
   DCHECK(IsValid());
 
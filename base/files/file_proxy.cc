@@ -13,11 +13,64 @@
 #include "base/task_runner.h"
 #include "base/task_runner_util.h"
 
+#if defined(OS_LINUX)
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "base/threading/thread_restrictions.h"
+#endif
+
 namespace {
 
 void FileDeleter(base::File file) {
 }
 
+#if defined(OS_LINUX)
+// FileProxy exists to keep blocking file I/O off the calling thread, but for
+// a small read whose data is already in the page cache the round trip
+// through the TaskRunner costs far more than the read itself. Reads no
+// larger than this are probed with mincore() and, if every page of the
+// range is resident, performed on the calling thread instead.
+const int kMaxResidentReadBytes = 32 * 1024;
+
+// Returns true if the |bytes| bytes of |fd| starting at |offset| are all in
+// the page cache, so that a pread() of the range will not touch the disk.
+// Errs on the side of returning false. Note that a page could in principle
+// be evicted again before the read happens; residency makes that window
+// small enough that the occasional blocking read is an acceptable trade for
+// skipping the thread hop on every cache hit.
+bool IsPageCacheResident(base::PlatformFile fd, int64 offset, int bytes) {
+  if (offset < 0 || bytes <= 0)
+    return false;
+
+  const int64 page_size = sysconf(_SC_PAGESIZE);
+  const int64 map_start = offset & ~(page_size - 1);
+  const size_t map_len = static_cast<size_t>(offset - map_start) + bytes;
+
+  unsigned char resident[kMaxResidentReadBytes / 4096 + 2];
+  const size_t pages = (map_len + page_size - 1) / page_size;
+  if (pages > arraysize(resident))
+    return false;
+
+  void* map = mmap(NULL, map_len, PROT_READ, MAP_SHARED, fd, map_start);
+  if (map == MAP_FAILED)
+    return false;
+
+  // mincore() fails (and any page beyond EOF reads as non-resident) for
+  // ranges the file does not cover; such reads take the slow path.
+  const bool ok = mincore(map, map_len, resident) == 0;
+  munmap(map, map_len);
+  if (!ok)
+    return false;
+
+  for (size_t i = 0; i < pages; ++i) {
+    if (!(resident[i] & 1))
+      return false;
+  }
+  return true;
+}
+#endif  // defined(OS_LINUX)
+
 }  // namespace
 
 namespace base {
@@ -303,6 +356,24 @@ bool FileProxy::Read(int64 offset,
   if (bytes_to_read < 0)
     return false;
 
+#if defined(OS_LINUX)
+  // Fast path: when the requested range is resident in the page cache the
+  // read completes here, without the round trip through |task_runner_|. The
+  // reply still runs asynchronously on the current thread.
+  if (bytes_to_read <= kMaxResidentReadBytes &&
+      MessageLoopProxy::current().get() &&
+      IsPageCacheResident(file_.GetPlatformFile(), offset, bytes_to_read)) {
+    ReadHelper* helper = new ReadHelper(this, file_.Pass(), bytes_to_read);
+    {
+      // The range was just seen resident, so this read will not block.
+      ThreadRestrictions::ScopedAllowIO allow_io;
+      helper->RunWork(offset);
+    }
+    return MessageLoopProxy::current()->PostTask(
+        FROM_HERE, Bind(&ReadHelper::Reply, Owned(helper), callback));
+  }
+#endif
+
   ReadHelper* helper = new ReadHelper(this, file_.Pass(), bytes_to_read);
   return task_runner_->PostTaskAndReply(
       FROM_HERE,
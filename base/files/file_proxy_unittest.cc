@@ -262,6 +262,25 @@ TEST_F(FileProxyTest, Read) {
   }
 }
 
+TEST_F(FileProxyTest, Read_FromOffset) {
+  // Setup.
+  const char data[] = "0123456789";
+  int data_bytes = arraysize(data) - 1;
+  ASSERT_EQ(data_bytes, base::WriteFile(test_path(), data, data_bytes));
+
+  // Run: read from an unaligned offset with a |bytes_to_read| that runs
+  // past the end of the file, so the read comes back short.
+  FileProxy proxy(file_task_runner());
+  CreateProxy(File::FLAG_OPEN | File::FLAG_READ, &proxy);
+
+  proxy.Read(3, 128, Bind(&FileProxyTest::DidRead, weak_factory_.GetWeakPtr()));
+  MessageLoop::current()->Run();
+
+  // Verify.
+  EXPECT_EQ(File::FILE_OK, error_);
+  EXPECT_EQ("3456789", std::string(buffer_.begin(), buffer_.end()));
+}
+
 TEST_F(FileProxyTest, WriteAndFlush) {
   FileProxy proxy(file_task_runner());
   CreateProxy(File::FLAG_CREATE | File::FLAG_WRITE, &proxy);
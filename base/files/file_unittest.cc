@@ -216,6 +216,50 @@ TEST(FileTest, ReadWrite) {
     EXPECT_EQ(data_to_write[i - kOffsetBeyondEndOfFile], data_read_2[i]);
 }
 
+TEST(FileTest, ScatterGather) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  FilePath file_path = temp_dir.path().AppendASCII("scatter_gather_file");
+  File file(file_path,
+            base::File::FLAG_CREATE | base::File::FLAG_READ |
+                base::File::FLAG_WRITE);
+  ASSERT_TRUE(file.IsValid());
+
+  // Write a "header" and a "body" with one gathered write.
+  const char kHeader[] = "head";
+  const char kBody[] = "some body bytes";
+  const int kHeaderSize = 4;
+  const int kBodySize = 15;
+  base::File::ConstMemoryRange write_ranges[2];
+  write_ranges[0].data = kHeader;
+  write_ranges[0].size = kHeaderSize;
+  write_ranges[1].data = kBody;
+  write_ranges[1].size = kBodySize;
+  int bytes_written = file.WriteGather(0, write_ranges, 2);
+  EXPECT_EQ(kHeaderSize + kBodySize, bytes_written);
+
+  // Read the two pieces back into separate buffers with one scattered read.
+  char header_read[kHeaderSize + 1] = {};
+  char body_read[kBodySize + 1] = {};
+  base::File::MemoryRange read_ranges[2];
+  read_ranges[0].data = header_read;
+  read_ranges[0].size = kHeaderSize;
+  read_ranges[1].data = body_read;
+  read_ranges[1].size = kBodySize;
+  int bytes_read = file.ReadScatter(0, read_ranges, 2);
+  EXPECT_EQ(kHeaderSize + kBodySize, bytes_read);
+  EXPECT_STREQ(kHeader, header_read);
+  EXPECT_STREQ(kBody, body_read);
+
+  // A scattered read reaching EOF returns the bytes that were available.
+  bytes_read = file.ReadScatter(kHeaderSize, read_ranges, 2);
+  EXPECT_EQ(kBodySize, bytes_read);
+
+  // Empty range lists are no-ops.
+  EXPECT_EQ(0, file.WriteGather(0, write_ranges, 0));
+  EXPECT_EQ(0, file.ReadScatter(0, read_ranges, 0));
+}
+
 TEST(FileTest, Append) {
   base::ScopedTempDir temp_dir;
   ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
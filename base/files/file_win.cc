@@ -217,6 +217,40 @@ int File::WriteAtCurrentPosNoBestEffort(const char* data, int size) {
   return WriteAtCurrentPos(data, size);
 }
 
+int File::ReadScatter(int64 offset, const MemoryRange* ranges, size_t count) {
+  // Windows has no positioned scatter read for buffered handles, so issue one
+  // read per range.
+  int bytes_read = 0;
+  for (size_t i = 0; i < count; ++i) {
+    int rv = Read(offset + bytes_read, ranges[i].data,
+                  static_cast<int>(ranges[i].size));
+    if (rv < 0)
+      return bytes_read ? bytes_read : rv;
+    bytes_read += rv;
+    if (rv < static_cast<int>(ranges[i].size))
+      break;
+  }
+  return bytes_read;
+}
+
+int File::WriteGather(int64 offset,
+                      const ConstMemoryRange* ranges,
+                      size_t count) {
+  // Windows has no positioned gather write for buffered handles, so issue one
+  // write per range.
+  int bytes_written = 0;
+  for (size_t i = 0; i < count; ++i) {
+    int rv = Write(offset + bytes_written, ranges[i].data,
+                   static_cast<int>(ranges[i].size));
+    if (rv < 0)
+      return bytes_written ? bytes_written : rv;
+    bytes_written += rv;
+    if (rv < static_cast<int>(ranges[i].size))
+      break;
+  }
+  return bytes_written;
+}
+
 int64 File::GetLength() {
   base::ThreadRestrictions::AssertIOAllowed();
   DCHECK(IsValid());
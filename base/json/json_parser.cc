@@ -202,11 +202,16 @@ JSONParser::~JSONParser() {
 }
 
 Value* JSONParser::Parse(const StringPiece& input) {
+  DCHECK(!((options_ & JSON_REFERENCE_INPUT) &&
+           (options_ & JSON_DETACHABLE_CHILDREN)));
   scoped_ptr<std::string> input_copy;
-  // If the children of a JSON root can be detached, then hidden roots cannot
-  // be used, so do not bother copying the input because StringPiece will not
-  // be used anywhere.
-  if (!(options_ & JSON_DETACHABLE_CHILDREN)) {
+  // In reference mode the returned values alias the caller's buffer, so no
+  // copy (and no hidden root) is needed at all. Otherwise, if the children of
+  // a JSON root can be detached, then hidden roots cannot be used, so do not
+  // bother copying the input because StringPiece will not be used anywhere.
+  if (options_ & JSON_REFERENCE_INPUT) {
+    start_pos_ = input.data();
+  } else if (!(options_ & JSON_DETACHABLE_CHILDREN)) {
     input_copy.reset(new std::string(input.as_string()));
     start_pos_ = input_copy->data();
   } else {
@@ -246,8 +251,10 @@ Value* JSONParser::Parse(const StringPiece& input) {
   }
 
   // Dictionaries and lists can contain JSONStringValues, so wrap them in a
-  // hidden root.
-  if (!(options_ & JSON_DETACHABLE_CHILDREN)) {
+  // hidden root. In reference mode there is nothing to own: the caller keeps
+  // the input alive, so every value (including a string root) can be
+  // returned directly.
+  if (!(options_ & (JSON_DETACHABLE_CHILDREN | JSON_REFERENCE_INPUT))) {
     if (root->IsType(Value::TYPE_DICTIONARY)) {
       return new DictionaryHiddenRootValue(input_copy.release(), root.get());
     } else if (root->IsType(Value::TYPE_LIST)) {
@@ -56,6 +56,14 @@ enum JSONParserOptions {
   // if the child is Remove()d from root, it would result in use-after-free
   // unless it is DeepCopy()ed or this option is used.
   JSON_DETACHABLE_CHILDREN = 1 << 1,
+
+  // String values reference the input buffer directly instead of being copied
+  // into the result, and the parser does not take its own copy of the input.
+  // The caller must guarantee that the input outlives the returned Value and
+  // everything detached from it. This avoids all per-string allocations when
+  // large documents (prefs, extension manifests) are parsed only to be
+  // inspected. Incompatible with JSON_DETACHABLE_CHILDREN.
+  JSON_REFERENCE_INPUT = 1 << 2,
 };
 
 class BASE_EXPORT JSONReader {
@@ -623,6 +623,38 @@ TEST(JSONReaderTest, StringOptimizations) {
   EXPECT_EQ("b", s);
 }
 
+TEST(JSONReaderTest, ReferenceInput) {
+  const std::string json =
+      "{"
+      "  \"key\": \"a long enough string value\","
+      "  \"list\": [ \"first\", \"second\" ],"
+      "  \"escaped\": \"tab\\there\""
+      "}";
+  scoped_ptr<Value> root(JSONReader::Read(json, JSON_REFERENCE_INPUT));
+  ASSERT_TRUE(root.get());
+
+  DictionaryValue* dict = NULL;
+  ASSERT_TRUE(root->GetAsDictionary(&dict));
+
+  std::string value;
+  EXPECT_TRUE(dict->GetString("key", &value));
+  EXPECT_EQ("a long enough string value", value);
+  EXPECT_TRUE(dict->GetString("escaped", &value));
+  EXPECT_EQ("tab\there", value);
+
+  ListValue* list = NULL;
+  ASSERT_TRUE(dict->GetList("list", &list));
+  EXPECT_TRUE(list->GetString(1, &value));
+  EXPECT_EQ("second", value);
+
+  // A string root in reference mode is returned without a deep copy.
+  scoped_ptr<Value> string_root(
+      JSONReader::Read("\"just a string\"", JSON_REFERENCE_INPUT));
+  ASSERT_TRUE(string_root.get());
+  EXPECT_TRUE(string_root->GetAsString(&value));
+  EXPECT_EQ("just a string", value);
+}
+
 // A smattering of invalid JSON designed to test specific portions of the
 // parser implementation against buffer overflow. Best run with DCHECKs so
 // that the one in NextChar fires.
@@ -0,0 +1,97 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/memory/arena.h"
+
+#include <stdlib.h>
+
+#include "base/lazy_instance.h"
+#include "base/logging.h"
+#include "base/memory/aligned_memory.h"
+#include "base/threading/thread_local.h"
+
+namespace base {
+
+namespace {
+
+// Alignment for all arena allocations; matches malloc's guarantee.
+const size_t kAlignment = 2 * sizeof(void*);
+
+size_t AlignUp(size_t size) {
+  return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+LazyInstance<ThreadLocalPointer<ScopedArena> >::Leaky g_current_scoped_arena =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+Arena::Arena(size_t block_size)
+    : block_size_(AlignUp(block_size)),
+      next_(NULL),
+      remaining_(0),
+      bytes_allocated_(0) {
+  DCHECK_GT(block_size, 0u);
+}
+
+Arena::~Arena() {
+  for (size_t i = 0; i < blocks_.size(); ++i)
+    AlignedFree(blocks_[i].data);
+}
+
+void* Arena::Allocate(size_t size) {
+  size = AlignUp(size);
+  if (size > remaining_) {
+    Block* block = AllocateBlock(size);
+    next_ = block->data;
+    remaining_ = block->size;
+  }
+  char* result = next_;
+  next_ += size;
+  remaining_ -= size;
+  bytes_allocated_ += size;
+  return result;
+}
+
+void Arena::Reset() {
+  // Keep the first block; a freshly Reset() arena is typically about to be
+  // reused for a similar workload.
+  while (blocks_.size() > 1) {
+    AlignedFree(blocks_.back().data);
+    blocks_.pop_back();
+  }
+  if (!blocks_.empty()) {
+    next_ = blocks_[0].data;
+    remaining_ = blocks_[0].size;
+  }
+  bytes_allocated_ = 0;
+}
+
+Arena::Block* Arena::AllocateBlock(size_t min_size) {
+  Block block;
+  block.size = min_size > block_size_ ? min_size : block_size_;
+  block.data = static_cast<char*>(AlignedAlloc(block.size, kAlignment));
+  CHECK(block.data);
+  blocks_.push_back(block);
+  return &blocks_.back();
+}
+
+ScopedArena::ScopedArena(size_t block_size)
+    : arena_(block_size),
+      previous_(g_current_scoped_arena.Get().Get()) {
+  g_current_scoped_arena.Get().Set(this);
+}
+
+ScopedArena::~ScopedArena() {
+  DCHECK_EQ(this, g_current_scoped_arena.Get().Get());
+  g_current_scoped_arena.Get().Set(previous_);
+}
+
+// static
+Arena* ScopedArena::GetThreadLocalArena() {
+  ScopedArena* current = g_current_scoped_arena.Get().Get();
+  return current ? current->arena() : NULL;
+}
+
+}  // namespace base
@@ -0,0 +1,147 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_MEMORY_ARENA_H_
+#define BASE_MEMORY_ARENA_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "base/base_export.h"
+#include "base/basictypes.h"
+#include "base/compiler_specific.h"
+
+namespace base {
+
+// Arena is a bump allocator for short-lived allocations: memory is carved
+// from large blocks with a pointer increment and is only reclaimed when the
+// whole arena is Reset() or destroyed, which frees everything in O(1) (plus
+// one free() per block). Use it for bursts of small allocations with a common
+// lifetime - e.g. temporary buffers and containers built while handling a
+// single task or IPC message - where per-object malloc/free overhead shows up
+// in profiles.
+//
+// Objects allocated from an arena must be trivially destructible or have
+// their destructors run manually; the arena never runs them.
+//
+// Arena is not thread safe. For a per-thread arena see ScopedArena below.
+class BASE_EXPORT Arena {
+ public:
+  // |block_size| is the size of the underlying blocks; allocations larger
+  // than that get a dedicated block.
+  explicit Arena(size_t block_size);
+  ~Arena();
+
+  // Returns |size| bytes aligned suitably for any object. Never returns NULL;
+  // like malloc, exhausting memory is fatal.
+  void* Allocate(size_t size);
+
+  // Frees every allocation made since the last Reset(). The first block is
+  // kept so a recycled arena does not have to warm up again.
+  void Reset();
+
+  // Total bytes handed out since the last Reset().
+  size_t bytes_allocated() const { return bytes_allocated_; }
+
+ private:
+  struct Block {
+    char* data;
+    size_t size;
+  };
+
+  // Adds a block of at least |min_size| bytes and returns it.
+  Block* AllocateBlock(size_t min_size);
+
+  const size_t block_size_;
+  std::vector<Block> blocks_;
+  // Bump pointer and remaining space in the current block.
+  char* next_;
+  size_t remaining_;
+  size_t bytes_allocated_;
+
+  DISALLOW_COPY_AND_ASSIGN(Arena);
+};
+
+// STL-compatible allocator that draws from an Arena. The arena must outlive
+// every container using it. deallocate() is a no-op; memory is reclaimed by
+// Arena::Reset().
+//
+//   Arena arena(4096);
+//   std::vector<int, ArenaAllocator<int> > v((ArenaAllocator<int>(&arena)));
+template <typename T>
+class ArenaAllocator {
+ public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+  template <typename U>
+  struct rebind {
+    typedef ArenaAllocator<U> other;
+  };
+
+  explicit ArenaAllocator(Arena* arena) : arena_(arena) {}
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.arena()) {}
+
+  pointer allocate(size_type n) {
+    return static_cast<pointer>(arena_->Allocate(n * sizeof(T)));
+  }
+  void deallocate(pointer, size_type) {}
+
+  size_type max_size() const {
+    return static_cast<size_type>(-1) / sizeof(T);
+  }
+
+  void construct(pointer p, const T& value) { new (p) T(value); }
+  void destroy(pointer p) { p->~T(); }
+
+  pointer address(reference x) const { return &x; }
+  const_pointer address(const_reference x) const { return &x; }
+
+  Arena* arena() const { return arena_; }
+
+  bool operator==(const ArenaAllocator& other) const {
+    return arena_ == other.arena_;
+  }
+  bool operator!=(const ArenaAllocator& other) const {
+    return arena_ != other.arena_;
+  }
+
+ private:
+  Arena* arena_;
+};
+
+// Binds a thread-local arena to a scope, typically the stack frame that runs
+// one task. The innermost ScopedArena on the current thread is returned by
+// GetThreadLocalArena(); the arena is Reset() when the scope exits, so
+// callees can make transient allocations without owning an arena themselves.
+class BASE_EXPORT ScopedArena {
+ public:
+  static const size_t kDefaultBlockSize = 16 * 1024;
+
+  explicit ScopedArena(size_t block_size = kDefaultBlockSize);
+  ~ScopedArena();
+
+  Arena* arena() { return &arena_; }
+
+  // Returns the arena of the innermost ScopedArena on this thread, or NULL if
+  // there is none.
+  static Arena* GetThreadLocalArena();
+
+ private:
+  Arena arena_;
+  ScopedArena* previous_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedArena);
+};
+
+}  // namespace base
+
+#endif  // BASE_MEMORY_ARENA_H_
@@ -0,0 +1,79 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/memory/arena.h"
+
+#include <string.h>
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+namespace {
+
+TEST(ArenaTest, Basic) {
+  Arena arena(128);
+  void* p1 = arena.Allocate(10);
+  void* p2 = arena.Allocate(10);
+  ASSERT_TRUE(p1);
+  ASSERT_TRUE(p2);
+  EXPECT_NE(p1, p2);
+  // Allocations must be usable.
+  memset(p1, 0xab, 10);
+  memset(p2, 0xcd, 10);
+  EXPECT_GE(arena.bytes_allocated(), 20u);
+}
+
+TEST(ArenaTest, Alignment) {
+  Arena arena(64);
+  for (int i = 0; i < 16; ++i) {
+    uintptr_t p = reinterpret_cast<uintptr_t>(arena.Allocate(i + 1));
+    EXPECT_EQ(0u, p % (2 * sizeof(void*)));
+  }
+}
+
+TEST(ArenaTest, LargeAllocationGetsDedicatedBlock) {
+  Arena arena(32);
+  char* p = static_cast<char*>(arena.Allocate(1000));
+  ASSERT_TRUE(p);
+  memset(p, 0, 1000);
+}
+
+TEST(ArenaTest, ResetReusesFirstBlock) {
+  Arena arena(128);
+  void* first = arena.Allocate(8);
+  arena.Allocate(500);  // Forces a second block.
+  arena.Reset();
+  EXPECT_EQ(0u, arena.bytes_allocated());
+  // After Reset() the bump pointer is back at the start of the first block.
+  EXPECT_EQ(first, arena.Allocate(8));
+}
+
+TEST(ArenaTest, StlAllocator) {
+  Arena arena(4096);
+  std::vector<int, ArenaAllocator<int> > v((ArenaAllocator<int>(&arena)));
+  for (int i = 0; i < 1000; ++i)
+    v.push_back(i);
+  for (int i = 0; i < 1000; ++i)
+    EXPECT_EQ(i, v[i]);
+  EXPECT_GE(arena.bytes_allocated(), 1000 * sizeof(int));
+}
+
+TEST(ArenaTest, ScopedArenaNesting) {
+  EXPECT_FALSE(ScopedArena::GetThreadLocalArena());
+  {
+    ScopedArena outer;
+    EXPECT_EQ(outer.arena(), ScopedArena::GetThreadLocalArena());
+    {
+      ScopedArena inner;
+      EXPECT_EQ(inner.arena(), ScopedArena::GetThreadLocalArena());
+    }
+    EXPECT_EQ(outer.arena(), ScopedArena::GetThreadLocalArena());
+  }
+  EXPECT_FALSE(ScopedArena::GetThreadLocalArena());
+}
+
+}  // namespace
+}  // namespace base
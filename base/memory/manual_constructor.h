@@ -18,6 +18,8 @@
 
 #include <stddef.h>
 
+#include <utility>
+
 #include "base/memory/aligned_memory.h"
 
 namespace base {
@@ -108,6 +110,13 @@ class ManualConstructor {
     new(space_.void_data()) Type(p1, p2, p3, p4, p5, p6, p7, p8);
   }
 
+  // Init() takes its arguments by const reference, so it always copies.
+  // InitFromMove() constructs the object from an rvalue instead.
+  template <typename T1>
+  inline void InitFromMove(T1&& p1) {
+    new(space_.void_data()) Type(std::forward<T1>(p1));
+  }
+
   inline void Destroy() {
     get()->~Type();
   }
@@ -0,0 +1,85 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/memory/shared_memory_pool.h"
+
+#include "base/logging.h"
+#include "base/stl_util.h"
+
+namespace base {
+
+namespace {
+
+// Segments smaller than this share one size class; it matches the typical
+// page size, below which rounding buys nothing.
+const size_t kMinSegmentSize = 4096;
+
+}  // namespace
+
+SharedMemoryPool::SharedMemoryPool(size_t max_cached_bytes)
+    : max_cached_bytes_(max_cached_bytes),
+      cached_bytes_(0) {
+}
+
+SharedMemoryPool::~SharedMemoryPool() {
+  AutoLock lock(lock_);
+  for (std::map<size_t, std::vector<SharedMemory*> >::iterator it =
+           free_lists_.begin();
+       it != free_lists_.end(); ++it) {
+    STLDeleteElements(&it->second);
+  }
+}
+
+scoped_ptr<SharedMemory> SharedMemoryPool::Allocate(size_t size) {
+  const size_t size_class = SizeClassFor(size);
+  {
+    AutoLock lock(lock_);
+    std::map<size_t, std::vector<SharedMemory*> >::iterator it =
+        free_lists_.find(size_class);
+    if (it != free_lists_.end() && !it->second.empty()) {
+      scoped_ptr<SharedMemory> memory(it->second.back());
+      it->second.pop_back();
+      cached_bytes_ -= size_class;
+      return memory.Pass();
+    }
+  }
+
+  // Create outside the lock; this is the slow path that hits the filesystem
+  // on POSIX.
+  scoped_ptr<SharedMemory> memory(new SharedMemory);
+  if (!memory->CreateAndMapAnonymous(size_class)) {
+    DLOG(ERROR) << "Failed to create pooled shared memory segment of "
+                << size_class << " bytes.";
+    return scoped_ptr<SharedMemory>();
+  }
+  return memory.Pass();
+}
+
+void SharedMemoryPool::Release(scoped_ptr<SharedMemory> memory) {
+  DCHECK(memory);
+  DCHECK(memory->memory());
+  const size_t size_class = memory->mapped_size();
+  DCHECK_EQ(size_class, SizeClassFor(size_class));
+
+  AutoLock lock(lock_);
+  if (cached_bytes_ + size_class > max_cached_bytes_)
+    return;  // Over budget; let the segment be destroyed.
+  free_lists_[size_class].push_back(memory.release());
+  cached_bytes_ += size_class;
+}
+
+size_t SharedMemoryPool::cached_bytes() const {
+  AutoLock lock(lock_);
+  return cached_bytes_;
+}
+
+// static
+size_t SharedMemoryPool::SizeClassFor(size_t size) {
+  size_t size_class = kMinSegmentSize;
+  while (size_class < size)
+    size_class <<= 1;
+  return size_class;
+}
+
+}  // namespace base
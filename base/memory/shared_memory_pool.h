@@ -0,0 +1,61 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_MEMORY_SHARED_MEMORY_POOL_H_
+#define BASE_MEMORY_SHARED_MEMORY_POOL_H_
+
+#include <map>
+#include <vector>
+
+#include "base/base_export.h"
+#include "base/basictypes.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/memory/shared_memory.h"
+#include "base/synchronization/lock.h"
+
+namespace base {
+
+// A thread-safe pool of anonymous SharedMemory segments. Segments are created
+// in power-of-two size classes and recycled on release, so hot paths that
+// churn through short-lived shared buffers (tile uploads, bitmap transport)
+// stop paying for file creation/unlinking on every allocation.
+//
+// Released segments keep their contents; callers that hand buffers to other
+// processes must not assume zero-filled memory from the pool.
+class BASE_EXPORT SharedMemoryPool {
+ public:
+  // |max_cached_bytes| caps the total mapped size of idle segments kept for
+  // reuse; releases beyond the cap free the segment instead.
+  explicit SharedMemoryPool(size_t max_cached_bytes);
+  ~SharedMemoryPool();
+
+  // Returns a mapped anonymous segment of at least |size| bytes (rounded up
+  // to the segment's size class; see SharedMemory::mapped_size()), or NULL on
+  // creation failure.
+  scoped_ptr<SharedMemory> Allocate(size_t size);
+
+  // Returns |memory| to the pool for reuse. The segment must have come from
+  // Allocate() on this pool.
+  void Release(scoped_ptr<SharedMemory> memory);
+
+  size_t cached_bytes() const;
+
+ private:
+  // Rounds |size| up to the smallest size class that holds it.
+  static size_t SizeClassFor(size_t size);
+
+  const size_t max_cached_bytes_;
+
+  mutable Lock lock_;
+  // Idle segments by size class. All segments in a list have mapped_size()
+  // equal to the key.
+  std::map<size_t, std::vector<SharedMemory*> > free_lists_;
+  size_t cached_bytes_;
+
+  DISALLOW_COPY_AND_ASSIGN(SharedMemoryPool);
+};
+
+}  // namespace base
+
+#endif  // BASE_MEMORY_SHARED_MEMORY_POOL_H_
@@ -0,0 +1,64 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/memory/shared_memory_pool.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+namespace {
+
+TEST(SharedMemoryPoolTest, AllocateAndRecycle) {
+  SharedMemoryPool pool(1024 * 1024);
+
+  scoped_ptr<SharedMemory> memory(pool.Allocate(1000));
+  ASSERT_TRUE(memory);
+  ASSERT_TRUE(memory->memory());
+  EXPECT_GE(memory->mapped_size(), 1000u);
+  void* address = memory->memory();
+
+  pool.Release(memory.Pass());
+  EXPECT_GT(pool.cached_bytes(), 0u);
+
+  // An allocation of the same size class must reuse the cached segment.
+  memory = pool.Allocate(512);
+  ASSERT_TRUE(memory);
+  EXPECT_EQ(address, memory->memory());
+  EXPECT_EQ(0u, pool.cached_bytes());
+}
+
+TEST(SharedMemoryPoolTest, SizeClassesAreDistinct) {
+  SharedMemoryPool pool(1024 * 1024);
+
+  scoped_ptr<SharedMemory> small(pool.Allocate(100));
+  scoped_ptr<SharedMemory> large(pool.Allocate(100 * 1024));
+  ASSERT_TRUE(small);
+  ASSERT_TRUE(large);
+  EXPECT_LT(small->mapped_size(), large->mapped_size());
+
+  pool.Release(small.Pass());
+
+  // A large request must not be satisfied by the cached small segment.
+  scoped_ptr<SharedMemory> large2(pool.Allocate(100 * 1024));
+  ASSERT_TRUE(large2);
+  EXPECT_GE(large2->mapped_size(), 100u * 1024);
+}
+
+TEST(SharedMemoryPoolTest, RespectsCacheBudget) {
+  SharedMemoryPool pool(4096);
+
+  scoped_ptr<SharedMemory> first(pool.Allocate(4096));
+  scoped_ptr<SharedMemory> second(pool.Allocate(4096));
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+
+  pool.Release(first.Pass());
+  EXPECT_EQ(4096u, pool.cached_bytes());
+  // The second release exceeds the budget and frees the segment instead.
+  pool.Release(second.Pass());
+  EXPECT_EQ(4096u, pool.cached_bytes());
+}
+
+}  // namespace
+}  // namespace base
@@ -9,6 +9,16 @@
 #include "base/metrics/histogram.h"
 #include "base/synchronization/waitable_event.h"
 #include "base/time/time.h"
+#include "build/build_config.h"
+
+// The lock-free producer path needs a full-width atomic exchange on a pointer
+// sized word. All of our first-class architectures provide one; NaCl and the
+// remaining ports fall back to the locked queue.
+#if !defined(OS_NACL) &&                                            \
+    (defined(ARCH_CPU_X86_FAMILY) || defined(ARCH_CPU_ARM_FAMILY) || \
+     defined(ARCH_CPU_ARM64))
+#define INCOMING_TASK_QUEUE_LOCK_FREE 1
+#endif
 
 namespace base {
 namespace internal {
@@ -30,8 +40,18 @@ bool AlwaysNotifyPump(MessageLoop::Type type) {
 
 }  // namespace
 
+struct IncomingTaskQueue::LockFreeNode {
+  explicit LockFreeNode(const PendingTask& task)
+      : task(task), next(NULL) {}
+
+  PendingTask task;
+  LockFreeNode* next;
+};
+
 IncomingTaskQueue::IncomingTaskQueue(MessageLoop* message_loop)
     : high_res_task_count_(0),
+      lock_free_head_(0),
+      accepting_tasks_(1),
       message_loop_(message_loop),
       next_sequence_num_(0),
       message_loop_scheduled_(false),
@@ -43,9 +63,17 @@ bool IncomingTaskQueue::AddToIncomingQueue(
     const Closure& task,
     TimeDelta delay,
     bool nestable) {
-  AutoLock locked(incoming_queue_lock_);
+  return AddToIncomingQueue(from_here, task, delay, TimeDelta(), nestable);
+}
+
+bool IncomingTaskQueue::AddToIncomingQueue(
+    const tracked_objects::Location& from_here,
+    const Closure& task,
+    TimeDelta delay,
+    TimeDelta slack,
+    bool nestable) {
   PendingTask pending_task(
-      from_here, task, CalculateDelayedRuntime(delay), nestable);
+      from_here, task, CalculateDelayedRuntime(delay, slack), nestable);
 #if defined(OS_WIN)
   // We consider the task needs a high resolution timer if the delay is
   // more than 0 and less than 32ms. This caps the relative error to
@@ -53,27 +81,34 @@ bool IncomingTaskQueue::AddToIncomingQueue(
   // resolution on Windows is between 10 and 15ms.
   if (delay > TimeDelta() &&
       delay.InMilliseconds() < (2 * Time::kMinLowResolutionThresholdMs)) {
-    ++high_res_task_count_;
+    subtle::NoBarrier_AtomicIncrement(&high_res_task_count_, 1);
     pending_task.is_high_res = true;
   }
 #endif
+#if defined(INCOMING_TASK_QUEUE_LOCK_FREE)
+  return PostPendingTaskLockFree(&pending_task);
+#else
+  AutoLock locked(incoming_queue_lock_);
   return PostPendingTask(&pending_task);
+#endif
 }
 
 bool IncomingTaskQueue::HasHighResolutionTasks() {
-  AutoLock lock(incoming_queue_lock_);
-  return high_res_task_count_ > 0;
+  return subtle::NoBarrier_Load(&high_res_task_count_) > 0;
 }
 
 bool IncomingTaskQueue::IsIdleForTesting() {
   AutoLock lock(incoming_queue_lock_);
-  return incoming_queue_.empty();
+  return incoming_queue_.empty() && !subtle::Acquire_Load(&lock_free_head_);
 }
 
 int IncomingTaskQueue::ReloadWorkQueue(TaskQueue* work_queue) {
   // Make sure no tasks are lost.
   DCHECK(work_queue->empty());
 
+#if defined(INCOMING_TASK_QUEUE_LOCK_FREE)
+  DrainLockFreeStack(work_queue);
+#else
   // Acquire all we can from the inter-thread queue with one lock acquisition.
   AutoLock lock(incoming_queue_lock_);
   if (incoming_queue_.empty()) {
@@ -84,28 +119,45 @@ int IncomingTaskQueue::ReloadWorkQueue(TaskQueue* work_queue) {
   } else {
     incoming_queue_.Swap(work_queue);
   }
+#endif
   // Reset the count of high resolution tasks since our queue is now empty.
-  int high_res_tasks = high_res_task_count_;
-  high_res_task_count_ = 0;
-  return high_res_tasks;
+  return subtle::NoBarrier_AtomicExchange(&high_res_task_count_, 0);
 }
 
 void IncomingTaskQueue::WillDestroyCurrentMessageLoop() {
+  // Stop lock-free producers first so that pushes racing with the drain below
+  // are the only ones that can strand a node; those are reclaimed in the
+  // destructor.
+  subtle::Release_Store(&accepting_tasks_, 0);
   AutoLock lock(incoming_queue_lock_);
+  DrainLockFreeStack(NULL);
   message_loop_ = NULL;
 }
 
 IncomingTaskQueue::~IncomingTaskQueue() {
   // Verify that WillDestroyCurrentMessageLoop() has been called.
   DCHECK(!message_loop_);
+  // Reclaim nodes pushed by producers that raced with shutdown.
+  DrainLockFreeStack(NULL);
 }
 
-TimeTicks IncomingTaskQueue::CalculateDelayedRuntime(TimeDelta delay) {
+TimeTicks IncomingTaskQueue::CalculateDelayedRuntime(TimeDelta delay,
+                                                     TimeDelta slack) {
   TimeTicks delayed_run_time;
   if (delay > TimeDelta())
     delayed_run_time = TimeTicks::Now() + delay;
   else
     DCHECK_EQ(delay.InMilliseconds(), 0) << "delay should not be negative";
+  if (slack > TimeDelta() && !delayed_run_time.is_null()) {
+    // Round up to the next window boundary. Windows are aligned on absolute
+    // TimeTicks, so near-coincident timers from any thread land on the same
+    // boundary and are drained by one wakeup.
+    const int64 slack_us = slack.InMicroseconds();
+    const int64 run_time_us = delayed_run_time.ToInternalValue();
+    const int64 aligned_us =
+        (run_time_us + slack_us - 1) / slack_us * slack_us;
+    delayed_run_time = TimeTicks::FromInternalValue(aligned_us);
+  }
   return delayed_run_time;
 }
 
@@ -125,7 +177,8 @@ bool IncomingTaskQueue::PostPendingTask(PendingTask* pending_task) {
   // Initialize the sequence number. The sequence number is used for delayed
   // tasks (to faciliate FIFO sorting when two tasks have the same
   // delayed_run_time value) and for identifying the task in about:tracing.
-  pending_task->sequence_num = next_sequence_num_++;
+  pending_task->sequence_num =
+      subtle::NoBarrier_AtomicIncrement(&next_sequence_num_, 1);
 
   message_loop_->task_annotator()->DidQueueTask("MessageLoop::PostTask",
                                                 *pending_task);
@@ -148,5 +201,64 @@ bool IncomingTaskQueue::PostPendingTask(PendingTask* pending_task) {
   return true;
 }
 
+bool IncomingTaskQueue::PostPendingTaskLockFree(PendingTask* pending_task) {
+  if (!subtle::Acquire_Load(&accepting_tasks_)) {
+    pending_task->task.Reset();
+    return false;
+  }
+
+  pending_task->sequence_num =
+      subtle::NoBarrier_AtomicIncrement(&next_sequence_num_, 1);
+
+  LockFreeNode* node = new LockFreeNode(*pending_task);
+  pending_task->task.Reset();
+
+  // Publish the node. Release semantics pair with the barrier in
+  // DrainLockFreeStack() so the consumer sees a fully constructed task.
+  subtle::AtomicWord old_head;
+  do {
+    old_head = subtle::NoBarrier_Load(&lock_free_head_);
+    node->next = reinterpret_cast<LockFreeNode*>(old_head);
+  } while (subtle::Release_CompareAndSwap(
+               &lock_free_head_, old_head,
+               reinterpret_cast<subtle::AtomicWord>(node)) != old_head);
+
+  if (always_schedule_work_ || !old_head) {
+    // This post made the queue nonempty (or the pump wants a wakeup per task),
+    // so the loop may be going to sleep; wake it. The lock is only needed here
+    // to make dereferencing |message_loop_| safe against shutdown.
+    AutoLock lock(incoming_queue_lock_);
+    if (message_loop_) {
+      message_loop_->task_annotator()->DidQueueTask("MessageLoop::PostTask",
+                                                    node->task);
+      message_loop_->ScheduleWork();
+    }
+  }
+  return true;
+}
+
+void IncomingTaskQueue::DrainLockFreeStack(TaskQueue* work_queue) {
+  LockFreeNode* node = reinterpret_cast<LockFreeNode*>(
+      subtle::NoBarrier_AtomicExchange(&lock_free_head_, 0));
+  // Pairs with the Release CAS in PostPendingTaskLockFree() so every node's
+  // task is fully visible before we touch it.
+  subtle::MemoryBarrier();
+  // The stack is in LIFO order; reverse it to restore posting order.
+  LockFreeNode* reversed = NULL;
+  while (node) {
+    LockFreeNode* next = node->next;
+    node->next = reversed;
+    reversed = node;
+    node = next;
+  }
+  while (reversed) {
+    LockFreeNode* next = reversed->next;
+    if (work_queue)
+      work_queue->push(reversed->task);
+    delete reversed;
+    reversed = next;
+  }
+}
+
 }  // namespace internal
 }  // namespace base
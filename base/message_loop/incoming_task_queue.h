@@ -5,6 +5,7 @@
 #ifndef BASE_MESSAGE_LOOP_INCOMING_TASK_QUEUE_H_
 #define BASE_MESSAGE_LOOP_INCOMING_TASK_QUEUE_H_
 
+#include "base/atomicops.h"
 #include "base/base_export.h"
 #include "base/memory/ref_counted.h"
 #include "base/pending_task.h"
@@ -21,6 +22,12 @@ namespace internal {
 // Implements a queue of tasks posted to the message loop running on the current
 // thread. This class takes care of synchronizing posting tasks from different
 // threads and together with MessageLoop ensures clean shutdown.
+//
+// On platforms with the required atomic primitives the cross-thread producer
+// path is lock-free: posting threads push onto an intrusive stack with a single
+// atomic exchange and only take |incoming_queue_lock_| on the rare
+// empty-to-nonempty transition that has to wake the loop. The original locked
+// queue is kept as a fallback for the remaining platforms.
 class BASE_EXPORT IncomingTaskQueue
     : public RefCountedThreadSafe<IncomingTaskQueue> {
  public:
@@ -38,6 +45,16 @@ class BASE_EXPORT IncomingTaskQueue
                           TimeDelta delay,
                           bool nestable);
 
+  // As above, but rounds the task's run time up to the next boundary of a
+  // |slack|-wide window aligned on TimeTicks, so tasks due close together
+  // coalesce into a single wakeup of the loop. A zero |slack| behaves like
+  // plain AddToIncomingQueue().
+  bool AddToIncomingQueue(const tracked_objects::Location& from_here,
+                          const Closure& task,
+                          TimeDelta delay,
+                          TimeDelta slack,
+                          bool nestable);
+
   // Returns true if the queue contains tasks that require higher than default
   // timer resolution. Currently only needed for Windows.
   bool HasHighResolutionTasks();
@@ -55,10 +72,16 @@ class BASE_EXPORT IncomingTaskQueue
 
  private:
   friend class RefCountedThreadSafe<IncomingTaskQueue>;
+
+  // A singly linked node used by the lock-free producer stack. Nodes are
+  // pushed in LIFO order and reversed by the consumer in ReloadWorkQueue().
+  struct LockFreeNode;
+
   virtual ~IncomingTaskQueue();
 
-  // Calculates the time at which a PendingTask should run.
-  TimeTicks CalculateDelayedRuntime(TimeDelta delay);
+  // Calculates the time at which a PendingTask should run. A nonzero |slack|
+  // aligns the result to the next |slack| window boundary.
+  TimeTicks CalculateDelayedRuntime(TimeDelta delay, TimeDelta slack);
 
   // Adds a task to |incoming_queue_|. The caller retains ownership of
   // |pending_task|, but this function will reset the value of
@@ -66,23 +89,40 @@ class BASE_EXPORT IncomingTaskQueue
   // does not retain |pending_task->task| beyond this function call.
   bool PostPendingTask(PendingTask* pending_task);
 
+  // Lock-free flavor of PostPendingTask(); pushes onto |lock_free_head_| with
+  // a single atomic exchange.
+  bool PostPendingTaskLockFree(PendingTask* pending_task);
+
+  // Detaches the whole producer stack, restores FIFO order and appends the
+  // tasks to |work_queue| (may be NULL to discard them during shutdown).
+  void DrainLockFreeStack(TaskQueue* work_queue);
+
   // Number of tasks that require high resolution timing. This value is kept
-  // so that ReloadWorkQueue() completes in constant time.
-  int high_res_task_count_;
+  // so that ReloadWorkQueue() completes in constant time. Updated with atomic
+  // ops so the lock-free producer path can maintain it without the lock.
+  subtle::Atomic32 high_res_task_count_;
 
-  // The lock that protects access to the members of this class.
+  // The lock that protects access to the members of this class. In lock-free
+  // mode producers only take it to wake the message loop and during shutdown.
   base::Lock incoming_queue_lock_;
 
   // An incoming queue of tasks that are acquired under a mutex for processing
   // on this instance's thread. These tasks have not yet been been pushed to
-  // |message_loop_|.
+  // |message_loop_|. Only used when the lock-free path is unavailable.
   TaskQueue incoming_queue_;
 
+  // Head of the lock-free producer stack (a LockFreeNode*), or 0 when empty.
+  subtle::AtomicWord lock_free_head_;
+
+  // Cleared (with release semantics) before |message_loop_| is disconnected so
+  // that lock-free producers stop pushing without having to take the lock.
+  subtle::Atomic32 accepting_tasks_;
+
   // Points to the message loop that owns |this|.
   MessageLoop* message_loop_;
 
   // The next sequence number to use for delayed tasks.
-  int next_sequence_num_;
+  subtle::Atomic32 next_sequence_num_;
 
   // True if our message loop has already been scheduled and does not need to be
   // scheduled again until an empty reload occurs.
@@ -278,6 +278,15 @@ void MessageLoop::PostDelayedTask(
   incoming_task_queue_->AddToIncomingQueue(from_here, task, delay, true);
 }
 
+void MessageLoop::PostDelayedTaskWithSlack(
+    const tracked_objects::Location& from_here,
+    const Closure& task,
+    TimeDelta delay,
+    TimeDelta slack) {
+  DCHECK(!task.is_null()) << from_here.ToString();
+  incoming_task_queue_->AddToIncomingQueue(from_here, task, delay, slack, true);
+}
+
 void MessageLoop::PostNonNestableTask(
     const tracked_objects::Location& from_here,
     const Closure& task) {
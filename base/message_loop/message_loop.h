@@ -181,6 +181,15 @@ class BASE_EXPORT MessageLoop : public MessagePump::Delegate {
                        const Closure& task,
                        TimeDelta delay);
 
+  // Like PostDelayedTask, but the task's run time is rounded up to the next
+  // boundary of a |slack|-wide window aligned across all posters, so delayed
+  // tasks that are due close together share one wakeup of the loop. Use this
+  // for periodic housekeeping that tolerates firing up to |slack| late.
+  void PostDelayedTaskWithSlack(const tracked_objects::Location& from_here,
+                                const Closure& task,
+                                TimeDelta delay,
+                                TimeDelta slack);
+
   void PostNonNestableTask(const tracked_objects::Location& from_here,
                            const Closure& task);
 
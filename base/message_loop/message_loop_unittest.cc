@@ -703,6 +703,32 @@ TEST(MessageLoopTest, TaskObserver) {
   EXPECT_EQ(kNumPosts, observer.num_tasks_processed());
 }
 
+namespace {
+
+void IncrementAndMaybeQuit(int* counter, int quit_at) {
+  if (++(*counter) == quit_at)
+    MessageLoop::current()->QuitWhenIdle();
+}
+
+}  // namespace
+
+TEST(MessageLoopTest, PostDelayedTaskWithSlack) {
+  MessageLoop loop;
+  int run_count = 0;
+  // Tasks due within the same slack window coalesce onto one aligned run
+  // time; both must still run (in posting order for equal run times).
+  loop.PostDelayedTaskWithSlack(FROM_HERE,
+                                Bind(&IncrementAndMaybeQuit, &run_count, 2),
+                                TimeDelta::FromMilliseconds(5),
+                                TimeDelta::FromMilliseconds(50));
+  loop.PostDelayedTaskWithSlack(FROM_HERE,
+                                Bind(&IncrementAndMaybeQuit, &run_count, 2),
+                                TimeDelta::FromMilliseconds(6),
+                                TimeDelta::FromMilliseconds(50));
+  loop.Run();
+  EXPECT_EQ(2, run_count);
+}
+
 #if defined(OS_WIN)
 TEST(MessageLoopTest, Dispatcher) {
   // This test requires a UI loop
@@ -6,6 +6,7 @@
 
 #include "base/at_exit.h"
 #include "base/debug/leak_annotations.h"
+#include "base/hash.h"
 #include "base/json/string_escape.h"
 #include "base/logging.h"
 #include "base/memory/scoped_ptr.h"
@@ -65,6 +66,7 @@ HistogramBase* StatisticsRecorder::RegisterOrDeleteDuplicate(
       if (histograms_->end() == it) {
         (*histograms_)[name] = histogram;
         ANNOTATE_LEAKING_OBJECT_PTR(histogram);  // see crbug.com/79322
+        InsertIntoLookupTable(histogram);
         histogram_to_return = histogram;
       } else if (histogram == it->second) {
         // The histogram was registered before.
@@ -236,6 +238,13 @@ void StatisticsRecorder::GetBucketRanges(
 HistogramBase* StatisticsRecorder::FindHistogram(const std::string& name) {
   if (lock_ == NULL)
     return NULL;
+
+  // Try the lock-free table first; the UMA macros hit this path every time a
+  // histogram that already exists is looked up.
+  HistogramBase* histogram = FindInLookupTable(name);
+  if (histogram)
+    return histogram;
+
   base::AutoLock auto_lock(*lock_);
   if (histograms_ == NULL)
     return NULL;
@@ -280,6 +289,10 @@ StatisticsRecorder::StatisticsRecorder() {
   base::AutoLock auto_lock(*lock_);
   histograms_ = new HistogramMap;
   ranges_ = new RangesMap;
+  if (histogram_table_ == NULL) {
+    // Deliberately leaked with |lock_| for the same reason.
+    histogram_table_ = new subtle::AtomicWord[kLookupTableSize]();
+  }
 
   if (VLOG_IS_ON(1))
     AtExitManager::RegisterCallback(&DumpHistogramsToVlog, this);
@@ -308,14 +321,57 @@ StatisticsRecorder::~StatisticsRecorder() {
     ranges_deleter.reset(ranges_);
     histograms_ = NULL;
     ranges_ = NULL;
+    // Tests recreate the recorder; stale entries must not outlive
+    // |histograms_|. (The histograms themselves are leaked.)
+    for (size_t i = 0; i < kLookupTableSize; ++i)
+      subtle::NoBarrier_Store(&histogram_table_[i], 0);
   }
   // We are going to leak the histograms and the ranges.
 }
 
 
+// static
+void StatisticsRecorder::InsertIntoLookupTable(HistogramBase* histogram) {
+  lock_->AssertAcquired();
+  const std::string& name = histogram->histogram_name();
+  const size_t mask = kLookupTableSize - 1;
+  size_t index = Hash(name) & mask;
+  // Writers are serialized by |lock_|, so probing for an empty slot does not
+  // race with other writers; readers tolerate any prefix of this sequence.
+  for (size_t probes = 0; probes < kLookupTableSize; ++probes) {
+    if (!subtle::NoBarrier_Load(&histogram_table_[index])) {
+      subtle::Release_Store(&histogram_table_[index],
+                            reinterpret_cast<subtle::AtomicWord>(histogram));
+      return;
+    }
+    index = (index + 1) & mask;
+  }
+  // Table full; the histogram is still reachable through |histograms_|.
+}
+
+// static
+HistogramBase* StatisticsRecorder::FindInLookupTable(const std::string& name) {
+  if (histogram_table_ == NULL)
+    return NULL;
+  const size_t mask = kLookupTableSize - 1;
+  size_t index = Hash(name) & mask;
+  for (size_t probes = 0; probes < kLookupTableSize; ++probes) {
+    HistogramBase* entry = reinterpret_cast<HistogramBase*>(
+        subtle::Acquire_Load(&histogram_table_[index]));
+    if (!entry)
+      return NULL;
+    if (entry->histogram_name() == name)
+      return entry;
+    index = (index + 1) & mask;
+  }
+  return NULL;
+}
+
 // static
 StatisticsRecorder::HistogramMap* StatisticsRecorder::histograms_ = NULL;
 // static
+subtle::AtomicWord* StatisticsRecorder::histogram_table_ = NULL;
+// static
 StatisticsRecorder::RangesMap* StatisticsRecorder::ranges_ = NULL;
 // static
 base::Lock* StatisticsRecorder::lock_ = NULL;
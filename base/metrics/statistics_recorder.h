@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 
+#include "base/atomicops.h"
 #include "base/base_export.h"
 #include "base/basictypes.h"
 #include "base/gtest_prod_util.h"
@@ -101,9 +102,26 @@ class BASE_EXPORT StatisticsRecorder {
 
   static void DumpHistogramsToVlog(void* instance);
 
+  // Publishes |histogram| in |histogram_table_| so FindHistogram() can return
+  // it without taking |lock_|. Must be called with |lock_| held. No-op if the
+  // table is full; such histograms are still found via |histograms_|.
+  static void InsertIntoLookupTable(HistogramBase* histogram);
+
+  // Lock-free probe of |histogram_table_|. Returns NULL on a miss, in which
+  // case the caller must fall back to the locked |histograms_| map.
+  static HistogramBase* FindInLookupTable(const std::string& name);
+
   static HistogramMap* histograms_;
   static RangesMap* ranges_;
 
+  // An open-addressed hash table of registered histograms, keyed by name
+  // hash. Histograms are never unregistered and slots are published with a
+  // release store, so reads need no synchronization: the common "histogram
+  // already exists" lookup from the UMA macros never touches |lock_|.
+  // Cleared (for tests) only in the destructor, under |lock_|.
+  static const size_t kLookupTableSize = 1 << 13;
+  static subtle::AtomicWord* histogram_table_;
+
   // Lock protects access to above maps.
   static base::Lock* lock_;
 
@@ -7,9 +7,11 @@
 
 #include <algorithm>
 #include <map>
+#include <utility>
 
 #include "base/basictypes.h"
 #include "base/bind.h"
+#include "base/containers/stack_container.h"
 #include "base/location.h"
 #include "base/logging.h"
 #include "base/memory/ref_counted.h"
@@ -172,15 +174,33 @@ class ObserverListThreadSafe
     UnboundMethod<ObserverType, Method, Tuple<Params...>> method(
         m, MakeTuple(params...));
 
-    base::AutoLock lock(list_lock_);
-    for (const auto& entry : observer_lists_) {
-      ObserverListContext* context = entry.second;
-      context->loop->PostTask(
+    // One task is posted per loop with observers, and each task walks that
+    // loop's whole ObserverList, so the fan-out cost is per loop rather than
+    // per observer. Snapshot the targets under the lock but post outside it:
+    // PostTask takes each destination loop's queue lock, and holding
+    // |list_lock_| across all of them would serialize every Notify against
+    // observer registration on every other thread. The contexts are passed
+    // by pointer without being dereferenced; NotifyWrapper() revalidates them
+    // against the map, exactly as it does for tasks already in flight when a
+    // context goes away.
+    typedef std::pair<scoped_refptr<base::MessageLoopProxy>,
+                      ObserverListContext*> NotificationTarget;
+    base::StackVector<NotificationTarget, 16> targets;
+    {
+      base::AutoLock lock(list_lock_);
+      for (const auto& entry : observer_lists_) {
+        ObserverListContext* context = entry.second;
+        targets->push_back(NotificationTarget(context->loop, context));
+      }
+    }
+
+    for (size_t i = 0; i < targets->size(); ++i) {
+      targets[i].first->PostTask(
           FROM_HERE,
           base::Bind(
               &ObserverListThreadSafe<ObserverType>::template NotifyWrapper<
                   Method, Tuple<Params...>>,
-              this, context, method));
+              this, targets[i].second, method));
     }
   }
 
@@ -152,6 +152,18 @@ bool PickleIterator::ReadString(std::string* result) {
   return true;
 }
 
+bool PickleIterator::ReadStringPiece(base::StringPiece* result) {
+  int len;
+  if (!ReadInt(&len))
+    return false;
+  const char* read_from = GetReadPointerAndAdvance(len);
+  if (!read_from)
+    return false;
+
+  *result = base::StringPiece(read_from, len);
+  return true;
+}
+
 bool PickleIterator::ReadWString(std::wstring* result) {
   int len;
   if (!ReadInt(&len))
@@ -176,6 +188,19 @@ bool PickleIterator::ReadString16(string16* result) {
   return true;
 }
 
+bool PickleIterator::ReadStringPiece16(base::StringPiece16* result) {
+  int len;
+  if (!ReadInt(&len))
+    return false;
+  const char* read_from = GetReadPointerAndAdvance(len, sizeof(char16));
+  if (!read_from)
+    return false;
+
+  *result = base::StringPiece16(reinterpret_cast<const char16*>(read_from),
+                                len);
+  return true;
+}
+
 bool PickleIterator::ReadData(const char** data, int* length) {
   *length = 0;
   *data = 0;
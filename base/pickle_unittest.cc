@@ -208,6 +208,27 @@ TEST(PickleTest, ZeroLenWStr) {
   EXPECT_EQ("", outstr);
 }
 
+TEST(PickleTest, StringPiece) {
+  Pickle pickle;
+  EXPECT_TRUE(pickle.WriteString(teststring));
+  EXPECT_TRUE(pickle.WriteString16(teststring16));
+
+  // The pieces must alias the pickle's buffer rather than copy out of it.
+  PickleIterator iter(pickle);
+  base::StringPiece outpiece;
+  EXPECT_TRUE(iter.ReadStringPiece(&outpiece));
+  EXPECT_EQ(teststring, outpiece);
+  EXPECT_GE(outpiece.data(), pickle.payload());
+  EXPECT_LT(outpiece.data(), pickle.end_of_payload());
+
+  base::StringPiece16 outpiece16;
+  EXPECT_TRUE(iter.ReadStringPiece16(&outpiece16));
+  EXPECT_EQ(teststring16, outpiece16);
+
+  // Reads past the end must fail without touching the result.
+  EXPECT_FALSE(iter.ReadStringPiece(&outpiece));
+}
+
 TEST(PickleTest, BadLenStr) {
   Pickle pickle;
   EXPECT_TRUE(pickle.WriteInt(-2));
@@ -11,11 +11,13 @@
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/json/json_file_value_serializer.h"
+#include "base/json/json_reader.h"
 #include "base/json/json_string_value_serializer.h"
 #include "base/memory/ref_counted.h"
 #include "base/metrics/histogram.h"
 #include "base/prefs/pref_filter.h"
 #include "base/sequenced_task_runner.h"
+#include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "base/task_runner_util.h"
 #include "base/threading/sequenced_worker_pool.h"
@@ -30,13 +32,16 @@ struct JsonPrefStore::ReadResult {
   scoped_ptr<base::Value> value;
   PrefReadError error;
   bool no_dir;
+  size_t journal_entries;
 
  private:
   DISALLOW_COPY_AND_ASSIGN(ReadResult);
 };
 
 JsonPrefStore::ReadResult::ReadResult()
-    : error(PersistentPrefStore::PREF_READ_ERROR_NONE), no_dir(false) {
+    : error(PersistentPrefStore::PREF_READ_ERROR_NONE),
+      no_dir(false),
+      journal_entries(0) {
 }
 
 JsonPrefStore::ReadResult::~ReadResult() {
@@ -47,6 +52,90 @@ namespace {
 // Some extensions we'll tack on to copies of the Preferences files.
 const base::FilePath::CharType kBadExtension[] = FILE_PATH_LITERAL("bad");
 
+// The delta journal next to the preferences file. Each line is a JSON object
+// with a |kJournalPathKey| entry naming the changed preference and, for sets
+// (but not removals), a |kJournalValueKey| entry holding its new value. The
+// main file plus the journal replayed in order always yields the current
+// state, so the journal may be replayed over a newer snapshot harmlessly; it
+// is trimmed whenever a full serialization covering its entries is written.
+const base::FilePath::CharType kJournalExtension[] =
+    FILE_PATH_LITERAL("journal");
+
+const char kJournalPathKey[] = "path";
+const char kJournalValueKey[] = "value";
+
+// Once this many bytes of deltas accumulate, a full rewrite is scheduled to
+// fold them back into the main file.
+const size_t kJournalSizeLimit = 64 * 1024;
+
+base::FilePath JournalPath(const base::FilePath& path) {
+  return path.AddExtension(kJournalExtension);
+}
+
+void AppendToJournal(const base::FilePath& journal_path,
+                     const std::string& entry) {
+  base::AppendToFile(journal_path, entry.data(), entry.size());
+}
+
+// Removes the first |entries| lines from the journal; entries appended after
+// the serialization that covered the first |entries| are preserved.
+void TrimJournal(const base::FilePath& journal_path, size_t entries) {
+  std::string contents;
+  if (!base::ReadFileToString(journal_path, &contents))
+    return;
+
+  size_t offset = 0;
+  while (entries > 0 && offset < contents.size()) {
+    size_t newline = contents.find('\n', offset);
+    if (newline == std::string::npos) {
+      offset = contents.size();
+      break;
+    }
+    offset = newline + 1;
+    --entries;
+  }
+
+  if (offset >= contents.size()) {
+    base::DeleteFile(journal_path, false);
+    return;
+  }
+  base::ImportantFileWriter::WriteFileAtomically(journal_path,
+                                                 contents.substr(offset));
+}
+
+// Applies the journal entries to |prefs| in order, returning the number of
+// lines consumed. Unparseable lines (e.g. an append torn by a crash) are
+// skipped but still counted so that trimming stays line-accurate.
+size_t ReplayJournal(const base::FilePath& journal_path,
+                     base::DictionaryValue* prefs) {
+  std::string contents;
+  if (!base::ReadFileToString(journal_path, &contents))
+    return 0;
+
+  std::vector<std::string> lines;
+  base::SplitString(contents, '\n', &lines);
+
+  size_t entries = 0;
+  for (size_t i = 0; i < lines.size(); ++i) {
+    if (lines[i].empty())
+      continue;
+    ++entries;
+    scoped_ptr<base::Value> entry(base::JSONReader::Read(lines[i]));
+    base::DictionaryValue* entry_dict = NULL;
+    std::string path;
+    if (!entry || !entry->GetAsDictionary(&entry_dict) ||
+        !entry_dict->GetString(kJournalPathKey, &path)) {
+      continue;
+    }
+    scoped_ptr<base::Value> value;
+    if (entry_dict->Remove(kJournalValueKey, &value))
+      prefs->Set(path, value.release());
+    else
+      prefs->RemovePath(path, NULL);
+  }
+  return entries;
+}
+
 PersistentPrefStore::PrefReadError HandleReadErrors(
     const base::Value* value,
     const base::FilePath& path,
@@ -108,6 +197,17 @@ scoped_ptr<JsonPrefStore::ReadResult> ReadPrefsFromDisk(
   read_result->error =
       HandleReadErrors(read_result->value.get(), path, error_code, error_msg);
   read_result->no_dir = !base::PathExists(path.DirName());
+
+  if (read_result->error == PersistentPrefStore::PREF_READ_ERROR_NONE) {
+    read_result->journal_entries = ReplayJournal(
+        JournalPath(path),
+        static_cast<base::DictionaryValue*>(read_result->value.get()));
+  } else {
+    // Without a good snapshot to replay over, any leftover journal is stale
+    // relative to whatever gets written next.
+    base::DeleteFile(JournalPath(path), false);
+  }
+
   return read_result.Pass();
 }
 
@@ -129,6 +229,7 @@ JsonPrefStore::JsonPrefStore(
     const scoped_refptr<base::SequencedTaskRunner>& sequenced_task_runner,
     scoped_ptr<PrefFilter> pref_filter)
     : path_(filename),
+      journal_path_(JournalPath(filename)),
       sequenced_task_runner_(sequenced_task_runner),
       prefs_(new base::DictionaryValue()),
       read_only_(false),
@@ -136,7 +237,9 @@ JsonPrefStore::JsonPrefStore(
       pref_filter_(pref_filter.Pass()),
       initialized_(false),
       filtering_in_progress_(false),
-      read_error_(PREF_READ_ERROR_NONE) {
+      read_error_(PREF_READ_ERROR_NONE),
+      journal_entry_count_(0),
+      journal_size_(0) {
   DCHECK(!path_.empty());
 }
 
@@ -147,6 +250,7 @@ JsonPrefStore::JsonPrefStore(
     scoped_ptr<PrefFilter> pref_filter)
     : path_(filename),
       alternate_path_(alternate_filename),
+      journal_path_(JournalPath(filename)),
       sequenced_task_runner_(sequenced_task_runner),
       prefs_(new base::DictionaryValue()),
       read_only_(false),
@@ -154,7 +258,9 @@ JsonPrefStore::JsonPrefStore(
       pref_filter_(pref_filter.Pass()),
       initialized_(false),
       filtering_in_progress_(false),
-      read_error_(PREF_READ_ERROR_NONE) {
+      read_error_(PREF_READ_ERROR_NONE),
+      journal_entry_count_(0),
+      journal_size_(0) {
   DCHECK(!path_.empty());
 }
 
@@ -225,8 +331,7 @@ void JsonPrefStore::SetValueSilently(const std::string& key,
   prefs_->Get(key, &old_value);
   if (!old_value || !value->Equals(old_value)) {
     prefs_->Set(key, new_value.release());
-    if (!read_only_)
-      writer_.ScheduleWrite(this);
+    ScheduleWrite(key);
   }
 }
 
@@ -241,8 +346,7 @@ void JsonPrefStore::RemoveValueSilently(const std::string& key) {
   DCHECK(CalledOnValidThread());
 
   prefs_->RemovePath(key, NULL);
-  if (!read_only_)
-    writer_.ScheduleWrite(this);
+  ScheduleWrite(key);
 }
 
 bool JsonPrefStore::ReadOnly() const {
@@ -282,6 +386,11 @@ void JsonPrefStore::ReadPrefsAsync(ReadErrorDelegate* error_delegate) {
 void JsonPrefStore::CommitPendingWrite() {
   DCHECK(CalledOnValidThread());
 
+  // Journaled deltas are folded into a full serialization here so that the
+  // main file is complete and up to date after an explicit commit.
+  if (journal_entry_count_ > 0 && !read_only_)
+    writer_.ScheduleWrite(this);
+
   if (writer_.HasPendingWrite() && !read_only_)
     writer_.DoScheduledWrite();
 }
@@ -294,10 +403,52 @@ void JsonPrefStore::ReportValueChanged(const std::string& key) {
 
   FOR_EACH_OBSERVER(PrefStore::Observer, observers_, OnPrefValueChanged(key));
 
-  if (!read_only_)
+  ScheduleWrite(key);
+}
+
+void JsonPrefStore::ScheduleWrite(const std::string& key) {
+  DCHECK(CalledOnValidThread());
+
+  if (read_only_)
+    return;
+
+  // Deltas are only valid against a snapshot that was actually read, and
+  // stores with a |pref_filter_| may rewrite parts of the contents during
+  // serialization (see FilterSerializeData()), which a delta can't capture.
+  // All those cases schedule the traditional full rewrite.
+  if (pref_filter_ || !initialized_ || read_error_ != PREF_READ_ERROR_NONE) {
+    writer_.ScheduleWrite(this);
+    return;
+  }
+
+  base::DictionaryValue entry;
+  entry.SetString(kJournalPathKey, key);
+  const base::Value* value = NULL;
+  if (prefs_->Get(key, &value))
+    entry.Set(kJournalValueKey, value->DeepCopy());
+
+  std::string line;
+  JSONStringValueSerializer serializer(&line);
+  serializer.Serialize(entry);
+  line.push_back('\n');
+
+  ++journal_entry_count_;
+  journal_size_ += line.size();
+  sequenced_task_runner_->PostTask(
+      FROM_HERE, base::Bind(&AppendToJournal, journal_path_, line));
+
+  // Once deltas stop being cheaper than a rewrite, fold them back in.
+  if (journal_size_ > kJournalSizeLimit)
     writer_.ScheduleWrite(this);
 }
 
+void JsonPrefStore::PostJournalTrim(size_t entries) {
+  DCHECK(CalledOnValidThread());
+
+  sequenced_task_runner_->PostTask(
+      FROM_HERE, base::Bind(&TrimJournal, journal_path_, entries));
+}
+
 void JsonPrefStore::RegisterOnNextSuccessfulWriteCallback(
     const base::Closure& on_next_successful_write) {
   DCHECK(CalledOnValidThread());
@@ -354,6 +505,14 @@ void JsonPrefStore::OnFileRead(scoped_ptr<ReadResult> read_result) {
     }
   }
 
+  // A non-empty journal was replayed into |unfiltered_prefs|; schedule a
+  // full write to fold it into the main file (and trim it, via
+  // SerializeData()).
+  if (read_result->journal_entries > 0 && !read_only_) {
+    journal_entry_count_ = read_result->journal_entries;
+    writer_.ScheduleWrite(this);
+  }
+
   if (pref_filter_) {
     filtering_in_progress_ = true;
     const PrefFilter::PostFilterOnLoadCallback post_filter_on_load_callback(
@@ -374,6 +533,20 @@ JsonPrefStore::~JsonPrefStore() {
 bool JsonPrefStore::SerializeData(std::string* output) {
   DCHECK(CalledOnValidThread());
 
+  if (journal_entry_count_ > 0) {
+    // This serialization covers all journaled entries, so they can go once
+    // the write it feeds has happened. The write task is posted to the
+    // sequenced runner right after this method returns, so bounce through
+    // the current message loop before posting the trim to order it after
+    // the write.
+    base::MessageLoopProxy::current()->PostTask(
+        FROM_HERE,
+        base::Bind(&JsonPrefStore::PostJournalTrim, AsWeakPtr(),
+                   journal_entry_count_));
+    journal_entry_count_ = 0;
+    journal_size_ = 0;
+  }
+
   if (pref_filter_)
     pref_filter_->FilterSerializeData(prefs_.get());
 
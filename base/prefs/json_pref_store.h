@@ -122,8 +122,23 @@ class BASE_PREFS_EXPORT JsonPrefStore
                         scoped_ptr<base::DictionaryValue> prefs,
                         bool schedule_write);
 
+  // Persists the change to |key|. When possible this appends a small delta
+  // entry to the journal file next to |path_| instead of scheduling a full
+  // rewrite of the (potentially large) preferences file; the journal is
+  // folded back into the main file by the next full serialization. Falls
+  // back to scheduling a full rewrite for stores where deltas don't apply
+  // (see the implementation for details).
+  void ScheduleWrite(const std::string& key);
+
+  // Posts the removal of the first |entries| journal entries to the file
+  // thread. Called (via the message loop, to order it after the write task)
+  // once a full serialization covering those entries has been handed to
+  // |writer_|.
+  void PostJournalTrim(size_t entries);
+
   const base::FilePath path_;
   const base::FilePath alternate_path_;
+  const base::FilePath journal_path_;
   const scoped_refptr<base::SequencedTaskRunner> sequenced_task_runner_;
 
   scoped_ptr<base::DictionaryValue> prefs_;
@@ -142,6 +157,11 @@ class BASE_PREFS_EXPORT JsonPrefStore
   bool filtering_in_progress_;
   PrefReadError read_error_;
 
+  // Number of delta entries appended to the journal that are not yet covered
+  // by a full serialization of |prefs_|, and their total size in bytes.
+  size_t journal_entry_count_;
+  size_t journal_size_;
+
   std::set<std::string> keys_need_empty_value_;
 
   DISALLOW_COPY_AND_ASSIGN(JsonPrefStore);
@@ -350,6 +350,49 @@ TEST_F(JsonPrefStoreTest, RemoveClearsEmptyParent) {
   EXPECT_FALSE(has_dict);
 }
 
+TEST_F(JsonPrefStoreTest, DeltaJournal) {
+  ASSERT_TRUE(base::CopyFile(data_dir_.AppendASCII("read.json"),
+                             temp_dir_.path().AppendASCII("write.json")));
+
+  base::FilePath input_file = temp_dir_.path().AppendASCII("write.json");
+  base::FilePath journal_file =
+      temp_dir_.path().AppendASCII("write.json.journal");
+
+  scoped_refptr<JsonPrefStore> pref_store = new JsonPrefStore(
+      input_file,
+      message_loop_.message_loop_proxy().get(),
+      scoped_ptr<PrefFilter>());
+  ASSERT_EQ(PersistentPrefStore::PREF_READ_ERROR_NONE, pref_store->ReadPrefs());
+
+  std::string original_contents;
+  ASSERT_TRUE(base::ReadFileToString(input_file, &original_contents));
+
+  pref_store->SetValue(kHomePage, new StringValue("http://www.example.com"));
+  pref_store->RemoveValue("some_directory");
+  RunLoop().RunUntilIdle();
+
+  // The changes went to the delta journal; the main file was not rewritten.
+  EXPECT_TRUE(PathExists(journal_file));
+  std::string contents;
+  ASSERT_TRUE(base::ReadFileToString(input_file, &contents));
+  EXPECT_EQ(original_contents, contents);
+
+  // A fresh store sees the journaled changes even though the main file is
+  // still the old snapshot.
+  pref_store = new JsonPrefStore(
+      input_file,
+      message_loop_.message_loop_proxy().get(),
+      scoped_ptr<PrefFilter>());
+  ASSERT_EQ(PersistentPrefStore::PREF_READ_ERROR_NONE, pref_store->ReadPrefs());
+
+  const Value* actual = NULL;
+  std::string string_value;
+  ASSERT_TRUE(pref_store->GetValue(kHomePage, &actual));
+  EXPECT_TRUE(actual->GetAsString(&string_value));
+  EXPECT_EQ("http://www.example.com", string_value);
+  EXPECT_FALSE(pref_store->GetValue("some_directory", NULL));
+}
+
 // Tests asynchronous reading of the file when there is no file.
 TEST_F(JsonPrefStoreTest, AsyncNonExistingFile) {
   base::FilePath bogus_input_file = data_dir_.AppendASCII("read.txt");
@@ -0,0 +1,34 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/strings/string_builder.h"
+
+namespace base {
+
+StringBuilder::StringBuilder() : size_(0) {
+}
+
+StringBuilder::~StringBuilder() {
+}
+
+void StringBuilder::Append(const StringPiece& piece) {
+  if (piece.empty())
+    return;
+  pieces_->push_back(piece);
+  size_ += piece.size();
+}
+
+std::string StringBuilder::ToString() const {
+  std::string result;
+  AppendToString(&result);
+  return result;
+}
+
+void StringBuilder::AppendToString(std::string* output) const {
+  output->reserve(output->size() + size_);
+  for (size_t i = 0; i < pieces_->size(); ++i)
+    pieces_[i].AppendToString(output);
+}
+
+}  // namespace base
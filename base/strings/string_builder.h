@@ -0,0 +1,61 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_STRINGS_STRING_BUILDER_H_
+#define BASE_STRINGS_STRING_BUILDER_H_
+
+#include <string>
+
+#include "base/base_export.h"
+#include "base/basictypes.h"
+#include "base/containers/stack_container.h"
+#include "base/strings/string_piece.h"
+
+namespace base {
+
+// Builds a string out of pieces without the repeated reallocation and
+// copying that a chain of operator+= can hit: the pieces are collected
+// first, then copied once into a result of exactly the right size.
+//
+//   base::StringBuilder builder;
+//   builder.Append(method);
+//   builder.Append(" ");
+//   builder.Append(path);
+//   builder.Append(" HTTP/1.1\r\n");
+//   std::string request_line = builder.ToString();
+//
+// Like StringPiece, StringBuilder references the bytes it is given rather
+// than copying them; every appended piece must outlive the ToString() or
+// AppendToString() call that consumes the builder.
+class BASE_EXPORT StringBuilder {
+ public:
+  StringBuilder();
+  ~StringBuilder();
+
+  // Appends |piece| to the string being built. The bytes are referenced,
+  // not copied.
+  void Append(const StringPiece& piece);
+
+  // The total size of the string built so far.
+  size_t size() const { return size_; }
+
+  // Concatenates the appended pieces, allocating exactly once.
+  std::string ToString() const;
+
+  // Appends the concatenation of the pieces to |*output|, growing it at
+  // most once. |output| must not back any of the appended pieces.
+  void AppendToString(std::string* output) const;
+
+ private:
+  // Enough inline slots for a typical header block before the piece list
+  // itself falls back to the heap.
+  StackVector<StringPiece, 32> pieces_;
+  size_t size_;
+
+  DISALLOW_COPY_AND_ASSIGN(StringBuilder);
+};
+
+}  // namespace base
+
+#endif  // BASE_STRINGS_STRING_BUILDER_H_
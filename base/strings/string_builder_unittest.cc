@@ -0,0 +1,59 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/strings/string_builder.h"
+
+#include <string>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+TEST(StringBuilderTest, Empty) {
+  StringBuilder builder;
+  EXPECT_EQ(0u, builder.size());
+  EXPECT_EQ("", builder.ToString());
+}
+
+TEST(StringBuilderTest, Append) {
+  const std::string host("www.example.com");
+  StringBuilder builder;
+  builder.Append("Host");
+  builder.Append(": ");
+  builder.Append(host);
+  builder.Append("\r\n");
+  EXPECT_EQ(23u, builder.size());
+  EXPECT_EQ("Host: www.example.com\r\n", builder.ToString());
+}
+
+TEST(StringBuilderTest, EmptyPiecesAreIgnored) {
+  StringBuilder builder;
+  builder.Append("a");
+  builder.Append("");
+  builder.Append(StringPiece());
+  builder.Append("b");
+  EXPECT_EQ(2u, builder.size());
+  EXPECT_EQ("ab", builder.ToString());
+}
+
+TEST(StringBuilderTest, AppendToString) {
+  StringBuilder builder;
+  builder.Append("def");
+  std::string output("abc");
+  builder.AppendToString(&output);
+  EXPECT_EQ("abcdef", output);
+}
+
+TEST(StringBuilderTest, ManyPieces) {
+  // More pieces than the inline capacity of the piece list.
+  StringBuilder builder;
+  std::string expected;
+  for (int i = 0; i < 100; ++i) {
+    builder.Append("x");
+    expected += "x";
+  }
+  EXPECT_EQ(expected, builder.ToString());
+}
+
+}  // namespace base
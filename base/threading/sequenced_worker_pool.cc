@@ -4,6 +4,7 @@
 
 #include "base/threading/sequenced_worker_pool.h"
 
+#include <deque>
 #include <list>
 #include <map>
 #include <set>
@@ -346,10 +347,21 @@ class SequencedWorkerPool::Inner {
   // In any case, the calling code should clear the given
   // delete_these_outside_lock vector the next time the lock is released.
   // See the implementation for a more detailed description.
-  GetWorkStatus GetWork(SequencedTask* task,
+  GetWorkStatus GetWork(size_t worker_index,
+                        SequencedTask* task,
                         TimeDelta* wait_time,
                         std::vector<Closure>* delete_these_outside_lock);
 
+  // Work-stealing fast path for unsequenced tasks. Pops from the back of the
+  // worker's own deque for cache locality, then steals from the front of the
+  // other workers' deques. Returns true and fills in |task| on success. On
+  // shutdown, drains the deques into |delete_these_outside_lock| instead
+  // (deque tasks never have BLOCK_SHUTDOWN behavior). Called with the lock
+  // held.
+  bool GetDequeWork(size_t worker_index,
+                    SequencedTask* task,
+                    std::vector<Closure>* delete_these_outside_lock);
+
   void HandleCleanup();
 
   // Peforms init and cleanup around running the given task. WillRun...
@@ -444,6 +456,23 @@ class SequencedWorkerPool::Inner {
   typedef std::set<SequencedTask, SequencedTaskLessThan> PendingTaskSet;
   PendingTaskSet pending_tasks_;
 
+  // Per-worker deques holding unsequenced, non-BLOCK_SHUTDOWN tasks with no
+  // delay. These bypass the time-ordered |pending_tasks_| set entirely: posts
+  // are O(1) round-robin pushes and workers pop their own deque before
+  // stealing from the others, so floods of small unrelated tasks no longer
+  // force every dispatch to rescan the set. Guarded by |lock_| like
+  // everything else.
+  typedef std::deque<SequencedTask> WorkerDeque;
+  std::vector<linked_ptr<WorkerDeque> > worker_deques_;
+
+  // Round-robin cursor for choosing the deque an unsequenced task is posted
+  // to.
+  size_t next_worker_deque_;
+
+  // Total number of tasks across |worker_deques_|, so GetWork() can skip the
+  // deques entirely when they are all empty.
+  size_t deque_task_count_;
+
   // The next sequence number for a new sequenced task.
   int64 next_sequence_task_number_;
 
@@ -525,6 +554,8 @@ SequencedWorkerPool::Inner::Inner(
       thread_being_created_(false),
       waiting_thread_count_(0),
       blocking_shutdown_thread_count_(0),
+      next_worker_deque_(0),
+      deque_task_count_(0),
       next_sequence_task_number_(0),
       blocking_shutdown_pending_task_count_(0),
       trace_id_(0),
@@ -533,7 +564,11 @@ SequencedWorkerPool::Inner::Inner(
       cleanup_state_(CLEANUP_DONE),
       cleanup_idlers_(0),
       cleanup_cv_(&lock_),
-      testing_observer_(observer) {}
+      testing_observer_(observer) {
+  worker_deques_.reserve(max_threads_);
+  for (size_t i = 0; i < max_threads_; ++i)
+    worker_deques_.push_back(make_linked_ptr(new WorkerDeque));
+}
 
 SequencedWorkerPool::Inner::~Inner() {
   // You must call Shutdown() before destroying the pool.
@@ -607,9 +642,19 @@ bool SequencedWorkerPool::Inner::PostTask(
     if (optional_token_name)
       sequenced.sequence_token_id = LockedGetNamedTokenID(*optional_token_name);
 
-    pending_tasks_.insert(sequenced);
-    if (shutdown_behavior == BLOCK_SHUTDOWN)
-      blocking_shutdown_pending_task_count_++;
+    if (!sequenced.sequence_token_id && shutdown_behavior != BLOCK_SHUTDOWN &&
+        delay <= TimeDelta()) {
+      // Unsequenced tasks that are immediately runnable and don't need
+      // shutdown accounting go to the per-worker deques so workers can pick
+      // them up without rescanning |pending_tasks_|.
+      worker_deques_[next_worker_deque_]->push_back(sequenced);
+      next_worker_deque_ = (next_worker_deque_ + 1) % worker_deques_.size();
+      deque_task_count_++;
+    } else {
+      pending_tasks_.insert(sequenced);
+      if (shutdown_behavior == BLOCK_SHUTDOWN)
+        blocking_shutdown_pending_task_count_++;
+    }
 
     create_thread_id = PrepareToStartAdditionalThreadIfHelpful();
   }
@@ -646,7 +691,8 @@ void SequencedWorkerPool::Inner::CleanupForTesting() {
   CHECK_EQ(CLEANUP_DONE, cleanup_state_);
   if (shutdown_called_)
     return;
-  if (pending_tasks_.empty() && waiting_thread_count_ == threads_.size())
+  if (pending_tasks_.empty() && deque_task_count_ == 0 &&
+      waiting_thread_count_ == threads_.size())
     return;
   cleanup_state_ = CLEANUP_REQUESTED;
   cleanup_idlers_ = 0;
@@ -712,6 +758,9 @@ void SequencedWorkerPool::Inner::ThreadLoop(Worker* this_worker) {
     AutoLock lock(lock_);
     DCHECK(thread_being_created_);
     thread_being_created_ = false;
+    // Threads are never removed from |threads_| before shutdown, so the
+    // current size is a stable index identifying this worker's deque.
+    const size_t worker_index = threads_.size();
     std::pair<ThreadMap::iterator, bool> result =
         threads_.insert(
             std::make_pair(this_worker->tid(), make_linked_ptr(this_worker)));
@@ -729,7 +778,7 @@ void SequencedWorkerPool::Inner::ThreadLoop(Worker* this_worker) {
       TimeDelta wait_time;
       std::vector<Closure> delete_these_outside_lock;
       GetWorkStatus status =
-          GetWork(&task, &wait_time, &delete_these_outside_lock);
+          GetWork(worker_index, &task, &wait_time, &delete_these_outside_lock);
       if (status == GET_WORK_FOUND) {
         TRACE_EVENT_FLOW_END0(TRACE_DISABLED_BY_DEFAULT("toplevel.flow"),
             "SequencedWorkerPool::PostTask",
@@ -897,12 +946,63 @@ SequencedWorkerPool::Inner::LockedCurrentThreadShutdownBehavior() const {
   return found->second->running_shutdown_behavior();
 }
 
+bool SequencedWorkerPool::Inner::GetDequeWork(
+    size_t worker_index,
+    SequencedTask* task,
+    std::vector<Closure>* delete_these_outside_lock) {
+  lock_.AssertAcquired();
+
+  if (deque_task_count_ == 0)
+    return false;
+
+  if (shutdown_called_) {
+    // Nothing in the deques blocks shutdown; drop everything. Like the set
+    // path below, the closures are destroyed outside the lock.
+    for (size_t i = 0; i < worker_deques_.size(); ++i) {
+      WorkerDeque* deque = worker_deques_[i].get();
+      while (!deque->empty()) {
+        delete_these_outside_lock->push_back(deque->front().task);
+        deque->pop_front();
+        deque_task_count_--;
+      }
+    }
+    return false;
+  }
+
+  // Prefer our own deque, newest first, for cache locality; steal oldest
+  // first from the others so stolen tasks are the ones least likely to be
+  // picked up by their home worker soon.
+  const size_t deque_count = worker_deques_.size();
+  WorkerDeque* own = worker_deques_[worker_index % deque_count].get();
+  if (!own->empty()) {
+    *task = own->back();
+    own->pop_back();
+    deque_task_count_--;
+    return true;
+  }
+  for (size_t i = 1; i < deque_count; ++i) {
+    WorkerDeque* victim =
+        worker_deques_[(worker_index + i) % deque_count].get();
+    if (!victim->empty()) {
+      *task = victim->front();
+      victim->pop_front();
+      deque_task_count_--;
+      return true;
+    }
+  }
+  return false;
+}
+
 SequencedWorkerPool::Inner::GetWorkStatus SequencedWorkerPool::Inner::GetWork(
+    size_t worker_index,
     SequencedTask* task,
     TimeDelta* wait_time,
     std::vector<Closure>* delete_these_outside_lock) {
   lock_.AssertAcquired();
 
+  if (GetDequeWork(worker_index, task, delete_these_outside_lock))
+    return GET_WORK_FOUND;
+
   // Find the next task with a sequence token that's not currently in use.
   // If the token is in use, that means another thread is running something
   // in that sequence, and we can't run it without going out-of-order.
@@ -1073,6 +1173,11 @@ int SequencedWorkerPool::Inner::PrepareToStartAdditionalThreadIfHelpful() {
       cleanup_state_ == CLEANUP_DONE &&
       threads_.size() < max_threads_ &&
       waiting_thread_count_ == 0) {
+    // Deque tasks are always runnable.
+    if (deque_task_count_ > 0) {
+      thread_being_created_ = true;
+      return static_cast<int>(threads_.size() + 1);
+    }
     // We could use an additional thread if there's work to be done.
     for (PendingTaskSet::const_iterator i = pending_tasks_.begin();
          i != pending_tasks_.end(); ++i) {
@@ -0,0 +1,259 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/timer/timing_wheel.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "base/logging.h"
+
+namespace base {
+
+namespace {
+
+// Ticks this far out (or further) from the current tick do not fit in the
+// wheel and go to the overflow list.
+const uint64 kMaxTicksInWheel = UINT64_C(1) << (6 * 6);
+
+}  // namespace
+
+TimingWheel::Timer::Timer()
+    : wheel_(NULL), list_(NULL), prev_(NULL), next_(NULL), tick_(0) {
+}
+
+TimingWheel::Timer::~Timer() {
+  if (wheel_)
+    wheel_->Cancel(this);
+}
+
+TimingWheel::TimingWheel(TimeDelta granularity)
+    : granularity_us_(granularity.InMicroseconds()),
+      current_tick_(0),
+      num_timers_(0),
+      overflow_(NULL) {
+  DCHECK_GT(granularity_us_, 0);
+  memset(levels_, 0, sizeof(levels_));
+}
+
+TimingWheel::~TimingWheel() {
+  DCHECK(thread_checker_.CalledOnValidThread());
+  // Detach any timers still scheduled so that their destructors do not
+  // reach back into a dead wheel.
+  for (size_t level = 0; level < kNumLevels; ++level) {
+    for (size_t slot = 0; slot < kSlotsPerLevel; ++slot) {
+      for (Timer* timer = levels_[level][slot]; timer;) {
+        Timer* next = timer->next_;
+        timer->wheel_ = NULL;
+        timer->list_ = NULL;
+        timer->prev_ = NULL;
+        timer->next_ = NULL;
+        timer->task_.Reset();
+        timer = next;
+      }
+    }
+  }
+  for (Timer* timer = overflow_; timer;) {
+    Timer* next = timer->next_;
+    timer->wheel_ = NULL;
+    timer->list_ = NULL;
+    timer->prev_ = NULL;
+    timer->next_ = NULL;
+    timer->task_.Reset();
+    timer = next;
+  }
+}
+
+void TimingWheel::Schedule(Timer* timer,
+                           TimeTicks now,
+                           TimeTicks deadline,
+                           const Closure& task) {
+  DCHECK(thread_checker_.CalledOnValidThread());
+  DCHECK(!timer->wheel_) << "Cancel() the timer before re-scheduling it";
+  DCHECK(!task.is_null());
+
+  // An empty wheel has nothing to migrate, so its current tick may be
+  // arbitrarily stale; catch it up for free before placing the timer.
+  if (num_timers_ == 0)
+    current_tick_ = std::max(current_tick_, TickForTime(now));
+
+  timer->wheel_ = this;
+  timer->task_ = task;
+  timer->tick_ = std::max(TickForDeadline(deadline), current_tick_ + 1);
+  InsertTimer(timer);
+  ++num_timers_;
+}
+
+void TimingWheel::Cancel(Timer* timer) {
+  DCHECK(thread_checker_.CalledOnValidThread());
+  if (!timer->wheel_)
+    return;
+  DCHECK_EQ(this, timer->wheel_);
+  Unlink(timer);
+  timer->wheel_ = NULL;
+  timer->task_.Reset();
+  --num_timers_;
+}
+
+void TimingWheel::AdvanceTo(TimeTicks now) {
+  DCHECK(thread_checker_.CalledOnValidThread());
+  const uint64 target = TickForTime(now);
+  while (current_tick_ < target) {
+    // Jump straight to the next tick with work in it; ticks in between have
+    // no timers to fire and no migrations to perform.
+    const uint64 next_work = NextWorkTick();
+    if (next_work > target) {
+      current_tick_ = target;
+      return;
+    }
+    current_tick_ = next_work;
+    Cascade();
+    ExpireCurrentSlot();
+  }
+}
+
+TimeTicks TimingWheel::NextWakeTime() const {
+  DCHECK(thread_checker_.CalledOnValidThread());
+  const uint64 next_work = NextWorkTick();
+  if (next_work == kuint64max)
+    return TimeTicks();
+  return TimeForTick(next_work);
+}
+
+uint64 TimingWheel::TickForTime(TimeTicks time) const {
+  const int64 us = (time - TimeTicks()).InMicroseconds();
+  if (us <= 0)
+    return 0;
+  return static_cast<uint64>(us) / granularity_us_;
+}
+
+uint64 TimingWheel::TickForDeadline(TimeTicks deadline) const {
+  const int64 us = (deadline - TimeTicks()).InMicroseconds();
+  if (us <= 0)
+    return 0;
+  return (static_cast<uint64>(us) + granularity_us_ - 1) / granularity_us_;
+}
+
+TimeTicks TimingWheel::TimeForTick(uint64 tick) const {
+  return TimeTicks() + TimeDelta::FromMicroseconds(tick * granularity_us_);
+}
+
+uint64 TimingWheel::NextWorkTick() const {
+  if (num_timers_ == 0)
+    return kuint64max;
+
+  uint64 best = kuint64max;
+
+  // Level 0 holds timers less than one window out, each in the slot of its
+  // exact tick.
+  for (size_t j = 1; j <= kSlotsPerLevel; ++j) {
+    const uint64 tick = current_tick_ + j;
+    if (levels_[0][tick & kSlotMask]) {
+      best = tick;
+      break;
+    }
+  }
+
+  // A coarser level's slot needs servicing when the current tick reaches
+  // the start of the window that slot covers.
+  for (size_t level = 1; level < kNumLevels; ++level) {
+    const size_t shift = kLevelBits * level;
+    for (size_t j = 1; j <= kSlotsPerLevel; ++j) {
+      const uint64 boundary = ((current_tick_ >> shift) + j) << shift;
+      if (boundary >= best)
+        break;
+      if (levels_[level][(boundary >> shift) & kSlotMask]) {
+        best = boundary;
+        break;
+      }
+    }
+  }
+
+  if (overflow_) {
+    const size_t shift = kLevelBits * kNumLevels;
+    const uint64 wrap = ((current_tick_ >> shift) + 1) << shift;
+    best = std::min(best, wrap);
+  }
+
+  return best;
+}
+
+void TimingWheel::InsertTimer(Timer* timer) {
+  const uint64 delta = timer->tick_ - current_tick_;
+  Timer** list;
+  if (delta >= kMaxTicksInWheel) {
+    list = &overflow_;
+  } else {
+    size_t level = 0;
+    while (delta >= (UINT64_C(1) << (kLevelBits * (level + 1))))
+      ++level;
+    const size_t slot = (timer->tick_ >> (kLevelBits * level)) & kSlotMask;
+    list = &levels_[level][slot];
+  }
+  timer->list_ = list;
+  timer->prev_ = NULL;
+  timer->next_ = *list;
+  if (timer->next_)
+    timer->next_->prev_ = timer;
+  *list = timer;
+}
+
+void TimingWheel::Unlink(Timer* timer) {
+  if (timer->prev_)
+    timer->prev_->next_ = timer->next_;
+  else
+    *timer->list_ = timer->next_;
+  if (timer->next_)
+    timer->next_->prev_ = timer->prev_;
+  timer->list_ = NULL;
+  timer->prev_ = NULL;
+  timer->next_ = NULL;
+}
+
+void TimingWheel::Cascade() {
+  for (size_t level = 1; level < kNumLevels; ++level) {
+    const uint64 window = UINT64_C(1) << (kLevelBits * level);
+    if (current_tick_ & (window - 1))
+      return;
+    const size_t slot =
+        (current_tick_ >> (kLevelBits * level)) & kSlotMask;
+    Timer* timer = levels_[level][slot];
+    levels_[level][slot] = NULL;
+    while (timer) {
+      Timer* next = timer->next_;
+      InsertTimer(timer);
+      timer = next;
+    }
+  }
+
+  // The whole wheel wrapped; overflow timers may fit into it now.
+  if ((current_tick_ & (kMaxTicksInWheel - 1)) == 0) {
+    Timer* timer = overflow_;
+    overflow_ = NULL;
+    while (timer) {
+      Timer* next = timer->next_;
+      InsertTimer(timer);
+      timer = next;
+    }
+  }
+}
+
+void TimingWheel::ExpireCurrentSlot() {
+  Timer** list = &levels_[0][current_tick_ & kSlotMask];
+  // Pop one timer at a time; tasks may schedule or cancel other timers,
+  // including ones on this list.
+  while (*list) {
+    Timer* timer = *list;
+    DCHECK_EQ(current_tick_, timer->tick_);
+    Unlink(timer);
+    timer->wheel_ = NULL;
+    --num_timers_;
+    Closure task = timer->task_;
+    timer->task_.Reset();
+    task.Run();
+  }
+}
+
+}  // namespace base
@@ -0,0 +1,137 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_TIMER_TIMING_WHEEL_H_
+#define BASE_TIMER_TIMING_WHEEL_H_
+
+#include "base/base_export.h"
+#include "base/basictypes.h"
+#include "base/callback.h"
+#include "base/threading/thread_checker.h"
+#include "base/time/time.h"
+
+namespace base {
+
+// A hierarchical timing wheel: a scheduler for large numbers of timeouts
+// with O(1) arm and cancel, at the cost of rounding deadlines up to a fixed
+// granularity. It is a good fit for code which arms and re-arms many timers
+// that mostly never fire (idle timeouts, retransmission alarms), where a
+// heap-based scheduler pays O(log n) per operation and churns allocations.
+//
+// The wheel does not post tasks or read the clock by itself. The owner is
+// expected to pump it:
+//
+//   wheel_.AdvanceTo(now);                // runs every expired timer
+//   TimeTicks wake = wheel_.NextWakeTime();
+//   if (!wake.is_null())
+//     ... arrange to call AdvanceTo() again at |wake| ...
+//
+// NextWakeTime() is never later than the earliest scheduled deadline, but it
+// can be earlier: timers far in the future are kept in coarser levels of the
+// wheel and migrate towards the finest level as time advances, and the wheel
+// may need to be serviced at a migration boundary before anything fires.
+//
+// TimingWheel is not thread safe; all methods, including Timer destructors,
+// must be called on the thread that owns the wheel.
+class BASE_EXPORT TimingWheel {
+ public:
+  // A handle to one scheduled timeout, intended to be embedded in the
+  // client object. Destroying a scheduled Timer cancels it, so a Timer must
+  // not outlive the wheel it was scheduled on.
+  class BASE_EXPORT Timer {
+   public:
+    Timer();
+    ~Timer();
+
+    bool IsScheduled() const { return wheel_ != NULL; }
+
+   private:
+    friend class TimingWheel;
+
+    TimingWheel* wheel_;
+    // Doubly-linked slot list. |list_| points at the head pointer of the
+    // list this timer is on, so unlinking the head needs no slot lookup.
+    Timer** list_;
+    Timer* prev_;
+    Timer* next_;
+    uint64 tick_;
+    Closure task_;
+
+    DISALLOW_COPY_AND_ASSIGN(Timer);
+  };
+
+  // |granularity| is the tick size. Deadlines are rounded up to a whole
+  // number of ticks, so it bounds how late a timer can fire relative to its
+  // requested deadline (in addition to how promptly the owner pumps).
+  explicit TimingWheel(TimeDelta granularity);
+  ~TimingWheel();
+
+  // Schedules |timer| to run |task| at |deadline|. |timer| must not already
+  // be scheduled. |now| is the current time; a |deadline| at or before |now|
+  // fires on the next AdvanceTo() call.
+  void Schedule(Timer* timer,
+                TimeTicks now,
+                TimeTicks deadline,
+                const Closure& task);
+
+  // Cancels |timer|. Does nothing when it is not scheduled. The task is
+  // dropped immediately; cancelling is O(1) and never leaves work behind,
+  // unlike un-postable delayed tasks.
+  void Cancel(Timer* timer);
+
+  // Runs the task of every timer whose deadline is at |now| or earlier, in
+  // deadline order (timers sharing a tick run in unspecified order). Tasks
+  // may schedule and cancel timers on this wheel. |now| must not go
+  // backwards between calls.
+  void AdvanceTo(TimeTicks now);
+
+  // The next time AdvanceTo() needs to be called, or a null TimeTicks when
+  // nothing is scheduled. See the class comment; this is a lower bound on
+  // the earliest deadline.
+  TimeTicks NextWakeTime() const;
+
+  size_t num_timers_for_testing() const { return num_timers_; }
+
+ private:
+  static const size_t kLevelBits = 6;
+  static const size_t kSlotsPerLevel = 1 << kLevelBits;  // 64
+  static const size_t kSlotMask = kSlotsPerLevel - 1;
+  // Six levels of 64 slots cover 2^36 ticks; later deadlines sit on
+  // |overflow_| until the top level wraps.
+  static const size_t kNumLevels = 6;
+
+  // Ticks are counts of |granularity_us_| since the TimeTicks epoch.
+  uint64 TickForTime(TimeTicks time) const;      // rounds down
+  uint64 TickForDeadline(TimeTicks deadline) const;  // rounds up
+  TimeTicks TimeForTick(uint64 tick) const;
+
+  // The next tick at which a timer fires or migrates down a level, or
+  // kuint64max when the wheel is empty.
+  uint64 NextWorkTick() const;
+
+  // Links |timer| into the slot its |tick_| calls for, given the current
+  // tick.
+  void InsertTimer(Timer* timer);
+  void Unlink(Timer* timer);
+
+  // Moves timers whose window begins at |current_tick_| from coarser levels
+  // (and the overflow list) towards level 0.
+  void Cascade();
+  // Runs every timer scheduled for |current_tick_|.
+  void ExpireCurrentSlot();
+
+  const int64 granularity_us_;
+  uint64 current_tick_;
+  size_t num_timers_;
+  Timer* levels_[kNumLevels][kSlotsPerLevel];
+  Timer* overflow_;
+
+  ThreadChecker thread_checker_;
+
+  DISALLOW_COPY_AND_ASSIGN(TimingWheel);
+};
+
+}  // namespace base
+
+#endif  // BASE_TIMER_TIMING_WHEEL_H_
@@ -0,0 +1,184 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/timer/timing_wheel.h"
+
+#include "base/bind.h"
+#include "base/memory/scoped_ptr.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+namespace {
+
+void Increment(int* count) {
+  ++(*count);
+}
+
+class TimingWheelTest : public testing::Test {
+ protected:
+  TimingWheelTest()
+      : wheel_(TimeDelta::FromMilliseconds(1)),
+        now_(TimeTicks() + TimeDelta::FromHours(1)) {
+    wheel_.AdvanceTo(now_);
+  }
+
+  void Schedule(TimingWheel::Timer* timer, TimeDelta delay, int* count) {
+    wheel_.Schedule(timer, now_, now_ + delay, Bind(&Increment, count));
+  }
+
+  void Advance(TimeDelta delta) {
+    now_ += delta;
+    wheel_.AdvanceTo(now_);
+  }
+
+  TimingWheel wheel_;
+  TimeTicks now_;
+};
+
+TEST_F(TimingWheelTest, FiresAtDeadline) {
+  TimingWheel::Timer timer;
+  int count = 0;
+  Schedule(&timer, TimeDelta::FromMilliseconds(5), &count);
+  EXPECT_TRUE(timer.IsScheduled());
+  EXPECT_EQ(now_ + TimeDelta::FromMilliseconds(5), wheel_.NextWakeTime());
+
+  Advance(TimeDelta::FromMilliseconds(4));
+  EXPECT_EQ(0, count);
+
+  Advance(TimeDelta::FromMilliseconds(1));
+  EXPECT_EQ(1, count);
+  EXPECT_FALSE(timer.IsScheduled());
+  EXPECT_TRUE(wheel_.NextWakeTime().is_null());
+}
+
+TEST_F(TimingWheelTest, PastDeadlineFiresOnNextAdvance) {
+  TimingWheel::Timer timer;
+  int count = 0;
+  Schedule(&timer, TimeDelta::FromMilliseconds(-5), &count);
+  EXPECT_EQ(0, count);
+
+  Advance(TimeDelta::FromMilliseconds(1));
+  EXPECT_EQ(1, count);
+}
+
+TEST_F(TimingWheelTest, Cancel) {
+  TimingWheel::Timer timer;
+  int count = 0;
+  Schedule(&timer, TimeDelta::FromMilliseconds(5), &count);
+  wheel_.Cancel(&timer);
+  EXPECT_FALSE(timer.IsScheduled());
+  EXPECT_TRUE(wheel_.NextWakeTime().is_null());
+
+  // Cancelling again is a no-op.
+  wheel_.Cancel(&timer);
+
+  Advance(TimeDelta::FromMilliseconds(10));
+  EXPECT_EQ(0, count);
+}
+
+TEST_F(TimingWheelTest, DestroyedTimerIsCancelled) {
+  scoped_ptr<TimingWheel::Timer> timer(new TimingWheel::Timer());
+  int count = 0;
+  Schedule(timer.get(), TimeDelta::FromMilliseconds(5), &count);
+  EXPECT_EQ(1u, wheel_.num_timers_for_testing());
+
+  timer.reset();
+  EXPECT_EQ(0u, wheel_.num_timers_for_testing());
+
+  Advance(TimeDelta::FromMilliseconds(10));
+  EXPECT_EQ(0, count);
+}
+
+TEST_F(TimingWheelTest, FiresInDeadlineOrder) {
+  TimingWheel::Timer timers[3];
+  int counts[3] = {0, 0, 0};
+  Schedule(&timers[0], TimeDelta::FromMilliseconds(30), &counts[0]);
+  Schedule(&timers[1], TimeDelta::FromMilliseconds(10), &counts[1]);
+  Schedule(&timers[2], TimeDelta::FromMilliseconds(20), &counts[2]);
+
+  Advance(TimeDelta::FromMilliseconds(10));
+  EXPECT_EQ(0, counts[0]);
+  EXPECT_EQ(1, counts[1]);
+  EXPECT_EQ(0, counts[2]);
+
+  // One advance past every remaining deadline fires them all.
+  Advance(TimeDelta::FromMilliseconds(50));
+  EXPECT_EQ(1, counts[0]);
+  EXPECT_EQ(1, counts[2]);
+}
+
+TEST_F(TimingWheelTest, DistantDeadlinesCascade) {
+  // Far enough out to start several levels up the wheel, and in the
+  // overflow list respectively.
+  const TimeDelta kFar = TimeDelta::FromMinutes(10);
+  const TimeDelta kVeryFar = TimeDelta::FromDays(900);
+
+  TimingWheel::Timer far_timer;
+  TimingWheel::Timer very_far_timer;
+  int far_count = 0;
+  int very_far_count = 0;
+  Schedule(&far_timer, kFar, &far_count);
+  Schedule(&very_far_timer, kVeryFar, &very_far_count);
+
+  // The wheel may ask to be serviced before the deadline, but never after.
+  EXPECT_FALSE(wheel_.NextWakeTime().is_null());
+  EXPECT_LE(wheel_.NextWakeTime(), now_ + kFar);
+
+  Advance(kFar - TimeDelta::FromMilliseconds(1));
+  EXPECT_EQ(0, far_count);
+  Advance(TimeDelta::FromMilliseconds(1));
+  EXPECT_EQ(1, far_count);
+  EXPECT_EQ(0, very_far_count);
+
+  Advance(kVeryFar);
+  EXPECT_EQ(1, very_far_count);
+}
+
+TEST_F(TimingWheelTest, RearmFromTask) {
+  TimingWheel::Timer timer;
+  int count = 0;
+
+  // A task which re-schedules its own timer must not fire again in the
+  // same AdvanceTo() pass.
+  struct Helper {
+    static void Rearm(TimingWheel* wheel,
+                      const TimeTicks* now,
+                      TimingWheel::Timer* timer,
+                      int* count) {
+      ++(*count);
+      wheel->Schedule(
+          timer, *now, *now + TimeDelta::FromMilliseconds(5),
+          Bind(&Helper::Rearm, Unretained(wheel), now, timer, count));
+    }
+  };
+
+  wheel_.Schedule(&timer, now_, now_ + TimeDelta::FromMilliseconds(5),
+                  Bind(&Helper::Rearm, Unretained(&wheel_), &now_, &timer,
+                       &count));
+
+  Advance(TimeDelta::FromMilliseconds(5));
+  EXPECT_EQ(1, count);
+  Advance(TimeDelta::FromMilliseconds(5));
+  EXPECT_EQ(2, count);
+  EXPECT_TRUE(timer.IsScheduled());
+}
+
+TEST_F(TimingWheelTest, NextWakeTimeAfterIdlePeriod) {
+  TimingWheel::Timer timer;
+  int count = 0;
+
+  // Let the wheel sit idle for a long stretch, then schedule; the stale
+  // internal position must not delay the timer.
+  Advance(TimeDelta::FromHours(5));
+  Schedule(&timer, TimeDelta::FromMilliseconds(3), &count);
+  EXPECT_EQ(now_ + TimeDelta::FromMilliseconds(3), wheel_.NextWakeTime());
+
+  Advance(TimeDelta::FromMilliseconds(3));
+  EXPECT_EQ(1, count);
+}
+
+}  // namespace
+
+}  // namespace base
@@ -4,6 +4,14 @@
 
 #include "cc/debug/rendering_stats_instrumentation.h"
 
+namespace {
+
+// Number of samples kept per frame timeline stage; roughly three seconds of
+// frames at 60fps.
+const size_t kFrameTimelineHistorySize = 180;
+
+}  // namespace
+
 namespace cc {
 
 // static
@@ -14,6 +22,10 @@ scoped_ptr<RenderingStatsInstrumentation>
 
 RenderingStatsInstrumentation::RenderingStatsInstrumentation()
     : record_rendering_stats_(false) {
+  for (int stage = 0; stage < FRAME_TIMELINE_STAGE_COUNT; ++stage) {
+    frame_timeline_histories_.push_back(make_scoped_ptr(
+        new RollingTimeDeltaHistory(kFrameTimelineHistorySize)));
+  }
 }
 
 RenderingStatsInstrumentation::~RenderingStatsInstrumentation() {}
@@ -84,10 +96,12 @@ void RenderingStatsInstrumentation::AddApproximatedVisibleContentArea(
 void RenderingStatsInstrumentation::AddDrawDuration(
     base::TimeDelta draw_duration,
     base::TimeDelta draw_duration_estimate) {
+  base::AutoLock scoped_lock(lock_);
+  frame_timeline_histories_[FRAME_TIMELINE_STAGE_DRAW]->InsertSample(
+      draw_duration);
   if (!record_rendering_stats_)
     return;
 
-  base::AutoLock scoped_lock(lock_);
   impl_thread_rendering_stats_.draw_duration.Append(draw_duration);
   impl_thread_rendering_stats_.draw_duration_estimate.Append(
       draw_duration_estimate);
@@ -96,10 +110,12 @@ void RenderingStatsInstrumentation::AddDrawDuration(
 void RenderingStatsInstrumentation::AddBeginMainFrameToCommitDuration(
     base::TimeDelta begin_main_frame_to_commit_duration,
     base::TimeDelta begin_main_frame_to_commit_duration_estimate) {
+  base::AutoLock scoped_lock(lock_);
+  frame_timeline_histories_[FRAME_TIMELINE_STAGE_BEGIN_MAIN_FRAME_TO_COMMIT]
+      ->InsertSample(begin_main_frame_to_commit_duration);
   if (!record_rendering_stats_)
     return;
 
-  base::AutoLock scoped_lock(lock_);
   impl_thread_rendering_stats_.begin_main_frame_to_commit_duration.Append(
       begin_main_frame_to_commit_duration);
   impl_thread_rendering_stats_.begin_main_frame_to_commit_duration_estimate
@@ -109,14 +125,32 @@ void RenderingStatsInstrumentation::AddBeginMainFrameToCommitDuration(
 void RenderingStatsInstrumentation::AddCommitToActivateDuration(
     base::TimeDelta commit_to_activate_duration,
     base::TimeDelta commit_to_activate_duration_estimate) {
+  base::AutoLock scoped_lock(lock_);
+  frame_timeline_histories_[FRAME_TIMELINE_STAGE_COMMIT_TO_ACTIVATE]
+      ->InsertSample(commit_to_activate_duration);
   if (!record_rendering_stats_)
     return;
 
-  base::AutoLock scoped_lock(lock_);
   impl_thread_rendering_stats_.commit_to_activate_duration.Append(
       commit_to_activate_duration);
   impl_thread_rendering_stats_.commit_to_activate_duration_estimate.Append(
       commit_to_activate_duration_estimate);
 }
 
+void RenderingStatsInstrumentation::AddSwapDuration(
+    base::TimeDelta swap_duration) {
+  base::AutoLock scoped_lock(lock_);
+  frame_timeline_histories_[FRAME_TIMELINE_STAGE_SWAP]->InsertSample(
+      swap_duration);
+}
+
+base::TimeDelta RenderingStatsInstrumentation::GetFrameTimelinePercentile(
+    FrameTimelineStage stage,
+    double percentile) {
+  DCHECK_GE(stage, 0);
+  DCHECK_LT(stage, FRAME_TIMELINE_STAGE_COUNT);
+  base::AutoLock scoped_lock(lock_);
+  return frame_timeline_histories_[stage]->Percentile(percentile);
+}
+
 }  // namespace cc
@@ -7,6 +7,8 @@
 
 #include "base/memory/scoped_ptr.h"
 #include "base/synchronization/lock.h"
+#include "cc/base/rolling_time_delta_history.h"
+#include "cc/base/scoped_ptr_vector.h"
 #include "cc/debug/rendering_stats.h"
 
 namespace cc {
@@ -15,6 +17,15 @@ namespace cc {
 // recording of rendering stats into a private RenderingStats instance.
 class CC_EXPORT RenderingStatsInstrumentation {
  public:
+  // Pipeline stages tracked by the frame timeline histories.
+  enum FrameTimelineStage {
+    FRAME_TIMELINE_STAGE_BEGIN_MAIN_FRAME_TO_COMMIT,
+    FRAME_TIMELINE_STAGE_COMMIT_TO_ACTIVATE,
+    FRAME_TIMELINE_STAGE_DRAW,
+    FRAME_TIMELINE_STAGE_SWAP,
+    FRAME_TIMELINE_STAGE_COUNT
+  };
+
   static scoped_ptr<RenderingStatsInstrumentation> Create();
   virtual ~RenderingStatsInstrumentation();
 
@@ -51,6 +62,15 @@ class CC_EXPORT RenderingStatsInstrumentation {
   void AddCommitToActivateDuration(
       base::TimeDelta commit_to_activate_duration,
       base::TimeDelta commit_to_activate_duration_estimate);
+  void AddSwapDuration(base::TimeDelta swap_duration);
+
+  // Returns the given percentile (in percent, 0 to 100) of the most recently
+  // recorded durations for |stage|, or base::TimeDelta() when no samples have
+  // been recorded yet. Unlike the rendering stats above, the frame timeline
+  // histories are recorded regardless of record_rendering_stats(), so that
+  // monitoring can poll per-stage latency without turning on stats recording.
+  base::TimeDelta GetFrameTimelinePercentile(FrameTimelineStage stage,
+                                             double percentile);
 
  protected:
   RenderingStatsInstrumentation();
@@ -59,6 +79,9 @@ class CC_EXPORT RenderingStatsInstrumentation {
   RenderingStats impl_thread_rendering_stats_;
   RenderingStats impl_thread_rendering_stats_accu_;
 
+  // One rolling history per FrameTimelineStage.
+  ScopedPtrVector<RollingTimeDeltaHistory> frame_timeline_histories_;
+
   bool record_rendering_stats_;
 
   base::Lock lock_;
@@ -429,8 +429,19 @@ InputHandler::ScrollStatus LayerImpl::TryScroll(
     const gfx::PointF& screen_space_point,
     InputHandler::ScrollInputType type) const {
   if (should_scroll_on_main_thread()) {
-    TRACE_EVENT0("cc", "LayerImpl::TryScroll: Failed ShouldScrollOnMainThread");
-    return InputHandler::ScrollOnMainThread;
+    // A fixed-position layer that is not itself scrollable does not move when
+    // its scroll ancestors scroll, so its main-thread requirement only covers
+    // scrolls of the layer itself. Falling through to the checks below lets
+    // FindScrollLayerForDeviceViewportPoint() keep walking up to the scroll
+    // ancestor, so the scroll stays on the compositor thread.
+    if (!position_constraint().is_fixed_position() || scrollable()) {
+      TRACE_EVENT0("cc",
+                   "LayerImpl::TryScroll: Failed ShouldScrollOnMainThread");
+      return InputHandler::ScrollOnMainThread;
+    }
+    TRACE_EVENT0("cc",
+                 "LayerImpl::TryScroll: Ignored main thread bit on fixed "
+                 "layer");
   }
 
   if (!screen_space_transform().IsInvertible()) {
@@ -207,9 +207,13 @@ void DirectRenderer::DrawFrame(RenderPassList* render_passes_in_draw_order,
   DrawingFrame frame;
   frame.render_passes_in_draw_order = render_passes_in_draw_order;
   frame.root_render_pass = root_render_pass;
-  frame.root_damage_rect = Capabilities().using_partial_swap
-                               ? root_render_pass->damage_rect
-                               : root_render_pass->output_rect;
+  // Without partial swap the whole buffer is swapped, but a back buffer of
+  // known age only needs the damage it missed redrawn.
+  frame.root_damage_rect =
+      Capabilities().using_partial_swap
+          ? root_render_pass->damage_rect
+          : output_surface_->AccumulateDamage(root_render_pass->damage_rect,
+                                              root_render_pass->output_rect);
   frame.root_damage_rect.Intersect(gfx::Rect(device_viewport_rect.size()));
   frame.device_viewport_rect = device_viewport_rect;
   frame.device_clip_rect = device_clip_rect;
@@ -336,7 +340,11 @@ void DirectRenderer::DrawRenderPass(DrawingFrame* frame,
   if (!UseRenderPass(frame, render_pass))
     return;
 
-  bool using_scissor_as_optimization = Capabilities().using_partial_swap;
+  // The root damage rect only covers the pixels that differ from the current
+  // back buffer when the buffer's age is known, either implicitly through
+  // partial swap or explicitly from the output surface.
+  bool using_scissor_as_optimization =
+      Capabilities().using_partial_swap || output_surface_->GetBufferAge() > 0;
   gfx::Rect render_pass_scissor;
   bool draw_rect_covers_full_surface = true;
   if (frame->current_render_pass == frame->root_render_pass &&
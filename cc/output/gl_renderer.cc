@@ -499,6 +499,9 @@ void GLRenderer::DoDrawQuad(DrawingFrame* frame, const DrawQuad* quad) {
   if (quad->material != DrawQuad::TEXTURE_CONTENT) {
     FlushTextureQuadCache();
   }
+  if (quad->material != DrawQuad::SOLID_COLOR) {
+    FlushSolidColorQuadCache();
+  }
 
   switch (quad->material) {
     case DrawQuad::INVALID:
@@ -1482,13 +1485,19 @@ void GLRenderer::DrawSolidColorQuad(const DrawingFrame* frame,
                 !quad->force_anti_aliasing_off &&
                 ShouldAntialiasQuad(device_transform, quad, force_aa);
 
-  SolidColorProgramUniforms uniforms;
-  if (use_aa) {
-    SetupQuadForAntialiasing(device_transform, quad, &local_quad, edge);
-    SolidColorUniformLocation(GetSolidColorProgramAA(), &uniforms);
-  } else {
-    SolidColorUniformLocation(GetSolidColorProgram(), &uniforms);
+  if (!use_aa) {
+    // Quads drawn without antialiasing only differ in their transform and
+    // color, so consecutive compatible ones can be coalesced into a single
+    // draw call.
+    EnqueueSolidColorQuad(frame, quad, alpha);
+    return;
   }
+
+  FlushSolidColorQuadCache();
+
+  SolidColorProgramUniforms uniforms;
+  SetupQuadForAntialiasing(device_transform, quad, &local_quad, edge);
+  SolidColorUniformLocation(GetSolidColorProgramAA(), &uniforms);
   SetUseProgram(uniforms.program);
 
   GLC(gl_,
@@ -1497,18 +1506,15 @@ void GLRenderer::DrawSolidColorQuad(const DrawingFrame* frame,
                      (SkColorGetG(color) * (1.0f / 255.0f)) * alpha,
                      (SkColorGetB(color) * (1.0f / 255.0f)) * alpha,
                      alpha));
-  if (use_aa) {
-    float viewport[4] = {static_cast<float>(viewport_.x()),
-                         static_cast<float>(viewport_.y()),
-                         static_cast<float>(viewport_.width()),
-                         static_cast<float>(viewport_.height()), };
-    GLC(gl_, gl_->Uniform4fv(uniforms.viewport_location, 1, viewport));
-    GLC(gl_, gl_->Uniform3fv(uniforms.edge_location, 8, edge));
-  }
+  float viewport[4] = {static_cast<float>(viewport_.x()),
+                       static_cast<float>(viewport_.y()),
+                       static_cast<float>(viewport_.width()),
+                       static_cast<float>(viewport_.height()), };
+  GLC(gl_, gl_->Uniform4fv(uniforms.viewport_location, 1, viewport));
+  GLC(gl_, gl_->Uniform3fv(uniforms.edge_location, 8, edge));
 
-  // Enable blending when the quad properties require it or if we decided
-  // to use antialiasing.
-  SetBlendEnabled(quad->ShouldDrawWithBlending() || use_aa);
+  // Antialiasing requires blending.
+  SetBlendEnabled(true);
 
   // Normalize to tile_rect.
   local_quad.Scale(1.0f / tile_rect.width(), 1.0f / tile_rect.height());
@@ -1526,6 +1532,85 @@ void GLRenderer::DrawSolidColorQuad(const DrawingFrame* frame,
       frame, quad->quadTransform(), centered_rect, uniforms.matrix_location);
 }
 
+void GLRenderer::EnqueueSolidColorQuad(const DrawingFrame* frame,
+                                       const SolidColorDrawQuad* quad,
+                                       float alpha) {
+  SkColor color = quad->color;
+  Float4 premultiplied_color = {
+      {(SkColorGetR(color) * (1.0f / 255.0f)) * alpha,
+       (SkColorGetG(color) * (1.0f / 255.0f)) * alpha,
+       (SkColorGetB(color) * (1.0f / 255.0f)) * alpha,
+       alpha}};
+
+  const SolidColorProgram* program = GetSolidColorProgram();
+
+  if (solid_color_draw_cache_.program_id !=
+          static_cast<int>(program->program()) ||
+      memcmp(solid_color_draw_cache_.color.data,
+             premultiplied_color.data,
+             sizeof(premultiplied_color.data)) != 0 ||
+      solid_color_draw_cache_.needs_blending !=
+          quad->ShouldDrawWithBlending() ||
+      solid_color_draw_cache_.matrix_data.size() >= 8) {
+    FlushSolidColorQuadCache();
+    solid_color_draw_cache_.program_id = program->program();
+    solid_color_draw_cache_.needs_blending = quad->ShouldDrawWithBlending();
+    solid_color_draw_cache_.color = premultiplied_color;
+
+    solid_color_draw_cache_.matrix_location =
+        program->vertex_shader().matrix_location();
+    solid_color_draw_cache_.color_location =
+        program->fragment_shader().color_location();
+  }
+
+  // Generate the transform matrix
+  gfx::Transform quad_rect_matrix;
+  QuadRectTransform(&quad_rect_matrix, quad->quadTransform(),
+                    quad->visible_rect);
+  quad_rect_matrix = frame->projection_matrix * quad_rect_matrix;
+
+  Float16 m;
+  quad_rect_matrix.matrix().asColMajorf(m.data);
+  solid_color_draw_cache_.matrix_data.push_back(m);
+}
+
+void GLRenderer::FlushSolidColorQuadCache() {
+  // Check to see if we have anything to draw.
+  if (solid_color_draw_cache_.program_id == -1)
+    return;
+
+  // Set the correct blending mode.
+  SetBlendEnabled(solid_color_draw_cache_.needs_blending);
+
+  // Bind the program to the GL state.
+  SetUseProgram(solid_color_draw_cache_.program_id);
+
+  GLC(gl_,
+      gl_->Uniform4fv(solid_color_draw_cache_.color_location,
+                      1,
+                      solid_color_draw_cache_.color.data));
+
+  // Upload the transforms for all of the cached quads.
+  GLC(gl_,
+      gl_->UniformMatrix4fv(
+          static_cast<int>(solid_color_draw_cache_.matrix_location),
+          static_cast<int>(solid_color_draw_cache_.matrix_data.size()),
+          false,
+          reinterpret_cast<float*>(
+              &solid_color_draw_cache_.matrix_data.front())));
+
+  // Draw the quads!
+  GLC(gl_,
+      gl_->DrawElements(GL_TRIANGLES,
+                        6 * solid_color_draw_cache_.matrix_data.size(),
+                        GL_UNSIGNED_SHORT,
+                        0));
+
+  // Clear the cache.
+  solid_color_draw_cache_.program_id = -1;
+  solid_color_draw_cache_.matrix_data.resize(0);
+}
+
 struct TileProgramUniforms {
   unsigned program;
   unsigned matrix_location;
@@ -2238,7 +2323,10 @@ void GLRenderer::FinishDrawingFrame(DrawingFrame* frame) {
   ScheduleOverlays(frame);
 }
 
-void GLRenderer::FinishDrawingQuadList() { FlushTextureQuadCache(); }
+void GLRenderer::FinishDrawingQuadList() {
+  FlushTextureQuadCache();
+  FlushSolidColorQuadCache();
+}
 
 bool GLRenderer::FlippedFramebuffer(const DrawingFrame* frame) const {
   if (frame->current_render_pass != frame->root_render_pass)
@@ -2256,6 +2344,7 @@ void GLRenderer::EnsureScissorTestEnabled() {
     return;
 
   FlushTextureQuadCache();
+  FlushSolidColorQuadCache();
   GLC(gl_, gl_->Enable(GL_SCISSOR_TEST));
   is_scissor_enabled_ = true;
 }
@@ -2265,6 +2354,7 @@ void GLRenderer::EnsureScissorTestDisabled() {
     return;
 
   FlushTextureQuadCache();
+  FlushSolidColorQuadCache();
   GLC(gl_, gl_->Disable(GL_SCISSOR_TEST));
   is_scissor_enabled_ = false;
 }
@@ -2729,6 +2819,7 @@ void GLRenderer::SetScissorTestRect(const gfx::Rect& scissor_rect) {
 
   scissor_rect_ = scissor_rect;
   FlushTextureQuadCache();
+  FlushSolidColorQuadCache();
   GLC(gl_,
       gl_->Scissor(scissor_rect.x(),
                    scissor_rect.y(),
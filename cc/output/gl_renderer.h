@@ -171,6 +171,10 @@ class CC_EXPORT GLRenderer : public DirectRenderer {
   void DrawRenderPassQuad(DrawingFrame* frame, const RenderPassDrawQuad* quad);
   void DrawSolidColorQuad(const DrawingFrame* frame,
                           const SolidColorDrawQuad* quad);
+  void EnqueueSolidColorQuad(const DrawingFrame* frame,
+                             const SolidColorDrawQuad* quad,
+                             float alpha);
+  void FlushSolidColorQuadCache();
   void DrawStreamVideoQuad(const DrawingFrame* frame,
                            const StreamVideoDrawQuad* quad);
   void EnqueueTextureQuad(const DrawingFrame* frame,
@@ -307,7 +311,7 @@ class CC_EXPORT GLRenderer : public DirectRenderer {
   // Special purpose / effects shaders.
   typedef ProgramBinding<VertexShaderPos, FragmentShaderColor>
       DebugBorderProgram;
-  typedef ProgramBinding<VertexShaderQuad, FragmentShaderColor>
+  typedef ProgramBinding<VertexShaderPosBatched, FragmentShaderColor>
       SolidColorProgram;
   typedef ProgramBinding<VertexShaderQuadAA, FragmentShaderColorAA>
       SolidColorProgramAA;
@@ -438,6 +442,7 @@ class CC_EXPORT GLRenderer : public DirectRenderer {
   bool blend_shadow_;
   unsigned program_shadow_;
   TexturedQuadDrawCache draw_cache_;
+  SolidColorQuadDrawCache solid_color_draw_cache_;
   int highp_threshold_min_;
   int highp_threshold_cache_;
 
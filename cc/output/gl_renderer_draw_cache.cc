@@ -21,4 +21,14 @@ TexturedQuadDrawCache::TexturedQuadDrawCache()
 
 TexturedQuadDrawCache::~TexturedQuadDrawCache() {}
 
+SolidColorQuadDrawCache::SolidColorQuadDrawCache()
+    : program_id(-1),
+      needs_blending(false),
+      color(),
+      matrix_location(-1),
+      color_location(-1) {
+}
+
+SolidColorQuadDrawCache::~SolidColorQuadDrawCache() {}
+
 }  // namespace cc
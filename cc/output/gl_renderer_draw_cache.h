@@ -52,6 +52,28 @@ struct TexturedQuadDrawCache {
   DISALLOW_COPY_AND_ASSIGN(TexturedQuadDrawCache);
 };
 
+// A cache for storing solid color quads to be drawn. Quads that only differ
+// by transform may be coalesced into a single draw call.
+struct SolidColorQuadDrawCache {
+  SolidColorQuadDrawCache();
+  ~SolidColorQuadDrawCache();
+
+  // Values tracked to determine if solid color quads may be coalesced.
+  int program_id;
+  bool needs_blending;
+  Float4 color;
+
+  // Information about the program binding that is required to draw.
+  int matrix_location;
+  int color_location;
+
+  // A cache for the coalesced quad data.
+  std::vector<Float16> matrix_data;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(SolidColorQuadDrawCache);
+};
+
 }  // namespace cc
 
 #endif  // CC_OUTPUT_GL_RENDERER_DRAW_CACHE_H_
@@ -200,6 +200,39 @@ gfx::Size OutputSurface::SurfaceSize() const {
   return surface_size_;
 }
 
+int OutputSurface::GetBufferAge() {
+  // A surface that supports partial swap keeps the previous frame in the
+  // back buffer; everything else is assumed to leave its contents undefined
+  // after a swap.
+  if (context_provider_.get() &&
+      context_provider_->ContextCapabilities().gpu.post_sub_buffer)
+    return 1;
+  return 0;
+}
+
+gfx::Rect OutputSurface::AccumulateDamage(const gfx::Rect& damage,
+                                          const gfx::Rect& full_rect) {
+  // Number of old frame damage rects kept around; back buffers older than
+  // this get fully redrawn.
+  const size_t kMaxDamageHistorySize = 4;
+
+  int age = GetBufferAge();
+  gfx::Rect accumulated_damage = damage;
+  if (age < 1 || damage_history_.size() < static_cast<size_t>(age - 1)) {
+    accumulated_damage = full_rect;
+  } else {
+    // The back buffer missed the damage of the |age - 1| frames swapped
+    // since it was last drawn to.
+    for (int i = 0; i < age - 1; ++i)
+      accumulated_damage.Union(damage_history_[i]);
+  }
+
+  damage_history_.push_front(damage);
+  if (damage_history_.size() > kMaxDamageHistorySize)
+    damage_history_.pop_back();
+  return accumulated_damage;
+}
+
 void OutputSurface::BindFramebuffer() {
   DCHECK(context_provider_.get());
   context_provider_->ContextGL()->BindFramebuffer(GL_FRAMEBUFFER, 0);
@@ -15,6 +15,7 @@
 #include "cc/output/context_provider.h"
 #include "cc/output/overlay_candidate_validator.h"
 #include "cc/output/software_output_device.h"
+#include "ui/gfx/geometry/rect.h"
 
 namespace base { class SingleThreadTaskRunner; }
 
@@ -115,6 +116,21 @@ class CC_EXPORT OutputSurface {
   virtual void Reshape(const gfx::Size& size, float scale_factor);
   virtual gfx::Size SurfaceSize() const;
 
+  // Returns how many frames ago the current back buffer was last swapped:
+  // 1 means it still holds the previous frame, and 0 that its contents are
+  // undefined. The default implementation only knows about back buffers
+  // preserved for partial swap; surfaces that can query EGL_EXT_buffer_age
+  // should override this with the queried age.
+  virtual int GetBufferAge();
+
+  // Returns the rect that must be redrawn to bring the current back buffer
+  // fully up to date when |damage| is the damage since the last swapped
+  // frame, and records |damage| for later frames. This is the union of the
+  // damage from the frames the back buffer missed, or |full_rect| when the
+  // buffer age is unknown.
+  gfx::Rect AccumulateDamage(const gfx::Rect& damage,
+                             const gfx::Rect& full_rect);
+
   // If supported, this causes a ReclaimResources for all resources that are
   // currently in use.
   virtual void ForceReclaimResources() {}
@@ -181,6 +197,10 @@ class CC_EXPORT OutputSurface {
 
   bool external_stencil_test_enabled_;
 
+  // Damage rects of recent frames, most recent first, kept for
+  // AccumulateDamage().
+  std::deque<gfx::Rect> damage_history_;
+
   base::WeakPtrFactory<OutputSurface> weak_ptr_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(OutputSurface);
@@ -23,14 +23,15 @@ namespace {
 class TestOutputSurface : public OutputSurface {
  public:
   explicit TestOutputSurface(scoped_refptr<ContextProvider> context_provider)
-      : OutputSurface(context_provider) {}
+      : OutputSurface(context_provider), buffer_age_for_testing_(0) {}
 
   explicit TestOutputSurface(scoped_ptr<SoftwareOutputDevice> software_device)
-      : OutputSurface(software_device.Pass()) {}
+      : OutputSurface(software_device.Pass()), buffer_age_for_testing_(0) {}
 
   TestOutputSurface(scoped_refptr<ContextProvider> context_provider,
                     scoped_ptr<SoftwareOutputDevice> software_device)
-      : OutputSurface(context_provider, software_device.Pass()) {}
+      : OutputSurface(context_provider, software_device.Pass()),
+        buffer_age_for_testing_(0) {}
 
   void SwapBuffers(CompositorFrame* frame) override {
     client_->DidSwapBuffers();
@@ -53,7 +54,11 @@ class TestOutputSurface : public OutputSurface {
 
   void OnSwapBuffersCompleteForTesting() { client_->DidSwapBuffersComplete(); }
 
+  void set_buffer_age_for_testing(int age) { buffer_age_for_testing_ = age; }
+  int GetBufferAge() override { return buffer_age_for_testing_; }
+
  protected:
+  int buffer_age_for_testing_;
 };
 
 class TestSoftwareOutputDevice : public SoftwareOutputDevice {
@@ -173,6 +178,36 @@ TEST_F(OutputSurfaceTestInitializeNewContext3d, Context3dMakeCurrentFails) {
   InitializeNewContextExpectFail();
 }
 
+TEST(OutputSurfaceTest, AccumulateDamageUsesBufferAge) {
+  TestOutputSurface output_surface(TestContextProvider::Create());
+
+  gfx::Rect full_rect(0, 0, 100, 100);
+  gfx::Rect damage1(10, 10, 10, 10);
+  gfx::Rect damage2(30, 30, 10, 10);
+  gfx::Rect damage3(50, 50, 10, 10);
+
+  // An unknown buffer age requires a full redraw.
+  output_surface.set_buffer_age_for_testing(0);
+  EXPECT_EQ(full_rect, output_surface.AccumulateDamage(damage1, full_rect));
+
+  // With age 1 the back buffer holds the previous frame, so only the new
+  // damage needs to be redrawn.
+  output_surface.set_buffer_age_for_testing(1);
+  EXPECT_EQ(damage2, output_surface.AccumulateDamage(damage2, full_rect));
+
+  // With age 3 the back buffer missed the two previous frames, so their
+  // damage accumulates into the redraw rect.
+  output_surface.set_buffer_age_for_testing(3);
+  gfx::Rect expected = damage3;
+  expected.Union(damage2);
+  expected.Union(damage1);
+  EXPECT_EQ(expected, output_surface.AccumulateDamage(damage3, full_rect));
+
+  // Buffers older than the kept damage history fall back to a full redraw.
+  output_surface.set_buffer_age_for_testing(50);
+  EXPECT_EQ(full_rect, output_surface.AccumulateDamage(damage1, full_rect));
+}
+
 TEST(OutputSurfaceTest, MemoryAllocation) {
   scoped_refptr<TestContextProvider> context_provider =
       TestContextProvider::Create();
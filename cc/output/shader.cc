@@ -265,6 +265,41 @@ std::string VertexShaderPos::GetShaderString() const {
   // clang-format on
 }
 
+VertexShaderPosBatched::VertexShaderPosBatched() : matrix_location_(-1) {
+}
+
+void VertexShaderPosBatched::Init(GLES2Interface* context,
+                                  unsigned program,
+                                  int* base_uniform_index) {
+  static const char* uniforms[] = {
+      "matrix",
+  };
+  int locations[arraysize(uniforms)];
+
+  GetProgramUniformLocations(context,
+                             program,
+                             arraysize(uniforms),
+                             uniforms,
+                             locations,
+                             base_uniform_index);
+  matrix_location_ = locations[0];
+}
+
+std::string VertexShaderPosBatched::GetShaderString() const {
+  // clang-format off
+  return VERTEX_SHADER(
+      // clang-format on
+      attribute vec4 a_position;
+      attribute float a_index;
+      uniform mat4 matrix[8];
+      void main() {
+        gl_Position = matrix[int(a_index * 0.25)] * a_position;  // NOLINT
+      }
+      // clang-format off
+  );  // NOLINT(whitespace/parens)
+  // clang-format on
+}
+
 VertexShaderPosTexTransform::VertexShaderPosTexTransform()
     : matrix_location_(-1),
       tex_transform_location_(-1),
@@ -130,6 +130,25 @@ class VertexShaderPos {
   DISALLOW_COPY_AND_ASSIGN(VertexShaderPos);
 };
 
+// Like VertexShaderPos, but with one matrix per quad of the shared geometry
+// so that multiple quads can be coalesced into a single draw call.
+class VertexShaderPosBatched {
+ public:
+  VertexShaderPosBatched();
+
+  void Init(gpu::gles2::GLES2Interface* context,
+            unsigned program,
+            int* base_uniform_index);
+  std::string GetShaderString() const;
+
+  int matrix_location() const { return matrix_location_; }
+
+ private:
+  int matrix_location_;
+
+  DISALLOW_COPY_AND_ASSIGN(VertexShaderPosBatched);
+};
+
 class VertexShaderPosTexIdentity {
  public:
   void Init(gpu::gles2::GLES2Interface* context,
@@ -7,7 +7,6 @@
 
 #include <vector>
 
-#include "base/memory/scoped_ptr.h"
 #include "cc/base/cc_export.h"
 #include "cc/resources/display_item.h"
 #include "third_party/skia/include/core/SkRRect.h"
@@ -22,10 +21,10 @@ class CC_EXPORT ClipDisplayItem : public DisplayItem {
  public:
   ~ClipDisplayItem() override;
 
-  static scoped_ptr<ClipDisplayItem> Create(
+  static ClipDisplayItem Create(
       gfx::Rect clip_rect,
       const std::vector<SkRRect>& rounded_clip_rects) {
-    return make_scoped_ptr(new ClipDisplayItem(clip_rect, rounded_clip_rects));
+    return ClipDisplayItem(clip_rect, rounded_clip_rects);
   }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
@@ -47,9 +46,7 @@ class CC_EXPORT EndClipDisplayItem : public DisplayItem {
  public:
   ~EndClipDisplayItem() override;
 
-  static scoped_ptr<EndClipDisplayItem> Create() {
-    return make_scoped_ptr(new EndClipDisplayItem());
-  }
+  static EndClipDisplayItem Create() { return EndClipDisplayItem(); }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
 
@@ -4,20 +4,53 @@
 
 #include "cc/resources/display_item_list.h"
 
+#include <algorithm>
 #include <string>
 
 #include "base/debug/trace_event.h"
 #include "base/debug/trace_event_argument.h"
 #include "cc/base/math_util.h"
 #include "cc/debug/picture_debug_util.h"
+#include "cc/resources/clip_display_item.h"
+#include "cc/resources/display_list_display_item.h"
+#include "cc/resources/drawing_display_item.h"
+#include "cc/resources/filter_display_item.h"
+#include "cc/resources/float_clip_display_item.h"
+#include "cc/resources/transform_display_item.h"
+#include "cc/resources/transparency_display_item.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
 #include "ui/gfx/skia_util.h"
 
 namespace cc {
+namespace {
+
+// Number of items to allocate space for up front, so that short lists do not
+// grow their backing storage while recording.
+const size_t kDefaultNumDisplayItemsToReserve = 100;
+
+size_t LargestDisplayItemSize() {
+  size_t size = sizeof(ClipDisplayItem);
+  size = std::max(size, sizeof(DisplayListDisplayItem));
+  size = std::max(size, sizeof(DrawingDisplayItem));
+  size = std::max(size, sizeof(EndClipDisplayItem));
+  size = std::max(size, sizeof(EndFilterDisplayItem));
+  size = std::max(size, sizeof(EndFloatClipDisplayItem));
+  size = std::max(size, sizeof(EndTransformDisplayItem));
+  size = std::max(size, sizeof(EndTransparencyDisplayItem));
+  size = std::max(size, sizeof(FilterDisplayItem));
+  size = std::max(size, sizeof(FloatClipDisplayItem));
+  size = std::max(size, sizeof(TransformDisplayItem));
+  size = std::max(size, sizeof(TransparencyDisplayItem));
+  return size;
+}
+
+}  // namespace
 
 DisplayItemList::DisplayItemList()
-    : is_suitable_for_gpu_rasterization_(true), approximate_op_count_(0) {
+    : items_(LargestDisplayItemSize(), kDefaultNumDisplayItemsToReserve),
+      is_suitable_for_gpu_rasterization_(true),
+      approximate_op_count_(0) {
 }
 
 scoped_refptr<DisplayItemList> DisplayItemList::Create() {
@@ -32,18 +65,11 @@ void DisplayItemList::Raster(SkCanvas* canvas,
                              float contents_scale) const {
   canvas->save();
   canvas->scale(contents_scale, contents_scale);
-  for (size_t i = 0; i < items_.size(); ++i) {
-    items_[i]->Raster(canvas, callback);
-  }
+  for (const auto& item : items_)
+    item->Raster(canvas, callback);
   canvas->restore();
 }
 
-void DisplayItemList::AppendItem(scoped_ptr<DisplayItem> item) {
-  is_suitable_for_gpu_rasterization_ &= item->IsSuitableForGpuRasterization();
-  approximate_op_count_ += item->ApproximateOpCount();
-  items_.push_back(item.Pass());
-}
-
 bool DisplayItemList::IsSuitableForGpuRasterization() const {
   // This is more permissive than Picture's implementation, since none of the
   // items might individually trigger a veto even though they collectively have
@@ -58,9 +84,8 @@ int DisplayItemList::ApproximateOpCount() const {
 size_t DisplayItemList::PictureMemoryUsage() const {
   size_t total_size = 0;
 
-  for (const auto& item : items_) {
+  for (const auto& item : items_)
     total_size += item->PictureMemoryUsage();
-  }
 
   return total_size;
 }
@@ -79,8 +104,8 @@ scoped_refptr<base::debug::ConvertableToTraceFormat> DisplayItemList::AsValue()
       recorder.beginRecording(layer_rect_.width(), layer_rect_.height());
   canvas->translate(-layer_rect_.x(), -layer_rect_.y());
   canvas->clipRect(gfx::RectToSkRect(layer_rect_));
-  for (size_t i = 0; i < items_.size(); ++i)
-    items_[i]->RasterForTracing(canvas);
+  for (const auto& item : items_)
+    item->RasterForTracing(canvas);
   skia::RefPtr<SkPicture> picture = skia::AdoptRef(recorder.endRecording());
 
   std::string b64_picture;
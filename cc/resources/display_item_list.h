@@ -7,9 +7,8 @@
 
 #include "base/debug/trace_event.h"
 #include "base/memory/ref_counted.h"
-#include "base/memory/scoped_ptr.h"
 #include "cc/base/cc_export.h"
-#include "cc/base/scoped_ptr_vector.h"
+#include "cc/quads/list_container.h"
 #include "cc/resources/display_item.h"
 #include "ui/gfx/geometry/rect.h"
 
@@ -27,7 +26,17 @@ class CC_EXPORT DisplayItemList
               SkDrawPictureCallback* callback,
               float contents_scale) const;
 
-  void AppendItem(scoped_ptr<DisplayItem> item);
+  // Copies |item| into the list's contiguous storage. Items hold their heavy
+  // data (pictures, filters) by reference, so appending is a shallow copy and
+  // the backing storage travels with the list across the commit boundary
+  // instead of being reallocated item by item.
+  template <typename DisplayItemType>
+  void AppendItem(const DisplayItemType& item) {
+    const DisplayItemType* appended = items_.AllocateAndCopyFrom(&item);
+    is_suitable_for_gpu_rasterization_ &=
+        appended->IsSuitableForGpuRasterization();
+    approximate_op_count_ += appended->ApproximateOpCount();
+  }
 
   void set_layer_rect(gfx::Rect layer_rect) { layer_rect_ = layer_rect; }
   gfx::Rect layer_rect() const { return layer_rect_; }
@@ -43,7 +52,7 @@ class CC_EXPORT DisplayItemList
  private:
   DisplayItemList();
   ~DisplayItemList();
-  ScopedPtrVector<DisplayItem> items_;
+  ListContainer<DisplayItem> items_;
   gfx::Rect layer_rect_;
   bool is_suitable_for_gpu_rasterization_;
   int approximate_op_count_;
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "cc/resources/clip_display_item.h"
+#include "cc/resources/display_list_display_item.h"
 #include "cc/resources/drawing_display_item.h"
 #include "cc/resources/transform_display_item.h"
 #include "cc/test/skia_common.h"
@@ -110,6 +111,61 @@ TEST(DisplayItemListTest, ClipItem) {
   EXPECT_EQ(0, memcmp(pixels, expected_pixels, 4 * 100 * 100));
 }
 
+TEST(DisplayItemListTest, SplicedDisplayListItems) {
+  gfx::Rect layer_rect(100, 100);
+  SkPictureRecorder recorder;
+  skia::RefPtr<SkCanvas> canvas;
+  skia::RefPtr<SkPicture> picture;
+  SkPaint blue_paint;
+  blue_paint.setColor(SK_ColorBLUE);
+  SkPaint red_paint;
+  red_paint.setColor(SK_ColorRED);
+  unsigned char pixels[4 * 100 * 100] = {0};
+
+  // An "old" list covering the layer with red and a "new" partial recording
+  // of blue, spliced together the way DisplayListRecordingSource does it.
+  scoped_refptr<DisplayItemList> old_list = DisplayItemList::Create();
+  canvas = skia::SharePtr(
+      recorder.beginRecording(layer_rect.width(), layer_rect.height()));
+  canvas->drawRectCoords(0.f, 0.f, 100.f, 100.f, red_paint);
+  picture = skia::AdoptRef(recorder.endRecording());
+  old_list->AppendItem(DrawingDisplayItem::Create(picture, gfx::PointF()));
+
+  scoped_refptr<DisplayItemList> new_list = DisplayItemList::Create();
+  canvas = skia::SharePtr(
+      recorder.beginRecording(layer_rect.width(), layer_rect.height()));
+  canvas->drawRectCoords(0.f, 0.f, 100.f, 100.f, blue_paint);
+  picture = skia::AdoptRef(recorder.endRecording());
+  new_list->AppendItem(DrawingDisplayItem::Create(picture, gfx::PointF()));
+
+  gfx::Rect invalidation_rect(50, 50, 20, 20);
+  scoped_refptr<DisplayItemList> spliced_list = DisplayItemList::Create();
+  spliced_list->AppendItem(
+      DisplayListDisplayItem::CreateWithExclusion(old_list, invalidation_rect));
+  spliced_list->AppendItem(
+      DisplayListDisplayItem::CreateClipped(new_list, invalidation_rect));
+  DrawDisplayList(pixels, layer_rect, spliced_list);
+
+  SkBitmap expected_bitmap;
+  unsigned char expected_pixels[4 * 100 * 100] = {0};
+  SkImageInfo info =
+      SkImageInfo::MakeN32Premul(layer_rect.width(), layer_rect.height());
+  expected_bitmap.installPixels(info, expected_pixels, info.minRowBytes());
+  SkCanvas expected_canvas(expected_bitmap);
+  expected_canvas.clipRect(gfx::RectToSkRect(layer_rect));
+  expected_canvas.save();
+  expected_canvas.clipRect(gfx::RectToSkRect(invalidation_rect),
+                           SkRegion::kDifference_Op);
+  expected_canvas.drawRectCoords(0.f, 0.f, 100.f, 100.f, red_paint);
+  expected_canvas.restore();
+  expected_canvas.save();
+  expected_canvas.clipRect(gfx::RectToSkRect(invalidation_rect));
+  expected_canvas.drawRectCoords(0.f, 0.f, 100.f, 100.f, blue_paint);
+  expected_canvas.restore();
+
+  EXPECT_EQ(0, memcmp(pixels, expected_pixels, 4 * 100 * 100));
+}
+
 TEST(DisplayItemListTest, TransformItem) {
   gfx::Rect layer_rect(100, 100);
   SkPictureRecorder recorder;
@@ -0,0 +1,45 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "cc/resources/display_list_display_item.h"
+
+#include "base/logging.h"
+#include "cc/resources/display_item_list.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+#include "ui/gfx/skia_util.h"
+
+namespace cc {
+
+DisplayListDisplayItem::DisplayListDisplayItem(
+    scoped_refptr<DisplayItemList> list,
+    const gfx::Rect& rect,
+    SkRegion::Op clip_op)
+    : list_(list), rect_(rect), clip_op_(clip_op) {
+  DCHECK(list_.get());
+}
+
+DisplayListDisplayItem::~DisplayListDisplayItem() {
+}
+
+void DisplayListDisplayItem::Raster(SkCanvas* canvas,
+                                    SkDrawPictureCallback* callback) const {
+  canvas->save();
+  canvas->clipRect(gfx::RectToSkRect(rect_), clip_op_);
+  list_->Raster(canvas, callback, 1.f);
+  canvas->restore();
+}
+
+bool DisplayListDisplayItem::IsSuitableForGpuRasterization() const {
+  return list_->IsSuitableForGpuRasterization();
+}
+
+int DisplayListDisplayItem::ApproximateOpCount() const {
+  return 1 + list_->ApproximateOpCount();
+}
+
+size_t DisplayListDisplayItem::PictureMemoryUsage() const {
+  return sizeof(gfx::Rect) + list_->PictureMemoryUsage();
+}
+
+}  // namespace cc
@@ -0,0 +1,62 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CC_RESOURCES_DISPLAY_LIST_DISPLAY_ITEM_H_
+#define CC_RESOURCES_DISPLAY_LIST_DISPLAY_ITEM_H_
+
+#include "base/memory/ref_counted.h"
+#include "cc/base/cc_export.h"
+#include "cc/resources/display_item.h"
+#include "third_party/skia/include/core/SkRegion.h"
+#include "ui/gfx/geometry/rect.h"
+
+class SkCanvas;
+class SkDrawPictureCallback;
+
+namespace cc {
+
+class DisplayItemList;
+
+// Rasters a previously recorded DisplayItemList restricted to, or excluding,
+// a rect. DisplayListRecordingSource uses a pair of these to splice a partial
+// re-recording of an invalidated rect over the display list recorded for an
+// earlier frame.
+class CC_EXPORT DisplayListDisplayItem : public DisplayItem {
+ public:
+  ~DisplayListDisplayItem() override;
+
+  // Rasters |list| clipped to |rect|.
+  static DisplayListDisplayItem CreateClipped(
+      scoped_refptr<DisplayItemList> list,
+      const gfx::Rect& rect) {
+    return DisplayListDisplayItem(list, rect, SkRegion::kIntersect_Op);
+  }
+
+  // Rasters |list| everywhere except |rect|.
+  static DisplayListDisplayItem CreateWithExclusion(
+      scoped_refptr<DisplayItemList> list,
+      const gfx::Rect& rect) {
+    return DisplayListDisplayItem(list, rect, SkRegion::kDifference_Op);
+  }
+
+  void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
+
+  bool IsSuitableForGpuRasterization() const override;
+  int ApproximateOpCount() const override;
+  size_t PictureMemoryUsage() const override;
+
+ protected:
+  DisplayListDisplayItem(scoped_refptr<DisplayItemList> list,
+                         const gfx::Rect& rect,
+                         SkRegion::Op clip_op);
+
+ private:
+  scoped_refptr<DisplayItemList> list_;
+  gfx::Rect rect_;
+  SkRegion::Op clip_op_;
+};
+
+}  // namespace cc
+
+#endif  // CC_RESOURCES_DISPLAY_LIST_DISPLAY_ITEM_H_
@@ -9,6 +9,7 @@
 #include "cc/base/region.h"
 #include "cc/layers/content_layer_client.h"
 #include "cc/resources/display_item_list.h"
+#include "cc/resources/display_list_display_item.h"
 #include "cc/resources/display_list_raster_source.h"
 #include "skia/ext/analysis_canvas.h"
 
@@ -21,6 +22,14 @@ const int kPixelDistanceToRecord = 8000;
 // We don't perform solid color analysis on images that have more than 10 skia
 // operations.
 const int kOpCountThatIsOkToAnalyze = 10;
+// Number of partial recordings that can be spliced on top of a full recording
+// before the next invalidation forces a full re-record. This bounds both
+// replay cost and the memory retained by the chain of old display lists.
+const int kMaxSplicedRecordings = 16;
+// Splicing a partial recording only pays off when the invalidated area is a
+// small fraction of the recorded viewport; above 1/kMinAreaRatioToSplice of
+// the viewport area a full re-record is about as cheap.
+const int kMinAreaRatioToSplice = 4;
 
 }  // namespace
 
@@ -32,7 +41,8 @@ DisplayListRecordingSource::DisplayListRecordingSource()
       is_solid_color_(false),
       solid_color_(SK_ColorTRANSPARENT),
       pixel_record_distance_(kPixelDistanceToRecord),
-      is_suitable_for_gpu_rasterization_(true) {
+      is_suitable_for_gpu_rasterization_(true),
+      spliced_recording_count_(0) {
 }
 
 DisplayListRecordingSource::~DisplayListRecordingSource() {
@@ -80,12 +90,43 @@ bool DisplayListRecordingSource::UpdateAndExpandInvalidation(
   if (!updated && !invalidation->Intersects(recorded_viewport_))
     return false;
 
+  gfx::Rect invalidation_bounds = invalidation->bounds();
+  invalidation_bounds.Intersect(recorded_viewport_);
+
+  // If nothing changed except a small part of an unchanged viewport, record
+  // just the invalidated area and splice it over the previous display list
+  // rather than re-recording the whole viewport. Each splice nests the
+  // previous list, so collapse the chain with a full record once it gets too
+  // long.
+  bool record_partially =
+      !updated && display_list_.get() && !invalidation_bounds.IsEmpty() &&
+      spliced_recording_count_ < kMaxSplicedRecordings &&
+      static_cast<int64>(invalidation_bounds.size().GetArea()) *
+              kMinAreaRatioToSplice <=
+          static_cast<int64>(recorded_viewport_.size().GetArea());
+  gfx::Rect record_rect =
+      record_partially ? invalidation_bounds : recorded_viewport_;
+
   // TODO(ajuma): Does repeating this way really makes sense with display lists?
   // With Blink caching recordings, repeated calls will not cause re-recording.
   int repeat_count = std::max(1, slow_down_raster_scale_factor_for_debug_);
+  scoped_refptr<DisplayItemList> recorded_list;
   for (int i = 0; i < repeat_count; ++i) {
-    display_list_ = painter->PaintContentsToDisplayList(
-        recorded_viewport_, ContentLayerClient::GRAPHICS_CONTEXT_ENABLED);
+    recorded_list = painter->PaintContentsToDisplayList(
+        record_rect, ContentLayerClient::GRAPHICS_CONTEXT_ENABLED);
+  }
+
+  if (record_partially) {
+    scoped_refptr<DisplayItemList> spliced_list = DisplayItemList::Create();
+    spliced_list->AppendItem(DisplayListDisplayItem::CreateWithExclusion(
+        display_list_, record_rect));
+    spliced_list->AppendItem(
+        DisplayListDisplayItem::CreateClipped(recorded_list, record_rect));
+    display_list_ = spliced_list;
+    ++spliced_recording_count_;
+  } else {
+    display_list_ = recorded_list;
+    spliced_recording_count_ = 0;
   }
   display_list_->set_layer_rect(recorded_viewport_);
   is_suitable_for_gpu_rasterization_ =
@@ -153,6 +194,7 @@ void DisplayListRecordingSource::Clear() {
   recorded_viewport_ = gfx::Rect();
   display_list_ = NULL;
   is_solid_color_ = false;
+  spliced_recording_count_ = 0;
 }
 
 }  // namespace cc
@@ -56,6 +56,9 @@ class CC_EXPORT DisplayListRecordingSource : public RecordingSource {
 
   bool is_suitable_for_gpu_rasterization_;
 
+  // Number of partial recordings spliced on top of the last full recording.
+  int spliced_recording_count_;
+
   DISALLOW_COPY_AND_ASSIGN(DisplayListRecordingSource);
 };
 
@@ -5,7 +5,6 @@
 #ifndef CC_RESOURCES_DRAWING_DISPLAY_ITEM_H_
 #define CC_RESOURCES_DRAWING_DISPLAY_ITEM_H_
 
-#include "base/memory/scoped_ptr.h"
 #include "cc/base/cc_export.h"
 #include "cc/resources/display_item.h"
 #include "skia/ext/refptr.h"
@@ -21,9 +20,9 @@ class CC_EXPORT DrawingDisplayItem : public DisplayItem {
  public:
   ~DrawingDisplayItem() override;
 
-  static scoped_ptr<DrawingDisplayItem> Create(skia::RefPtr<SkPicture> picture,
-                                               gfx::PointF location) {
-    return make_scoped_ptr(new DrawingDisplayItem(picture, location));
+  static DrawingDisplayItem Create(skia::RefPtr<SkPicture> picture,
+                                   gfx::PointF location) {
+    return DrawingDisplayItem(picture, location);
   }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
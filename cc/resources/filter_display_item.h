@@ -5,15 +5,14 @@
 #ifndef CC_RESOURCES_FILTER_DISPLAY_ITEM_H_
 #define CC_RESOURCES_FILTER_DISPLAY_ITEM_H_
 
-#include "base/memory/scoped_ptr.h"
 #include "cc/base/cc_export.h"
 #include "cc/resources/display_item.h"
 #include "skia/ext/refptr.h"
+#include "third_party/skia/include/core/SkImageFilter.h"
 #include "ui/gfx/geometry/rect_f.h"
 
 class SkCanvas;
 class SkDrawPictureCallback;
-class SkImageFilter;
 
 namespace cc {
 
@@ -21,10 +20,9 @@ class CC_EXPORT FilterDisplayItem : public DisplayItem {
  public:
   ~FilterDisplayItem() override;
 
-  static scoped_ptr<FilterDisplayItem> Create(
-      skia::RefPtr<SkImageFilter> filter,
-      gfx::RectF bounds) {
-    return make_scoped_ptr(new FilterDisplayItem(filter, bounds));
+  static FilterDisplayItem Create(skia::RefPtr<SkImageFilter> filter,
+                                  gfx::RectF bounds) {
+    return FilterDisplayItem(filter, bounds);
   }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
@@ -45,9 +43,7 @@ class CC_EXPORT EndFilterDisplayItem : public DisplayItem {
  public:
   ~EndFilterDisplayItem() override;
 
-  static scoped_ptr<EndFilterDisplayItem> Create() {
-    return make_scoped_ptr(new EndFilterDisplayItem());
-  }
+  static EndFilterDisplayItem Create() { return EndFilterDisplayItem(); }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
 
@@ -7,7 +7,6 @@
 
 #include <vector>
 
-#include "base/memory/scoped_ptr.h"
 #include "cc/base/cc_export.h"
 #include "cc/resources/display_item.h"
 #include "ui/gfx/geometry/rect_f.h"
@@ -21,8 +20,8 @@ class CC_EXPORT FloatClipDisplayItem : public DisplayItem {
  public:
   ~FloatClipDisplayItem() override;
 
-  static scoped_ptr<FloatClipDisplayItem> Create(gfx::RectF clip_rect) {
-    return make_scoped_ptr(new FloatClipDisplayItem(clip_rect));
+  static FloatClipDisplayItem Create(gfx::RectF clip_rect) {
+    return FloatClipDisplayItem(clip_rect);
   }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
@@ -42,8 +41,8 @@ class CC_EXPORT EndFloatClipDisplayItem : public DisplayItem {
  public:
   ~EndFloatClipDisplayItem() override;
 
-  static scoped_ptr<EndFloatClipDisplayItem> Create() {
-    return make_scoped_ptr(new EndFloatClipDisplayItem());
+  static EndFloatClipDisplayItem Create() {
+    return EndFloatClipDisplayItem();
   }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
@@ -57,6 +57,8 @@ PictureLayerTiling::PictureLayerTiling(
       resolution_(NON_IDEAL_RESOLUTION),
       tiling_data_(gfx::Size(), gfx::Size(), kBorderTexels),
       last_impl_frame_time_in_seconds_(0.0),
+      visible_edge_velocities_(),
+      has_visible_edge_velocities_(false),
       can_require_tiles_for_activation_(false),
       current_content_to_screen_scale_(0.f),
       has_visible_rect_tiles_(false),
@@ -526,8 +528,7 @@ gfx::Rect PictureLayerTiling::ComputeSkewport(
   if (time_delta == 0.0)
     return skewport;
 
-  double extrapolation_multiplier =
-      skewport_target_time_in_seconds_ / time_delta;
+  double target_time = skewport_target_time_in_seconds_;
 
   int old_x = last_visible_rect_in_content_space_.x();
   int old_y = last_visible_rect_in_content_space_.y();
@@ -545,11 +546,29 @@ gfx::Rect PictureLayerTiling::ComputeSkewport(
   max_skewport.Inset(-skewport_extrapolation_limit_in_content_pixels_,
                      -skewport_extrapolation_limit_in_content_pixels_);
 
+  // Extrapolate where each edge will be |target_time| seconds from now. The
+  // velocity term alone lags an accelerating fling by a frame, so when the
+  // velocities of the previous frame pair are known the change in velocity
+  // is extrapolated as well.
+  double velocities[4];
+  velocities[0] = (new_x - old_x) / time_delta;
+  velocities[1] = (new_y - old_y) / time_delta;
+  velocities[2] = (new_right - old_right) / time_delta;
+  velocities[3] = (new_bottom - old_bottom) / time_delta;
+
+  double displacements[4];
+  for (int i = 0; i < 4; ++i) {
+    displacements[i] = velocities[i] * target_time;
+    if (has_visible_edge_velocities_) {
+      double acceleration =
+          (velocities[i] - visible_edge_velocities_[i]) / time_delta;
+      displacements[i] += 0.5 * acceleration * target_time * target_time;
+    }
+  }
+
   // Inset the skewport by the needed adjustment.
-  skewport.Inset(extrapolation_multiplier * (new_x - old_x),
-                 extrapolation_multiplier * (new_y - old_y),
-                 extrapolation_multiplier * (old_right - new_right),
-                 extrapolation_multiplier * (old_bottom - new_bottom));
+  skewport.Inset(displacements[0], displacements[1], -displacements[2],
+                 -displacements[3]);
 
   // Clip the skewport to |max_skewport|.
   skewport.Intersect(max_skewport);
@@ -578,6 +597,7 @@ bool PictureLayerTiling::ComputeTilePriorityRects(
     last_impl_frame_time_in_seconds_ = current_frame_time_in_seconds;
     last_viewport_in_layer_space_ = viewport_in_layer_space;
     last_visible_rect_in_content_space_ = visible_rect_in_content_space;
+    has_visible_edge_velocities_ = false;
     return false;
   }
 
@@ -608,6 +628,30 @@ bool PictureLayerTiling::ComputeTilePriorityRects(
   float border = kSoonBorderDistanceInScreenPixels / content_to_screen_scale;
   soon_border_rect.Inset(-border, -border, -border, -border);
 
+  // Save the edge velocities of this frame pair, so the next frame's
+  // skewport can extrapolate how they are changing.
+  double time_delta =
+      current_frame_time_in_seconds - last_impl_frame_time_in_seconds_;
+  if (last_impl_frame_time_in_seconds_ != 0.0 && time_delta != 0.0) {
+    visible_edge_velocities_[0] = (visible_rect_in_content_space.x() -
+                                   last_visible_rect_in_content_space_.x()) /
+                                  time_delta;
+    visible_edge_velocities_[1] = (visible_rect_in_content_space.y() -
+                                   last_visible_rect_in_content_space_.y()) /
+                                  time_delta;
+    visible_edge_velocities_[2] =
+        (visible_rect_in_content_space.right() -
+         last_visible_rect_in_content_space_.right()) /
+        time_delta;
+    visible_edge_velocities_[3] =
+        (visible_rect_in_content_space.bottom() -
+         last_visible_rect_in_content_space_.bottom()) /
+        time_delta;
+    has_visible_edge_velocities_ = true;
+  } else {
+    has_visible_edge_velocities_ = false;
+  }
+
   last_impl_frame_time_in_seconds_ = current_frame_time_in_seconds;
   last_viewport_in_layer_space_ = viewport_in_layer_space;
   last_visible_rect_in_content_space_ = visible_rect_in_content_space;
@@ -256,8 +256,11 @@ class CC_EXPORT PictureLayerTiling {
 
   // Computes a skewport. The calculation extrapolates the last visible
   // rect and the current visible rect to expand the skewport to where it
-  // would be in |skewport_target_time| seconds. Note that the skewport
-  // is guaranteed to contain the current visible rect.
+  // would be in |skewport_target_time| seconds. When edge velocities from
+  // the previous frame pair are known, the change in velocity is
+  // extrapolated too, so an accelerating scroll skews ahead of the
+  // viewport instead of trailing one frame behind it. Note that the
+  // skewport is guaranteed to contain the current visible rect.
   gfx::Rect ComputeSkewport(double current_frame_time_in_seconds,
                             const gfx::Rect& visible_rect_in_content_space)
       const;
@@ -298,6 +301,13 @@ class CC_EXPORT PictureLayerTiling {
   gfx::Rect last_viewport_in_layer_space_;
   gfx::Rect last_visible_rect_in_content_space_;
 
+  // Edge velocities (left, top, right, bottom) of the visible rect over the
+  // previous frame pair, in content pixels per second. Only meaningful when
+  // |has_visible_edge_velocities_| is true; used by ComputeSkewport() to
+  // extrapolate acceleration.
+  double visible_edge_velocities_[4];
+  bool has_visible_edge_velocities_;
+
   bool can_require_tiles_for_activation_;
 
   // Iteration rects in content space.
@@ -665,6 +665,47 @@ TEST(PictureLayerTilingTest, ComputeSkewport) {
   EXPECT_EQ(160, expanded_skewport.height());
 }
 
+TEST(PictureLayerTilingTest, SkewportAcceleration) {
+  FakePictureLayerTilingClient client;
+
+  gfx::Rect viewport(0, 0, 100, 100);
+  gfx::Size layer_bounds(200, 200);
+
+  client.SetTileSize(gfx::Size(100, 100));
+  client.set_tree(ACTIVE_TREE);
+
+  scoped_refptr<FakePicturePileImpl> pile =
+      FakePicturePileImpl::CreateFilledPileWithDefaultTileSize(layer_bounds);
+  scoped_ptr<TestablePictureLayerTiling> tiling =
+      TestablePictureLayerTiling::Create(1.0f, pile, &client,
+                                         LayerTreeSettings());
+
+  // Two frames moving down 50 pixels per second establish edge velocities.
+  tiling->ComputeTilePriorityRects(viewport, 1.f, 1.0, Occlusion());
+  tiling->ComputeTilePriorityRects(gfx::Rect(0, 50, 100, 100), 1.f, 2.0,
+                                   Occlusion());
+
+  // At a steady 50 pixels per second the skewport matches the velocity-only
+  // extrapolation: 50 pixels ahead over the one second target time.
+  gfx::Rect steady_skewport =
+      tiling->ComputeSkewport(3.0, gfx::Rect(0, 100, 100, 100));
+
+  EXPECT_EQ(0, steady_skewport.x());
+  EXPECT_EQ(100, steady_skewport.y());
+  EXPECT_EQ(100, steady_skewport.width());
+  EXPECT_EQ(150, steady_skewport.height());
+
+  // Speeding up to 100 pixels per second adds an acceleration term of
+  // 0.5 * 50 * 1^2 = 25 pixels to the velocity extrapolation of 100.
+  gfx::Rect accelerated_skewport =
+      tiling->ComputeSkewport(3.0, gfx::Rect(0, 150, 100, 100));
+
+  EXPECT_EQ(0, accelerated_skewport.x());
+  EXPECT_EQ(150, accelerated_skewport.y());
+  EXPECT_EQ(100, accelerated_skewport.width());
+  EXPECT_EQ(225, accelerated_skewport.height());
+}
+
 TEST(PictureLayerTilingTest, ViewportDistanceWithScale) {
   FakePictureLayerTilingClient client;
 
@@ -0,0 +1,143 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "cc/resources/picture.h"
+
+#include <string>
+
+#include "base/basictypes.h"
+#include "cc/base/region.h"
+#include "cc/debug/lap_timer.h"
+#include "cc/test/fake_content_layer_client.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_test.h"
+#include "third_party/skia/include/core/SkBBHFactory.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+#include "ui/gfx/geometry/rect.h"
+
+namespace cc {
+namespace {
+
+const int kTimeLimitMillis = 2000;
+const int kWarmupRuns = 5;
+const int kTimeCheckInterval = 10;
+
+const int kLayerSize = 1000;
+
+// Deterministic synthetic corpora approximating common kinds of recorded
+// page content.  Run-of-text pages record many small draw ops, image-heavy
+// pages few ops referencing large pixel refs, and simple pages a handful of
+// solid blocks.  The op counts stay fixed between runs so results are
+// comparable across builds.
+struct CorpusSpec {
+  const char* name;
+  int rect_count;
+  int bitmap_count;
+};
+
+const CorpusSpec kCorpora[] = {
+  {"text", 2000, 0},
+  {"blocks", 50, 0},
+  {"images", 20, 16},
+};
+
+class PicturePerfTest : public testing::Test {
+ public:
+  PicturePerfTest()
+      : timer_(kWarmupRuns,
+               base::TimeDelta::FromMilliseconds(kTimeLimitMillis),
+               kTimeCheckInterval) {}
+
+ protected:
+  // Populates |client| with the given numbers of small colored rects and
+  // bitmaps, scattered deterministically across the layer.
+  void BuildCorpusContent(const CorpusSpec& spec,
+                          FakeContentLayerClient* client) {
+    for (int i = 0; i < spec.rect_count; ++i) {
+      SkPaint paint;
+      paint.setColor(
+          SkColorSetARGB(255, i % 255, (i * 7) % 255, (i * 13) % 255));
+      gfx::RectF rect((i * 17) % kLayerSize, (i * 29) % kLayerSize,
+                      10 + i % 60, 4 + i % 12);
+      client->add_draw_rect(rect, paint);
+    }
+    SkPaint bitmap_paint;
+    for (int i = 0; i < spec.bitmap_count; ++i) {
+      SkBitmap bitmap;
+      bitmap.allocN32Pixels(64, 64);
+      bitmap.eraseARGB(255, 0, i % 255, 255 - i % 255);
+      client->add_draw_bitmap(
+          bitmap,
+          gfx::Point((i * 293) % kLayerSize, (i * 379) % kLayerSize),
+          bitmap_paint);
+    }
+  }
+
+  SkTileGridFactory::TileGridInfo DefaultTileGridInfo() {
+    SkTileGridFactory::TileGridInfo tile_grid_info;
+    tile_grid_info.fTileInterval = SkISize::Make(100, 100);
+    tile_grid_info.fMargin.setEmpty();
+    tile_grid_info.fOffset.setZero();
+    return tile_grid_info;
+  }
+
+  void RunRecordTest(const CorpusSpec& spec) {
+    FakeContentLayerClient client;
+    BuildCorpusContent(spec, &client);
+    gfx::Rect layer_rect(kLayerSize, kLayerSize);
+    SkTileGridFactory::TileGridInfo tile_grid_info = DefaultTileGridInfo();
+
+    timer_.Reset();
+    do {
+      scoped_refptr<Picture> picture =
+          Picture::Create(layer_rect, &client, tile_grid_info, false,
+                          Picture::RECORD_NORMALLY);
+      timer_.NextLap();
+    } while (!timer_.HasTimeLimitExpired());
+
+    perf_test::PrintResult(
+        "record_corpus", "", spec.name, timer_.LapsPerSecond(), "runs/s",
+        true);
+  }
+
+  void RunRasterTest(const CorpusSpec& spec) {
+    FakeContentLayerClient client;
+    BuildCorpusContent(spec, &client);
+    gfx::Rect layer_rect(kLayerSize, kLayerSize);
+    scoped_refptr<Picture> picture =
+        Picture::Create(layer_rect, &client, DefaultTileGridInfo(), false,
+                        Picture::RECORD_NORMALLY);
+
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(kLayerSize, kLayerSize);
+    SkCanvas canvas(bitmap);
+
+    timer_.Reset();
+    do {
+      picture->Raster(&canvas, NULL, Region(), 1.0f);
+      timer_.NextLap();
+    } while (!timer_.HasTimeLimitExpired());
+
+    perf_test::PrintResult(
+        "raster_corpus", "", spec.name, timer_.LapsPerSecond(), "runs/s",
+        true);
+  }
+
+ private:
+  LapTimer timer_;
+};
+
+TEST_F(PicturePerfTest, Record) {
+  for (size_t i = 0; i < arraysize(kCorpora); ++i)
+    RunRecordTest(kCorpora[i]);
+}
+
+TEST_F(PicturePerfTest, Raster) {
+  for (size_t i = 0; i < arraysize(kCorpora); ++i)
+    RunRasterTest(kCorpora[i]);
+}
+
+}  // namespace
+}  // namespace cc
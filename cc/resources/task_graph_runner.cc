@@ -13,7 +13,34 @@
 namespace cc {
 namespace {
 
-// Helper class for iterating over all dependents of a task.
+// Orders nodes by task so the node of a given task can be found with a
+// binary search. Also usable with std::lower_bound when searching by task.
+class NodeTaskComparator {
+ public:
+  bool operator()(const TaskGraph::Node& a, const TaskGraph::Node& b) const {
+    return a.task < b.task;
+  }
+  bool operator()(const TaskGraph::Node& node, const Task* task) const {
+    return node.task < task;
+  }
+};
+
+// Orders edges by task so all outgoing edges of a given task form one
+// contiguous range. Also usable with std::lower_bound when searching by task.
+class EdgeTaskComparator {
+ public:
+  bool operator()(const TaskGraph::Edge& a, const TaskGraph::Edge& b) const {
+    return a.task < b.task;
+  }
+  bool operator()(const TaskGraph::Edge& edge, const Task* task) const {
+    return edge.task < task;
+  }
+};
+
+// Helper class for iterating over all dependents of a task. Requires the
+// nodes and edges of |graph| to be sorted by task, as ScheduleTasks()
+// guarantees for scheduled graphs. This keeps the iteration cheap enough to
+// perform while holding the runner lock without serializing the workers.
 class DependentIterator {
  public:
   DependentIterator(TaskGraph* graph, const Task* task)
@@ -21,7 +48,15 @@ class DependentIterator {
         task_(task),
         current_index_(static_cast<size_t>(-1)),
         current_node_(NULL) {
-    ++(*this);
+    // Edges are sorted by task, so the edges of |task_| start at the lower
+    // bound and the iteration below ends at the first mismatch.
+    current_index_ = static_cast<size_t>(
+        std::lower_bound(graph_->edges.begin(),
+                         graph_->edges.end(),
+                         task_,
+                         EdgeTaskComparator()) -
+        graph_->edges.begin());
+    UpdateCurrentNode();
   }
 
   TaskGraph::Node& operator->() const {
@@ -38,30 +73,35 @@ class DependentIterator {
     return *current_node_;
   }
 
-  // Note: Performance can be improved by keeping edges sorted.
   DependentIterator& operator++() {
-    // Find next dependency edge for |task_|.
-    do {
-      ++current_index_;
-      if (current_index_ == graph_->edges.size())
-        return *this;
-    } while (graph_->edges[current_index_].task != task_);
-
-    // Now find the node for the dependent of this edge.
-    TaskGraph::Node::Vector::iterator it =
-        std::find_if(graph_->nodes.begin(),
-                     graph_->nodes.end(),
-                     TaskGraph::Node::TaskComparator(
-                         graph_->edges[current_index_].dependent));
-    DCHECK(it != graph_->nodes.end());
-    current_node_ = &(*it);
-
+    ++current_index_;
+    UpdateCurrentNode();
     return *this;
   }
 
   operator bool() const { return current_index_ < graph_->edges.size(); }
 
  private:
+  void UpdateCurrentNode() {
+    if (current_index_ == graph_->edges.size() ||
+        graph_->edges[current_index_].task != task_) {
+      current_index_ = graph_->edges.size();
+      current_node_ = NULL;
+      return;
+    }
+
+    // Nodes are sorted by task as well, so find the node for the dependent
+    // of this edge with a binary search.
+    TaskGraph::Node::Vector::iterator it =
+        std::lower_bound(graph_->nodes.begin(),
+                         graph_->nodes.end(),
+                         graph_->edges[current_index_].dependent,
+                         NodeTaskComparator());
+    DCHECK(it != graph_->nodes.end());
+    DCHECK_EQ(it->task, graph_->edges[current_index_].dependent);
+    current_node_ = &(*it);
+  }
+
   TaskGraph* graph_;
   const Task* task_;
   size_t current_index_;
@@ -176,6 +216,13 @@ void TaskGraphRunner::ScheduleTasks(NamespaceToken token, TaskGraph* graph) {
                       DependencyMismatchComparator(graph)) ==
          graph->nodes.end());
 
+  // Sort nodes and edges by task before taking |lock_|, so that dependents
+  // can be found with binary searches while the lock is held. Workers walk
+  // the graph under the lock after every task, so this is what keeps them
+  // from contending on many-core devices.
+  std::sort(graph->nodes.begin(), graph->nodes.end(), NodeTaskComparator());
+  std::sort(graph->edges.begin(), graph->edges.end(), EdgeTaskComparator());
+
   {
     base::AutoLock lock(lock_);
 
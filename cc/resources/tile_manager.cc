@@ -172,6 +172,11 @@ class ImageDecodeTaskImpl : public ImageDecodeTask {
   DISALLOW_COPY_AND_ASSIGN(ImageDecodeTaskImpl);
 };
 
+bool IsLowResolutionPreviewTile(const Tile* tile) {
+  return tile->combined_priority().resolution == LOW_RESOLUTION &&
+         !tile->required_for_activation() && !tile->required_for_draw();
+}
+
 const char* TaskSetName(TaskSet task_set) {
   switch (task_set) {
     case TileManager::ALL:
@@ -673,6 +678,16 @@ void TileManager::AssignGpuMemoryToTiles(
 
   raster_priority_queue_.Reset();
 
+  // Move low resolution preview tiles behind everything else so they occupy
+  // the lowest raster task priorities. Memory and scheduling slots were
+  // already assigned above, so this doesn't change which tiles get
+  // rasterized; it only prevents preview tiles from delaying tiles that
+  // block activation or draw in the shared raster pool.
+  std::stable_partition(
+      tiles_that_need_to_be_rasterized->begin(),
+      tiles_that_need_to_be_rasterized->end(),
+      [](const Tile* tile) { return !IsLowResolutionPreviewTile(tile); });
+
   TRACE_EVENT_END2("cc", "TileManager::AssignGpuMemoryToTiles",
                    "all_tiles_that_need_to_be_rasterized_are_scheduled",
                    all_tiles_that_need_to_be_rasterized_are_scheduled_,
@@ -779,6 +794,26 @@ scoped_refptr<RasterTask> TileManager::CreateRasterTask(Tile* tile) {
       continue;
     }
 
+    // The same image is often shared between layers. Reuse a decode task
+    // already scheduled for another layer instead of having two workers
+    // race to decode the same pixels; the loser would only block on the
+    // pixel ref lock. The task is deliberately not added to this layer's
+    // map as cancellation cleanup only knows about the task's own layer.
+    scoped_refptr<ImageDecodeTask> shared_decode_task;
+    for (LayerPixelRefTaskMap::iterator layer_it = image_decode_tasks_.begin();
+         layer_it != image_decode_tasks_.end() && !shared_decode_task.get();
+         ++layer_it) {
+      if (layer_it->first == tile->layer_id())
+        continue;
+      PixelRefTaskMap::iterator task_it = layer_it->second.find(id);
+      if (task_it != layer_it->second.end())
+        shared_decode_task = task_it->second;
+    }
+    if (shared_decode_task.get()) {
+      decode_tasks.push_back(shared_decode_task);
+      continue;
+    }
+
     // Create and append new image decode task for this pixel ref.
     scoped_refptr<ImageDecodeTask> decode_task =
         CreateImageDecodeTask(tile, pixel_ref);
@@ -5,7 +5,6 @@
 #ifndef CC_RESOURCES_TRANSFORM_DISPLAY_ITEM_H_
 #define CC_RESOURCES_TRANSFORM_DISPLAY_ITEM_H_
 
-#include "base/memory/scoped_ptr.h"
 #include "cc/base/cc_export.h"
 #include "cc/resources/display_item.h"
 #include "ui/gfx/transform.h"
@@ -19,9 +18,8 @@ class CC_EXPORT TransformDisplayItem : public DisplayItem {
  public:
   ~TransformDisplayItem() override;
 
-  static scoped_ptr<TransformDisplayItem> Create(
-      const gfx::Transform& transform) {
-    return make_scoped_ptr(new TransformDisplayItem(transform));
+  static TransformDisplayItem Create(const gfx::Transform& transform) {
+    return TransformDisplayItem(transform);
   }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
@@ -41,8 +39,8 @@ class CC_EXPORT EndTransformDisplayItem : public DisplayItem {
  public:
   ~EndTransformDisplayItem() override;
 
-  static scoped_ptr<EndTransformDisplayItem> Create() {
-    return make_scoped_ptr(new EndTransformDisplayItem());
+  static EndTransformDisplayItem Create() {
+    return EndTransformDisplayItem();
   }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
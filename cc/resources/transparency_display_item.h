@@ -5,7 +5,6 @@
 #ifndef CC_RESOURCES_TRANSPARENCY_DISPLAY_ITEM_H_
 #define CC_RESOURCES_TRANSPARENCY_DISPLAY_ITEM_H_
 
-#include "base/memory/scoped_ptr.h"
 #include "cc/base/cc_export.h"
 #include "cc/resources/display_item.h"
 #include "skia/ext/refptr.h"
@@ -21,10 +20,9 @@ class CC_EXPORT TransparencyDisplayItem : public DisplayItem {
  public:
   ~TransparencyDisplayItem() override;
 
-  static scoped_ptr<TransparencyDisplayItem> Create(
-      float opacity,
-      SkXfermode::Mode blend_mode) {
-    return make_scoped_ptr(new TransparencyDisplayItem(opacity, blend_mode));
+  static TransparencyDisplayItem Create(float opacity,
+                                        SkXfermode::Mode blend_mode) {
+    return TransparencyDisplayItem(opacity, blend_mode);
   }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
@@ -45,8 +43,8 @@ class CC_EXPORT EndTransparencyDisplayItem : public DisplayItem {
  public:
   ~EndTransparencyDisplayItem() override;
 
-  static scoped_ptr<EndTransparencyDisplayItem> Create() {
-    return make_scoped_ptr(new EndTransparencyDisplayItem());
+  static EndTransparencyDisplayItem Create() {
+    return EndTransparencyDisplayItem();
   }
 
   void Raster(SkCanvas* canvas, SkDrawPictureCallback* callback) const override;
@@ -145,36 +145,65 @@ static ResourceProvider::ResourceId ResourceRemapHelper(
   return remapped_id;
 }
 
+SurfaceAggregator::RemappedFrameData::RemappedFrameData() : frame_index(0) {
+}
+
+SurfaceAggregator::RemappedFrameData::~RemappedFrameData() {
+}
+
 bool SurfaceAggregator::TakeResources(Surface* surface,
                                       const DelegatedFrameData* frame_data,
-                                      RenderPassList* render_pass_list) {
-  RenderPass::CopyAll(frame_data->render_pass_list, render_pass_list);
-  if (!provider_)  // TODO(jamesr): hack for unit tests that don't set up rp
-    return false;
-
-  int child_id = ChildIdForSurface(surface);
-  if (surface->factory())
-    surface->factory()->RefResources(frame_data->resource_list);
-  provider_->ReceiveFromChild(child_id, frame_data->resource_list);
-
-  typedef ResourceProvider::ResourceIdArray IdArray;
-  IdArray referenced_resources;
-
-  bool invalid_frame = false;
-  DrawQuad::ResourceIteratorCallback remap =
-      base::Bind(&ResourceRemapHelper,
-                 &invalid_frame,
-                 provider_->GetChildToParentMap(child_id),
-                 &referenced_resources);
-  for (const auto& render_pass : *render_pass_list) {
-    for (const auto& quad : render_pass->quad_list)
-      quad->IterateResources(remap);
+                                      const RenderPassList** render_pass_list) {
+  // Resources are reffed and received for every aggregation to keep them
+  // alive while the aggregated frame is in flight, but the per-quad copy and
+  // resource id remapping below only needs to be redone when the surface
+  // displays a new frame.
+  if (provider_) {
+    int child_id = ChildIdForSurface(surface);
+    if (surface->factory())
+      surface->factory()->RefResources(frame_data->resource_list);
+    provider_->ReceiveFromChild(child_id, frame_data->resource_list);
   }
 
-  if (!invalid_frame)
-    provider_->DeclareUsedResourcesFromChild(child_id, referenced_resources);
+  RemappedFrameData* remapped_frame =
+      remapped_frames_.get(surface->surface_id());
+  if (!remapped_frame ||
+      remapped_frame->frame_index != surface->frame_index()) {
+    scoped_ptr<RemappedFrameData> new_frame(new RemappedFrameData);
+    new_frame->frame_index = surface->frame_index();
+    RenderPass::CopyAll(frame_data->render_pass_list, &new_frame->passes);
+
+    // TODO(jamesr): hack for unit tests that don't set up rp
+    if (provider_) {
+      bool invalid_frame = false;
+      DrawQuad::ResourceIteratorCallback remap =
+          base::Bind(&ResourceRemapHelper,
+                     &invalid_frame,
+                     provider_->GetChildToParentMap(
+                         ChildIdForSurface(surface)),
+                     &new_frame->referenced_resources);
+      for (const auto& render_pass : new_frame->passes) {
+        for (const auto& quad : render_pass->quad_list)
+          quad->IterateResources(remap);
+      }
 
-  return invalid_frame;
+      if (invalid_frame) {
+        remapped_frames_.erase(surface->surface_id());
+        return true;
+      }
+    }
+
+    remapped_frame = new_frame.get();
+    remapped_frames_.set(surface->surface_id(), new_frame.Pass());
+  }
+
+  if (provider_) {
+    provider_->DeclareUsedResourcesFromChild(
+        ChildIdForSurface(surface), remapped_frame->referenced_resources);
+  }
+
+  *render_pass_list = &remapped_frame->passes;
+  return false;
 }
 
 gfx::Rect SurfaceAggregator::DamageRectForSurface(const Surface* surface,
@@ -214,7 +243,7 @@ void SurfaceAggregator::HandleSurfaceQuad(
   std::multimap<RenderPassId, CopyOutputRequest*> copy_requests;
   surface->TakeCopyOutputRequests(&copy_requests);
 
-  RenderPassList render_pass_list;
+  const RenderPassList* render_pass_list = nullptr;
   bool invalid_frame = TakeResources(surface, frame_data, &render_pass_list);
   if (invalid_frame) {
     for (auto& request : copy_requests) {
@@ -228,7 +257,7 @@ void SurfaceAggregator::HandleSurfaceQuad(
 
   bool merge_pass = surface_quad->opacity() == 1.f && copy_requests.empty();
 
-  const RenderPassList& referenced_passes = render_pass_list;
+  const RenderPassList& referenced_passes = *render_pass_list;
   size_t passes_to_copy =
       merge_pass ? referenced_passes.size() - 1 : referenced_passes.size();
   for (size_t j = 0; j < passes_to_copy; ++j) {
@@ -264,7 +293,7 @@ void SurfaceAggregator::HandleSurfaceQuad(
     dest_pass_list_->push_back(copy_pass.Pass());
   }
 
-  const RenderPass& last_pass = *render_pass_list.back();
+  const RenderPass& last_pass = *render_pass_list->back();
   if (merge_pass) {
     // TODO(jamesr): Clean up last pass special casing.
     const QuadList& quads = last_pass.quad_list;
@@ -389,18 +418,17 @@ void SurfaceAggregator::CopyQuadsToPass(
 
 void SurfaceAggregator::CopyPasses(const DelegatedFrameData* frame_data,
                                    Surface* surface) {
-  RenderPassList source_pass_list;
-
   // The root surface is allowed to have copy output requests, so grab them
   // off its render passes.
   std::multimap<RenderPassId, CopyOutputRequest*> copy_requests;
   surface->TakeCopyOutputRequests(&copy_requests);
 
+  const RenderPassList* source_pass_list = nullptr;
   bool invalid_frame = TakeResources(surface, frame_data, &source_pass_list);
   DCHECK(!invalid_frame);
 
-  for (size_t i = 0; i < source_pass_list.size(); ++i) {
-    const RenderPass& source = *source_pass_list[i];
+  for (size_t i = 0; i < source_pass_list->size(); ++i) {
+    const RenderPass& source = *(*source_pass_list)[i];
 
     size_t sqs_size = source.shared_quad_state_list.size();
     size_t dq_size = source.quad_list.size();
@@ -433,6 +461,7 @@ void SurfaceAggregator::RemoveUnreferencedChildren() {
         provider_->DestroyChild(it->second);
         surface_id_to_resource_child_id_.erase(it);
       }
+      remapped_frames_.erase(surface.first);
     }
   }
 }
@@ -490,6 +519,7 @@ void SurfaceAggregator::ReleaseResources(SurfaceId surface_id) {
     provider_->DestroyChild(it->second);
     surface_id_to_resource_child_id_.erase(it);
   }
+  remapped_frames_.erase(surface_id);
 }
 
 }  // namespace cc
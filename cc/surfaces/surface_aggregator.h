@@ -11,6 +11,7 @@
 #include "base/containers/scoped_ptr_hash_map.h"
 #include "base/memory/scoped_ptr.h"
 #include "cc/quads/render_pass.h"
+#include "cc/resources/resource_provider.h"
 #include "cc/resources/transferable_resource.h"
 #include "cc/surfaces/surface_id.h"
 #include "cc/surfaces/surfaces_export.h"
@@ -19,7 +20,6 @@ namespace cc {
 
 class CompositorFrame;
 class DelegatedFrameData;
-class ResourceProvider;
 class Surface;
 class SurfaceDrawQuad;
 class SurfaceManager;
@@ -76,7 +76,7 @@ class CC_SURFACES_EXPORT SurfaceAggregator {
 
   bool TakeResources(Surface* surface,
                      const DelegatedFrameData* frame_data,
-                     RenderPassList* render_pass_list);
+                     const RenderPassList** render_pass_list);
   int ChildIdForSurface(Surface* surface);
   gfx::Rect DamageRectForSurface(const Surface* surface,
                                  const RenderPass& source,
@@ -94,6 +94,25 @@ class CC_SURFACES_EXPORT SurfaceAggregator {
   typedef base::hash_map<SurfaceId, int> SurfaceToResourceChildIdMap;
   SurfaceToResourceChildIdMap surface_id_to_resource_child_id_;
 
+  // A copy of a surface's current frame whose quads have had their resource
+  // ids remapped into the parent namespace. Kept between aggregations so
+  // surfaces that still display the same frame don't pay the per-quad copy
+  // and remapping cost again.
+  struct RemappedFrameData {
+    RemappedFrameData();
+    ~RemappedFrameData();
+
+    int frame_index;
+    RenderPassList passes;
+    ResourceProvider::ResourceIdArray referenced_resources;
+
+   private:
+    DISALLOW_COPY_AND_ASSIGN(RemappedFrameData);
+  };
+  typedef base::ScopedPtrHashMap<SurfaceId, RemappedFrameData>
+      RemappedFrameMap;
+  RemappedFrameMap remapped_frames_;
+
   // The following state is only valid for the duration of one Aggregate call
   // and is only stored on the class to avoid having to pass through every
   // function call.
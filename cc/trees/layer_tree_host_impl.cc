@@ -225,6 +225,7 @@ LayerTreeHostImpl::LayerTreeHostImpl(
       begin_impl_frame_interval_(BeginFrameArgs::DefaultInterval()),
       animation_registrar_(AnimationRegistrar::Create()),
       rendering_stats_instrumentation_(rendering_stats_instrumentation),
+      swap_buffers_overlapped_(false),
       micro_benchmark_controller_(this),
       shared_bitmap_manager_(shared_bitmap_manager),
       gpu_memory_buffer_manager_(gpu_memory_buffer_manager),
@@ -1405,10 +1406,17 @@ void LayerTreeHostImpl::SetNeedsRedrawRect(const gfx::Rect& damage_rect) {
 }
 
 void LayerTreeHostImpl::DidSwapBuffers() {
+  swap_buffers_overlapped_ = !swap_buffers_time_.is_null();
+  swap_buffers_time_ = base::TimeTicks::HighResNow();
   client_->DidSwapBuffersOnImplThread();
 }
 
 void LayerTreeHostImpl::DidSwapBuffersComplete() {
+  if (!swap_buffers_time_.is_null() && !swap_buffers_overlapped_) {
+    rendering_stats_instrumentation_->AddSwapDuration(
+        base::TimeTicks::HighResNow() - swap_buffers_time_);
+  }
+  swap_buffers_time_ = base::TimeTicks();
   client_->DidSwapBuffersCompleteOnImplThread();
 }
 
@@ -2054,9 +2062,11 @@ void LayerTreeHostImpl::CreateResourceAndTileTaskWorkerPool(
         context_provider->ContextCapabilities().gpu.egl_image_external);
 
     if (settings_.use_zero_copy || IsSynchronousSingleThreaded()) {
-      *resource_pool =
-          ResourcePool::Create(resource_provider_.get(), image_target,
-                               resource_provider_->best_texture_format());
+      // GpuMemoryBuffers supports all the formats raster can playback to,
+      // including RGBA_4444, so the memory efficient format can be used.
+      *resource_pool = ResourcePool::Create(
+          resource_provider_.get(), image_target,
+          resource_provider_->memory_efficient_texture_format());
 
       TaskGraphRunner* task_graph_runner;
       if (IsSynchronousSingleThreaded()) {
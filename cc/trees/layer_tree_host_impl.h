@@ -712,6 +712,13 @@ class CC_EXPORT LayerTreeHostImpl
   scoped_ptr<AnimationRegistrar> animation_registrar_;
 
   RenderingStatsInstrumentation* rendering_stats_instrumentation_;
+
+  // Time of the last SwapBuffers, used to report the swap-to-ack duration to
+  // the frame timeline. Overlapping swaps are not timed since their acks
+  // can't be attributed to a single swap.
+  base::TimeTicks swap_buffers_time_;
+  bool swap_buffers_overlapped_;
+
   MicroBenchmarkControllerImpl micro_benchmark_controller_;
   scoped_ptr<TaskGraphRunner> single_thread_synchronous_task_graph_runner_;
 
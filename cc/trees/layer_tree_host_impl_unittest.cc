@@ -3052,6 +3052,38 @@ TEST_F(LayerTreeHostImplTest, ScrollBlockedByContentLayer) {
                                     InputHandler::Wheel));
 }
 
+TEST_F(LayerTreeHostImplTest, ScrollNotBlockedByFixedContentLayer) {
+  gfx::Size surface_size(10, 10);
+  scoped_ptr<LayerImpl> clip_layer =
+      LayerImpl::Create(host_impl_->active_tree(), 3);
+  scoped_ptr<LayerImpl> content_layer =
+      CreateScrollableLayer(1, surface_size, clip_layer.get());
+  content_layer->SetShouldScrollOnMainThread(true);
+  content_layer->SetScrollClipLayer(Layer::INVALID_ID);
+
+  // A fixed-position layer does not move when its scroll ancestor scrolls, so
+  // its main thread bit should not divert the ancestor's scroll.
+  LayerPositionConstraint fixed_to_container;
+  fixed_to_container.set_is_fixed_position(true);
+  content_layer->SetPositionConstraint(fixed_to_container);
+
+  scoped_ptr<LayerImpl> scroll_layer =
+      CreateScrollableLayer(2, surface_size, clip_layer.get());
+  LayerImpl* scroll_layer_ptr = scroll_layer.get();
+  scroll_layer->AddChild(content_layer.Pass());
+  clip_layer->AddChild(scroll_layer.Pass());
+  clip_layer->SetHasRenderSurface(true);
+
+  host_impl_->active_tree()->SetRootLayer(clip_layer.Pass());
+  host_impl_->SetViewportSize(surface_size);
+  DrawFrame();
+
+  EXPECT_EQ(InputHandler::ScrollStarted,
+            host_impl_->ScrollBegin(gfx::Point(5, 5),
+                                    InputHandler::Wheel));
+  EXPECT_EQ(scroll_layer_ptr, host_impl_->CurrentlyScrollingLayer());
+}
+
 TEST_F(LayerTreeHostImplTest, ScrollRootAndChangePageScaleOnMainThread) {
   gfx::Size surface_size(20, 20);
   gfx::Size viewport_size(10, 10);
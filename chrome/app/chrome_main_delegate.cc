@@ -104,6 +104,7 @@
 
 #if defined(OS_LINUX)
 #include "base/environment.h"
+#include "chrome/app/startup_prefetch_linux.h"
 #endif
 
 #if defined(OS_MACOSX) || defined(OS_WIN)
@@ -681,6 +682,20 @@ void ChromeMainDelegate::PreSandboxStartup() {
   base::CPU cpu_info;
 #endif
 
+#if defined(OS_LINUX)
+  // Ask the kernel to read ahead the parts of the binary and the startup
+  // data files the browser is about to fault in, before anything else pages
+  // through them at random. Child processes share the warmed page cache, so
+  // only the browser process prefetches. Skipped while recording a manifest,
+  // which would otherwise see every prefetched page as touched.
+  if (process_type.empty() &&
+      !command_line.HasSwitch(switches::kRecordStartupPrefetchManifest)) {
+    base::FilePath exe_dir;
+    if (PathService::Get(base::DIR_EXE, &exe_dir))
+      startup_prefetch::PrefetchForStartup(exe_dir);
+  }
+#endif
+
   // Initialize the user data dir for any process type that needs it.
   if (chrome::ProcessNeedsProfileDir(process_type))
     InitializeUserDataDir();
@@ -0,0 +1,165 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "chrome/app/startup_prefetch_linux.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/logging.h"
+#include "base/process/process_metrics.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+#include "base/strings/stringprintf.h"
+
+namespace startup_prefetch {
+
+namespace {
+
+// The manifest holds one range per line: "<file> <offset> <length>", where
+// <file> is relative to the directory holding the manifest. Recording page
+// residency loses the original fault order, but the ranges are emitted in
+// file order, which is what the kernel's readahead handles best anyway.
+const base::FilePath::CharType kManifestName[] =
+    FILE_PATH_LITERAL("chrome.prefetch");
+
+// The files that dominate cold-start page faults of the browser process.
+const base::FilePath::CharType* const kStartupFiles[] = {
+  FILE_PATH_LITERAL("chrome"),
+  FILE_PATH_LITERAL("icudtl.dat"),
+  FILE_PATH_LITERAL("natives_blob.bin"),
+  FILE_PATH_LITERAL("snapshot_blob.bin"),
+};
+
+// Advises the kernel to read |length| bytes of |file| at |offset| into the
+// page cache. A |length| of zero advises the whole file.
+bool AdviseWillNeed(base::File* file, int64 offset, int64 length) {
+  return posix_fadvise(file->GetPlatformFile(), offset, length,
+                       POSIX_FADV_WILLNEED) == 0;
+}
+
+// Appends manifest lines for the page-cache-resident ranges of |path|.
+void AppendResidentRanges(const base::FilePath& path,
+                          const std::string& name,
+                          std::string* manifest) {
+  base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (!file.IsValid())
+    return;
+  const int64 length = file.GetLength();
+  if (length <= 0)
+    return;
+
+  // A fresh mapping is enough for mincore() to report page cache residency;
+  // PROT_NONE guarantees we cannot fault anything in ourselves.
+  void* mapping = mmap(NULL, length, PROT_NONE, MAP_PRIVATE,
+                       file.GetPlatformFile(), 0);
+  if (mapping == MAP_FAILED) {
+    DPLOG(WARNING) << "Could not map " << path.value() << " for recording.";
+    return;
+  }
+
+  const int64 page_size = base::GetPageSize();
+  const size_t num_pages = (length + page_size - 1) / page_size;
+  std::vector<unsigned char> resident(num_pages);
+  if (mincore(mapping, length, &resident[0]) == 0) {
+    size_t run_start = 0;
+    bool in_run = false;
+    for (size_t i = 0; i <= num_pages; ++i) {
+      const bool is_resident = i < num_pages && (resident[i] & 1);
+      if (is_resident && !in_run) {
+        run_start = i;
+        in_run = true;
+      } else if (!is_resident && in_run) {
+        in_run = false;
+        const int64 run_offset = run_start * page_size;
+        const int64 run_length =
+            std::min(static_cast<int64>(i) * page_size, length) - run_offset;
+        base::StringAppendF(manifest, "%s %s %s\n", name.c_str(),
+                            base::Int64ToString(run_offset).c_str(),
+                            base::Int64ToString(run_length).c_str());
+      }
+    }
+  } else {
+    DPLOG(WARNING) << "mincore failed for " << path.value();
+  }
+  munmap(mapping, length);
+}
+
+}  // namespace
+
+bool PrefetchForStartup(const base::FilePath& exe_dir) {
+  std::string manifest;
+  if (!base::ReadFileToString(exe_dir.Append(kManifestName), &manifest)) {
+    // No recorded manifest; fault the startup files in whole. This still
+    // replaces seeky demand paging with sequential reads.
+    bool prefetched_any = false;
+    for (size_t i = 0; i < arraysize(kStartupFiles); ++i) {
+      base::File file(exe_dir.Append(kStartupFiles[i]),
+                      base::File::FLAG_OPEN | base::File::FLAG_READ);
+      if (file.IsValid() && AdviseWillNeed(&file, 0, 0))
+        prefetched_any = true;
+    }
+    return prefetched_any;
+  }
+
+  std::vector<std::string> lines;
+  base::SplitString(manifest, '\n', &lines);
+
+  // Ranges for one file are adjacent in a recorded manifest, so keeping the
+  // last file open avoids reopening it for every range.
+  base::File file;
+  std::string open_name;
+  bool prefetched_any = false;
+  for (size_t i = 0; i < lines.size(); ++i) {
+    std::vector<std::string> fields;
+    base::SplitString(lines[i], ' ', &fields);
+    int64 offset;
+    int64 length;
+    if (fields.size() != 3 || fields[0].empty() ||
+        fields[0].find('/') != std::string::npos ||
+        !base::StringToInt64(fields[1], &offset) ||
+        !base::StringToInt64(fields[2], &length) ||
+        offset < 0 || length <= 0) {
+      if (!lines[i].empty())
+        DLOG(WARNING) << "Malformed prefetch manifest line: " << lines[i];
+      continue;
+    }
+    if (fields[0] != open_name) {
+      file = base::File(exe_dir.Append(fields[0]),
+                        base::File::FLAG_OPEN | base::File::FLAG_READ).Pass();
+      open_name = fields[0];
+    }
+    if (file.IsValid() && AdviseWillNeed(&file, offset, length))
+      prefetched_any = true;
+  }
+  return prefetched_any;
+}
+
+bool RecordStartupManifest(const base::FilePath& exe_dir) {
+  std::string manifest;
+  for (size_t i = 0; i < arraysize(kStartupFiles); ++i) {
+    AppendResidentRanges(exe_dir.Append(kStartupFiles[i]), kStartupFiles[i],
+                         &manifest);
+  }
+  if (manifest.empty())
+    return false;
+
+  const base::FilePath manifest_path = exe_dir.Append(kManifestName);
+  const int size = static_cast<int>(manifest.size());
+  if (base::WriteFile(manifest_path, manifest.data(), size) != size) {
+    DLOG(WARNING) << "Could not write " << manifest_path.value();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace startup_prefetch
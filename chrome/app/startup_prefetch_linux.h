@@ -0,0 +1,33 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CHROME_APP_STARTUP_PREFETCH_LINUX_H_
+#define CHROME_APP_STARTUP_PREFETCH_LINUX_H_
+
+namespace base {
+class FilePath;
+}
+
+// Cold starts on rotating media are dominated by the essentially random
+// order in which the chrome binary and its startup data files (ICU data,
+// V8 snapshots) are faulted in. These functions let the kernel fetch the
+// needed ranges ahead of time with large sequential reads instead.
+namespace startup_prefetch {
+
+// Asks the kernel to read ahead the file ranges recorded in the prefetch
+// manifest found next to the binary in |exe_dir|. Without a manifest, the
+// known startup-critical files are prefetched whole. The advice is
+// asynchronous; this does not wait for the data to arrive. Returns false if
+// nothing could be prefetched.
+bool PrefetchForStartup(const base::FilePath& exe_dir);
+
+// Writes the prefetch manifest for |exe_dir| by recording which pages of
+// the startup files are currently resident in the page cache, coalesced
+// into ranges. Meant to run once startup has settled, on a thread that is
+// allowed to block. Returns true if the manifest was written.
+bool RecordStartupManifest(const base::FilePath& exe_dir);
+
+}  // namespace startup_prefetch
+
+#endif  // CHROME_APP_STARTUP_PREFETCH_LINUX_H_
@@ -0,0 +1,269 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Performance tests for the omnibox providers that answer synchronously from
+// profile-derived indexes.  Each test builds a synthetic large profile and
+// simulates typing a set of queries one keystroke at a time, reporting the
+// mean and 99th-percentile time spent in AutocompleteProvider::Start().  The
+// corpus is generated deterministically so results are comparable between
+// runs and builds.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "base/format_macros.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/message_loop/message_loop.h"
+#include "base/strings/stringprintf.h"
+#include "base/strings/utf_string_conversions.h"
+#include "base/time/time.h"
+#include "base/timer/elapsed_timer.h"
+#include "chrome/browser/autocomplete/bookmark_provider.h"
+#include "chrome/browser/autocomplete/chrome_autocomplete_scheme_classifier.h"
+#include "chrome/browser/autocomplete/history_quick_provider.h"
+#include "chrome/browser/autocomplete/shortcuts_backend.h"
+#include "chrome/browser/autocomplete/shortcuts_backend_factory.h"
+#include "chrome/browser/autocomplete/shortcuts_provider.h"
+#include "chrome/browser/history/history_backend.h"
+#include "chrome/browser/history/history_database.h"
+#include "chrome/browser/history/history_service.h"
+#include "chrome/browser/history/history_service_factory.h"
+#include "chrome/browser/history/in_memory_url_index.h"
+#include "chrome/browser/search_engines/chrome_template_url_service_client.h"
+#include "chrome/browser/search_engines/template_url_service_factory.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/bookmarks/browser/bookmark_model.h"
+#include "components/bookmarks/test/test_bookmark_client.h"
+#include "components/metrics/proto/omnibox_event.pb.h"
+#include "components/omnibox/autocomplete_input.h"
+#include "components/omnibox/autocomplete_match.h"
+#include "components/search_engines/search_terms_data.h"
+#include "components/search_engines/template_url_service.h"
+#include "content/public/test/test_browser_thread.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_test.h"
+#include "ui/base/page_transition_types.h"
+
+using base::ASCIIToUTF16;
+using base::Time;
+using base::TimeDelta;
+using content::BrowserThread;
+
+namespace {
+
+// Profile sizes.  The history corpus is deliberately far larger than any
+// provider's result limit so that per-keystroke costs which scale with
+// profile size show up clearly.
+const size_t kHistoryURLCount = 100000;
+const size_t kShortcutCount = 10000;
+const size_t kBookmarkCount = 10000;
+
+// How many times each query is retyped.  More repetitions smooth out the
+// percentile estimates.
+const size_t kTypingRepetitions = 5;
+
+// Words combined to form synthetic URLs and titles.  The queries below are
+// drawn from this list so that short inputs match broad swaths of the corpus,
+// which is the expensive case for the providers.
+const char* const kCorpusWords[] = {
+  "red", "orange", "yellow", "green", "blue", "violet", "brown", "black",
+  "cats", "dogs", "birds", "fish", "mice", "horses", "sheep", "goats",
+};
+
+// Simulated user inputs, typed one character at a time.
+const char* const kQueries[] = {
+  "red",
+  "green",
+  "blue fish",
+  "cats",
+  "horses",
+  "orange dogs",
+  "bl",
+  "go",
+};
+
+const size_t kNumWords = arraysize(kCorpusWords);
+
+std::string SyntheticURL(size_t i) {
+  return base::StringPrintf(
+      "http://www.%s%s.com/%s/%" PRIuS,
+      kCorpusWords[i % kNumWords],
+      kCorpusWords[(i / kNumWords) % kNumWords],
+      kCorpusWords[(i / (kNumWords * kNumWords)) % kNumWords],
+      i);
+}
+
+std::string SyntheticTitle(size_t i) {
+  return base::StringPrintf(
+      "%s %s %s",
+      kCorpusWords[i % kNumWords],
+      kCorpusWords[(i / kNumWords) % kNumWords],
+      kCorpusWords[(i / (kNumWords * kNumWords)) % kNumWords]);
+}
+
+}  // namespace
+
+class AutocompleteProviderPerfTest : public testing::Test {
+ public:
+  AutocompleteProviderPerfTest()
+      : ui_thread_(BrowserThread::UI, &message_loop_),
+        file_thread_(BrowserThread::FILE, &message_loop_) {}
+
+ protected:
+  static KeyedService* CreateTemplateURLService(
+      content::BrowserContext* context) {
+    Profile* profile = static_cast<Profile*>(context);
+    return new TemplateURLService(
+        profile->GetPrefs(), make_scoped_ptr(new SearchTermsData), NULL,
+        scoped_ptr<TemplateURLServiceClient>(
+            new ChromeTemplateURLServiceClient(
+                HistoryServiceFactory::GetForProfile(
+                    profile, Profile::EXPLICIT_ACCESS))),
+        NULL, NULL, base::Closure());
+  }
+
+  void SetUp() override {
+    profile_.reset(new TestingProfile());
+    ASSERT_TRUE(profile_->CreateHistoryService(true, false));
+    TemplateURLServiceFactory::GetInstance()->SetTestingFactoryAndUse(
+        profile_.get(),
+        &AutocompleteProviderPerfTest::CreateTemplateURLService);
+  }
+
+  void TearDown() override {
+    // Run all pending tasks or else some threads hold on to the message loop
+    // and prevent it from being deleted.
+    message_loop_.RunUntilIdle();
+  }
+
+  history::HistoryBackend* history_backend() {
+    return HistoryServiceFactory::GetForProfile(
+        profile_.get(), Profile::EXPLICIT_ACCESS)->history_backend_.get();
+  }
+
+  // Inserts |kHistoryURLCount| synthetic rows directly into the urls table.
+  // One transaction keeps corpus construction out of the measured time and
+  // fast enough for a perf test setup phase.
+  void FillHistory() {
+    sql::Connection& db(history_backend()->db()->GetDB());
+    ASSERT_TRUE(db.is_open());
+    sql::Transaction transaction(&db);
+    ASSERT_TRUE(transaction.Begin());
+    sql::Statement insert(db.GetUniqueStatement(
+        "INSERT INTO \"urls\" VALUES(?, ?, ?, ?, ?, ?, 0, 0)"));
+    for (size_t i = 0; i < kHistoryURLCount; ++i) {
+      const Time visit_time =
+          Time::Now() - TimeDelta::FromDays(static_cast<int>(i % 60));
+      insert.BindInt64(0, i + 1);
+      insert.BindString(1, SyntheticURL(i));
+      insert.BindString(2, SyntheticTitle(i));
+      insert.BindInt(3, static_cast<int>(1 + i % 50));   // visit_count
+      insert.BindInt(4, static_cast<int>(i % 5));        // typed_count
+      insert.BindInt64(5, visit_time.ToInternalValue());
+      ASSERT_TRUE(insert.Run());
+      insert.Reset(true);
+    }
+    ASSERT_TRUE(transaction.Commit());
+  }
+
+  // Types each of |kQueries| into |provider| one character at a time and
+  // records the elapsed time of every Start() call, then reports the mean
+  // and 99th percentile under |trace|.
+  void MeasureKeystrokes(AutocompleteProvider* provider,
+                         const std::string& trace) {
+    std::vector<TimeDelta> samples;
+    for (size_t repetition = 0; repetition < kTypingRepetitions;
+         ++repetition) {
+      for (size_t i = 0; i < arraysize(kQueries); ++i) {
+        const base::string16 query(ASCIIToUTF16(kQueries[i]));
+        for (size_t length = 1; length <= query.length(); ++length) {
+          AutocompleteInput input(
+              query.substr(0, length), base::string16::npos, std::string(),
+              GURL(), metrics::OmniboxEventProto::INVALID_SPEC, false, false,
+              true, false,
+              ChromeAutocompleteSchemeClassifier(profile_.get()));
+          base::ElapsedTimer timer;
+          provider->Start(input, length > 1, false);
+          samples.push_back(timer.Elapsed());
+        }
+        provider->Stop(true);
+      }
+    }
+    ASSERT_FALSE(samples.empty());
+
+    TimeDelta total;
+    for (size_t i = 0; i < samples.size(); ++i)
+      total += samples[i];
+    std::sort(samples.begin(), samples.end());
+    const TimeDelta p99 =
+        samples[std::min(samples.size() - 1, (samples.size() * 99) / 100)];
+
+    perf_test::PrintResult("omnibox_keystroke_time", "", trace + "_mean",
+                           total.InMillisecondsF() / samples.size(), "ms",
+                           true);
+    perf_test::PrintResult("omnibox_keystroke_time", "", trace + "_p99",
+                           p99.InMillisecondsF(), "ms", true);
+  }
+
+  base::MessageLoopForUI message_loop_;
+  content::TestBrowserThread ui_thread_;
+  content::TestBrowserThread file_thread_;
+
+  scoped_ptr<TestingProfile> profile_;
+};
+
+TEST_F(AutocompleteProviderPerfTest, HistoryQuickProvider) {
+  FillHistory();
+  scoped_refptr<HistoryQuickProvider> provider(
+      new HistoryQuickProvider(profile_.get()));
+  provider->GetIndex()->RebuildFromHistory(history_backend()->db());
+  MeasureKeystrokes(provider.get(), "HistoryQuickProvider");
+  provider = NULL;
+}
+
+TEST_F(AutocompleteProviderPerfTest, ShortcutsProvider) {
+  ShortcutsBackendFactory::GetInstance()->SetTestingFactoryAndUse(
+      profile_.get(),
+      &ShortcutsBackendFactory::BuildProfileNoDatabaseForTesting);
+  scoped_refptr<ShortcutsBackend> backend =
+      ShortcutsBackendFactory::GetForProfile(profile_.get());
+  ASSERT_TRUE(backend.get());
+  scoped_refptr<ShortcutsProvider> provider(
+      new ShortcutsProvider(profile_.get()));
+  for (size_t i = 0; i < kShortcutCount; ++i) {
+    const std::string url(SyntheticURL(i));
+    const std::string title(SyntheticTitle(i));
+    history::ShortcutsDatabase::Shortcut shortcut(
+        base::StringPrintf("BD85DBA2-8C29-49F9-84AE-%012" PRIuS, i),
+        ASCIIToUTF16(title),
+        history::ShortcutsDatabase::Shortcut::MatchCore(
+            ASCIIToUTF16(url), GURL(url), ASCIIToUTF16(url), "0,1",
+            ASCIIToUTF16(title), "0,0", ui::PAGE_TRANSITION_TYPED,
+            AutocompleteMatchType::HISTORY_URL, base::string16()),
+        Time::Now() - TimeDelta::FromDays(static_cast<int>(i % 60)),
+        static_cast<int>(1 + i % 30));
+    ASSERT_TRUE(backend->AddShortcut(shortcut));
+  }
+  MeasureKeystrokes(provider.get(), "ShortcutsProvider");
+  provider = NULL;
+}
+
+TEST_F(AutocompleteProviderPerfTest, BookmarkProvider) {
+  bookmarks::TestBookmarkClient client;
+  scoped_ptr<BookmarkModel> model(client.CreateModel());
+  scoped_refptr<BookmarkProvider> provider(
+      new BookmarkProvider(profile_.get()));
+  provider->set_bookmark_model_for_testing(model.get());
+  const BookmarkNode* other_node = model->other_node();
+  for (size_t i = 0; i < kBookmarkCount; ++i) {
+    model->AddURL(other_node, other_node->child_count(),
+                  ASCIIToUTF16(SyntheticTitle(i)), GURL(SyntheticURL(i)));
+  }
+  MeasureKeystrokes(provider.get(), "BookmarkProvider");
+  provider = NULL;
+}
@@ -43,6 +43,7 @@ class HistoryQuickProvider : public HistoryProvider {
   static void set_disabled(bool disabled) { disabled_ = disabled; }
 
  private:
+  friend class AutocompleteProviderPerfTest;
   friend class HistoryQuickProviderTest;
   FRIEND_TEST_ALL_PREFIXES(HistoryQuickProviderTest, Spans);
   FRIEND_TEST_ALL_PREFIXES(HistoryQuickProviderTest, Relevance);
@@ -30,7 +30,6 @@
 #include "components/metrics/proto/omnibox_input_type.pb.h"
 #include "components/omnibox/autocomplete_input.h"
 #include "components/omnibox/autocomplete_match.h"
-#include "components/omnibox/autocomplete_result.h"
 #include "components/omnibox/omnibox_field_trial.h"
 #include "components/omnibox/url_prefix.h"
 #include "components/url_fixer/url_fixer.h"
@@ -48,6 +47,16 @@ class DestinationURLEqualsURL {
   const GURL url_;
 };
 
+// A matching shortcut and the relevance it scored, used to pick the best
+// shortcuts before building full AutocompleteMatches for them.
+typedef std::pair<int, const history::ShortcutsDatabase::Shortcut*>
+    ScoredShortcut;
+
+bool ShortcutIsMoreRelevant(const ScoredShortcut& elem1,
+                            const ScoredShortcut& elem2) {
+  return elem1.first > elem2.first;
+}
+
 }  // namespace
 
 const int ShortcutsProvider::kShortcutsProviderDefaultMaxRelevance = 1199;
@@ -142,32 +151,62 @@ void ShortcutsProvider::GetMatches(const AutocompleteInput& input) {
     max_relevance = kShortcutsProviderDefaultMaxRelevance;
   TemplateURLService* template_url_service =
       TemplateURLServiceFactory::GetForProfile(profile_);
-  const base::string16 fixed_up_input(FixupUserInput(input).second);
+  // Score all shortcuts matching the input, but don't build full
+  // AutocompleteMatches yet; classifying the contents and description is
+  // expensive, a short input can match a large fraction of the database, and
+  // all but the best few shortcuts are about to be thrown away.
+  //
+  // Duplicates don't need to be preserved in the matches because they are
+  // only used for deletions, and shortcuts deletes matches based on the URL,
+  // so only the best-scoring shortcut for each destination is kept.
+  std::vector<ScoredShortcut> scored_shortcuts;
+  std::map<GURL, size_t> best_for_destination;
   for (ShortcutsBackend::ShortcutMap::const_iterator it =
            FindFirstMatch(term_string, backend.get());
        it != backend->shortcuts_map().end() &&
            StartsWith(it->first, term_string, true); ++it) {
     // Don't return shortcuts with zero relevance.
     int relevance = CalculateScore(term_string, it->second, max_relevance);
-    if (relevance) {
-      matches_.push_back(ShortcutToACMatch(it->second, relevance, input,
-                                           fixed_up_input));
-      matches_.back().ComputeStrippedDestinationURL(template_url_service);
+    if (!relevance)
+      continue;
+    const GURL stripped_destination(AutocompleteMatch::GURLToStrippedGURL(
+        it->second.match_core.destination_url, template_url_service,
+        it->second.match_core.keyword));
+    if (stripped_destination.is_empty()) {
+      // Empty destinations are expected for non-navigable matches and are
+      // never considered duplicates of each other.
+      scored_shortcuts.push_back(std::make_pair(relevance, &it->second));
+      continue;
     }
+    std::map<GURL, size_t>::const_iterator best =
+        best_for_destination.find(stripped_destination);
+    if (best == best_for_destination.end()) {
+      best_for_destination[stripped_destination] = scored_shortcuts.size();
+      scored_shortcuts.push_back(std::make_pair(relevance, &it->second));
+    } else if (relevance > scored_shortcuts[best->second].first) {
+      scored_shortcuts[best->second] =
+          std::make_pair(relevance, &it->second);
+    }
+  }
+  // Find best shortcuts.
+  std::partial_sort(scored_shortcuts.begin(),
+      scored_shortcuts.begin() +
+          std::min(AutocompleteProvider::kMaxMatches,
+                   scored_shortcuts.size()),
+      scored_shortcuts.end(), &ShortcutIsMoreRelevant);
+  if (scored_shortcuts.size() > AutocompleteProvider::kMaxMatches) {
+    scored_shortcuts.erase(
+        scored_shortcuts.begin() + AutocompleteProvider::kMaxMatches,
+        scored_shortcuts.end());
   }
-  // Remove duplicates.  Duplicates don't need to be preserved in the matches
-  // because they are only used for deletions, and shortcuts deletes matches
-  // based on the URL.
-  AutocompleteResult::DedupMatchesByDestination(
-      input.current_page_classification(), false, &matches_);
-  // Find best matches.
-  std::partial_sort(matches_.begin(),
-      matches_.begin() +
-          std::min(AutocompleteProvider::kMaxMatches, matches_.size()),
-      matches_.end(), &AutocompleteMatch::MoreRelevant);
-  if (matches_.size() > AutocompleteProvider::kMaxMatches) {
-    matches_.erase(matches_.begin() + AutocompleteProvider::kMaxMatches,
-                   matches_.end());
+  // Create autocomplete matches for the survivors.
+  const base::string16 fixed_up_input(FixupUserInput(input).second);
+  matches_.reserve(scored_shortcuts.size());
+  for (std::vector<ScoredShortcut>::const_iterator it =
+           scored_shortcuts.begin(); it != scored_shortcuts.end(); ++it) {
+    matches_.push_back(
+        ShortcutToACMatch(*it->second, it->first, input, fixed_up_input));
+    matches_.back().ComputeStrippedDestinationURL(template_url_service);
   }
   // Guarantee that all scores are decreasing (but do not assign any scores
   // below 1).
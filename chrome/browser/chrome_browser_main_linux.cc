@@ -6,14 +6,20 @@
 
 #include <fontconfig/fontconfig.h>
 
+#include "base/bind.h"
+#include "base/bind_helpers.h"
+#include "base/command_line.h"
+#include "base/path_service.h"
+#include "chrome/app/startup_prefetch_linux.h"
 #include "chrome/browser/browser_process.h"
+#include "chrome/common/chrome_switches.h"
 #include "components/crash/app/breakpad_linux.h"
 #include "components/metrics/metrics_service.h"
+#include "content/public/browser/browser_thread.h"
 
 #if !defined(OS_CHROMEOS)
 #include "base/linux_util.h"
 #include "chrome/browser/sxs_linux.h"
-#include "content/public/browser/browser_thread.h"
 #endif
 
 ChromeBrowserMainPartsLinux::ChromeBrowserMainPartsLinux(
@@ -53,6 +59,21 @@ void ChromeBrowserMainPartsLinux::PreProfileInit() {
 void ChromeBrowserMainPartsLinux::PostProfileInit() {
   ChromeBrowserMainPartsPosix::PostProfileInit();
 
+  // By now the binary and the startup data files have been faulted in, so
+  // their page cache residency describes what the next launch will need.
+  const base::CommandLine& command_line =
+      *base::CommandLine::ForCurrentProcess();
+  if (command_line.HasSwitch(switches::kRecordStartupPrefetchManifest)) {
+    base::FilePath exe_dir;
+    if (PathService::Get(base::DIR_EXE, &exe_dir)) {
+      content::BrowserThread::PostBlockingPoolTask(
+          FROM_HERE,
+          base::Bind(
+              base::IgnoreResult(&startup_prefetch::RecordStartupManifest),
+              exe_dir));
+    }
+  }
+
   g_browser_process->metrics_service()->RecordBreakpadRegistration(
       breakpad::IsCrashReporterEnabled());
 }
@@ -64,6 +64,27 @@ base::CancelableTaskTracker::TaskId GetFaviconForChromeURL(
   return id;
 }
 
+// The maximum number of entries kept in each of the favicon transform caches.
+const size_t kMaxCachedFaviconTransforms = 64;
+
+// Returns a hash of the bitmap data in |favicon_bitmap_results| suitable for
+// keying a favicon transform cache. Invalid results are skipped so that the
+// hash only depends on the data which is actually transformed.
+uint32 HashFaviconResults(
+    const std::vector<favicon_base::FaviconRawBitmapResult>&
+        favicon_bitmap_results) {
+  uint32 hash = 0;
+  for (size_t i = 0; i < favicon_bitmap_results.size(); ++i) {
+    if (!favicon_bitmap_results[i].is_valid())
+      continue;
+    hash = 37 * hash +
+           base::Hash(reinterpret_cast<const char*>(
+                          favicon_bitmap_results[i].bitmap_data->front()),
+                      favicon_bitmap_results[i].bitmap_data->size());
+  }
+  return hash;
+}
+
 // Returns a vector of pixel edge sizes from |size_in_dip| and
 // favicon_base::GetFaviconScales().
 std::vector<int> GetPixelSizesForFaviconScales(int size_in_dip) {
@@ -78,7 +99,9 @@ std::vector<int> GetPixelSizesForFaviconScales(int size_in_dip) {
 }  // namespace
 
 FaviconService::FaviconService(Profile* profile, FaviconClient* favicon_client)
-    : history_service_(
+    : favicon_image_cache_(kMaxCachedFaviconTransforms),
+      favicon_raw_bitmap_cache_(kMaxCachedFaviconTransforms),
+      history_service_(
           HistoryServiceFactory::GetForProfile(profile,
                                                Profile::EXPLICIT_ACCESS)),
       profile_(profile),
@@ -368,11 +391,20 @@ void FaviconService::RunFaviconImageCallbackWithBitmapResults(
     const std::vector<favicon_base::FaviconRawBitmapResult>&
         favicon_bitmap_results) {
   favicon_base::FaviconImageResult image_result;
-  image_result.image = favicon_base::SelectFaviconFramesFromPNGs(
-      favicon_bitmap_results,
-      favicon_base::GetFaviconScales(),
-      desired_size_in_dip);
-  favicon_base::SetFaviconColorSpace(&image_result.image);
+  FaviconTransformKey cache_key(HashFaviconResults(favicon_bitmap_results),
+                                desired_size_in_dip);
+  FaviconImageCache::iterator it = favicon_image_cache_.Get(cache_key);
+  if (it != favicon_image_cache_.end()) {
+    image_result.image = it->second;
+  } else {
+    image_result.image = favicon_base::SelectFaviconFramesFromPNGs(
+        favicon_bitmap_results,
+        favicon_base::GetFaviconScales(),
+        desired_size_in_dip);
+    favicon_base::SetFaviconColorSpace(&image_result.image);
+    if (!image_result.image.IsEmpty())
+      favicon_image_cache_.Put(cache_key, image_result.image);
+  }
 
   image_result.icon_url = image_result.image.IsEmpty() ?
       GURL() : favicon_bitmap_results[0].icon_url;
@@ -407,6 +439,16 @@ void FaviconService::RunFaviconRawBitmapCallbackWithBitmapResults(
     return;
   }
 
+  FaviconTransformKey cache_key(HashFaviconResults(favicon_bitmap_results),
+                                desired_size_in_pixel);
+  FaviconRawBitmapCache::iterator it =
+      favicon_raw_bitmap_cache_.Get(cache_key);
+  if (it != favicon_raw_bitmap_cache_.end()) {
+    bitmap_result.bitmap_data = it->second;
+    callback.Run(bitmap_result);
+    return;
+  }
+
   // Convert raw bytes to SkBitmap, resize via SelectFaviconFrames(), then
   // convert back.
   std::vector<float> desired_favicon_scales;
@@ -423,5 +465,6 @@ void FaviconService::RunFaviconRawBitmapCallbackWithBitmapResults(
 
   bitmap_result.bitmap_data = base::RefCountedBytes::TakeVector(
       &resized_bitmap_data);
+  favicon_raw_bitmap_cache_.Put(cache_key, bitmap_result.bitmap_data);
   callback.Run(bitmap_result);
 }
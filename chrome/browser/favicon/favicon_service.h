@@ -5,15 +5,18 @@
 #ifndef CHROME_BROWSER_FAVICON_FAVICON_SERVICE_H_
 #define CHROME_BROWSER_FAVICON_FAVICON_SERVICE_H_
 
+#include <utility>
 #include <vector>
 
 #include "base/callback.h"
 #include "base/containers/hash_tables.h"
+#include "base/containers/mru_cache.h"
 #include "base/memory/ref_counted.h"
 #include "base/task/cancelable_task_tracker.h"
 #include "components/favicon_base/favicon_callback.h"
 #include "components/favicon_base/favicon_types.h"
 #include "components/keyed_service/core/keyed_service.h"
+#include "ui/gfx/image/image.h"
 
 class FaviconClient;
 class GURL;
@@ -212,7 +215,23 @@ class FaviconService : public KeyedService {
 
  private:
   typedef uint32 MissingFaviconURLHash;
+
+  // Caches of recently computed favicon transforms, keyed by a hash of the
+  // favicon bitmap data which was transformed and by the requested size.
+  // Building a favicon_base::FaviconImageResult or resizing a raw bitmap
+  // result decodes, resamples and re-encodes the bitmap data from history on
+  // the UI thread. The tab strip, bookmarks and history UI request the same
+  // icons over and over, so memoize the results. Entries for favicons which
+  // change are keyed by the new bitmap data and the old entries age out.
+  typedef std::pair<uint32, int> FaviconTransformKey;
+  typedef base::MRUCache<FaviconTransformKey, gfx::Image> FaviconImageCache;
+  typedef base::MRUCache<FaviconTransformKey,
+                         scoped_refptr<base::RefCountedMemory> >
+      FaviconRawBitmapCache;
+
   base::hash_set<MissingFaviconURLHash> missing_favicon_urls_;
+  FaviconImageCache favicon_image_cache_;
+  FaviconRawBitmapCache favicon_raw_bitmap_cache_;
   HistoryService* history_service_;
   Profile* profile_;
   FaviconClient* favicon_client_;
@@ -1577,6 +1577,55 @@ void HistoryBackend::GetFaviconsForURL(
   GetFaviconsFromDB(page_url, icon_types, desired_sizes, bitmap_results);
 }
 
+void HistoryBackend::GetFaviconsForURLs(
+    const std::vector<GURL>& page_urls,
+    int icon_types,
+    const std::vector<int>& desired_sizes,
+    std::vector<std::vector<favicon_base::FaviconRawBitmapResult> >*
+        bitmap_results) {
+  DCHECK(bitmap_results);
+  bitmap_results->clear();
+  bitmap_results->resize(page_urls.size());
+
+  if (!db_ || !thumbnail_db_ || page_urls.empty())
+    return;
+
+  // Resolve the icon mappings for the whole batch with one statement rather
+  // than one per page.
+  std::vector<IconMapping> batched_mappings;
+  thumbnail_db_->GetIconMappingsForPageURLs(page_urls, &batched_mappings);
+
+  // Group the mappings by page. The returned page URLs are in database form,
+  // so the requested URLs must be converted the same way when looking up.
+  std::map<std::string, std::vector<IconMapping> > mappings_by_page;
+  for (size_t i = 0; i < batched_mappings.size(); ++i) {
+    mappings_by_page[batched_mappings[i].page_url.spec()].push_back(
+        batched_mappings[i]);
+  }
+
+  for (size_t i = 0; i < page_urls.size(); ++i) {
+    const std::vector<IconMapping>& mappings =
+        mappings_by_page[URLDatabase::GURLToDatabaseURL(page_urls[i])];
+
+    // Restrict the results to a single icon type the same way the
+    // single-page lookup does: the mappings for each page arrive in
+    // descending order of IconType, and the largest requested type that is
+    // present wins.
+    std::vector<favicon_base::FaviconID> favicon_ids;
+    int required_icon_types = icon_types;
+    for (size_t j = 0; j < mappings.size(); ++j) {
+      if (mappings[j].icon_type & required_icon_types) {
+        required_icon_types = mappings[j].icon_type;
+        favicon_ids.push_back(mappings[j].icon_id);
+      }
+    }
+    if (!favicon_ids.empty()) {
+      GetFaviconBitmapResultsForBestMatch(favicon_ids, desired_sizes,
+                                          &(*bitmap_results)[i]);
+    }
+  }
+}
+
 void HistoryBackend::GetFaviconForID(
     favicon_base::FaviconID favicon_id,
     int desired_size,
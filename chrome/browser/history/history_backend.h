@@ -267,6 +267,17 @@ class HistoryBackend : public base::RefCountedThreadSafe<HistoryBackend>,
       const std::vector<int>& desired_sizes,
       std::vector<favicon_base::FaviconRawBitmapResult>* bitmap_results);
 
+  // Looks up favicons for several page URLs with a single batched query
+  // against the thumbnail database. |bitmap_results| is sized to match
+  // |page_urls|; entry i holds the results for page_urls[i], selected
+  // exactly as GetFaviconsForURL() would select them.
+  void GetFaviconsForURLs(
+      const std::vector<GURL>& page_urls,
+      int icon_types,
+      const std::vector<int>& desired_sizes,
+      std::vector<std::vector<favicon_base::FaviconRawBitmapResult> >*
+          bitmap_results);
+
   void GetFaviconForID(
       favicon_base::FaviconID favicon_id,
       int desired_size,
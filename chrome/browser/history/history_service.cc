@@ -75,6 +75,13 @@ void RunWithFaviconResults(
   callback.Run(*bitmap_results);
 }
 
+void RunWithFaviconResultsForURLs(
+    const favicon_base::FaviconResultsForURLsCallback& callback,
+    std::vector<std::vector<favicon_base::FaviconRawBitmapResult> >*
+        bitmap_results) {
+  callback.Run(*bitmap_results);
+}
+
 void RunWithFaviconResult(
     const favicon_base::FaviconRawBitmapCallback& callback,
     favicon_base::FaviconRawBitmapResult* bitmap_result) {
@@ -568,6 +575,30 @@ base::CancelableTaskTracker::TaskId HistoryService::GetFaviconsForURL(
       base::Bind(&RunWithFaviconResults, callback, base::Owned(results)));
 }
 
+base::CancelableTaskTracker::TaskId HistoryService::GetFaviconsForURLs(
+    const std::vector<GURL>& page_urls,
+    int icon_types,
+    const std::vector<int>& desired_sizes,
+    const favicon_base::FaviconResultsForURLsCallback& callback,
+    base::CancelableTaskTracker* tracker) {
+  DCHECK(thread_) << "History service being called after cleanup";
+  DCHECK(thread_checker_.CalledOnValidThread());
+  std::vector<std::vector<favicon_base::FaviconRawBitmapResult> >* results =
+      new std::vector<std::vector<favicon_base::FaviconRawBitmapResult> >();
+  return tracker->PostTaskAndReply(
+      thread_->message_loop_proxy().get(),
+      FROM_HERE,
+      base::Bind(&HistoryBackend::GetFaviconsForURLs,
+                 history_backend_.get(),
+                 page_urls,
+                 icon_types,
+                 desired_sizes,
+                 results),
+      base::Bind(&RunWithFaviconResultsForURLs,
+                 callback,
+                 base::Owned(results)));
+}
+
 base::CancelableTaskTracker::TaskId HistoryService::GetLargestFaviconForURL(
     const GURL& page_url,
     const std::vector<int>& icon_types,
@@ -528,6 +528,7 @@ class HistoryService : public content::NotificationObserver,
 #if defined(OS_ANDROID)
   friend class AndroidHistoryProviderService;
 #endif
+  friend class AutocompleteProviderPerfTest;
   friend class base::RefCountedThreadSafe<HistoryService>;
   friend class BackendDelegate;
   friend class FaviconService;
@@ -655,6 +656,17 @@ class HistoryService : public content::NotificationObserver,
       const favicon_base::FaviconResultsCallback& callback,
       base::CancelableTaskTracker* tracker);
 
+  // As GetFaviconsForURL(), but resolves all of |page_urls| with one backend
+  // task and one batched database query. The vector handed to |callback| is
+  // parallel to |page_urls|. Useful when many lookups arrive at once, e.g.
+  // while restoring a session, to avoid serializing on per-page tasks.
+  base::CancelableTaskTracker::TaskId GetFaviconsForURLs(
+      const std::vector<GURL>& page_urls,
+      int icon_types,
+      const std::vector<int>& desired_sizes,
+      const favicon_base::FaviconResultsForURLsCallback& callback,
+      base::CancelableTaskTracker* tracker);
+
   // Used by FaviconService to find the first favicon bitmap whose width and
   // height are greater than that of |minimum_size_in_pixels|. This searches
   // for icons by IconType. Each element of |icon_types| is a bitmask of
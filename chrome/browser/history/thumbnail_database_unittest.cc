@@ -299,6 +299,55 @@ TEST_F(ThumbnailDatabaseTest, GetIconMappingsForPageURL) {
   EXPECT_EQ(id2, icon_mappings[1].icon_id);
 }
 
+TEST_F(ThumbnailDatabaseTest, GetIconMappingsForPageURLs) {
+  ThumbnailDatabase db(NULL);
+  ASSERT_EQ(sql::INIT_OK, db.Init(file_name_));
+  db.BeginTransaction();
+
+  std::vector<unsigned char> data(kBlob1, kBlob1 + sizeof(kBlob1));
+  scoped_refptr<base::RefCountedBytes> favicon(new base::RefCountedBytes(data));
+  base::Time time = base::Time::Now();
+
+  GURL url1("http://google.com");
+  favicon_base::FaviconID id1 = db.AddFavicon(url1, favicon_base::FAVICON);
+  db.AddFaviconBitmap(id1, favicon, time, kSmallSize);
+  EXPECT_LT(0, db.AddIconMapping(url1, id1));
+
+  GURL url2("http://yahoo.com");
+  favicon_base::FaviconID id2 = db.AddFavicon(url2, favicon_base::TOUCH_ICON);
+  db.AddFaviconBitmap(id2, favicon, time, kSmallSize);
+  EXPECT_LT(0, db.AddIconMapping(url2, id2));
+  favicon_base::FaviconID id3 = db.AddFavicon(url2, favicon_base::FAVICON);
+  db.AddFaviconBitmap(id3, favicon, time, kSmallSize);
+  EXPECT_LT(0, db.AddIconMapping(url2, id3));
+
+  GURL url3("http://www.unmapped.com");
+
+  std::vector<GURL> page_urls;
+  page_urls.push_back(url1);
+  page_urls.push_back(url2);
+  page_urls.push_back(url3);
+
+  // All the mappings should come back from the one batched lookup, grouped
+  // by page and in descending order of icon type within each page.
+  std::vector<IconMapping> icon_mappings;
+  EXPECT_TRUE(db.GetIconMappingsForPageURLs(page_urls, &icon_mappings));
+  ASSERT_EQ(3u, icon_mappings.size());
+  EXPECT_EQ(url1, icon_mappings[0].page_url);
+  EXPECT_EQ(id1, icon_mappings[0].icon_id);
+  EXPECT_EQ(url2, icon_mappings[1].page_url);
+  EXPECT_EQ(id2, icon_mappings[1].icon_id);
+  EXPECT_EQ(url2, icon_mappings[2].page_url);
+  EXPECT_EQ(id3, icon_mappings[2].icon_id);
+
+  // A batch with only unmapped pages finds nothing.
+  page_urls.clear();
+  page_urls.push_back(url3);
+  icon_mappings.clear();
+  EXPECT_FALSE(db.GetIconMappingsForPageURLs(page_urls, &icon_mappings));
+  EXPECT_TRUE(icon_mappings.empty());
+}
+
 TEST_F(ThumbnailDatabaseTest, RetainDataForPageUrls) {
   ThumbnailDatabase db(NULL);
 
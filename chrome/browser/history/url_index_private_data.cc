@@ -4,6 +4,7 @@
 
 #include "chrome/browser/history/url_index_private_data.h"
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
 #include <limits>
@@ -73,6 +74,39 @@ bool LengthGreater(const base::string16& string_a,
   return string_a.length() > string_b.length();
 }
 
+// Comparison function for ordering posting sets by ascending size.
+template <typename Set>
+bool SetSizeLess(const Set* set_a, const Set* set_b) {
+  return set_a->size() < set_b->size();
+}
+
+// When the sets are of comparable size a linear merge is cheapest, but the
+// posting sets for common characters and words can be orders of magnitude
+// larger than the running result set. Below this size ratio the smaller set
+// is walked and the larger one probed with find(), which skips over the
+// non-matching runs the way skip pointers do in a classic posting list.
+const size_t kProbeIntersectionSizeRatio = 16;
+
+// Intersects |set_a| and |set_b|, returning the result.
+template <typename Set>
+Set IntersectSets(const Set& set_a, const Set& set_b) {
+  const Set& smaller = (set_a.size() <= set_b.size()) ? set_a : set_b;
+  const Set& larger = (set_a.size() <= set_b.size()) ? set_b : set_a;
+  Set result;
+  if (smaller.size() * kProbeIntersectionSizeRatio < larger.size()) {
+    for (typename Set::const_iterator iter = smaller.begin();
+         iter != smaller.end(); ++iter) {
+      if (larger.find(*iter) != larger.end())
+        result.insert(result.end(), *iter);
+    }
+  } else {
+    std::set_intersection(smaller.begin(), smaller.end(),
+                          larger.begin(), larger.end(),
+                          std::inserter(result, result.end()));
+  }
+  return result;
+}
+
 
 // UpdateRecentVisitsFromHistoryDBTask -----------------------------------------
 
@@ -536,8 +570,8 @@ HistoryIDSet URLIndexPrivateData::HistoryIDSetFromWords(
     if (iter == words.begin()) {
       history_id_set.swap(term_history_set);
     } else {
-      HistoryIDSet new_history_id_set = base::STLSetIntersection<HistoryIDSet>(
-          history_id_set, term_history_set);
+      HistoryIDSet new_history_id_set =
+          IntersectSets(history_id_set, term_history_set);
       history_id_set.swap(new_history_id_set);
     }
   }
@@ -608,8 +642,7 @@ HistoryIDSet URLIndexPrivateData::HistoryIDsForTerm(
       if (prefix_chars.empty()) {
         word_id_set.swap(leftover_set);
       } else {
-        WordIDSet new_word_id_set = base::STLSetIntersection<WordIDSet>(
-            word_id_set, leftover_set);
+        WordIDSet new_word_id_set = IntersectSets(word_id_set, leftover_set);
         word_id_set.swap(new_word_id_set);
       }
     }
@@ -653,31 +686,36 @@ HistoryIDSet URLIndexPrivateData::HistoryIDsForTerm(
 
 WordIDSet URLIndexPrivateData::WordIDSetForTermChars(
     const Char16Set& term_chars) {
-  WordIDSet word_id_set;
+  // Look up the posting set for each character first so that the sets can be
+  // intersected rarest-first: starting with the smallest set keeps every
+  // intermediate result no larger than it, and uncommon characters give the
+  // intersection the earliest chance to come up empty.
+  std::vector<const WordIDSet*> char_word_id_sets;
+  char_word_id_sets.reserve(term_chars.size());
   for (Char16Set::const_iterator c_iter = term_chars.begin();
        c_iter != term_chars.end(); ++c_iter) {
     CharWordIDMap::iterator char_iter = char_word_map_.find(*c_iter);
-    if (char_iter == char_word_map_.end()) {
-      // A character was not found so there are no matching results: bail.
-      word_id_set.clear();
-      break;
-    }
-    WordIDSet& char_word_id_set(char_iter->second);
-    // It is possible for there to no longer be any words associated with
-    // a particular character. Give up in that case.
-    if (char_word_id_set.empty()) {
-      word_id_set.clear();
-      break;
-    }
+    // If a character is not found, or no longer has any words associated with
+    // it, then there are no matching results: bail.
+    if (char_iter == char_word_map_.end() || char_iter->second.empty())
+      return WordIDSet();
+    char_word_id_sets.push_back(&char_iter->second);
+  }
+  std::sort(char_word_id_sets.begin(), char_word_id_sets.end(),
+            SetSizeLess<WordIDSet>);
 
-    if (c_iter == term_chars.begin()) {
-      // First character results becomes base set of results.
-      word_id_set = char_word_id_set;
+  WordIDSet word_id_set;
+  for (size_t i = 0; i < char_word_id_sets.size(); ++i) {
+    if (i == 0) {
+      // Smallest character results becomes base set of results.
+      word_id_set = *char_word_id_sets[i];
     } else {
       // Subsequent character results get intersected in.
-      WordIDSet new_word_id_set = base::STLSetIntersection<WordIDSet>(
-          word_id_set, char_word_id_set);
+      WordIDSet new_word_id_set =
+          IntersectSets(word_id_set, *char_word_id_sets[i]);
       word_id_set.swap(new_word_id_set);
+      if (word_id_set.empty())
+        break;
     }
   }
   return word_id_set;
@@ -1071,6 +1109,7 @@ bool URLIndexPrivateData::RestoreWordList(
   if (actual_item_count == 0 || actual_item_count != expected_item_count)
     return false;
   const RepeatedPtrField<std::string>& words(list_item.word());
+  word_list_.reserve(expected_item_count);
   for (RepeatedPtrField<std::string>::const_iterator iter = words.begin();
        iter != words.end(); ++iter)
     word_list_.push_back(base::UTF8ToUTF16(*iter));
@@ -1111,12 +1150,14 @@ bool URLIndexPrivateData::RestoreCharWordMap(
     if (actual_item_count == 0 || actual_item_count != expected_item_count)
       return false;
     base::char16 uni_char = static_cast<base::char16>(iter->char_16());
-    WordIDSet word_id_set;
+    WordIDSet& word_id_set = char_word_map_[uni_char];
     const RepeatedField<int32>& word_ids(iter->word_id());
+    // The word IDs were written in set-iteration order, i.e. ascending, so
+    // inserting with an end() hint builds the set in linear time instead of
+    // rebalancing on every insertion.
     for (RepeatedField<int32>::const_iterator jiter = word_ids.begin();
          jiter != word_ids.end(); ++jiter)
-      word_id_set.insert(*jiter);
-    char_word_map_[uni_char] = word_id_set;
+      word_id_set.insert(word_id_set.end(), *jiter);
   }
   return true;
 }
@@ -1139,14 +1180,15 @@ bool URLIndexPrivateData::RestoreWordIDHistoryMap(
     if (actual_item_count == 0 || actual_item_count != expected_item_count)
       return false;
     WordID word_id = iter->word_id();
-    HistoryIDSet history_id_set;
+    HistoryIDSet& history_id_set = word_id_history_map_[word_id];
     const RepeatedField<int64>& history_ids(iter->history_id());
+    // As with the char/word map, the history IDs arrive in ascending order,
+    // so an end() hint makes the set insertions linear.
     for (RepeatedField<int64>::const_iterator jiter = history_ids.begin();
          jiter != history_ids.end(); ++jiter) {
-      history_id_set.insert(*jiter);
+      history_id_set.insert(history_id_set.end(), *jiter);
       AddToHistoryIDWordMap(*jiter, word_id);
     }
-    word_id_history_map_[word_id] = history_id_set;
   }
   return true;
 }
@@ -1174,17 +1216,16 @@ bool URLIndexPrivateData::RestoreHistoryInfoMap(
       base::string16 title(base::UTF8ToUTF16(iter->title()));
       url_row.set_title(title);
     }
-    history_info_map_[history_id].url_row = url_row;
+    HistoryInfoMapValue& map_value = history_info_map_[history_id];
+    map_value.url_row = url_row;
 
     // Restore visits list.
-    VisitInfoVector visits;
-    visits.reserve(iter->visits_size());
+    map_value.visits.reserve(iter->visits_size());
     for (int i = 0; i < iter->visits_size(); ++i) {
-      visits.push_back(std::make_pair(
+      map_value.visits.push_back(std::make_pair(
           base::Time::FromInternalValue(iter->visits(i).visit_time()),
           ui::PageTransitionFromInt(iter->visits(i).transition_type())));
     }
-    history_info_map_[history_id].visits = visits;
   }
   return true;
 }
@@ -1206,18 +1247,19 @@ bool URLIndexPrivateData::RestoreWordStartsMap(
     for (RepeatedPtrField<WordStartsMapEntry>::const_iterator iter =
          entries.begin(); iter != entries.end(); ++iter) {
       HistoryID history_id = iter->history_id();
-      RowWordStarts word_starts;
+      RowWordStarts& word_starts = word_starts_map_[history_id];
       // Restore the URL word starts.
       const RepeatedField<int32>& url_starts(iter->url_word_starts());
+      word_starts.url_word_starts_.reserve(url_starts.size());
       for (RepeatedField<int32>::const_iterator jiter = url_starts.begin();
            jiter != url_starts.end(); ++jiter)
         word_starts.url_word_starts_.push_back(*jiter);
       // Restore the page title word starts.
       const RepeatedField<int32>& title_starts(iter->title_word_starts());
+      word_starts.title_word_starts_.reserve(title_starts.size());
       for (RepeatedField<int32>::const_iterator jiter = title_starts.begin();
            jiter != title_starts.end(); ++jiter)
         word_starts.title_word_starts_.push_back(*jiter);
-      word_starts_map_[history_id] = word_starts;
     }
   } else {
     // Since the cache did not contain any word starts we must rebuild then from
@@ -72,6 +72,7 @@ const int64 Predictor::kDurationBetweenTrimmingsHours = 1;
 const int64 Predictor::kDurationBetweenTrimmingIncrementsSeconds = 15;
 const size_t Predictor::kUrlsTrimmedPerIncrement = 5u;
 const size_t Predictor::kMaxSpeculativeParallelResolves = 3;
+const size_t Predictor::kMaxStartupPreconnections = 3;
 const int Predictor::kMaxUnusedSocketLifetimeSecondsWithoutAGet = 10;
 // To control our congestion avoidance system, which discards a queue when
 // resolutions are "taking too long," we need an expected resolution time.
@@ -729,6 +730,28 @@ void Predictor::FinalizeInitializationOnIOThread(
   // Prefetch these hostnames on startup.
   DnsPrefetchMotivatedList(startup_urls, UrlInfo::STARTUP_LIST_MOTIVATED);
 
+  // The startup list orders the user's dominant origins first (the hosts
+  // learned during the last session precede any static home pages). For the
+  // first few https origins, go a step beyond resolution and open a warm
+  // connection, so the TLS handshake is already done (and its session
+  // cached for later connections) by the time the first request goes out.
+  if (preconnect_enabled_ && CanPreresolveAndPreconnect()) {
+    size_t preconnections_made = 0;
+    std::set<std::string> hosts_preconnected;
+    for (UrlList::const_iterator it = startup_urls.begin();
+         it != startup_urls.end() &&
+             preconnections_made < kMaxStartupPreconnections;
+         ++it) {
+      if (!it->SchemeIs("https"))
+        continue;
+      if (!hosts_preconnected.insert(it->host()).second)
+        continue;
+      PreconnectUrlOnIOThread(it->GetWithEmptyPath(), GURL(),
+                              UrlInfo::STARTUP_LIST_MOTIVATED, 1);
+      ++preconnections_made;
+    }
+  }
+
   // TODO(vadimt): Remove ScopedTracker below once crbug.com/436671 is fixed.
   tracked_objects::ScopedTracker tracking_profile5(
       FROM_HERE_WITH_EXPLICIT_FUNCTION(
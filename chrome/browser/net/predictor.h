@@ -93,6 +93,12 @@ class Predictor {
   // TODO(jar): Move this limitation into the resolver.
   static const size_t kMaxSpeculativeParallelResolves;
 
+  // Maximum number of distinct https origins from the learned startup list
+  // that get a full preconnection, rather than just a resolution, at
+  // startup. Warming these connections performs the TLS handshake before
+  // the first real request needs it.
+  static const size_t kMaxStartupPreconnections;
+
   // To control the congestion avoidance system, we need an estimate of how
   // many speculative requests may arrive at once.  Since we currently only
   // keep 8 subresource names for each frame, we'll use that as our basis.
@@ -10,6 +10,7 @@
 #include "base/stl_util.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/io_buffer.h"
+#include "net/base/load_flags.h"
 #include "net/base/request_priority.h"
 #include "net/url_request/url_request_context.h"
 
@@ -134,6 +135,9 @@ void ResourcePrefetcher::SendRequest(Request* request) {
   url_request->set_method("GET");
   url_request->set_first_party_for_cookies(navigation_id_.main_frame_url);
   url_request->SetReferrer(navigation_id_.main_frame_url.spec());
+  // Mark the request as a prefetch so the cache and the server can treat it
+  // accordingly.
+  url_request->SetLoadFlags(url_request->load_flags() | net::LOAD_PREFETCH);
   StartURLRequest(url_request);
 }
 
@@ -228,7 +232,15 @@ void ResourcePrefetcher::OnResponseStarted(net::URLRequest* request) {
     return;
   }
 
-  // TODO(shishir): Do not read cached entries, or ones that are not cacheable.
+  // A response served from the cache means the entry was already fresh or has
+  // just been revalidated; the prefetch has done its job and there is no need
+  // to stream the body out of the cache.
+  if (request->was_cached()) {
+    FinishRequest(request, Request::PREFETCH_STATUS_FROM_CACHE);
+    return;
+  }
+
+  // TODO(shishir): Do not read responses that are not cacheable.
   ReadFullResponse(request);
 }
 
@@ -48,9 +48,12 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cstring>
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "base/base_paths.h"
 #include "base/basictypes.h"
@@ -108,6 +111,12 @@ const char kTokenDelimiter = '\0';
 const int kMaxMessageLength = 32 * 1024;
 const int kMaxACKMessageLength = arraysize(kShutdownToken) - 1;
 
+// How long a handled message stays eligible for answering an identical
+// follow-up straight from the IO thread. Long enough to collapse the bursts
+// automated launchers produce, short enough that a user deliberately
+// relaunching the browser still gets the window raised.
+const int kIdenticalMessageCacheSeconds = 2;
+
 const char kLockDelimiter = '-';
 
 // Set a file descriptor to be non-blocking.
@@ -540,12 +549,23 @@ class ProcessSingleton::LinuxWatcher
   // called from the IO thread.
   void StartListening(int socket);
 
+  // Routes a parsed message towards the UI thread.  |message| is the raw
+  // message as read from the socket and keys the batching and caching of
+  // identical invocations.  An invocation identical to one handled within
+  // the last kIdenticalMessageCacheSeconds is answered from the cached
+  // response, and one identical to a message already in flight to the UI
+  // thread just joins that request; in both cases no UI thread task is
+  // posted.  This runs on the IO thread.
+  void DispatchMessage(const std::string& current_dir,
+                       const std::vector<std::string>& argv,
+                       const std::string& message,
+                       SocketReader* reader);
+
   // This method determines if we should use the same process and if we should,
   // opens a new browser tab.  This runs on the UI thread.
-  // |reader| is for sending back ACK message.
   void HandleMessage(const std::string& current_dir,
                      const std::vector<std::string>& argv,
-                     SocketReader* reader);
+                     const std::string& message);
 
   // MessageLoopForIO::Watcher impl.  These run on the IO thread.
   void OnFileCanReadWithoutBlocking(int fd) override;
@@ -571,9 +591,16 @@ class ProcessSingleton::LinuxWatcher
     ml->RemoveDestructionObserver(this);
   }
 
+  typedef std::map<std::string, std::vector<SocketReader*> > PendingReaders;
+
   // Removes and deletes the SocketReader.
   void RemoveSocketReader(SocketReader* reader);
 
+  // Sends |response| to every reader waiting on |message| and records it in
+  // the identical-message cache.  This runs on the IO thread.
+  void FinishPendingReaders(const std::string& message,
+                            const std::string& response);
+
   base::MessageLoopForIO::FileDescriptorWatcher fd_watcher_;
 
   // A reference to the UI message loop (i.e., the message loop we were
@@ -585,6 +612,16 @@ class ProcessSingleton::LinuxWatcher
 
   std::set<SocketReader*> readers_;
 
+  // Readers waiting on a message currently being handled on the UI thread,
+  // keyed by the raw message. Only accessed on the IO thread.
+  PendingReaders pending_readers_;
+
+  // The most recently handled message, its response, and when it was
+  // handled. Only accessed on the IO thread.
+  std::string last_message_;
+  std::string last_response_;
+  base::TimeTicks last_message_time_;
+
   DISALLOW_COPY_AND_ASSIGN(LinuxWatcher);
 };
 
@@ -616,33 +653,96 @@ void ProcessSingleton::LinuxWatcher::StartListening(int socket) {
                           &fd_watcher_, this);
 }
 
+void ProcessSingleton::LinuxWatcher::DispatchMessage(
+    const std::string& current_dir,
+    const std::vector<std::string>& argv,
+    const std::string& message,
+    SocketReader* reader) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+  DCHECK(reader);
+
+  // Repeated identical invocations (e.g. an automated launcher poking the
+  // singleton) are answered from the cache without another round trip to the
+  // UI thread.
+  if (!last_response_.empty() && message == last_message_ &&
+      base::TimeTicks::Now() - last_message_time_ <=
+          base::TimeDelta::FromSeconds(kIdenticalMessageCacheSeconds)) {
+    reader->FinishWithACK(last_response_.data(), last_response_.size());
+    return;
+  }
+
+  // If an identical message is already on its way to the UI thread, batch
+  // this reader with it; all of them get the one response.
+  PendingReaders::iterator i = pending_readers_.find(message);
+  if (i != pending_readers_.end()) {
+    i->second.push_back(reader);
+    return;
+  }
+
+  pending_readers_[message].push_back(reader);
+  ui_message_loop_->PostTask(
+      FROM_HERE,
+      base::Bind(&ProcessSingleton::LinuxWatcher::HandleMessage, this,
+                 current_dir, argv, message));
+}
+
 void ProcessSingleton::LinuxWatcher::HandleMessage(
     const std::string& current_dir, const std::vector<std::string>& argv,
-    SocketReader* reader) {
+    const std::string& message) {
   DCHECK(ui_message_loop_ == base::MessageLoop::current());
-  DCHECK(reader);
 
+  std::string response;
   if (parent_->notification_callback_.Run(base::CommandLine(argv),
                                           base::FilePath(current_dir))) {
     // Send back "ACK" message to prevent the client process from starting up.
-    reader->FinishWithACK(kACKToken, arraysize(kACKToken) - 1);
+    response.assign(kACKToken, arraysize(kACKToken) - 1);
   } else {
     LOG(WARNING) << "Not handling interprocess notification as browser"
                     " is shutting down";
     // Send back "SHUTDOWN" message, so that the client process can start up
     // without killing this process.
-    reader->FinishWithACK(kShutdownToken, arraysize(kShutdownToken) - 1);
-    return;
+    response.assign(kShutdownToken, arraysize(kShutdownToken) - 1);
   }
+
+  BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::Bind(&ProcessSingleton::LinuxWatcher::FinishPendingReaders, this,
+                 message, response));
 }
 
 void ProcessSingleton::LinuxWatcher::RemoveSocketReader(SocketReader* reader) {
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
   DCHECK(reader);
+  for (PendingReaders::iterator i = pending_readers_.begin();
+       i != pending_readers_.end(); ++i) {
+    std::vector<SocketReader*>::iterator j =
+        std::find(i->second.begin(), i->second.end(), reader);
+    if (j != i->second.end())
+      i->second.erase(j);
+  }
   readers_.erase(reader);
   delete reader;
 }
 
+void ProcessSingleton::LinuxWatcher::FinishPendingReaders(
+    const std::string& message,
+    const std::string& response) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::IO));
+
+  last_message_ = message;
+  last_response_ = response;
+  last_message_time_ = base::TimeTicks::Now();
+
+  PendingReaders::iterator i = pending_readers_.find(message);
+  if (i == pending_readers_.end())
+    return;
+  std::vector<SocketReader*> readers;
+  readers.swap(i->second);
+  pending_readers_.erase(i);
+  for (size_t j = 0; j < readers.size(); ++j)
+    readers[j]->FinishWithACK(response.data(), response.size());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // ProcessSingleton::LinuxWatcher::SocketReader
 //
@@ -701,17 +801,12 @@ void ProcessSingleton::LinuxWatcher::SocketReader::OnFileCanReadWithoutBlocking(
   tokens.erase(tokens.begin());
   tokens.erase(tokens.begin());
 
-  // Return to the UI thread to handle opening a new browser tab.
-  ui_message_loop_->PostTask(FROM_HERE, base::Bind(
-      &ProcessSingleton::LinuxWatcher::HandleMessage,
-      parent_,
-      current_dir,
-      tokens,
-      this));
   fd_reader_.StopWatchingFileDescriptor();
 
-  // LinuxWatcher::HandleMessage() is in charge of destroying this SocketReader
-  // object by invoking SocketReader::FinishWithACK().
+  // Hand the message over to the watcher, which decides whether it needs a
+  // trip to the UI thread at all.  The watcher is in charge of destroying
+  // this SocketReader object by invoking SocketReader::FinishWithACK().
+  parent_->DispatchMessage(current_dir, tokens, str, this);
 }
 
 void ProcessSingleton::LinuxWatcher::SocketReader::FinishWithACK(
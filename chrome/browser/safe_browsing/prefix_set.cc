@@ -138,6 +138,78 @@ bool PrefixSet::Exists(const SBFullHash& hash) const {
   return PrefixExists(hash.prefix);
 }
 
+void PrefixSet::ExistsBatch(const std::vector<SBFullHash>& hashes,
+                            std::vector<SBPrefix>* prefix_hits) const {
+  // Resolve full-hash matches first, and collect the prefixes left to probe.
+  std::vector<SBPrefix> prefixes;
+  prefixes.reserve(hashes.size());
+  for (size_t i = 0; i < hashes.size(); ++i) {
+    if (std::binary_search(full_hashes_.begin(), full_hashes_.end(),
+                           hashes[i], SBFullHashLess)) {
+      prefix_hits->push_back(hashes[i].prefix);
+    } else {
+      prefixes.push_back(hashes[i].prefix);
+    }
+  }
+  if (index_.empty() || prefixes.empty())
+    return;
+
+  // Probing in ascending order lets each probe resume from the previous
+  // probe's position, so |index_| and |deltas_| are only walked forward.
+  std::sort(prefixes.begin(), prefixes.end());
+  prefixes.erase(std::unique(prefixes.begin(), prefixes.end()),
+                 prefixes.end());
+
+  // Decode state for the most recently visited run, shared between probes
+  // which land in the same run.  |run| at |index_.end()| means no run has
+  // been entered yet.
+  IndexVector::const_iterator run = index_.end();
+  IndexVector::const_iterator search_begin = index_.begin();
+  SBPrefix current = 0;
+  size_t di = 0;
+  size_t bound = 0;
+
+  for (size_t i = 0; i < prefixes.size(); ++i) {
+    const SBPrefix prefix = prefixes[i];
+
+    // Find the probe's run unless it falls in the current one.
+    if (run == index_.end() ||
+        (run + 1 != index_.end() && (run + 1)->first <= prefix)) {
+      IndexVector::const_iterator iter =
+          std::upper_bound(search_begin, index_.end(),
+                           IndexPair(prefix, 0), PrefixLess);
+
+      // |prefix| comes before anything that's in the set.
+      if (iter == index_.begin())
+        continue;
+
+      bound = (iter == index_.end() ? deltas_.size() : iter->second);
+      run = iter - 1;
+      search_begin = run;
+      current = run->first;
+      di = run->second;
+    }
+
+    if (current == prefix) {
+      prefix_hits->push_back(prefix);
+      continue;
+    }
+
+    // The decode has already passed |prefix| without seeing it, so it cannot
+    // be in the set (every member up to |current| has been enumerated).
+    if (prefix < current)
+      continue;
+
+    // Scan forward accumulating deltas while a match is possible.
+    while (di < bound && current < prefix) {
+      current += deltas_[di++];
+    }
+
+    if (current == prefix)
+      prefix_hits->push_back(prefix);
+  }
+}
+
 void PrefixSet::GetPrefixes(std::vector<SBPrefix>* prefixes) const {
   prefixes->reserve(index_.size() + deltas_.size());
 
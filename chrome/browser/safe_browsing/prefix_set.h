@@ -70,6 +70,14 @@ class PrefixSet {
   // |hash.prefix| is one of the prefixes passed to the set's builder.
   bool Exists(const SBFullHash& hash) const;
 
+  // As |Exists()| for each item of |hashes|, appending the prefix of each
+  // hash found to |prefix_hits|.  The probes are processed in sorted order so
+  // that |index_| and |deltas_| are each walked forward at most once, which
+  // is cheaper than independent lookups when a URL expands to many host/path
+  // combinations.  Hits may be appended in any order.
+  void ExistsBatch(const std::vector<SBFullHash>& hashes,
+                   std::vector<SBPrefix>* prefix_hits) const;
+
   // Persist the set on disk.
   static scoped_ptr<const PrefixSet> LoadFile(
       const base::FilePath& filter_name);
@@ -631,6 +631,80 @@ TEST_F(PrefixSetTest, FullHashBuild) {
   EXPECT_FALSE(prefix_set->PrefixExists(kHash6.prefix));
 }
 
+// |ExistsBatch()| should agree with |Exists()| for full-hash matches, prefix
+// matches, and misses, with the probes arriving in arbitrary order.
+TEST_F(PrefixSetTest, ExistsBatch) {
+  const SBFullHash kHash1 = SBFullHashForString("one");
+  const SBFullHash kHash2 = SBFullHashForString("two");
+  const SBFullHash kHash3 = SBFullHashForString("three");
+  const SBFullHash kHash4 = SBFullHashForString("four");
+  const SBFullHash kHash5 = SBFullHashForString("five");
+  const SBFullHash kHash6 = SBFullHashForString("six");
+
+  std::vector<SBPrefix> prefixes;
+  prefixes.push_back(kHash1.prefix);
+  prefixes.push_back(kHash2.prefix);
+  std::sort(prefixes.begin(), prefixes.end());
+
+  std::vector<SBFullHash> hashes;
+  hashes.push_back(kHash4);
+  hashes.push_back(kHash5);
+
+  PrefixSetBuilder builder(prefixes);
+  scoped_ptr<const PrefixSet> prefix_set = builder.GetPrefixSet(hashes);
+
+  std::vector<SBFullHash> probes;
+  probes.push_back(kHash6);
+  probes.push_back(kHash1);
+  probes.push_back(kHash4);
+  probes.push_back(kHash3);
+  probes.push_back(kHash2);
+
+  std::vector<SBPrefix> hits;
+  prefix_set->ExistsBatch(probes, &hits);
+  std::sort(hits.begin(), hits.end());
+
+  std::vector<SBPrefix> expected;
+  expected.push_back(kHash1.prefix);
+  expected.push_back(kHash2.prefix);
+  expected.push_back(kHash4.prefix);
+  std::sort(expected.begin(), expected.end());
+
+  ASSERT_EQ(expected.size(), hits.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), hits.begin()));
+}
+
+// |ExistsBatch()| over the shared prefixes and their siblings should produce
+// exactly the set members.
+TEST_F(PrefixSetTest, ExistsBatchBaseline) {
+  PrefixSetBuilder builder(shared_prefixes_);
+  scoped_ptr<const PrefixSet> prefix_set = builder.GetPrefixSetNoHashes();
+
+  std::vector<SBFullHash> probes;
+  for (size_t i = 0; i < shared_prefixes_.size(); ++i) {
+    SBFullHash hash;
+    memset(&hash, 0, sizeof(hash));
+    hash.prefix = shared_prefixes_[i];
+    probes.push_back(hash);
+    // Siblings only hit if they happen to be members themselves, in which
+    // case they are already in |shared_prefixes_|.
+    hash.prefix = shared_prefixes_[i] + 1;
+    probes.push_back(hash);
+  }
+
+  std::vector<SBPrefix> hits;
+  prefix_set->ExistsBatch(probes, &hits);
+  std::sort(hits.begin(), hits.end());
+
+  std::vector<SBPrefix> expected(shared_prefixes_);
+  std::sort(expected.begin(), expected.end());
+  expected.erase(std::unique(expected.begin(), expected.end()),
+                 expected.end());
+
+  ASSERT_EQ(expected.size(), hits.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), hits.begin()));
+}
+
 // Test that a version 1 file is discarded on read.
 TEST_F(PrefixSetTest, ReadSigned) {
   base::FilePath filename;
@@ -884,14 +884,18 @@ bool SafeBrowsingDatabaseNew::PrefixSetContainsUrlHashes(
     if (!prefix_set)
       return false;
 
+    std::vector<SBFullHash> uncached_hashes;
+    uncached_hashes.reserve(full_hashes.size());
     for (size_t i = 0; i < full_hashes.size(); ++i) {
       if (!GetCachedFullHash(txn->prefix_gethash_cache(), full_hashes[i], now,
                              cache_hits)) {
         // No valid cached result, check the database.
-        if (prefix_set->Exists(full_hashes[i]))
-          prefix_hits->push_back(full_hashes[i].prefix);
+        uncached_hashes.push_back(full_hashes[i]);
       }
     }
+
+    // Probe the database for all uncached hashes in one pass.
+    prefix_set->ExistsBatch(uncached_hashes, prefix_hits);
   }
 
   // Multiple full hashes could share prefix, remove duplicates.
@@ -37,6 +37,7 @@
 #include "chrome/browser/ui/browser_tabstrip.h"
 #include "chrome/browser/ui/browser_window.h"
 #include "chrome/browser/ui/tabs/tab_strip_model.h"
+#include "chrome/common/chrome_switches.h"
 #include "chrome/common/extensions/extension_metrics.h"
 #include "chrome/common/url_constants.h"
 #include "components/sessions/session_types.h"
@@ -91,7 +92,10 @@ void NotifySessionRestored(SessionRestore::CallbackList* callbacks) {
 // TabLoader is responsible for loading tabs after session restore has finished
 // creating all the tabs. Tabs are loaded after a previously tab finishes
 // loading or a timeout is reached. If the timeout is reached before a tab
-// finishes loading the timeout delay is doubled.
+// finishes loading the timeout delay is doubled. Tabs from the window being
+// activated are loaded before tabs from background windows, most recently
+// used first, and the number of simultaneous loads is capped by the
+// TabLoaderDelegate so a large restore cannot saturate the disk.
 //
 // TabLoader keeps a reference to itself when it's loading. When it has finished
 // loading, it drops the reference. If another profile is restored while the
@@ -109,8 +113,12 @@ class TabLoader : public content::NotificationObserver,
   // starting timestamp is set to |restore_started|.
   static TabLoader* GetTabLoader(base::TimeTicks restore_started);
 
-  // Schedules a tab for loading.
-  void ScheduleLoad(NavigationController* controller);
+  // Schedules a tab for loading. Tabs with |in_active_window| set are loaded
+  // before any others, and ties are broken by |last_active|, most recently
+  // used first.
+  void ScheduleLoad(NavigationController* controller,
+                    bool in_active_window,
+                    base::Time last_active);
 
   // Notifies the loader that a tab has been scheduled for loading through
   // some other mechanism.
@@ -132,16 +140,30 @@ class TabLoader : public content::NotificationObserver,
  private:
   friend class base::RefCounted<TabLoader>;
 
+  // A tab waiting to be loaded, together with the signals its load priority
+  // is derived from.
+  struct TabToLoad {
+    NavigationController* controller;
+    bool in_active_window;
+    base::Time last_active;
+  };
+
   typedef std::set<NavigationController*> TabsLoading;
-  typedef std::list<NavigationController*> TabsToLoad;
+  typedef std::list<TabToLoad> TabsToLoad;
   typedef std::set<RenderWidgetHost*> RenderWidgetHostSet;
 
   explicit TabLoader(base::TimeTicks restore_started);
   ~TabLoader() override;
 
   // Loads the next tab. If there are no more tabs to load this deletes itself,
-  // otherwise |force_load_timer_| is restarted.
-  void LoadNextTab();
+  // otherwise |force_load_timer_| is restarted. Unless |force_load| is set,
+  // no tab is loaded while the delegate's maximum number of simultaneous
+  // loads is reached.
+  void LoadNextTab(bool force_load);
+
+  // Returns an iterator into |tabs_to_load_| for |controller|, or
+  // tabs_to_load_.end() if the tab is not scheduled for loading.
+  TabsToLoad::iterator FindTabToLoad(NavigationController* controller);
 
   // Starts a timer to load load the next tab once expired before the current
   // tab loading is finished.
@@ -240,12 +262,30 @@ TabLoader* TabLoader::GetTabLoader(base::TimeTicks restore_started) {
   return shared_tab_loader;
 }
 
-void TabLoader::ScheduleLoad(NavigationController* controller) {
+void TabLoader::ScheduleLoad(NavigationController* controller,
+                             bool in_active_window,
+                             base::Time last_active) {
   CheckNotObserving(controller);
   DCHECK(controller);
-  DCHECK(find(tabs_to_load_.begin(), tabs_to_load_.end(), controller) ==
-         tabs_to_load_.end());
-  tabs_to_load_.push_back(controller);
+  DCHECK(FindTabToLoad(controller) == tabs_to_load_.end());
+  TabToLoad tab_to_load;
+  tab_to_load.controller = controller;
+  tab_to_load.in_active_window = in_active_window;
+  tab_to_load.last_active = last_active;
+  // Keep the queue ordered by priority: tabs from the active window first,
+  // then most recently used first. Insertion keeps the relative order of
+  // equal-priority tabs stable.
+  TabsToLoad::iterator i = tabs_to_load_.begin();
+  for (; i != tabs_to_load_.end(); ++i) {
+    if (in_active_window != i->in_active_window) {
+      if (in_active_window)
+        break;
+      continue;
+    }
+    if (last_active > i->last_active)
+      break;
+  }
+  tabs_to_load_.insert(i, tab_to_load);
   RegisterForNotifications(controller);
 }
 
@@ -289,7 +329,7 @@ void TabLoader::SetTabLoadingEnabled(bool enable_tab_loading) {
     return;
   loading_enabled_ = enable_tab_loading;
   if (loading_enabled_)
-    LoadNextTab();
+    LoadNextTab(false);
   else
     force_load_timer_.Stop();
 }
@@ -313,12 +353,14 @@ TabLoader::~TabLoader() {
   shared_tab_loader = NULL;
 }
 
-void TabLoader::LoadNextTab() {
+void TabLoader::LoadNextTab(bool force_load) {
   // LoadNextTab should only get called after we have started the tab
   // loading.
   CHECK(delegate_);
-  if (!tabs_to_load_.empty()) {
-    NavigationController* tab = tabs_to_load_.front();
+  if (!tabs_to_load_.empty() &&
+      (force_load ||
+       tabs_loading_.size() < delegate_->GetMaxSimultaneousTabLoads())) {
+    NavigationController* tab = tabs_to_load_.front().controller;
     DCHECK(tab);
     tabs_loading_.insert(tab);
     if (tabs_loading_.size() > max_parallel_tab_loads_)
@@ -480,15 +522,24 @@ void TabLoader::RemoveTab(NavigationController* tab) {
   if (i != tabs_loading_.end())
     tabs_loading_.erase(i);
 
-  TabsToLoad::iterator j =
-      find(tabs_to_load_.begin(), tabs_to_load_.end(), tab);
+  TabsToLoad::iterator j = FindTabToLoad(tab);
   if (j != tabs_to_load_.end())
     tabs_to_load_.erase(j);
 }
 
 void TabLoader::ForceLoadTimerFired() {
   force_load_delay_multiplier_ *= 2;
-  LoadNextTab();
+  LoadNextTab(true);
+}
+
+TabLoader::TabsToLoad::iterator TabLoader::FindTabToLoad(
+    NavigationController* controller) {
+  TabsToLoad::iterator i = tabs_to_load_.begin();
+  for (; i != tabs_to_load_.end(); ++i) {
+    if (i->controller == controller)
+      break;
+  }
+  return i;
 }
 
 RenderWidgetHost* TabLoader::GetRenderWidgetHost(NavigationController* tab) {
@@ -515,7 +566,7 @@ void TabLoader::RegisterForNotifications(NavigationController* controller) {
 void TabLoader::HandleTabClosedOrLoaded(NavigationController* tab) {
   RemoveTab(tab);
   if (delegate_ && loading_enabled_)
-    LoadNextTab();
+    LoadNextTab(false);
   if (tabs_loading_.empty() && tabs_to_load_.empty()) {
     base::TimeDelta time_to_load =
         base::TimeTicks::Now() - restore_started_;
@@ -543,9 +594,7 @@ void TabLoader::HandleTabClosedOrLoaded(NavigationController* tab) {
 }
 
 void TabLoader::CheckNotObserving(NavigationController* controller) {
-  const bool in_tabs_to_load =
-      find(tabs_to_load_.begin(), tabs_to_load_.end(), controller) !=
-          tabs_to_load_.end();
+  const bool in_tabs_to_load = FindTabToLoad(controller) != tabs_to_load_.end();
   const bool in_tabs_loading =
       find(tabs_loading_.begin(), tabs_loading_.end(), controller) !=
           tabs_loading_.end();
@@ -575,13 +624,13 @@ base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
   // Stop the timer and suppress any tab loads while we clean the list.
   SetTabLoadingEnabled(false);
   while (!tabs_to_load_.empty()) {
-    NavigationController* controller = tabs_to_load_.front();
+    NavigationController* controller = tabs_to_load_.front().controller;
     tabs_to_load_.pop_front();
     RemoveTab(controller);
   }
   // By calling |LoadNextTab| explicitly, we make sure that the
   // |NOTIFICATION_SESSION_RESTORE_DONE| event gets sent.
-  LoadNextTab();
+  LoadNextTab(false);
 }
 
 // SessionRestoreImpl ---------------------------------------------------------
@@ -691,7 +740,7 @@ class SessionRestoreImpl : public content::NotificationObserver {
           std::min((*i)->selected_tab_index,
                    static_cast<int>((*i)->tabs.size()) - 1));
       RestoreTabsToBrowser(*(*i), browser, initial_tab_count,
-                           selected_tab_index);
+                           selected_tab_index, false);
       NotifySessionServiceOfRestoredTabs(browser, initial_tab_count);
     }
 
@@ -969,11 +1018,12 @@ class SessionRestoreImpl : public content::NotificationObserver {
                                 : std::max(0,
                                     std::min((*i)->selected_tab_index,
                                     static_cast<int>((*i)->tabs.size()) - 1));
-      if ((*i)->window_id.id() == active_window_id)
+      bool is_active_window = (*i)->window_id.id() == active_window_id;
+      if (is_active_window)
         browser_to_activate = browser;
 
       RestoreTabsToBrowser(*(*i), browser, initial_tab_count,
-                           selected_tab_index);
+                           selected_tab_index, is_active_window);
       NotifySessionServiceOfRestoredTabs(browser, initial_tab_count);
       // This needs to be done after restore because closing the last tab will
       // close the whole window.
@@ -1034,7 +1084,8 @@ class SessionRestoreImpl : public content::NotificationObserver {
   void RestoreTabsToBrowser(const sessions::SessionWindow& window,
                            Browser* browser,
                            int initial_tab_count,
-                           int selected_tab_index) {
+                           int selected_tab_index,
+                           bool is_active_window) {
     DVLOG(1) << "RestoreTabsToBrowser " << window.tabs.size();
     DCHECK(!window.tabs.empty());
     if (initial_tab_count == 0) {
@@ -1045,7 +1096,7 @@ class SessionRestoreImpl : public content::NotificationObserver {
         // be selected as ShowBrowser() will load the selected tab.
         bool is_selected_tab = (i == selected_tab_index);
         WebContents* restored_tab =
-            RestoreTab(tab, i, browser, is_selected_tab);
+            RestoreTab(tab, i, browser, is_selected_tab, is_active_window);
 
         // RestoreTab can return NULL if |tab| doesn't have valid data.
         if (!restored_tab)
@@ -1073,7 +1124,7 @@ class SessionRestoreImpl : public content::NotificationObserver {
       for (int i = 0; i < static_cast<int>(window.tabs.size()); ++i) {
         const sessions::SessionTab& tab = *(window.tabs[i]);
         // Always schedule loads as we will not be calling ShowBrowser().
-        RestoreTab(tab, tab_index_offset + i, browser, false);
+        RestoreTab(tab, tab_index_offset + i, browser, false, is_active_window);
       }
     }
   }
@@ -1085,7 +1136,8 @@ class SessionRestoreImpl : public content::NotificationObserver {
   WebContents* RestoreTab(const sessions::SessionTab& tab,
                           const int tab_index,
                           Browser* browser,
-                          bool is_selected_tab) {
+                          bool is_selected_tab,
+                          bool in_active_window) {
     // It's possible (particularly for foreign sessions) to receive a tab
     // without valid navigations. In that case, just skip it.
     // See crbug.com/154129.
@@ -1123,8 +1175,14 @@ class SessionRestoreImpl : public content::NotificationObserver {
     // focused tab will be loaded by Browser, and TabLoader will load the rest.
     DCHECK(web_contents->GetController().NeedsReload());
 
-    if (!is_selected_tab)
-      tab_loader_->ScheduleLoad(&web_contents->GetController());
+    if (!is_selected_tab &&
+        !base::CommandLine::ForCurrentProcess()->HasSwitch(
+            switches::kEnableDeferredTabLoading)) {
+      // With deferred tab loading background tabs are left unloaded; the
+      // NavigationController loads them when they are first activated.
+      tab_loader_->ScheduleLoad(&web_contents->GetController(),
+                                in_active_window, tab.timestamp);
+    }
     return web_contents;
   }
 
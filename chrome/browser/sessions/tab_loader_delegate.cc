@@ -6,12 +6,20 @@
 
 #if !defined(OS_CHROMEOS)
 
+#include <algorithm>
+
+#include "base/sys_info.h"
+
 namespace {
 
 // The timeout time after which the next tab gets loaded if the previous tab did
 // not finish loading yet.
 static const int kInitialDelayTimerMS = 100;
 
+// The minimum number of simultaneous tab loads. With fewer than two slots a
+// single slow tab would serialize the entire restore.
+static const size_t kMinSimultaneousTabLoads = 2;
+
 class TabLoaderDelegateImpl : public TabLoaderDelegate {
  public:
   TabLoaderDelegateImpl() {}
@@ -22,6 +30,15 @@ class TabLoaderDelegateImpl : public TabLoaderDelegate {
     return base::TimeDelta::FromMilliseconds(kInitialDelayTimerMS);
   }
 
+  size_t GetMaxSimultaneousTabLoads() const override {
+    // Scale with the number of cores as a rough stand-in for how much disk
+    // and CPU contention the machine can absorb before the foreground tab
+    // starts to suffer.
+    return std::max(
+        kMinSimultaneousTabLoads,
+        static_cast<size_t>(base::SysInfo::NumberOfProcessors() / 2));
+  }
+
  private:
   DISALLOW_COPY_AND_ASSIGN(TabLoaderDelegateImpl);
 };
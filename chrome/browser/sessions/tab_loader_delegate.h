@@ -30,6 +30,10 @@ class TabLoaderDelegate {
   // Returns the default timeout time after which the next tab gets loaded if
   // the previous tab did not finish to load.
   virtual base::TimeDelta GetTimeoutBeforeLoadingNextTab() const = 0;
+
+  // Returns the maximum number of tabs that should be loading at the same
+  // time. A load forced by the timeout above may exceed this number.
+  virtual size_t GetMaxSimultaneousTabLoads() const = 0;
 };
 
 #endif  // CHROME_BROWSER_SESSIONS_TAB_LOADER_DELEGATE_H_
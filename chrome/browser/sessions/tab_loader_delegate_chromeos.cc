@@ -14,6 +14,10 @@ namespace {
 // the loading time is a mix of server response and data bandwidth.
 static const int kInitialDelayTimerMS = 1500;
 
+// ChromeOS devices are typically memory and I/O constrained, so restrict the
+// restore to a pair of simultaneous tab loads.
+static const size_t kMaxSimultaneousTabLoads = 2;
+
 class TabLoaderDelegateImpl
     : public TabLoaderDelegate,
       public net::NetworkChangeNotifier::ConnectionTypeObserver {
@@ -26,6 +30,10 @@ class TabLoaderDelegateImpl
     return base::TimeDelta::FromMilliseconds(kInitialDelayTimerMS);
   }
 
+  size_t GetMaxSimultaneousTabLoads() const override {
+    return kMaxSimultaneousTabLoads;
+  }
+
   // net::NetworkChangeNotifier::ConnectionTypeObserver:
   void OnConnectionTypeChanged(
       net::NetworkChangeNotifier::ConnectionType type) override;
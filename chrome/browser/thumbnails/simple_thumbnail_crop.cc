@@ -5,6 +5,7 @@
 #include "chrome/browser/thumbnails/simple_thumbnail_crop.h"
 
 #include "base/metrics/histogram.h"
+#include "base/threading/sequenced_worker_pool.h"
 #include "content/public/browser/browser_thread.h"
 #include "skia/ext/platform_canvas.h"
 #include "ui/gfx/color_utils.h"
@@ -15,9 +16,18 @@
 #include "ui/gfx/skbitmap_operations.h"
 
 namespace {
+
 static const char kThumbnailHistogramName[] = "Thumbnail.ComputeMS";
+
+void CallbackInvocationAdapter(
+    const thumbnails::ThumbnailingAlgorithm::ConsumerCallback& callback,
+    scoped_refptr<thumbnails::ThumbnailingContext> context,
+    const SkBitmap& thumbnail) {
+  callback.Run(*context.get(), thumbnail);
 }
 
+}  // namespace
+
 namespace thumbnails {
 
 SimpleThumbnailCrop::SimpleThumbnailCrop(const gfx::Size& target_size)
@@ -45,10 +55,30 @@ void SimpleThumbnailCrop::ProcessBitmap(
   if (bitmap.isNull() || bitmap.empty())
     return;
 
-  SkBitmap thumbnail = CreateThumbnail(
-      bitmap,
-      ComputeTargetSizeAtMaximumScale(target_size_),
-      &context->clip_result);
+  // Scaling the captured bitmap several times over is too slow to run while
+  // the user is switching tabs, so ship it off to the blocking thread pool.
+  if (!content::BrowserThread::GetBlockingPool()
+           ->PostWorkerTaskWithShutdownBehavior(
+               FROM_HERE,
+               base::Bind(&SimpleThumbnailCrop::ComputeThumbnailAndScore,
+                          bitmap,
+                          ComputeTargetSizeAtMaximumScale(target_size_),
+                          context,
+                          callback),
+               base::SequencedWorkerPool::SKIP_ON_SHUTDOWN)) {
+    LOG(WARNING) << "PostWorkerTask failed. The thumbnail for "
+                 << context->url << " will not be created.";
+  }
+}
+
+// static
+void SimpleThumbnailCrop::ComputeThumbnailAndScore(
+    const SkBitmap& bitmap,
+    const gfx::Size& desired_size,
+    scoped_refptr<ThumbnailingContext> context,
+    const ConsumerCallback& callback) {
+  SkBitmap thumbnail =
+      CreateThumbnail(bitmap, desired_size, &context->clip_result);
 
   context->score.boring_score = color_utils::CalculateBoringScore(thumbnail);
   context->score.good_clipping =
@@ -56,7 +86,10 @@ void SimpleThumbnailCrop::ProcessBitmap(
        context->clip_result == CLIP_RESULT_TALLER_THAN_WIDE ||
        context->clip_result == CLIP_RESULT_NOT_CLIPPED);
 
-  callback.Run(*context.get(), thumbnail);
+  content::BrowserThread::PostTask(
+      content::BrowserThread::UI,
+      FROM_HERE,
+      base::Bind(&CallbackInvocationAdapter, callback, context, thumbnail));
 }
 
 SkBitmap SimpleThumbnailCrop::GetClippedBitmap(const SkBitmap& bitmap,
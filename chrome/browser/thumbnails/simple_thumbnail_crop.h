@@ -53,6 +53,13 @@ class SimpleThumbnailCrop : public ThumbnailingAlgorithm {
   ~SimpleThumbnailCrop() override;
 
  private:
+  // Does the actual cropping, scaling and scoring on the blocking thread
+  // pool, then posts |callback| with the result back to the UI thread.
+  static void ComputeThumbnailAndScore(const SkBitmap& bitmap,
+                                       const gfx::Size& desired_size,
+                                       scoped_refptr<ThumbnailingContext> context,
+                                       const ConsumerCallback& callback);
+
   static SkBitmap CreateThumbnail(const SkBitmap& bitmap,
                                   const gfx::Size& desired_size,
                                   ClipResult* clip_result);
@@ -412,6 +412,10 @@ const char kEnableBookmarkUndo[]            = "enable-bookmark-undo";
 // Print Proxy component within the service process.
 const char kEnableCloudPrintProxy[]         = "enable-cloud-print-proxy";
 
+// During session restore, only the selected tab of each window is loaded;
+// background tabs are left unloaded until the user first activates them.
+const char kEnableDeferredTabLoading[]      = "enable-deferred-tab-loading";
+
 // If true devtools experimental settings are enabled.
 const char kEnableDevToolsExperiments[]     = "enable-devtools-experiments";
 
@@ -1002,6 +1006,15 @@ const char kQuicVersion[]                   = "quic-version";
 // See also kPlaybackMode.
 const char kRecordMode[]                    = "record-mode";
 
+#if defined(OS_LINUX)
+// Records which parts of the binary and the startup data files were touched
+// during startup into the prefetch manifest next to the binary, for use by
+// the startup prefetch pass on later launches. Disables that pass for this
+// launch so the measurement is not polluted.
+const char kRecordStartupPrefetchManifest[] =
+    "record-startup-prefetch-manifest";
+#endif
+
 // Remember user proceeds through SSL interstitials for a specified amount of
 // time. In particular, remember these decisions through session restart. The
 // time delta to remember certificates should be specified in seconds.
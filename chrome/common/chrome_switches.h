@@ -121,6 +121,7 @@ extern const char kEnableBenchmarking[];
 extern const char kEnableClientHints[];
 extern const char kEnableBookmarkUndo[];
 extern const char kEnableCloudPrintProxy[];
+extern const char kEnableDeferredTabLoading[];
 extern const char kEnableDevToolsExperiments[];
 extern const char kEnableDeviceDiscoveryNotifications[];
 extern const char kEnableDomDistiller[];
@@ -274,6 +275,9 @@ extern const char kQuicConnectionOptions[];
 extern const char kQuicMaxPacketLength[];
 extern const char kQuicVersion[];
 extern const char kRecordMode[];
+#if defined(OS_LINUX)
+extern const char kRecordStartupPrefetchManifest[];
+#endif
 extern const char kRememberCertErrorDecisions[];
 extern const char kRequireCTForEV[];
 extern const char kResetAppListInstallState[];
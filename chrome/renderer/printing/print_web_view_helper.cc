@@ -1069,7 +1069,16 @@ void PrintWebViewHelper::OnFramePreparedForPreviewDocument() {
     PrepareFrameForPreviewDocument();
     return;
   }
-  DidFinishPrinting(CreatePreviewDocument() ? OK : FAIL_PREVIEW);
+  if (!CreatePreviewDocument()) {
+    DidFinishPrinting(FAIL_PREVIEW);
+    return;
+  }
+  // Rendering continues in RenderNextPreviewPage(), one page per task.
+  base::MessageLoop::current()->PostTask(
+      FROM_HERE,
+      base::Bind(&PrintWebViewHelper::RenderNextPreviewPage,
+                 weak_ptr_factory_.GetWeakPtr(),
+                 print_pages_params_->params.preview_request_id));
 }
 
 bool PrintWebViewHelper::CreatePreviewDocument() {
@@ -1119,34 +1128,59 @@ bool PrintWebViewHelper::CreatePreviewDocument() {
   if (CheckForCancel())
     return false;
 
-  while (!print_preview_context_.IsFinalPageRendered()) {
-    int page_number = print_preview_context_.GetNextPageNumber();
-    DCHECK_GE(page_number, 0);
-    if (!RenderPreviewPage(page_number, print_params))
-      return false;
+  return true;
+}
 
-    if (CheckForCancel())
-      return false;
+void PrintWebViewHelper::RenderNextPreviewPage(int preview_request_id) {
+  // A newer preview request may have restarted the pipeline while this task
+  // was queued; if so the new request drives its own rendering.
+  if (!print_pages_params_ ||
+      print_pages_params_->params.preview_request_id != preview_request_id) {
+    return;
+  }
 
-    // We must call PrepareFrameAndViewForPrint::FinishPrinting() (by way of
-    // print_preview_context_.AllPagesRendered()) before calling
-    // FinalizePrintReadyDocument() when printing a PDF because the plugin
-    // code does not generate output until we call FinishPrinting().  We do not
-    // generate draft pages for PDFs, so IsFinalPageRendered() and
-    // IsLastPageOfPrintReadyMetafile() will be true in the same iteration of
-    // the loop.
-    if (print_preview_context_.IsFinalPageRendered())
-      print_preview_context_.AllPagesRendered();
-
-    if (print_preview_context_.IsLastPageOfPrintReadyMetafile()) {
-      DCHECK(print_preview_context_.IsModifiable() ||
-             print_preview_context_.IsFinalPageRendered());
-      if (!FinalizePrintReadyDocument())
-        return false;
+  const PrintMsg_Print_Params& print_params = print_pages_params_->params;
+
+  int page_number = print_preview_context_.GetNextPageNumber();
+  DCHECK_GE(page_number, 0);
+  if (!RenderPreviewPage(page_number, print_params)) {
+    DidFinishPrinting(FAIL_PREVIEW);
+    return;
+  }
+
+  if (CheckForCancel()) {
+    DidFinishPrinting(FAIL_PREVIEW);
+    return;
+  }
+
+  // We must call PrepareFrameAndViewForPrint::FinishPrinting() (by way of
+  // print_preview_context_.AllPagesRendered()) before calling
+  // FinalizePrintReadyDocument() when printing a PDF because the plugin
+  // code does not generate output until we call FinishPrinting().  We do not
+  // generate draft pages for PDFs, so IsFinalPageRendered() and
+  // IsLastPageOfPrintReadyMetafile() will be true for the same page.
+  if (print_preview_context_.IsFinalPageRendered())
+    print_preview_context_.AllPagesRendered();
+
+  if (print_preview_context_.IsLastPageOfPrintReadyMetafile()) {
+    DCHECK(print_preview_context_.IsModifiable() ||
+           print_preview_context_.IsFinalPageRendered());
+    if (!FinalizePrintReadyDocument()) {
+      DidFinishPrinting(FAIL_PREVIEW);
+      return;
     }
   }
-  print_preview_context_.Finished();
-  return true;
+
+  if (print_preview_context_.IsFinalPageRendered()) {
+    print_preview_context_.Finished();
+    DidFinishPrinting(OK);
+    return;
+  }
+
+  base::MessageLoop::current()->PostTask(
+      FROM_HERE,
+      base::Bind(&PrintWebViewHelper::RenderNextPreviewPage,
+                 weak_ptr_factory_.GetWeakPtr(), preview_request_id));
 }
 
 bool PrintWebViewHelper::FinalizePrintReadyDocument() {
@@ -173,6 +173,13 @@ class PrintWebViewHelper
   // Initialize the print preview document.
   bool CreatePreviewDocument();
 
+  // Renders the next page of the preview document and posts itself until
+  // every page is rendered, so the main thread stays responsive and finished
+  // pages reach the browser while a long document renders. Tasks belonging
+  // to a superseded preview request (|preview_request_id| is stale) do
+  // nothing.
+  void RenderNextPreviewPage(int preview_request_id);
+
   // Renders a print preview page. |page_number| is 0-based.
   // Returns true if print preview should continue, false on failure.
   bool RenderPreviewPage(int page_number,
@@ -25,6 +25,9 @@ namespace {
   // 24 is the observed limits for OSX system checker.
   const size_t kMaxSuggestLen = 24;
 
+  // Maximum number of words whose verdicts are cached.
+  const size_t kMaxVerdictCacheSize = 1024;
+
   static_assert(kMaxCheckedLen <= size_t(MAXWORDLEN),
                 "MaxCheckedLen too long");
   static_assert(kMaxSuggestLen <= kMaxCheckedLen,
@@ -38,7 +41,8 @@ SpellingEngine* CreateNativeSpellingEngine() {
 #endif
 
 HunspellEngine::HunspellEngine()
-    : hunspell_enabled_(false),
+    : verdict_cache_(kMaxVerdictCacheSize),
+      hunspell_enabled_(false),
       initialized_(false),
       dictionary_requested_(false) {
   // Wait till we check the first word before doing any initializing.
@@ -51,6 +55,7 @@ void HunspellEngine::Init(base::File file) {
   initialized_ = true;
   hunspell_.reset();
   bdict_file_.reset();
+  verdict_cache_.Clear();
   file_ = file.Pass();
   hunspell_enabled_ = file_.IsValid();
   // Delay the actual initialization of hunspell until it is needed.
@@ -75,18 +80,27 @@ bool HunspellEngine::CheckSpelling(const base::string16& word_to_check,
   // offer suggestions on them, either, there's no point in flagging them to
   // the user.
   bool word_correct = true;
+
+  // If |hunspell_| is NULL here, an error has occurred, but it's better
+  // to check rather than crash. Don't consult or fill the cache in that
+  // case, because the verdict may change once the dictionary is loaded.
+  if (!hunspell_.get())
+    return word_correct;
+
+  base::HashingMRUCache<base::string16, bool>::iterator cached =
+      verdict_cache_.Get(word_to_check);
+  if (cached != verdict_cache_.end())
+    return cached->second;
+
   std::string word_to_check_utf8(base::UTF16ToUTF8(word_to_check));
 
   // Limit the size of checked words.
   if (word_to_check_utf8.length() <= kMaxCheckedLen) {
-    // If |hunspell_| is NULL here, an error has occurred, but it's better
-    // to check rather than crash.
-    if (hunspell_.get()) {
-      // |hunspell_->spell| returns 0 if the word is misspelled.
-      word_correct = (hunspell_->spell(word_to_check_utf8.c_str()) != 0);
-    }
+    // |hunspell_->spell| returns 0 if the word is misspelled.
+    word_correct = (hunspell_->spell(word_to_check_utf8.c_str()) != 0);
   }
 
+  verdict_cache_.Put(word_to_check, word_correct);
   return word_correct;
 }
 
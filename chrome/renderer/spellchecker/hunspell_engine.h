@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/mru_cache.h"
 #include "base/memory/scoped_ptr.h"
 #include "base/strings/string16.h"
 #include "base/strings/utf_string_conversions.h"
@@ -45,6 +46,12 @@ class HunspellEngine : public SpellingEngine {
   // The hunspell dictionary in use.
   scoped_ptr<Hunspell> hunspell_;
 
+  // Caches the verdicts of the most recently checked words. Natural text
+  // repeats words constantly, so this saves a UTF-8 conversion and a
+  // dictionary lookup for most of the words of a large paste. The cache is
+  // only valid for the dictionary in |hunspell_| and is reset by Init().
+  base::HashingMRUCache<base::string16, bool> verdict_cache_;
+
   base::File file_;
 
   // This flag is true if hunspell is enabled.
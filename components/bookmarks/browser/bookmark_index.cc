@@ -31,8 +31,12 @@ namespace {
 // normalize the string, returns |text| itself as a best-effort.
 base::string16 Normalize(const base::string16& text) {
   UErrorCode status = U_ZERO_ERROR;
-  const icu::Normalizer2* normalizer2 =
+  // The normalizer is a process-wide singleton; look it up only once since
+  // this is called for every node when building the index.
+  static const icu::Normalizer2* normalizer2 =
       icu::Normalizer2::getInstance(NULL, "nfkc", UNORM2_COMPOSE, status);
+  if (!normalizer2)
+    return text;
   icu::UnicodeString unicode_text(
       text.data(), static_cast<int32_t>(text.length()));
   icu::UnicodeString unicode_normalized_text;
@@ -76,12 +80,7 @@ BookmarkIndex::~BookmarkIndex() {
 void BookmarkIndex::Add(const BookmarkNode* node) {
   if (!node->is_url())
     return;
-  std::vector<base::string16> terms =
-      ExtractQueryWords(Normalize(node->GetTitle()));
-  for (size_t i = 0; i < terms.size(); ++i)
-    RegisterNode(terms[i], node);
-  terms =
-      ExtractQueryWords(CleanUpUrlForMatching(node->url(), languages_, NULL));
+  std::vector<base::string16> terms = ExtractIndexTerms(node);
   for (size_t i = 0; i < terms.size(); ++i)
     RegisterNode(terms[i], node);
 }
@@ -90,12 +89,7 @@ void BookmarkIndex::Remove(const BookmarkNode* node) {
   if (!node->is_url())
     return;
 
-  std::vector<base::string16> terms =
-      ExtractQueryWords(Normalize(node->GetTitle()));
-  for (size_t i = 0; i < terms.size(); ++i)
-    UnregisterNode(terms[i], node);
-  terms =
-      ExtractQueryWords(CleanUpUrlForMatching(node->url(), languages_, NULL));
+  std::vector<base::string16> terms = ExtractIndexTerms(node);
   for (size_t i = 0; i < terms.size(); ++i)
     UnregisterNode(terms[i], node);
 }
@@ -253,6 +247,21 @@ bool BookmarkIndex::GetBookmarksMatchingTerm(
   return !matches->empty();
 }
 
+std::vector<base::string16> BookmarkIndex::ExtractIndexTerms(
+    const BookmarkNode* node) {
+  std::vector<base::string16> terms =
+      ExtractQueryWords(Normalize(node->GetTitle()));
+  std::vector<base::string16> url_terms =
+      ExtractQueryWords(CleanUpUrlForMatching(node->url(), languages_, NULL));
+  terms.insert(terms.end(), url_terms.begin(), url_terms.end());
+  // A term appearing several times in the title or URL needs only one index
+  // entry for the node; registering (and later unregistering) it once per
+  // occurrence is wasted work on common terms like "www".
+  std::sort(terms.begin(), terms.end());
+  terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+  return terms;
+}
+
 std::vector<base::string16> BookmarkIndex::ExtractQueryWords(
     const base::string16& query) {
   std::vector<base::string16> terms;
@@ -274,8 +283,8 @@ void BookmarkIndex::UnregisterNode(const base::string16& term,
                                    const BookmarkNode* node) {
   Index::iterator i = index_.find(term);
   if (i == index_.end()) {
-    // We can get here if the node has the same term more than once. For
-    // example, a bookmark with the title 'foo foo' would end up here.
+    // The term extraction is deduplicated, so this should not happen, but be
+    // tolerant of a stale index entry.
     return;
   }
   i->second.erase(node);
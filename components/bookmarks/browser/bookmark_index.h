@@ -74,6 +74,9 @@ class BookmarkIndex {
       query_parser::MatchingAlgorithm matching_algorithm,
       NodeSet* matches);
 
+  // Returns the deduplicated set of index terms for |node|'s title and URL.
+  std::vector<base::string16> ExtractIndexTerms(const BookmarkNode* node);
+
   // Returns the set of query words from |query|.
   std::vector<base::string16> ExtractQueryWords(const base::string16& query);
 
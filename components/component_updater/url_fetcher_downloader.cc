@@ -36,6 +36,7 @@ void UrlFetcherDownloader::DoStartDownload(const GURL& url) {
   url_fetcher_.reset(
       net::URLFetcher::Create(0, url, net::URLFetcher::GET, this));
   url_fetcher_->SetRequestContext(context_getter_);
+  url_fetcher_->SetRequestPriority(net::IDLE);
   url_fetcher_->SetLoadFlags(net::LOAD_DO_NOT_SEND_COOKIES |
                              net::LOAD_DO_NOT_SAVE_COOKIES |
                              net::LOAD_DISABLE_CACHE);
@@ -930,6 +930,40 @@ bool ThumbnailDatabase::GetIconMappingsForPageURL(
   return result;
 }
 
+bool ThumbnailDatabase::GetIconMappingsForPageURLs(
+    const std::vector<GURL>& page_urls,
+    std::vector<IconMapping>* mapping_data) {
+  DCHECK(mapping_data);
+  if (page_urls.empty())
+    return false;
+
+  // The statement is built to match the size of the batch, so it cannot come
+  // from the statement cache.
+  std::string sql =
+      "SELECT icon_mapping.id, icon_mapping.icon_id, favicons.icon_type, "
+      "favicons.url, icon_mapping.page_url "
+      "FROM icon_mapping "
+      "INNER JOIN favicons "
+      "ON icon_mapping.icon_id = favicons.id "
+      "WHERE icon_mapping.page_url IN (?";
+  for (size_t i = 1; i < page_urls.size(); ++i)
+    sql += ",?";
+  sql += ") ORDER BY icon_mapping.page_url, favicons.icon_type DESC";
+
+  sql::Statement statement(db_.GetUniqueStatement(sql.c_str()));
+  for (size_t i = 0; i < page_urls.size(); ++i)
+    statement.BindString(i, URLDatabase::GURLToDatabaseURL(page_urls[i]));
+
+  bool result = false;
+  while (statement.Step()) {
+    result = true;
+    IconMapping icon_mapping;
+    FillIconMapping(statement, GURL(statement.ColumnString(4)), &icon_mapping);
+    mapping_data->push_back(icon_mapping);
+  }
+  return result;
+}
+
 IconMappingID ThumbnailDatabase::AddIconMapping(
     const GURL& page_url,
     favicon_base::FaviconID icon_id) {
@@ -179,6 +179,13 @@ class ThumbnailDatabase {
   bool GetIconMappingsForPageURL(const GURL& page_url,
                                  std::vector<IconMapping>* mapping_data);
 
+  // Looks up the icon mappings for all of |page_urls| with a single
+  // statement, appending the matches for every page to |mapping_data|, in
+  // descent order of IconType within each page. No icon type filtering is
+  // applied. Returns true if any of the pages has a mapping.
+  bool GetIconMappingsForPageURLs(const std::vector<GURL>& page_urls,
+                                  std::vector<IconMapping>* mapping_data);
+
   // Adds a mapping between the given page_url and icon_id.
   // Returns the new mapping id if the adding succeeds, otherwise 0 is returned.
   IconMappingID AddIconMapping(const GURL& page_url,
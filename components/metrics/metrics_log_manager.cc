@@ -54,6 +54,14 @@ MetricsLogManager::MetricsLogManager(PrefService* local_state,
 
 MetricsLogManager::~MetricsLogManager() {}
 
+void MetricsLogManager::SetPersistedLogStores(
+    scoped_ptr<MetricsLogStore> initial_log_store,
+    scoped_ptr<MetricsLogStore> ongoing_log_store) {
+  DCHECK(!unsent_logs_loaded_);
+  initial_log_queue_.SetFileStore(initial_log_store.Pass());
+  ongoing_log_queue_.SetFileStore(ongoing_log_store.Pass());
+}
+
 void MetricsLogManager::BeginLoggingWithLog(scoped_ptr<MetricsLog> log) {
   DCHECK(!current_log_);
   current_log_ = log.Pass();
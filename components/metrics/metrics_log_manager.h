@@ -26,6 +26,11 @@ class MetricsLogManager {
   MetricsLogManager(PrefService* local_state, size_t max_ongoing_log_size);
   ~MetricsLogManager();
 
+  // Persists unsent logs through the given file stores instead of
+  // |local_state|. Must be called before LoadPersistedUnsentLogs().
+  void SetPersistedLogStores(scoped_ptr<MetricsLogStore> initial_log_store,
+                             scoped_ptr<MetricsLogStore> ongoing_log_store);
+
   // Makes |log| the current_log. This should only be called if there is not a
   // current log.
   void BeginLoggingWithLog(scoped_ptr<MetricsLog> log);
@@ -0,0 +1,83 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "components/metrics/metrics_log_store.h"
+
+#include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
+#include "base/location.h"
+#include "base/logging.h"
+#include "base/pickle.h"
+
+namespace metrics {
+
+namespace {
+
+// Bump this whenever the record layout below changes. Old files are treated
+// as unreadable rather than migrated; unsent logs are not worth carrying
+// conversion code for.
+const int kLogStoreVersion = 1;
+
+void WriteDataToFile(const base::FilePath& file_path,
+                     const std::string& data) {
+  if (!base::ImportantFileWriter::WriteFileAtomically(file_path, data))
+    LOG(WARNING) << "Failed to write unsent log store " << file_path.value();
+}
+
+}  // namespace
+
+MetricsLogStore::MetricsLogStore(
+    const base::FilePath& file_path,
+    const scoped_refptr<base::SequencedTaskRunner>& task_runner)
+    : file_path_(file_path), task_runner_(task_runner) {
+  DCHECK(task_runner_.get());
+}
+
+MetricsLogStore::~MetricsLogStore() {}
+
+void MetricsLogStore::WriteLogs(const std::vector<LogRecord>& logs) const {
+  Pickle pickle;
+  pickle.WriteInt(kLogStoreVersion);
+  pickle.WriteUInt64(logs.size());
+  for (size_t i = 0; i < logs.size(); ++i) {
+    pickle.WriteString(logs[i].compressed_log_data);
+    pickle.WriteString(logs[i].hash);
+  }
+  task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&WriteDataToFile, file_path_,
+                 std::string(static_cast<const char*>(pickle.data()),
+                             pickle.size())));
+}
+
+bool MetricsLogStore::ReadLogs(std::vector<LogRecord>* logs) const {
+  DCHECK(logs);
+  logs->clear();
+
+  std::string data;
+  if (!base::ReadFileToString(file_path_, &data))
+    return false;
+
+  Pickle pickle(data.data(), data.size());
+  PickleIterator iterator(pickle);
+  int version = 0;
+  uint64 log_count = 0;
+  if (!iterator.ReadInt(&version) || version != kLogStoreVersion ||
+      !iterator.ReadUInt64(&log_count)) {
+    return false;
+  }
+
+  logs->resize(log_count);
+  for (uint64 i = 0; i < log_count; ++i) {
+    if (!iterator.ReadString(&(*logs)[i].compressed_log_data) ||
+        !iterator.ReadString(&(*logs)[i].hash)) {
+      logs->clear();
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace metrics
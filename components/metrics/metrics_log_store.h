@@ -0,0 +1,56 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef COMPONENTS_METRICS_METRICS_LOG_STORE_H_
+#define COMPONENTS_METRICS_METRICS_LOG_STORE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted.h"
+#include "base/sequenced_task_runner.h"
+
+namespace metrics {
+
+// Persists unsent metrics logs to a dedicated binary file instead of the
+// preference store. Logs are stored as length-prefixed records that carry the
+// already zlib-compressed protobuf plus its hash, so persisting them does not
+// involve base64 expansion or rewriting the whole preferences file.
+class MetricsLogStore {
+ public:
+  // One persisted log: the zlib-compressed serialized protobuf and the SHA1
+  // hash of the uncompressed data.
+  struct LogRecord {
+    std::string compressed_log_data;
+    std::string hash;
+  };
+
+  // Constructs a store backed by |file_path|. Writes are scheduled on
+  // |task_runner|, which must support blocking file IO.
+  MetricsLogStore(const base::FilePath& file_path,
+                  const scoped_refptr<base::SequencedTaskRunner>& task_runner);
+  ~MetricsLogStore();
+
+  // Serializes |logs| and schedules an asynchronous atomic rewrite of the
+  // store file. A later call supersedes the data of an earlier one.
+  void WriteLogs(const std::vector<LogRecord>& logs) const;
+
+  // Reads the store file into |logs|. Returns false if the file does not
+  // exist or does not parse; |logs| is left empty in that case. This reads
+  // synchronously and is meant to be called once during startup, like the
+  // initial preference load.
+  bool ReadLogs(std::vector<LogRecord>* logs) const;
+
+ private:
+  const base::FilePath file_path_;
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+
+  DISALLOW_COPY_AND_ASSIGN(MetricsLogStore);
+};
+
+}  // namespace metrics
+
+#endif  // COMPONENTS_METRICS_METRICS_LOG_STORE_H_
@@ -0,0 +1,102 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "components/metrics/metrics_log_store.h"
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/message_loop/message_loop.h"
+#include "base/run_loop.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace metrics {
+
+namespace {
+
+const base::FilePath::CharType kStoreFilename[] =
+    FILE_PATH_LITERAL("Test Logs");
+
+class MetricsLogStoreTest : public testing::Test {
+ public:
+  MetricsLogStoreTest() {
+    EXPECT_TRUE(temp_dir_.CreateUniqueTempDir());
+  }
+
+ protected:
+  base::FilePath store_path() const {
+    return temp_dir_.path().Append(kStoreFilename);
+  }
+
+  // Runs the scheduled write tasks.
+  void RunPendingWrites() { base::RunLoop().RunUntilIdle(); }
+
+  base::MessageLoop message_loop_;
+  base::ScopedTempDir temp_dir_;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(MetricsLogStoreTest);
+};
+
+}  // namespace
+
+TEST_F(MetricsLogStoreTest, WriteThenReadBack) {
+  MetricsLogStore store(store_path(), message_loop_.message_loop_proxy());
+
+  std::vector<MetricsLogStore::LogRecord> logs(2);
+  logs[0].compressed_log_data = "log data one";
+  logs[0].hash = "hash one";
+  logs[1].compressed_log_data = "log data two";
+  logs[1].hash = "hash two";
+  store.WriteLogs(logs);
+  RunPendingWrites();
+
+  std::vector<MetricsLogStore::LogRecord> read_logs;
+  EXPECT_TRUE(store.ReadLogs(&read_logs));
+  ASSERT_EQ(2U, read_logs.size());
+  EXPECT_EQ(logs[0].compressed_log_data, read_logs[0].compressed_log_data);
+  EXPECT_EQ(logs[0].hash, read_logs[0].hash);
+  EXPECT_EQ(logs[1].compressed_log_data, read_logs[1].compressed_log_data);
+  EXPECT_EQ(logs[1].hash, read_logs[1].hash);
+}
+
+TEST_F(MetricsLogStoreTest, LaterWriteSupersedesEarlierOne) {
+  MetricsLogStore store(store_path(), message_loop_.message_loop_proxy());
+
+  std::vector<MetricsLogStore::LogRecord> logs(1);
+  logs[0].compressed_log_data = "stale log";
+  logs[0].hash = "stale hash";
+  store.WriteLogs(logs);
+  logs[0].compressed_log_data = "fresh log";
+  logs[0].hash = "fresh hash";
+  store.WriteLogs(logs);
+  RunPendingWrites();
+
+  std::vector<MetricsLogStore::LogRecord> read_logs;
+  EXPECT_TRUE(store.ReadLogs(&read_logs));
+  ASSERT_EQ(1U, read_logs.size());
+  EXPECT_EQ("fresh log", read_logs[0].compressed_log_data);
+  EXPECT_EQ("fresh hash", read_logs[0].hash);
+}
+
+TEST_F(MetricsLogStoreTest, ReadMissingFile) {
+  MetricsLogStore store(store_path(), message_loop_.message_loop_proxy());
+
+  std::vector<MetricsLogStore::LogRecord> read_logs;
+  EXPECT_FALSE(store.ReadLogs(&read_logs));
+  EXPECT_TRUE(read_logs.empty());
+}
+
+TEST_F(MetricsLogStoreTest, ReadCorruptFile) {
+  MetricsLogStore store(store_path(), message_loop_.message_loop_proxy());
+
+  const char kGarbage[] = "not a log store";
+  ASSERT_EQ(static_cast<int>(arraysize(kGarbage)),
+            base::WriteFile(store_path(), kGarbage, arraysize(kGarbage)));
+
+  std::vector<MetricsLogStore::LogRecord> read_logs;
+  EXPECT_FALSE(store.ReadLogs(&read_logs));
+  EXPECT_TRUE(read_logs.empty());
+}
+
+}  // namespace metrics
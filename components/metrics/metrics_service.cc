@@ -167,6 +167,7 @@
 
 #include "base/bind.h"
 #include "base/callback.h"
+#include "base/files/file_path.h"
 #include "base/metrics/histogram.h"
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/histogram_samples.h"
@@ -184,6 +185,7 @@
 #include "base/values.h"
 #include "components/metrics/metrics_log.h"
 #include "components/metrics/metrics_log_manager.h"
+#include "components/metrics/metrics_log_store.h"
 #include "components/metrics/metrics_log_uploader.h"
 #include "components/metrics/metrics_pref_names.h"
 #include "components/metrics/metrics_reporting_scheduler.h"
@@ -227,6 +229,13 @@ const size_t kUploadLogAvoidRetransmitSize = 100 * 1024;
 // Interval, in minutes, between state saves.
 const int kSaveStateIntervalMinutes = 5;
 
+// The names of the files, within the directory given to
+// SetPersistedLogsDirectory(), that hold the unsent logs of each type.
+const base::FilePath::CharType kInitialLogsFilename[] =
+    FILE_PATH_LITERAL("Initial Metrics Logs");
+const base::FilePath::CharType kOngoingLogsFilename[] =
+    FILE_PATH_LITERAL("Ongoing Metrics Logs");
+
 // The metrics server's URL.
 const char kServerUrl[] = "https://clients4.google.com/uma/v2";
 
@@ -345,6 +354,16 @@ MetricsService::~MetricsService() {
   DisableRecording();
 }
 
+void MetricsService::SetPersistedLogsDirectory(
+    const base::FilePath& directory,
+    const scoped_refptr<base::SequencedTaskRunner>& task_runner) {
+  log_manager_.SetPersistedLogStores(
+      make_scoped_ptr(new MetricsLogStore(
+          directory.Append(kInitialLogsFilename), task_runner)),
+      make_scoped_ptr(new MetricsLogStore(
+          directory.Append(kOngoingLogsFilename), task_runner)));
+}
+
 void MetricsService::InitializeMetricsRecordingState() {
   InitializeMetricsState();
 
@@ -35,9 +35,11 @@ class PrefRegistrySimple;
 
 namespace base {
 class DictionaryValue;
+class FilePath;
 class HistogramSamples;
 class MessageLoopProxy;
 class PrefService;
+class SequencedTaskRunner;
 }
 
 namespace variations {
@@ -118,6 +120,15 @@ class MetricsService : public base::HistogramFlattener {
   // this is run.
   void InitializeMetricsRecordingState();
 
+  // Persists unsent logs in dedicated files under |directory| instead of in
+  // |local_state|, writing on |task_runner| (which must support blocking file
+  // IO). Embedders opt in by calling this before
+  // InitializeMetricsRecordingState(); logs left in |local_state| by earlier
+  // versions are migrated on the first write.
+  void SetPersistedLogsDirectory(
+      const base::FilePath& directory,
+      const scoped_refptr<base::SequencedTaskRunner>& task_runner);
+
   // Starts the metrics system, turning on recording and uploading of metrics.
   // Should be called when starting up with metrics enabled, or when metrics
   // are turned on.
@@ -83,12 +83,30 @@ PersistedLogs::PersistedLogs(PrefService* local_state,
 
 PersistedLogs::~PersistedLogs() {}
 
+void PersistedLogs::SetFileStore(scoped_ptr<MetricsLogStore> file_store) {
+  DCHECK(file_store.get());
+  file_store_ = file_store.Pass();
+}
+
 void PersistedLogs::SerializeLogs() const {
+  if (file_store_) {
+    WriteLogsToFileStore();
+    // Drop any copy a previous version left in the preference, so that the
+    // preferences file stops carrying the logs.
+    local_state_->ClearPref(pref_name_);
+    return;
+  }
   ListPrefUpdate update(local_state_, pref_name_);
   WriteLogsToPrefList(update.Get());
 }
 
 PersistedLogs::LogReadStatus PersistedLogs::DeserializeLogs() {
+  if (file_store_ && ReadLogsFromFileStore()) {
+    return MakeRecallStatusHistogram(list_.empty() ? LIST_EMPTY
+                                                   : RECALL_SUCCESS);
+  }
+  // No store configured, or its file is missing or unreadable. Reading the
+  // preference covers logs persisted before the store was configured.
   return ReadLogsFromPrefList(*local_state_->GetList(pref_name_));
 }
 
@@ -113,9 +131,7 @@ void PersistedLogs::DiscardStagedLog() {
   staged_log_index_ = -1;
 }
 
-void PersistedLogs::WriteLogsToPrefList(base::ListValue* list_value) const {
-  list_value->Clear();
-
+size_t PersistedLogs::FirstLogToPersist() const {
   // Keep the most recent logs which are smaller than |max_log_size_|.
   // We keep at least |min_log_bytes_| and |min_log_count_| of logs before
   // discarding older logs.
@@ -134,8 +150,13 @@ void PersistedLogs::WriteLogsToPrefList(base::ListValue* list_value) const {
     bytes_used += log_size;
     ++saved_log_count;
   }
+  return start;
+}
 
-  for (size_t i = start; i < list_.size(); ++i) {
+void PersistedLogs::WriteLogsToPrefList(base::ListValue* list_value) const {
+  list_value->Clear();
+
+  for (size_t i = FirstLogToPersist(); i < list_.size(); ++i) {
     size_t log_size = list_[i].compressed_log_data.length();
     if (log_size > max_log_size_) {
       UMA_HISTOGRAM_COUNTS("UMA.Large Accumulated Log Not Persisted",
@@ -147,6 +168,22 @@ void PersistedLogs::WriteLogsToPrefList(base::ListValue* list_value) const {
   }
 }
 
+void PersistedLogs::WriteLogsToFileStore() const {
+  std::vector<MetricsLogStore::LogRecord> records;
+  for (size_t i = FirstLogToPersist(); i < list_.size(); ++i) {
+    size_t log_size = list_[i].compressed_log_data.length();
+    if (log_size > max_log_size_) {
+      UMA_HISTOGRAM_COUNTS("UMA.Large Accumulated Log Not Persisted",
+                           static_cast<int>(log_size));
+      continue;
+    }
+    records.push_back(MetricsLogStore::LogRecord());
+    records.back().compressed_log_data = list_[i].compressed_log_data;
+    records.back().hash = list_[i].hash;
+  }
+  file_store_->WriteLogs(records);
+}
+
 PersistedLogs::LogReadStatus PersistedLogs::ReadLogsFromPrefList(
     const base::ListValue& list_value) {
   if (list_value.empty())
@@ -172,4 +209,18 @@ PersistedLogs::LogReadStatus PersistedLogs::ReadLogsFromPrefList(
   return MakeRecallStatusHistogram(RECALL_SUCCESS);
 }
 
+bool PersistedLogs::ReadLogsFromFileStore() {
+  std::vector<MetricsLogStore::LogRecord> records;
+  if (!file_store_->ReadLogs(&records))
+    return false;
+
+  DCHECK(list_.empty());
+  list_.resize(records.size());
+  for (size_t i = 0; i < records.size(); ++i) {
+    list_[i].compressed_log_data.swap(records[i].compressed_log_data);
+    list_[i].hash.swap(records[i].hash);
+  }
+  return true;
+}
+
 }  // namespace metrics
@@ -10,7 +10,9 @@
 
 #include "base/basictypes.h"
 #include "base/logging.h"
+#include "base/memory/scoped_ptr.h"
 #include "base/values.h"
+#include "components/metrics/metrics_log_store.h"
 
 class PrefService;
 
@@ -54,6 +56,13 @@ class PersistedLogs {
                 size_t max_log_size);
   ~PersistedLogs();
 
+  // Routes persistence through |file_store| instead of the preference. Once
+  // set, SerializeLogs() clears any logs left in the preference so the
+  // preferences file stops paying for them; DeserializeLogs() still falls
+  // back to the preference when the store file cannot be read, which
+  // migrates logs persisted before the store was configured.
+  void SetFileStore(scoped_ptr<MetricsLogStore> file_store);
+
   // Write list to storage.
   void SerializeLogs() const;
 
@@ -92,12 +101,25 @@ class PersistedLogs {
   bool empty() const { return list_.empty(); }
 
  private:
+  // Returns the index of the first log that should be persisted, applying
+  // the |min_log_count_| / |min_log_bytes_| retention rules and skipping
+  // logs larger than |max_log_size_|.
+  size_t FirstLogToPersist() const;
+
   // Writes the list to the ListValue.
   void WriteLogsToPrefList(base::ListValue* list) const;
 
+  // Writes the list to |file_store_|.
+  void WriteLogsToFileStore() const;
+
   // Reads the list from the ListValue.
   LogReadStatus ReadLogsFromPrefList(const base::ListValue& list);
 
+  // Reads the list from |file_store_|. Returns false if the store file is
+  // missing or unreadable, in which case the caller should fall back to the
+  // preference.
+  bool ReadLogsFromFileStore();
+
   // A weak pointer to the PrefService object to read and write the preference
   // from.  Calling code should ensure this object continues to exist for the
   // lifetime of the PersistedLogs object.
@@ -115,6 +137,9 @@ class PersistedLogs {
   // Logs greater than this size will not be written to disk.
   const size_t max_log_size_;
 
+  // If set, logs are persisted to this file store rather than the preference.
+  scoped_ptr<MetricsLogStore> file_store_;
+
   struct LogHashPair {
     // Initializes the members based on uncompressed |log_data|.
     void Init(const std::string& log_data);
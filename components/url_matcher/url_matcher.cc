@@ -786,7 +786,7 @@ bool URLMatcherConditionSet::IsMatch(
 // URLMatcher
 //
 
-URLMatcher::URLMatcher() {}
+URLMatcher::URLMatcher() : update_pending_(false) {}
 
 URLMatcher::~URLMatcher() {}
 
@@ -798,7 +798,7 @@ void URLMatcher::AddConditionSets(
         url_matcher_condition_sets_.end());
     url_matcher_condition_sets_[(*i)->id()] = *i;
   }
-  UpdateInternalDatastructures();
+  update_pending_ = true;
 }
 
 void URLMatcher::RemoveConditionSets(
@@ -809,7 +809,7 @@ void URLMatcher::RemoveConditionSets(
         url_matcher_condition_sets_.end());
     url_matcher_condition_sets_.erase(*i);
   }
-  UpdateInternalDatastructures();
+  update_pending_ = true;
 }
 
 void URLMatcher::ClearUnusedConditionSets() {
@@ -818,6 +818,8 @@ void URLMatcher::ClearUnusedConditionSets() {
 
 std::set<URLMatcherConditionSet::ID> URLMatcher::MatchURL(
     const GURL& url) const {
+  UpdateInternalDatastructuresIfNecessary();
+
   // Find all IDs of StringPatterns that match |url|.
   // See URLMatcherConditionFactory for the canonicalization of URLs and the
   // distinction between full url searches and url component searches.
@@ -873,6 +875,7 @@ std::set<URLMatcherConditionSet::ID> URLMatcher::MatchURL(
 }
 
 bool URLMatcher::IsEmpty() const {
+  UpdateInternalDatastructuresIfNecessary();
   return condition_factory_.IsEmpty() &&
       url_matcher_condition_sets_.empty() &&
       substring_match_triggers_.empty() &&
@@ -1086,6 +1089,18 @@ void URLMatcher::UpdateInternalDatastructures() {
   UpdateRegexSetMatcher();
   UpdateTriggers();
   UpdateConditionFactory();
+  update_pending_ = false;
+}
+
+void URLMatcher::UpdateInternalDatastructuresIfNecessary() const {
+  // Rebuilding the matching structures walks every registered pattern, so
+  // doing it once per batch of additions/removals instead of once per call
+  // keeps registering N condition sets one at a time O(N) instead of
+  // O(N^2). The cast is safe: the rebuild only brings the derived data
+  // structures in sync with the registered condition sets and is not
+  // observable through the public interface.
+  if (update_pending_)
+    const_cast<URLMatcher*>(this)->UpdateInternalDatastructures();
 }
 
 }  // namespace url_matcher
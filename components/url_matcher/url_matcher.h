@@ -363,14 +363,13 @@ class URL_MATCHER_EXPORT URLMatcher {
 
   // Adds new URLMatcherConditionSet to this URL Matcher. Each condition set
   // must have a unique ID.
-  // This is an expensive operation as it triggers pre-calculations on the
-  // currently registered condition sets. Do not call this operation many
-  // times with a single condition set in each call.
+  // The expensive pre-calculations on the registered condition sets are
+  // deferred until the next MatchURL() call, so any number of additions and
+  // removals between matches costs a single update.
   void AddConditionSets(const URLMatcherConditionSet::Vector& condition_sets);
 
   // Removes the listed condition sets. All |condition_set_ids| must be
-  // currently registered. This function should be called with large batches
-  // of |condition_set_ids| at a time to improve performance.
+  // currently registered.
   void RemoveConditionSets(
       const std::vector<URLMatcherConditionSet::ID>& condition_set_ids);
 
@@ -395,9 +394,14 @@ class URL_MATCHER_EXPORT URLMatcher {
   void UpdateTriggers();
   void UpdateConditionFactory();
   void UpdateInternalDatastructures();
+  void UpdateInternalDatastructuresIfNecessary() const;
 
   URLMatcherConditionFactory condition_factory_;
 
+  // Whether condition sets were added or removed since the last update of
+  // the data structures below. See UpdateInternalDatastructuresIfNecessary().
+  mutable bool update_pending_;
+
   // Maps the ID of a URLMatcherConditionSet to the respective
   // URLMatcherConditionSet.
   typedef std::map<URLMatcherConditionSet::ID,
@@ -154,6 +154,14 @@ void VisitedLinkEventListener::Add(VisitedLinkMaster::Fingerprint fingerprint) {
   }
 }
 
+void VisitedLinkEventListener::Remove(
+    VisitedLinkMaster::Fingerprint fingerprint) {
+  // The shared memory has already been updated, the renderers only need to
+  // re-calculate the coloring state of the link with this fingerprint. That
+  // is exactly what the add message requests, so share its buffer and timer.
+  Add(fingerprint);
+}
+
 void VisitedLinkEventListener::Reset() {
   pending_visited_links_.clear();
   coalesce_timer_.Stop();
@@ -37,6 +37,7 @@ class VisitedLinkEventListener : public VisitedLinkMaster::Listener,
 
   void NewTable(base::SharedMemory* table_memory) override;
   void Add(VisitedLinkMaster::Fingerprint fingerprint) override;
+  void Remove(VisitedLinkMaster::Fingerprint fingerprint) override;
   void Reset() override;
 
  private:
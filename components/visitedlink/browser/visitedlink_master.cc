@@ -126,10 +126,11 @@ void AsyncClose(FILE** file) {
 // will be called on the history thread by the history system for every URL
 // in the database.
 //
-// The builder will store the fingerprints for those URLs, and then marshalls
-// back to the main thread where the VisitedLinkMaster will be notified. The
-// master then replaces its table with a new table containing the computed
-// fingerprints.
+// The builder will store the fingerprints for those URLs, lay out the new
+// hash table while still on the history thread, and then marshall back to the
+// main thread where the VisitedLinkMaster will be notified. The master then
+// only has to copy the prebuilt table into place, instead of inserting every
+// fingerprint on the UI thread.
 //
 // The builder must remain active while the history system is using it.
 // Sometimes, the master will be deleted before the rebuild is complete, in
@@ -154,6 +155,10 @@ class VisitedLinkMaster::TableBuilder
  private:
   ~TableBuilder() override {}
 
+  // Called on the history thread when enumeration is done to lay out the new
+  // hash table from the collected fingerprints.
+  void BuildTable();
+
   // OnComplete mashals to this function on the main thread to do the
   // notification.
   void OnCompleteMainThread();
@@ -170,6 +175,11 @@ class VisitedLinkMaster::TableBuilder
   // Stores the fingerprints we computed on the background thread.
   VisitedLinkCommon::Fingerprints fingerprints_;
 
+  // The new hash table laid out by BuildTable(), and the number of items
+  // in it (the fingerprints may have contained duplicates).
+  VisitedLinkCommon::Fingerprints prebuilt_table_;
+  int32 prebuilt_used_count_;
+
   DISALLOW_COPY_AND_ASSIGN(TableBuilder);
 };
 
@@ -337,10 +347,12 @@ void VisitedLinkMaster::DeleteURLs(URLIterator* urls) {
   if (!urls->HasNextURL())
     return;
 
-  listener_->Reset();
-
   if (table_builder_.get()) {
-    // A rebuild is in progress, save this deletion in the temporary list so
+    // A rebuild is in progress. The new table will be sent to the renderers
+    // when the rebuild completes, so just tell them to forget the current one.
+    listener_->Reset();
+
+    // Save this deletion in the temporary list so
     // it can be added once rebuild is complete.
     while (urls->HasNextURL()) {
       const GURL& url(urls->NextURL());
@@ -386,25 +398,38 @@ VisitedLinkMaster::Hash VisitedLinkMaster::AddFingerprint(
     return null_hash_;
   }
 
-  Hash cur_hash = HashFingerprint(fingerprint);
+  Hash inserted_hash =
+      AddFingerprintToTable(fingerprint, hash_table_, table_length_);
+  if (inserted_hash == null_hash_)
+    return null_hash_;  // This fingerprint is already in there, do nothing.
+
+  used_items_++;
+  // If allowed, notify listener that a new visited link was added.
+  if (send_notifications)
+    listener_->Add(fingerprint);
+  return inserted_hash;
+}
+
+// static
+VisitedLinkMaster::Hash VisitedLinkMaster::AddFingerprintToTable(
+    Fingerprint fingerprint,
+    Fingerprint* table,
+    int32 table_length) {
+  Hash cur_hash = HashFingerprint(fingerprint, table_length);
   Hash first_hash = cur_hash;
   while (true) {
-    Fingerprint cur_fingerprint = FingerprintAt(cur_hash);
+    Fingerprint cur_fingerprint = table[cur_hash];
     if (cur_fingerprint == fingerprint)
       return null_hash_;  // This fingerprint is already in there, do nothing.
 
     if (cur_fingerprint == null_fingerprint_) {
       // End of probe sequence found, insert here.
-      hash_table_[cur_hash] = fingerprint;
-      used_items_++;
-      // If allowed, notify listener that a new visited link was added.
-      if (send_notifications)
-        listener_->Add(fingerprint);
+      table[cur_hash] = fingerprint;
       return cur_hash;
     }
 
     // Advance in the probe sequence.
-    cur_hash = IncrementHash(cur_hash);
+    cur_hash = (cur_hash == table_length - 1) ? 0 : cur_hash + 1;
     if (cur_hash == first_hash) {
       // This means that we've wrapped around and are about to go into an
       // infinite loop. Something was wrong with the hashtable resizing
@@ -419,10 +444,17 @@ void VisitedLinkMaster::DeleteFingerprintsFromCurrentTable(
     const std::set<Fingerprint>& fingerprints) {
   bool bulk_write = (fingerprints.size() > kBigDeleteThreshold);
 
+  // Above the threshold it is cheaper for the renderers to throw away their
+  // coloring state wholesale than to re-check every deleted link.
+  if (bulk_write)
+    listener_->Reset();
+
   // Delete the URLs from the table.
   for (std::set<Fingerprint>::const_iterator i = fingerprints.begin();
-       i != fingerprints.end(); ++i)
-    DeleteFingerprint(*i, !bulk_write);
+       i != fingerprints.end(); ++i) {
+    if (DeleteFingerprint(*i, !bulk_write) && !bulk_write)
+      listener_->Remove(*i);
+  }
 
   // These deleted fingerprints may make us shrink the table.
   if (ResizeTableIfNecessary())
@@ -796,7 +828,8 @@ void VisitedLinkMaster::ResizeTable(int32 new_size) {
     WriteFullTable();
 }
 
-uint32 VisitedLinkMaster::NewTableSizeForCount(int32 item_count) const {
+// static
+uint32 VisitedLinkMaster::NewTableSizeForCount(int32 item_count) {
   // These table sizes are selected to be the maximum prime number less than
   // a "convenient" multiple of 1K.
   static const int table_sizes[] = {
@@ -841,7 +874,8 @@ bool VisitedLinkMaster::RebuildTableFromDelegate() {
 // See the TableBuilder declaration above for how this works.
 void VisitedLinkMaster::OnTableRebuildComplete(
     bool success,
-    const std::vector<Fingerprint>& fingerprints) {
+    const std::vector<Fingerprint>& prebuilt_table,
+    int32 prebuilt_used_count) {
   if (success) {
     // Replace the old table with a new blank one.
     shared_memory_serial_++;
@@ -850,17 +884,18 @@ void VisitedLinkMaster::OnTableRebuildComplete(
     // replacement succeeds.
     base::SharedMemory* old_shared_memory = shared_memory_;
 
-    int new_table_size = NewTableSizeForCount(
-        static_cast<int>(fingerprints.size() + added_since_rebuild_.size()));
+    int new_table_size = static_cast<int>(prebuilt_table.size());
     if (BeginReplaceURLTable(new_table_size)) {
       // Free the old table.
       delete old_shared_memory;
 
-      // Add the stored fingerprints to the hash table.
-      for (size_t i = 0; i < fingerprints.size(); i++)
-        AddFingerprint(fingerprints[i], false);
+      // The table was laid out on the rebuild thread, just copy it into the
+      // shared memory.
+      memcpy(hash_table_, &prebuilt_table[0],
+             prebuilt_table.size() * sizeof(Fingerprint));
+      used_items_ = prebuilt_used_count;
 
-      // Also add anything that was added while we were asynchronously
+      // Add anything that was added while we were asynchronously
       // generating the new table.
       for (std::set<Fingerprint>::iterator i = added_since_rebuild_.begin();
            i != added_since_rebuild_.end(); ++i)
@@ -953,7 +988,8 @@ VisitedLinkMaster::TableBuilder::TableBuilder(
     VisitedLinkMaster* master,
     const uint8 salt[LINK_SALT_LENGTH])
     : master_(master),
-      success_(true) {
+      success_(true),
+      prebuilt_used_count_(0) {
   fingerprints_.reserve(4096);
   memcpy(salt_, salt, LINK_SALT_LENGTH * sizeof(uint8));
 }
@@ -975,6 +1011,11 @@ void VisitedLinkMaster::TableBuilder::OnComplete(bool success) {
   success_ = success;
   DLOG_IF(WARNING, !success) << "Unable to rebuild visited links";
 
+  // Lay out the new table while still off the main thread. Inserting the
+  // fingerprints is the expensive part of the rebuild for large histories.
+  if (success_)
+    BuildTable();
+
   // Marshal to the main thread to notify the VisitedLinkMaster that the
   // rebuild is complete.
   BrowserThread::PostTask(
@@ -982,9 +1023,25 @@ void VisitedLinkMaster::TableBuilder::OnComplete(bool success) {
       base::Bind(&TableBuilder::OnCompleteMainThread, this));
 }
 
+void VisitedLinkMaster::TableBuilder::BuildTable() {
+  const uint32 table_length =
+      VisitedLinkMaster::NewTableSizeForCount(fingerprints_.size());
+  prebuilt_table_.resize(table_length, VisitedLinkMaster::null_fingerprint_);
+  for (size_t i = 0; i < fingerprints_.size(); ++i) {
+    if (VisitedLinkMaster::AddFingerprintToTable(
+            fingerprints_[i], &prebuilt_table_[0], table_length) !=
+        VisitedLinkMaster::null_hash_)
+      prebuilt_used_count_++;
+  }
+  // The fingerprints are no longer needed, only the table.
+  VisitedLinkCommon::Fingerprints().swap(fingerprints_);
+}
+
 void VisitedLinkMaster::TableBuilder::OnCompleteMainThread() {
-  if (master_)
-    master_->OnTableRebuildComplete(success_, fingerprints_);
+  if (master_) {
+    master_->OnTableRebuildComplete(success_, prebuilt_table_,
+                                    prebuilt_used_count_);
+  }
 }
 
 }  // namespace visitedlink
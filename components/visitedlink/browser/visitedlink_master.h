@@ -55,6 +55,11 @@ class VisitedLinkMaster : public VisitedLinkCommon {
     // (hash) of the link.
     virtual void Add(Fingerprint fingerprint) = 0;
 
+    // Called when a link has been deleted. The argument is the fingerprint
+    // (hash) of the link. Only the coloring state of that link needs to be
+    // re-calculated, the table itself has already been updated.
+    virtual void Remove(Fingerprint fingerprint) = 0;
+
     // Called when link coloring state has been reset. This may occur when
     // entire or parts of history were deleted.
     virtual void Reset() = 0;
@@ -250,6 +255,14 @@ class VisitedLinkMaster : public VisitedLinkCommon {
   // duplicate and this item was skippped.
   Hash AddFingerprint(Fingerprint fingerprint, bool send_notifications);
 
+  // Adds |fingerprint| to the raw |table| with |table_length| slots using the
+  // same linear probing as AddFingerprint(). Returns the index of the
+  // inserted fingerprint or null_hash_ on a duplicate. Static so the table
+  // rebuilder can lay out a new table off the main thread.
+  static Hash AddFingerprintToTable(Fingerprint fingerprint,
+                                    Fingerprint* table,
+                                    int32 table_length);
+
   // Deletes all fingerprints from the given vector from the current hash table
   // and syncs it to disk if there are changes. This does not update the
   // deleted_since_rebuild_ list, the caller must update this itself if there
@@ -300,7 +313,7 @@ class VisitedLinkMaster : public VisitedLinkCommon {
   void ResizeTable(int32 new_size);
 
   // Returns the desired table size for |item_count| URLs.
-  uint32 NewTableSizeForCount(int32 item_count) const;
+  static uint32 NewTableSizeForCount(int32 item_count);
 
   // Computes the table load as fraction. For example, if 1/4 of the entries are
   // full, this value will be 0.25
@@ -319,10 +332,12 @@ class VisitedLinkMaster : public VisitedLinkCommon {
 
   // Callback that the table rebuilder uses when the rebuild is complete.
   // |success| is true if the fingerprint generation succeeded, in which case
-  // |fingerprints| will contain the computed fingerprints. On failure, there
-  // will be no fingerprints.
+  // |prebuilt_table| holds the new hash table, already laid out on the
+  // history thread with AddFingerprintToTable(), and |prebuilt_used_count|
+  // the number of items in it. On failure, the table will be empty.
   void OnTableRebuildComplete(bool success,
-                              const std::vector<Fingerprint>& fingerprints);
+                              const std::vector<Fingerprint>& prebuilt_table,
+                              int32 prebuilt_used_count);
 
   // Increases or decreases the given hash value by one, wrapping around as
   // necessary. Used for probing.
@@ -18,12 +18,12 @@
 IPC_MESSAGE_CONTROL1(ChromeViewMsg_VisitedLink_NewTable,
                      base::SharedMemoryHandle)
 
-// History system notification that a link has been added and the link
-// coloring state for the given hash must be re-calculated.
+// History system notification that a link has been added or removed and the
+// link coloring state for the given hash must be re-calculated.
 IPC_MESSAGE_CONTROL1(ChromeViewMsg_VisitedLink_Add, std::vector<uint64>)
 
-// History system notification that one or more history items have been
-// deleted, which at this point means that all link coloring state must be
+// History system notification that many history items have been deleted at
+// once, which at this point means that all link coloring state must be
 // re-calculated.
 IPC_MESSAGE_CONTROL0(ChromeViewMsg_VisitedLink_Reset)
 
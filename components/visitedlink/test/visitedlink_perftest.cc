@@ -41,6 +41,7 @@ class DummyVisitedLinkEventListener : public VisitedLinkMaster::Listener {
   DummyVisitedLinkEventListener() {}
   void NewTable(base::SharedMemory* table) override {}
   void Add(VisitedLinkCommon::Fingerprint) override {}
+  void Remove(VisitedLinkCommon::Fingerprint) override {}
   void Reset() override {}
 };
 
@@ -105,7 +105,8 @@ class TrackingVisitedLinkEventListener : public VisitedLinkMaster::Listener {
  public:
   TrackingVisitedLinkEventListener()
       : reset_count_(0),
-        add_count_(0) {}
+        add_count_(0),
+        remove_count_(0) {}
 
   void NewTable(base::SharedMemory* table) override {
     if (table) {
@@ -118,19 +119,23 @@ class TrackingVisitedLinkEventListener : public VisitedLinkMaster::Listener {
     }
   }
   void Add(VisitedLinkCommon::Fingerprint) override { add_count_++; }
+  void Remove(VisitedLinkCommon::Fingerprint) override { remove_count_++; }
   void Reset() override { reset_count_++; }
 
   void SetUp() {
     reset_count_ = 0;
     add_count_ = 0;
+    remove_count_ = 0;
   }
 
   int reset_count() const { return reset_count_; }
   int add_count() const { return add_count_; }
+  int remove_count() const { return remove_count_; }
 
  private:
   int reset_count_;
   int add_count_;
+  int remove_count_;
 };
 
 class VisitedLinkTest : public testing::Test {
@@ -483,9 +488,12 @@ TEST_F(VisitedLinkTest, Listener) {
 
   // Verify that VisitedLinkMaster::Listener::Add was called for each added URL.
   EXPECT_EQ(g_test_count, listener->add_count());
-  // Verify that VisitedLinkMaster::Listener::Reset was called both when one and
-  // all URLs are deleted.
-  EXPECT_EQ(2, listener->reset_count());
+  // Verify that VisitedLinkMaster::Listener::Remove was called for the small
+  // deletion...
+  EXPECT_EQ(1, listener->remove_count());
+  // ... and that VisitedLinkMaster::Listener::Reset was only called when all
+  // URLs were deleted.
+  EXPECT_EQ(1, listener->reset_count());
 }
 
 class VisitCountingContext : public content::TestBrowserContext {
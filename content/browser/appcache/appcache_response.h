@@ -169,6 +169,7 @@ class CONTENT_EXPORT AppCacheResponseReader
   void SetReadRange(int offset, int length);
 
  protected:
+  friend class AppCacheStorage;
   friend class AppCacheStorageImpl;
   friend class content::MockAppCacheStorage;
 
@@ -19,12 +19,14 @@ const int64 AppCacheStorage::kUnitializedId = -1;
 
 AppCacheStorage::AppCacheStorage(AppCacheServiceImpl* service)
     : last_cache_id_(kUnitializedId), last_group_id_(kUnitializedId),
-      last_response_id_(kUnitializedId), service_(service)  {
+      last_response_id_(kUnitializedId), service_(service),
+      warm_entry_(NULL), warm_entry_response_id_(kUnitializedId) {
 }
 
 AppCacheStorage::~AppCacheStorage() {
   STLDeleteValues(&pending_info_loads_);
   DCHECK(delegate_references_.empty());
+  DCHECK(!warm_entry_);
 }
 
 AppCacheStorage::DelegateReference::DelegateReference(
@@ -74,8 +76,12 @@ void AppCacheStorage::ResponseInfoLoadTask::OnReadComplete(int result) {
                                     response_id_,
                                     info_buffer_->http_info.release(),
                                     info_buffer_->response_data_size);
+    // Park the open disk cache entry; a delegate that goes on to create a
+    // reader for the response body will pick it up and skip a second open.
+    storage_->StashWarmEntry(response_id_, reader_.get());
   }
   FOR_EACH_DELEGATE(delegates_, OnResponseInfoLoaded(info.get(), response_id_));
+  storage_->DropWarmEntry(response_id_);
   delete this;
 }
 
@@ -95,6 +101,32 @@ void AppCacheStorage::LoadResponseInfo(
   info_load->StartIfNeeded();
 }
 
+void AppCacheStorage::StashWarmEntry(int64 response_id,
+                                     AppCacheResponseReader* reader) {
+  DCHECK(!warm_entry_);
+  if (!reader->entry_)
+    return;
+  warm_entry_ = reader->entry_;
+  warm_entry_response_id_ = response_id;
+  reader->entry_ = NULL;
+}
+
+AppCacheDiskCacheInterface::Entry* AppCacheStorage::TakeWarmEntry(
+    int64 response_id) {
+  if (!warm_entry_ || response_id != warm_entry_response_id_)
+    return NULL;
+  AppCacheDiskCacheInterface::Entry* entry = warm_entry_;
+  warm_entry_ = NULL;
+  warm_entry_response_id_ = kUnitializedId;
+  return entry;
+}
+
+void AppCacheStorage::DropWarmEntry(int64 response_id) {
+  AppCacheDiskCacheInterface::Entry* entry = TakeWarmEntry(response_id);
+  if (entry)
+    entry->Close();
+}
+
 void AppCacheStorage::UpdateUsageMapAndNotify(
     const GURL& origin, int64 new_usage) {
   DCHECK_GE(new_usage, 0);
@@ -13,6 +13,7 @@
 #include "base/gtest_prod_util.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
+#include "content/browser/appcache/appcache_response.h"
 #include "content/browser/appcache/appcache_working_set.h"
 #include "content/common/content_export.h"
 #include "net/base/completion_callback.h"
@@ -26,13 +27,10 @@ class AppCache;
 class AppCacheEntry;
 class AppCacheGroup;
 class AppCacheQuotaClientTest;
-class AppCacheResponseReader;
 class AppCacheResponseTest;
-class AppCacheResponseWriter;
 class AppCacheServiceImpl;
 class AppCacheStorageTest;
 struct AppCacheInfoCollection;
-struct HttpResponseInfoIOBuffer;
 
 class CONTENT_EXPORT AppCacheStorage {
  public:
@@ -292,6 +290,13 @@ class CONTENT_EXPORT AppCacheStorage {
     return new ResponseInfoLoadTask(manifest_url, group_id, response_id, this);
   }
 
+  // An info load briefly parks the disk cache entry it read from so a
+  // response reader created while delegates are being notified can pick it
+  // up, instead of opening the same entry a second time to stream the body.
+  void StashWarmEntry(int64 response_id, AppCacheResponseReader* reader);
+  AppCacheDiskCacheInterface::Entry* TakeWarmEntry(int64 response_id);
+  void DropWarmEntry(int64 response_id);
+
   // Should only be called when creating a new response writer.
   int64 NewResponseId() {
     return ++last_response_id_;
@@ -313,6 +318,10 @@ class CONTENT_EXPORT AppCacheStorage {
   DelegateReferenceMap delegate_references_;
   PendingResponseInfoLoads pending_info_loads_;
 
+  // Only non-NULL while an info load is notifying its delegates.
+  AppCacheDiskCacheInterface::Entry* warm_entry_;
+  int64 warm_entry_response_id_;
+
   // The set of last ids must be retrieved from storage prior to being used.
   static const int64 kUnitializedId;
 
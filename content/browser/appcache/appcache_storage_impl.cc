@@ -1635,7 +1635,12 @@ void AppCacheStorageImpl::MakeGroupObsolete(AppCacheGroup* group,
 
 AppCacheResponseReader* AppCacheStorageImpl::CreateResponseReader(
     const GURL& manifest_url, int64 group_id, int64 response_id) {
-  return new AppCacheResponseReader(response_id, group_id, disk_cache());
+  AppCacheResponseReader* reader =
+      new AppCacheResponseReader(response_id, group_id, disk_cache());
+  // If an info load for this response just finished, reuse the disk cache
+  // entry it read from rather than opening the entry again.
+  reader->entry_ = TakeWarmEntry(response_id);
+  return reader;
 }
 
 AppCacheResponseWriter* AppCacheStorageImpl::CreateResponseWriter(
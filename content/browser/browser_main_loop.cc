@@ -6,6 +6,7 @@
 
 #include "base/bind.h"
 #include "base/command_line.h"
+#include "base/debug/long_task_watchdog.h"
 #include "base/debug/trace_event.h"
 #include "base/logging.h"
 #include "base/message_loop/message_loop.h"
@@ -292,6 +293,16 @@ NOINLINE void ResetThread_IndexedDb(scoped_ptr<base::Thread> thread) {
 MSVC_POP_WARNING()
 MSVC_ENABLE_OPTIMIZE();
 
+// Parameters of the --long-task-watchdog jank watchdog.  200ms is the stall
+// duration above which user interactions feel broken rather than sluggish.
+const int kLongTaskThresholdMs = 200;
+const size_t kLongTaskWatchdogCapacity = 64;
+
+// TaskObservers can only be added on the watched thread itself.
+void AddLongTaskWatchdogToCurrentLoop(base::debug::LongTaskWatchdog* watchdog) {
+  base::MessageLoop::current()->AddTaskObserver(watchdog);
+}
+
 }  // namespace
 
 // The currently-running BrowserMainLoop.  There can be one or zero.
@@ -583,6 +594,14 @@ void BrowserMainLoop::MainMessageLoopStart() {
     base::MessageLoop::current()->AddTaskObserver(memory_observer_.get());
   }
 
+  if (parsed_command_line_.HasSwitch(switches::kLongTaskWatchdog)) {
+    ui_long_task_watchdog_.reset(new base::debug::LongTaskWatchdog(
+        "UI", base::TimeDelta::FromMilliseconds(kLongTaskThresholdMs),
+        kLongTaskWatchdogCapacity));
+    base::MessageLoop::current()->AddTaskObserver(
+        ui_long_task_watchdog_.get());
+  }
+
 #if defined(TCMALLOC_TRACE_MEMORY_SUPPORTED)
   trace_memory_controller_.reset(new base::debug::TraceMemoryController(
       base::MessageLoop::current()->message_loop_proxy(),
@@ -1023,6 +1042,16 @@ int BrowserMainLoop::BrowserThreadsStarted() {
 #if !defined(OS_IOS)
   HistogramSynchronizer::GetInstance();
 
+  if (parsed_command_line_.HasSwitch(switches::kLongTaskWatchdog)) {
+    io_long_task_watchdog_.reset(new base::debug::LongTaskWatchdog(
+        "IO", base::TimeDelta::FromMilliseconds(kLongTaskThresholdMs),
+        kLongTaskWatchdogCapacity));
+    BrowserThread::PostTask(
+        BrowserThread::IO, FROM_HERE,
+        base::Bind(&AddLongTaskWatchdogToCurrentLoop,
+                   base::Unretained(io_long_task_watchdog_.get())));
+  }
+
   bool initialize_gpu_data_manager = true;
 #if defined(OS_ANDROID)
   // On Android, GLSurface::InitializeOneOff() must be called before initalizing
@@ -24,6 +24,7 @@ class SystemMonitor;
 class MemoryPressureObserverChromeOS;
 #endif
 namespace debug {
+class LongTaskWatchdog;
 class TraceMemoryController;
 class TraceEventSystemStatsMonitor;
 }  // namespace debug
@@ -209,6 +210,8 @@ class CONTENT_EXPORT BrowserMainLoop {
   scoped_ptr<BrowserProcessSubThread> io_thread_;
   scoped_ptr<base::Thread> indexed_db_thread_;
   scoped_ptr<MemoryObserver> memory_observer_;
+  scoped_ptr<base::debug::LongTaskWatchdog> ui_long_task_watchdog_;
+  scoped_ptr<base::debug::LongTaskWatchdog> io_long_task_watchdog_;
   scoped_ptr<base::debug::TraceMemoryController> trace_memory_controller_;
   scoped_ptr<base::debug::TraceEventSystemStatsMonitor> system_stats_monitor_;
 
@@ -10,6 +10,7 @@
 
 #include "base/bind.h"
 #include "base/location.h"
+#include "base/memory/linked_ptr.h"
 #include "base/memory/ref_counted.h"
 #include "base/sequenced_task_runner.h"
 
@@ -150,7 +151,13 @@ class ByteStreamReaderImpl : public ByteStreamReader {
   // True while this object is alive.
   scoped_refptr<LifetimeFlag> my_lifetime_flag_;
 
-  ContentVector available_contents_;
+  // Transfer buffers received from the writer, oldest first.  Each buffer
+  // is kept whole and consumed in place so that accepting a transfer is
+  // O(1) however many chunks it carries; |next_content_index_| is the next
+  // unread element of the front buffer.  Exhausted buffers are popped as
+  // part of Read(), so a non-empty deque always means readable data.
+  std::deque<linked_ptr<ContentVector> > available_contents_;
+  size_t next_content_index_;
 
   bool received_status_;
   int status_;
@@ -315,6 +322,7 @@ ByteStreamReaderImpl::ByteStreamReaderImpl(
     : total_buffer_size_(buffer_size),
       my_task_runner_(task_runner),
       my_lifetime_flag_(lifetime_flag),
+      next_content_index_(0),
       received_status_(false),
       status_(0),
       unreported_consumed_bytes_(0),
@@ -344,10 +352,16 @@ ByteStreamReaderImpl::Read(scoped_refptr<net::IOBuffer>* data,
                            size_t* length) {
   DCHECK(my_task_runner_->RunsTasksOnCurrentThread());
 
-  if (available_contents_.size()) {
-    *data = available_contents_.front().first;
-    *length = available_contents_.front().second;
-    available_contents_.pop_front();
+  if (!available_contents_.empty()) {
+    ContentVector& contents = *available_contents_.front();
+    DCHECK_LT(next_content_index_, contents.size());
+    *data = contents[next_content_index_].first;
+    *length = contents[next_content_index_].second;
+    contents[next_content_index_].first = NULL;
+    if (++next_content_index_ == contents.size()) {
+      available_contents_.pop_front();
+      next_content_index_ = 0;
+    }
     unreported_consumed_bytes_ += *length;
 
     MaybeUpdateInput();
@@ -397,9 +411,11 @@ void ByteStreamReaderImpl::TransferDataInternal(
   bool was_empty = available_contents_.empty();
 
   if (transfer_buffer) {
-    available_contents_.insert(available_contents_.end(),
-                               transfer_buffer->begin(),
-                               transfer_buffer->end());
+    // The writer only sends a buffer when it has contents; queueing it
+    // whole avoids per-chunk work proportional to the transfer size.
+    DCHECK(!transfer_buffer->empty());
+    available_contents_.push_back(
+        linked_ptr<ContentVector>(transfer_buffer.release()));
   }
 
   if (source_complete) {
@@ -244,6 +244,45 @@ TEST_F(ByteStreamTest, ByteStream_PushBackSplit) {
             byte_stream_output->Read(&output_io_buffer, &output_length));
 }
 
+// Confirm that data is returned in order when reads are interleaved
+// with the arrival of later transfer batches.
+TEST_F(ByteStreamTest, ByteStream_ReadsAcrossTransferBatches) {
+  scoped_ptr<ByteStreamWriter> byte_stream_input;
+  scoped_ptr<ByteStreamReader> byte_stream_output;
+  CreateByteStream(
+      message_loop_.message_loop_proxy(), message_loop_.message_loop_proxy(),
+      3 * 1024, &byte_stream_input, &byte_stream_output);
+
+  // Two writes crossing the sending threshold make a single transfer
+  // batch holding both buffers.
+  EXPECT_TRUE(Write(byte_stream_input.get(), 1024));
+  EXPECT_TRUE(Write(byte_stream_input.get(), 1024));
+  message_loop_.RunUntilIdle();
+
+  // Read only part of the first batch.
+  scoped_refptr<net::IOBuffer> output_io_buffer;
+  size_t output_length;
+  EXPECT_EQ(ByteStreamReader::STREAM_HAS_DATA,
+            byte_stream_output->Read(&output_io_buffer, &output_length));
+  EXPECT_TRUE(ValidateIOBuffer(output_io_buffer, output_length));
+
+  // A second batch arrives while the first is partly consumed.
+  EXPECT_TRUE(Write(byte_stream_input.get(), 1024));
+  byte_stream_input->Flush();
+  message_loop_.RunUntilIdle();
+
+  EXPECT_EQ(ByteStreamReader::STREAM_HAS_DATA,
+            byte_stream_output->Read(&output_io_buffer, &output_length));
+  EXPECT_TRUE(ValidateIOBuffer(output_io_buffer, output_length));
+
+  EXPECT_EQ(ByteStreamReader::STREAM_HAS_DATA,
+            byte_stream_output->Read(&output_io_buffer, &output_length));
+  EXPECT_TRUE(ValidateIOBuffer(output_io_buffer, output_length));
+
+  EXPECT_EQ(ByteStreamReader::STREAM_EMPTY,
+            byte_stream_output->Read(&output_io_buffer, &output_length));
+}
+
 // Confirm that a Close() notification transmits in-order
 // with data on the stream.
 TEST_F(ByteStreamTest, ByteStream_CompleteTransmits) {
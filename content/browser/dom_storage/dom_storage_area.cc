@@ -134,8 +134,16 @@ bool DOMStorageArea::SetItem(const base::string16& key,
   if (is_shutdown_)
     return false;
   InitialImportIfNeeded();
-  if (!map_->HasOneRef())
+  if (!map_->HasOneRef()) {
+    // The map is shared with clones of this area; don't pay for a deep
+    // copy on a write that changes nothing.
+    base::NullableString16 current_value = map_->GetItem(key);
+    if (!current_value.is_null() && current_value.string() == value) {
+      *old_value = current_value;
+      return true;
+    }
     map_ = map_->DeepCopy();
+  }
   bool success = map_->SetItem(key, value, old_value);
   if (success && backing_) {
     CommitBatch* commit_batch = CreateCommitBatchIfNeeded();
@@ -149,8 +157,12 @@ bool DOMStorageArea::RemoveItem(const base::string16& key,
   if (is_shutdown_)
     return false;
   InitialImportIfNeeded();
-  if (!map_->HasOneRef())
+  if (!map_->HasOneRef()) {
+    // Removing a key that isn't there is a no-op; keep sharing the map.
+    if (map_->GetItem(key).is_null())
+      return false;
     map_ = map_->DeepCopy();
+  }
   bool success = map_->RemoveItem(key, old_value);
   if (success && backing_) {
     CommitBatch* commit_batch = CreateCommitBatchIfNeeded();
@@ -106,6 +106,15 @@ TEST_F(DOMStorageAreaTest, DOMStorageAreaBasics) {
   EXPECT_NE(copy->map_.get(), area->map_.get());
   copy = area->ShallowCopy(2, std::string());
   EXPECT_EQ(copy->map_.get(), area->map_.get());
+
+  // Writes that change nothing don't trigger the deep copy-on-write: a
+  // same-value set or a remove of an absent key leaves the map shared.
+  EXPECT_TRUE(area->SetItem(kKey, kValue, &old_nullable_value));
+  EXPECT_EQ(kValue, old_nullable_value.string());
+  EXPECT_EQ(copy->map_.get(), area->map_.get());
+  EXPECT_FALSE(area->RemoveItem(ASCIIToUTF16("no_such_key"), &old_value));
+  EXPECT_EQ(copy->map_.get(), area->map_.get());
+
   EXPECT_NE(0u, area->Length());
   EXPECT_TRUE(area->Clear());
   EXPECT_EQ(0u, area->Length());
@@ -120,7 +120,6 @@ void IndexedDBCursor::CursorPrefetchIterationOperation(
   std::vector<IndexedDBKey> found_primary_keys;
   std::vector<IndexedDBValue> found_values;
 
-  saved_cursor_.reset();
   const size_t max_size_estimate = 10 * 1024 * 1024;
   size_t size_estimate = 0;
   leveldb::Status s;
@@ -134,9 +133,11 @@ void IndexedDBCursor::CursorPrefetchIterationOperation(
       break;
     }
 
-    if (i == 0) {
+    if (i == 0 && !saved_cursor_) {
       // First prefetched result is always used, so that's the position
-      // a cursor should be reset to if the prefetch is invalidated.
+      // a cursor should be reset to if the prefetch is invalidated. The
+      // saved position spans consecutive batches of a prefetch run; the
+      // front end counts used results across the whole run.
       saved_cursor_.reset(cursor_->Clone());
     }
 
@@ -164,11 +165,8 @@ void IndexedDBCursor::CursorPrefetchIterationOperation(
       break;
   }
 
-  if (!found_keys.size()) {
-    callbacks->OnSuccess(static_cast<IndexedDBValue*>(NULL));
-    return;
-  }
-
+  // Always reply in prefetch form, even when empty, so the front end can
+  // settle its refill bookkeeping for this request.
   callbacks->OnSuccessWithPrefetch(
       found_keys, found_primary_keys, &found_values);
 }
@@ -14,6 +14,7 @@
 #include "content/browser/indexed_db/indexed_db_database_callbacks.h"
 #include "content/browser/indexed_db/indexed_db_tracing.h"
 #include "content/browser/indexed_db/indexed_db_transaction_coordinator.h"
+#include "content/browser/indexed_db/leveldb/leveldb_transaction.h"
 #include "third_party/WebKit/public/platform/WebIDBDatabaseException.h"
 
 namespace content {
@@ -342,6 +343,14 @@ void IndexedDBTransaction::ProcessTaskQueue() {
 
   if (!backing_store_transaction_begun_) {
     transaction_->Begin();
+    // Schema changes must reach disk before the transaction completes, but
+    // for ordinary transactions the write-ahead log plus the synced
+    // background compactions provide enough durability; skipping the sync
+    // lets a burst of small transactions share a single flush. The fake
+    // backing store used in tests has no leveldb transaction.
+    if (mode_ != blink::WebIDBTransactionModeVersionChange &&
+        transaction_->transaction())
+      transaction_->transaction()->set_sync_on_commit(false);
     backing_store_transaction_begun_ = true;
   }
 
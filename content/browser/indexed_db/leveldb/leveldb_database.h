@@ -89,7 +89,8 @@ class CONTENT_EXPORT LevelDBDatabase {
                               std::string* value,
                               bool* found,
                               const LevelDBSnapshot* = 0);
-  leveldb::Status Write(const LevelDBWriteBatch& write_batch);
+  // |sync| controls whether the write is flushed to disk before returning.
+  leveldb::Status Write(const LevelDBWriteBatch& write_batch, bool sync);
   scoped_ptr<LevelDBIterator> CreateIterator(const LevelDBSnapshot* = 0);
   const LevelDBComparator* Comparator() const;
   void Compact(const base::StringPiece& start, const base::StringPiece& stop);
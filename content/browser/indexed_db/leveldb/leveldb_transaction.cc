@@ -21,7 +21,8 @@ LevelDBTransaction::LevelDBTransaction(LevelDBDatabase* db)
       comparator_(db->Comparator()),
       data_comparator_(comparator_),
       data_(data_comparator_),
-      finished_(false) {}
+      finished_(false),
+      sync_on_commit_(true) {}
 
 LevelDBTransaction::Record::Record() : deleted(false) {}
 LevelDBTransaction::Record::~Record() {}
@@ -104,7 +105,7 @@ leveldb::Status LevelDBTransaction::Commit() {
       write_batch->Remove(iterator.first);
   }
 
-  leveldb::Status s = db_->Write(*write_batch);
+  leveldb::Status s = db_->Write(*write_batch, sync_on_commit_);
   if (s.ok()) {
     Clear();
     finished_ = true;
@@ -483,7 +484,7 @@ void LevelDBDirectTransaction::Remove(const StringPiece& key) {
 leveldb::Status LevelDBDirectTransaction::Commit() {
   DCHECK(!finished_);
 
-  leveldb::Status s = db_->Write(*write_batch_);
+  leveldb::Status s = db_->Write(*write_batch_, true /* sync */);
   if (s.ok()) {
     finished_ = true;
     write_batch_->Clear();
@@ -32,6 +32,13 @@ class CONTENT_EXPORT LevelDBTransaction
   virtual leveldb::Status Commit();
   void Rollback();
 
+  // Controls whether Commit() flushes the write to disk before returning.
+  // Defaults to true; transactions whose contents are adequately protected
+  // by the write-ahead log may opt out to avoid a sync per commit.
+  void set_sync_on_commit(bool sync_on_commit) {
+    sync_on_commit_ = sync_on_commit;
+  }
+
   scoped_ptr<LevelDBIterator> CreateIterator();
 
  protected:
@@ -140,6 +147,7 @@ class CONTENT_EXPORT LevelDBTransaction
   Comparator data_comparator_;
   DataType data_;
   bool finished_;
+  bool sync_on_commit_;
   std::set<TransactionIterator*> iterators_;
 
   DISALLOW_COPY_AND_ASSIGN(LevelDBTransaction);
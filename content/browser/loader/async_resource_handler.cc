@@ -124,14 +124,18 @@ void AsyncResourceHandler::OnFollowRedirect(int request_id) {
   ResumeIfDeferred();
 }
 
-void AsyncResourceHandler::OnDataReceivedACK(int request_id) {
-  if (pending_data_count_) {
-    --pending_data_count_;
+void AsyncResourceHandler::OnDataReceivedACK(int request_id,
+                                             int number_of_chunks) {
+  if (!pending_data_count_ || number_of_chunks < 1)
+    return;
 
+  number_of_chunks = std::min(number_of_chunks, pending_data_count_);
+  pending_data_count_ -= number_of_chunks;
+  while (number_of_chunks--)
     buffer_->RecycleLeastRecentlyAllocated();
-    if (buffer_->CanAllocate())
-      ResumeIfDeferred();
-  }
+
+  if (buffer_->CanAllocate())
+    ResumeIfDeferred();
 }
 
 bool AsyncResourceHandler::OnUploadProgress(uint64 position,
@@ -65,6 +65,10 @@ const char* GetNumClientsString(size_t num_clients) {
 
 static const size_t kCoalescedTimerPeriod = 5000;
 static const size_t kMaxNumDelayableRequestsPerClient = 10;
+// Clients that are neither visible nor audible get a much smaller delayable
+// budget, so a background tab fanning out requests cannot crowd out fetches
+// for the tab the user is watching or listening to.
+static const size_t kMaxNumDelayableRequestsPerBackgroundClient = 2;
 static const size_t kMaxNumDelayableRequestsPerHost = 6;
 static const size_t kMaxNumThrottledRequestsPerClient = 1;
 
@@ -374,6 +378,9 @@ class ResourceScheduler::Client {
       return;
     last_active_switch_time_ = base::TimeTicks::Now();
     UpdateThrottleState();
+    // The delayable budget depends on observability; requests that were held
+    // back under the background budget may now be startable.
+    LoadAnyStartablePendingRequests();
   }
 
   void OnLoadingStateChanged(bool is_loaded) {
@@ -646,6 +653,12 @@ class ResourceScheduler::Client {
     request->Start();
   }
 
+  // The delayable budget is weighted by user observability.
+  size_t MaxNumDelayableRequests() const {
+    return is_active() ? kMaxNumDelayableRequestsPerClient
+                       : kMaxNumDelayableRequestsPerBackgroundClient;
+  }
+
   // ShouldStartRequest is the main scheduling algorithm.
   //
   // Requests are evaluated on five attributes:
@@ -738,7 +751,7 @@ class ResourceScheduler::Client {
       return START_REQUEST;
     }
 
-    if (in_flight_delayable_count_ >= kMaxNumDelayableRequestsPerClient) {
+    if (in_flight_delayable_count_ >= MaxNumDelayableRequests()) {
       return DO_NOT_START_REQUEST_AND_STOP_SEARCHING;
     }
 
@@ -463,6 +463,27 @@ TEST_F(ResourceSchedulerTest, LimitedNumberOfDelayableRequestsInFlight) {
   EXPECT_FALSE(last_differenthost->started());
 }
 
+TEST_F(ResourceSchedulerTest, BackgroundClientGetsSmallerDelayableBudget) {
+  // We only load low priority resources if there's a body.
+  scheduler_.OnWillInsertBody(kBackgroundChildId, kBackgroundRouteId);
+
+  const int kMaxNumDelayableRequestsPerBackgroundClient = 2;  // Matches .cc.
+  ScopedVector<TestRequest> lows;
+  for (int i = 0; i < kMaxNumDelayableRequestsPerBackgroundClient; ++i) {
+    string url = "http://host" + base::IntToString(i) + "/low";
+    lows.push_back(NewBackgroundRequest(url.c_str(), net::LOWEST));
+    EXPECT_TRUE(lows[i]->started());
+  }
+
+  scoped_ptr<TestRequest> last(NewBackgroundRequest("http://host_new/last",
+                                                    net::LOWEST));
+  EXPECT_FALSE(last->started());
+
+  // Becoming visible restores the full delayable budget.
+  scheduler_.OnVisibilityChanged(kBackgroundChildId, kBackgroundRouteId, true);
+  EXPECT_TRUE(last->started());
+}
+
 TEST_F(ResourceSchedulerTest, RaisePriorityAndStart) {
   // Dummies to enforce scheduling.
   scoped_ptr<TestRequest> high(NewRequest("http://host/high", net::HIGHEST));
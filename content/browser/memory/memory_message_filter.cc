@@ -0,0 +1,39 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "content/browser/memory/memory_message_filter.h"
+
+#include "base/bind.h"
+#include "content/common/child_process_messages.h"
+
+namespace content {
+
+MemoryMessageFilter::MemoryMessageFilter()
+    : BrowserMessageFilter(ChildProcessMsgStart) {
+}
+
+MemoryMessageFilter::~MemoryMessageFilter() {
+}
+
+void MemoryMessageFilter::OnFilterAdded(IPC::Sender* sender) {
+  // Unretained is safe because the listener is destroyed before the filter.
+  memory_pressure_listener_.reset(new base::MemoryPressureListener(
+      base::Bind(&MemoryMessageFilter::OnMemoryPressure,
+                 base::Unretained(this))));
+}
+
+void MemoryMessageFilter::OnChannelClosing() {
+  memory_pressure_listener_.reset();
+}
+
+bool MemoryMessageFilter::OnMessageReceived(const IPC::Message& message) {
+  return false;
+}
+
+void MemoryMessageFilter::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
+  Send(new ChildProcessMsg_NotifyMemoryPressure(memory_pressure_level));
+}
+
+}  // namespace content
@@ -0,0 +1,44 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CONTENT_BROWSER_MEMORY_MEMORY_MESSAGE_FILTER_H_
+#define CONTENT_BROWSER_MEMORY_MEMORY_MESSAGE_FILTER_H_
+
+#include "base/memory/memory_pressure_listener.h"
+#include "base/memory/scoped_ptr.h"
+#include "content/common/content_export.h"
+#include "content/public/browser/browser_message_filter.h"
+
+namespace content {
+
+// This class forwards memory pressure notifications from the browser process
+// to its child processes, so that all of them release memory in concert.
+// See also: child_thread.cc, where the notification is re-raised.
+class CONTENT_EXPORT MemoryMessageFilter : public BrowserMessageFilter {
+ public:
+  MemoryMessageFilter();
+
+  // BrowserMessageFilter implementation.
+  void OnFilterAdded(IPC::Sender* sender) override;
+  void OnChannelClosing() override;
+  bool OnMessageReceived(const IPC::Message& message) override;
+
+ protected:
+  ~MemoryMessageFilter() override;
+
+ private:
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
+
+  // Created and destroyed on the IO thread, where the filter is added to the
+  // channel, so pressure notifications arrive on a thread where Send() can be
+  // called directly.
+  scoped_ptr<base::MemoryPressureListener> memory_pressure_listener_;
+
+  DISALLOW_COPY_AND_ASSIGN(MemoryMessageFilter);
+};
+
+}  // namespace content
+
+#endif  // CONTENT_BROWSER_MEMORY_MEMORY_MESSAGE_FILTER_H_
@@ -310,6 +310,11 @@ namespace {
 
 // Version number of the database.
 //
+// Version 8 adds the domain_key column and an index over it. The column
+// holds the precomputed eTLD+1 of each host key, so that start up no longer
+// has to run the registry-controlled-domain parser over every distinct host
+// in the store before any cookie can be loaded.
+//
 // Version 7 adds encrypted values.  Old values will continue to be used but
 // all new values written will be encrypted on selected operating systems.  New
 // records read by old clients will simply get an empty cookie value while old
@@ -333,7 +338,7 @@ namespace {
 // Version 3 updated the database to include the last access time, so we can
 // expire them in decreasing order of use when we've reached the maximum
 // number of cookies.
-const int kCurrentVersionNumber = 7;
+const int kCurrentVersionNumber = 8;
 const int kCompatibleVersionNumber = 5;
 
 // Possible values for the 'priority' column.
@@ -411,7 +416,8 @@ bool InitTable(sql::Connection* db) {
             "has_expires INTEGER NOT NULL DEFAULT 1, "
             "persistent INTEGER NOT NULL DEFAULT 1,"
             "priority INTEGER NOT NULL DEFAULT %d,"
-            "encrypted_value BLOB DEFAULT '')",
+            "encrypted_value BLOB DEFAULT '',"
+            "domain_key TEXT NOT NULL DEFAULT '')",
         CookiePriorityToDBCookiePriority(net::COOKIE_PRIORITY_DEFAULT)));
     if (!db->Execute(stmt.c_str()))
       return false;
@@ -425,9 +431,20 @@ bool InitTable(sql::Connection* db) {
   if (!db->Execute("CREATE INDEX IF NOT EXISTS domain ON cookies(host_key)"))
     return false;
 
+  if (!db->Execute(
+          "CREATE INDEX IF NOT EXISTS domain_key ON cookies(domain_key)"))
+    return false;
+
   return true;
 }
 
+// Returns the domain key (eTLD+1) for |domain|, under which all of its
+// cookies are loaded in one chunk.
+std::string GetKey(const std::string& domain) {
+  return net::registry_controlled_domains::GetDomainAndRegistry(
+      domain, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+}
+
 }  // namespace
 
 void SQLitePersistentCookieStore::Backend::Load(
@@ -628,11 +645,14 @@ bool SQLitePersistentCookieStore::Backend::InitializeDatabase() {
 
   start = base::Time::Now();
 
-  // Retrieve all the domains
+  // Retrieve all the domains together with their precomputed domain keys
+  // (always eTLD+1) to build a map of domain keys to domains.
   sql::Statement smt(db_->GetUniqueStatement(
-    "SELECT DISTINCT host_key FROM cookies"));
+      "SELECT DISTINCT domain_key, host_key FROM cookies"));
+  sql::Statement update_key_smt(db_->GetUniqueStatement(
+      "UPDATE cookies SET domain_key=? WHERE host_key=? AND domain_key=''"));
 
-  if (!smt.is_valid()) {
+  if (!smt.is_valid() || !update_key_smt.is_valid()) {
     if (corruption_detected_)
       db_->Raze();
     meta_table_.Reset();
@@ -640,32 +660,29 @@ bool SQLitePersistentCookieStore::Backend::InitializeDatabase() {
     return false;
   }
 
-  std::vector<std::string> host_keys;
-  while (smt.Step())
-    host_keys.push_back(smt.ColumnString(0));
-
-  UMA_HISTOGRAM_CUSTOM_TIMES(
-      "Cookie.TimeLoadDomains",
-      base::Time::Now() - start,
-      base::TimeDelta::FromMilliseconds(1), base::TimeDelta::FromMinutes(1),
-      50);
-
-  base::Time start_parse = base::Time::Now();
-
-  // Build a map of domain keys (always eTLD+1) to domains.
-  for (size_t idx = 0; idx < host_keys.size(); ++idx) {
-    const std::string& domain = host_keys[idx];
-    std::string key =
-        net::registry_controlled_domains::GetDomainAndRegistry(
-            domain,
-            net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
-
+  while (smt.Step()) {
+    std::string key = smt.ColumnString(0);
+    const std::string domain = smt.ColumnString(1);
+    if (key.empty()) {
+      // Rows written by clients predating the domain_key column carry an
+      // empty key. Compute it now and backfill the column so that the next
+      // start up can rely on the index. Hosts without a registry-controlled
+      // domain (IP addresses, for instance) legitimately map to the empty
+      // key and are recomputed harmlessly.
+      key = GetKey(domain);
+      if (!key.empty()) {
+        update_key_smt.Reset(true);
+        update_key_smt.BindString(0, key);
+        update_key_smt.BindString(1, domain);
+        ignore_result(update_key_smt.Run());
+      }
+    }
     keys_to_load_[key].insert(domain);
   }
 
   UMA_HISTOGRAM_CUSTOM_TIMES(
-      "Cookie.TimeParseDomains",
-      base::Time::Now() - start_parse,
+      "Cookie.TimeLoadDomains",
+      base::Time::Now() - start,
       base::TimeDelta::FromMilliseconds(1), base::TimeDelta::FromMinutes(1),
       50);
 
@@ -916,6 +933,45 @@ bool SQLitePersistentCookieStore::Backend::EnsureDatabaseVersion() {
                         base::TimeTicks::Now() - start_time);
   }
 
+  if (cur_version == 7) {
+    const base::TimeTicks start_time = base::TimeTicks::Now();
+    sql::Transaction transaction(db_.get());
+    if (!transaction.Begin())
+      return false;
+    // Alter the table to add the precomputed domain key column, then
+    // backfill it with the eTLD+1 of every host key in the store.
+    if (!db_->Execute("ALTER TABLE cookies "
+                      "ADD COLUMN domain_key TEXT NOT NULL DEFAULT ''")) {
+      LOG(WARNING) << "Unable to update cookie database to version 8.";
+      return false;
+    }
+    sql::Statement select_smt(
+        db_->GetUniqueStatement("SELECT DISTINCT host_key FROM cookies"));
+    sql::Statement update_smt(db_->GetUniqueStatement(
+        "UPDATE cookies SET domain_key=? WHERE host_key=?"));
+    if (!select_smt.is_valid() || !update_smt.is_valid()) {
+      LOG(WARNING) << "Unable to update cookie database to version 8.";
+      return false;
+    }
+    while (select_smt.Step()) {
+      const std::string domain = select_smt.ColumnString(0);
+      update_smt.Reset(true);
+      update_smt.BindString(0, GetKey(domain));
+      update_smt.BindString(1, domain);
+      if (!update_smt.Run()) {
+        LOG(WARNING) << "Unable to update cookie database to version 8.";
+        return false;
+      }
+    }
+    ++cur_version;
+    meta_table_.SetVersionNumber(cur_version);
+    meta_table_.SetCompatibleVersionNumber(
+        std::min(cur_version, kCompatibleVersionNumber));
+    transaction.Commit();
+    UMA_HISTOGRAM_TIMES("Cookie.TimeDatabaseMigrationToV8",
+                        base::TimeTicks::Now() - start_time);
+  }
+
   // Put future migration cases here.
 
   if (cur_version < kCurrentVersionNumber) {
@@ -1002,8 +1058,8 @@ void SQLitePersistentCookieStore::Backend::Commit() {
   sql::Statement add_smt(db_->GetCachedStatement(SQL_FROM_HERE,
       "INSERT INTO cookies (creation_utc, host_key, name, value, "
       "encrypted_value, path, expires_utc, secure, httponly, last_access_utc, "
-      "has_expires, persistent, priority) "
-      "VALUES (?,?,?,?,?,?,?,?,?,?,?,?,?)"));
+      "has_expires, persistent, priority, domain_key) "
+      "VALUES (?,?,?,?,?,?,?,?,?,?,?,?,?,?)"));
   if (!add_smt.is_valid())
     return;
 
@@ -1053,6 +1109,7 @@ void SQLitePersistentCookieStore::Backend::Commit() {
         add_smt.BindInt(11, po->cc().IsPersistent());
         add_smt.BindInt(
             12, CookiePriorityToDBCookiePriority(po->cc().Priority()));
+        add_smt.BindString(13, GetKey(po->cc().Domain()));
         if (!add_smt.Run())
           NOTREACHED() << "Could not add a cookie to the DB.";
         break;
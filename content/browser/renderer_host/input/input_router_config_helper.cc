@@ -18,6 +18,11 @@
 namespace content {
 namespace {
 
+// Mouse moves are forwarded to the renderer at most once per this interval,
+// roughly the frame interval of a 60Hz display; faster mice have their
+// intermediate moves coalesced with movement deltas accumulated.
+const int kMouseMoveIntervalMs = 16;
+
 #if defined(USE_AURA)
 // TODO(jdduke): Consolidate router configuration paths using
 // ui::GestureConfiguration.
@@ -114,6 +119,8 @@ TouchEventQueue::TouchScrollingMode GetTouchScrollingMode() {
 
 InputRouterImpl::Config GetInputRouterConfigForPlatform() {
   InputRouterImpl::Config config;
+  config.mouse_move_interval =
+      base::TimeDelta::FromMilliseconds(kMouseMoveIntervalMs);
   config.gesture_config = GetGestureEventQueueConfig();
   config.touch_config = GetTouchEventQueueConfig();
   config.touch_config.touch_scrolling_mode = GetTouchScrollingMode();
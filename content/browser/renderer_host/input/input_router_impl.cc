@@ -72,6 +72,7 @@ InputRouterImpl::InputRouterImpl(IPC::Sender* sender,
       select_message_pending_(false),
       move_caret_pending_(false),
       mouse_move_pending_(false),
+      mouse_move_interval_(config.mouse_move_interval),
       mouse_wheel_pending_(false),
       current_view_flags_(0),
       current_ack_source_(ACK_SOURCE_NONE),
@@ -204,16 +205,40 @@ void InputRouterImpl::SendMouseEventImmediately(
   // Avoid spamming the renderer with mouse move events.  It is important
   // to note that WM_MOUSEMOVE events are anyways synthetic, but since our
   // thread is able to rapidly consume WM_MOUSEMOVE events, we may get way
-  // more WM_MOUSEMOVE events than we wish to send to the renderer.
+  // more WM_MOUSEMOVE events than we wish to send to the renderer. Moves are
+  // withheld while a previously sent move awaits its ack and, if
+  // |mouse_move_interval_| is non-zero, until that interval has passed since
+  // the last send. Withheld moves coalesce into |next_mouse_move_|, which
+  // carries the newest position and timestamp with the movement deltas of
+  // the dropped events accumulated.
   if (mouse_event.event.type == WebInputEvent::MouseMove) {
-    if (mouse_move_pending_) {
+    base::TimeTicks now = base::TimeTicks::Now();
+    base::TimeDelta time_since_last_move = now - last_mouse_move_time_;
+    if (mouse_move_pending_ || time_since_last_move < mouse_move_interval_) {
       if (!next_mouse_move_)
         next_mouse_move_.reset(new MouseEventWithLatencyInfo(mouse_event));
       else
         next_mouse_move_->CoalesceWith(mouse_event);
+      if (!mouse_move_pending_ && !mouse_move_flush_timer_.IsRunning()) {
+        mouse_move_flush_timer_.Start(
+            FROM_HERE, mouse_move_interval_ - time_since_last_move, this,
+            &InputRouterImpl::FlushThrottledMouseMove);
+      }
       return;
     }
     mouse_move_pending_ = true;
+    last_mouse_move_time_ = now;
+    if (next_mouse_move_) {
+      // The flush timer hadn't fired yet; fold this event into the withheld
+      // move so its accumulated movement deltas aren't lost.
+      mouse_move_flush_timer_.Stop();
+      next_mouse_move_->CoalesceWith(mouse_event);
+      scoped_ptr<MouseEventWithLatencyInfo> coalesced_move =
+          next_mouse_move_.Pass();
+      FilterAndSendWebInputEvent(
+          coalesced_move->event, coalesced_move->latency, false);
+      return;
+    }
   }
 
   FilterAndSendWebInputEvent(mouse_event.event, mouse_event.latency, false);
@@ -614,6 +639,17 @@ void InputRouterImpl::ProcessMouseAck(blink::WebInputEvent::Type type,
   }
 }
 
+void InputRouterImpl::FlushThrottledMouseMove() {
+  // The withheld move may since have been dropped by an intervening non-move
+  // event, or claimed when another move passed the throttle.
+  if (mouse_move_pending_ || !next_mouse_move_)
+    return;
+  DCHECK(next_mouse_move_->event.type == WebInputEvent::MouseMove);
+  scoped_ptr<MouseEventWithLatencyInfo> next_mouse_move =
+      next_mouse_move_.Pass();
+  SendMouseEvent(*next_mouse_move);
+}
+
 void InputRouterImpl::ProcessWheelAck(InputEventAckState ack_result,
                                       const ui::LatencyInfo& latency) {
   // TODO(miletus): Add renderer side latency to each uncoalesced mouse
@@ -694,6 +730,7 @@ bool InputRouterImpl::HasPendingEvents() const {
          !gesture_event_queue_.empty() ||
          !key_queue_.empty() ||
          mouse_move_pending_ ||
+         next_mouse_move_ ||
          mouse_wheel_pending_ ||
          select_message_pending_ ||
          move_caret_pending_;
@@ -10,6 +10,7 @@
 #include "base/basictypes.h"
 #include "base/memory/scoped_ptr.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "content/browser/renderer_host/input/gesture_event_queue.h"
 #include "content/browser/renderer_host/input/input_router.h"
 #include "content/browser/renderer_host/input/touch_action_filter.h"
@@ -44,6 +45,10 @@ class CONTENT_EXPORT InputRouterImpl
  public:
   struct CONTENT_EXPORT Config {
     Config();
+    // Minimum interval between mouse moves forwarded to the renderer; moves
+    // arriving faster than this are coalesced. Zero (the default) sends each
+    // move as soon as its predecessor has been acked.
+    base::TimeDelta mouse_move_interval;
     GestureEventQueue::Config gesture_config;
     TouchEventQueue::Config touch_config;
   };
@@ -175,6 +180,10 @@ private:
   void ProcessMouseAck(blink::WebInputEvent::Type type,
                        InputEventAckState ack_result);
 
+  // Sends a |next_mouse_move_| withheld only by |mouse_move_interval_| once
+  // that interval has elapsed.
+  void FlushThrottledMouseMove();
+
   // Dispatches the ack'ed event to |ack_handler_|, forwarding queued events
   // from |coalesced_mouse_wheel_events_|.
   void ProcessWheelAck(InputEventAckState ack_result,
@@ -231,9 +240,19 @@ private:
   bool mouse_move_pending_;
 
   // The next mouse move event to send (only non-null while mouse_move_pending_
-  // is true).
+  // is true or while a move is withheld by |mouse_move_interval_|).
   scoped_ptr<MouseEventWithLatencyInfo> next_mouse_move_;
 
+  // Minimum spacing between forwarded mouse moves, from the Config; zero
+  // disables interval-based throttling.
+  base::TimeDelta mouse_move_interval_;
+
+  // The time at which the last mouse move was forwarded to the renderer.
+  base::TimeTicks last_mouse_move_time_;
+
+  // Fires when a move withheld by |mouse_move_interval_| comes due.
+  base::OneShotTimer<InputRouterImpl> mouse_move_flush_timer_;
+
   // (Similar to |mouse_move_pending_|.) True if a mouse wheel event was sent
   // and we are waiting for a corresponding ack.
   bool mouse_wheel_pending_;
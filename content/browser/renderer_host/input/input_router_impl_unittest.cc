@@ -180,6 +180,13 @@ class InputRouterImplTest : public testing::Test {
     SetUp();
   }
 
+  void SetUpForMouseMoveThrottleTest(int interval_ms) {
+    config_.mouse_move_interval =
+        base::TimeDelta::FromMilliseconds(interval_ms);
+    TearDown();
+    SetUp();
+  }
+
   void SimulateKeyboardEvent(WebInputEvent::Type type, bool is_shortcut) {
     WebKeyboardEvent event = SyntheticWebKeyboardEventBuilder::Build(type);
     NativeWebKeyboardEvent native_event;
@@ -771,6 +778,47 @@ TEST_F(InputRouterImplTest, CoalescesWheelEvents) {
   EXPECT_EQ(0U, GetSentMessageCountAndResetSink());
 }
 
+// Tests that, with a minimum mouse move interval configured, mouse moves
+// arriving faster than that interval are coalesced and sent once per
+// interval rather than once per ack.
+TEST_F(InputRouterImplTest, ThrottlesMouseMoves) {
+  const int interval_ms = 100;
+  SetUpForMouseMoveThrottleTest(interval_ms);
+
+  // The first move is sent immediately.
+  SimulateMouseEvent(WebInputEvent::MouseMove, 1, 1);
+  EXPECT_EQ(1u, GetSentMessageCountAndResetSink());
+
+  // Moves arriving within the interval are withheld, even though the first
+  // move has already been acked.
+  SendInputEventACK(WebInputEvent::MouseMove,
+                    INPUT_EVENT_ACK_STATE_NOT_CONSUMED);
+  SimulateMouseEvent(WebInputEvent::MouseMove, 2, 2);
+  SimulateMouseEvent(WebInputEvent::MouseMove, 3, 3);
+  EXPECT_EQ(0u, GetSentMessageCountAndResetSink());
+  EXPECT_TRUE(HasPendingEvents());
+
+  // Once the interval has elapsed, a single coalesced move carrying the
+  // latest position goes out.
+  RunTasksAndWait(base::TimeDelta::FromMilliseconds(interval_ms + 10));
+  EXPECT_TRUE(process_->sink().GetUniqueMessageMatching(
+      InputMsg_HandleInputEvent::ID));
+  const WebInputEvent* input_event =
+      GetInputEventFromMessage(*process_->sink().GetMessageAt(0));
+  ASSERT_EQ(WebInputEvent::MouseMove, input_event->type);
+  const WebMouseEvent* mouse_event =
+      static_cast<const WebMouseEvent*>(input_event);
+  EXPECT_EQ(3, mouse_event->x);
+  EXPECT_EQ(3, mouse_event->y);
+  EXPECT_EQ(1u, GetSentMessageCountAndResetSink());
+
+  // After the ack, nothing further is sent and no events remain pending.
+  SendInputEventACK(WebInputEvent::MouseMove,
+                    INPUT_EVENT_ACK_STATE_NOT_CONSUMED);
+  EXPECT_EQ(0u, GetSentMessageCountAndResetSink());
+  EXPECT_FALSE(HasPendingEvents());
+}
+
 // Tests that touch-events are queued properly.
 TEST_F(InputRouterImplTest, TouchEventQueue) {
   OnHasTouchEventHandlers(true);
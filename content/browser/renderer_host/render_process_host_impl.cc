@@ -64,6 +64,7 @@
 #include "content/browser/media/capture/audio_mirroring_manager.h"
 #include "content/browser/media/media_internals.h"
 #include "content/browser/media/midi_host.h"
+#include "content/browser/memory/memory_message_filter.h"
 #include "content/browser/message_port_message_filter.h"
 #include "content/browser/mime_registry_message_filter.h"
 #include "content/browser/mojo/mojo_application_host.h"
@@ -645,6 +646,12 @@ bool RenderProcessHostImpl::Init() {
     fast_shutdown_started_ = false;
   }
 
+  // Queued ahead of any view or worker creation message, this lets the
+  // renderer bring up Blink and its V8 isolate while the browser is still
+  // busy with navigation work, instead of paying for it on the critical path
+  // of the first commit.
+  Send(new ViewMsg_WarmupWebKit());
+
   if (!gpu_observer_registered_) {
     gpu_observer_registered_ = true;
     ui::GpuSwitchingManager::GetInstance()->AddObserver(this);
@@ -858,6 +865,7 @@ void RenderProcessHostImpl::CreateMessageFilters() {
 #endif
 
   AddFilter(new TraceMessageFilter());
+  AddFilter(new MemoryMessageFilter());
   AddFilter(new ResolveProxyMsgHelper(
       browser_context->GetRequestContextForRenderProcess(GetID())));
   AddFilter(new QuotaDispatcherHost(
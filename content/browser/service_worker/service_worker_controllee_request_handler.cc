@@ -241,6 +241,15 @@ ServiceWorkerControlleeRequestHandler::DidLookupRegistrationForMainResource(
   ServiceWorkerMetrics::CountControlledPageLoad();
 
   provider_host_->AssociateRegistration(registration.get());
+
+  // Start the worker now, so that process launch and script evaluation
+  // overlap with the request job getting under way; the fetch event is
+  // dispatched as soon as the worker has finished starting.
+  if (active_version->running_status() != ServiceWorkerVersion::RUNNING) {
+    active_version->StartWorker(
+        base::Bind(&ServiceWorkerUtils::NoOpStatusCallback));
+  }
+
   job_->ForwardToServiceWorker();
   TRACE_EVENT_ASYNC_END2(
       "ServiceWorker",
@@ -266,6 +275,12 @@ void ServiceWorkerControlleeRequestHandler::OnVersionStatusChanged(
   ServiceWorkerMetrics::CountControlledPageLoad();
 
   provider_host_->AssociateRegistration(registration);
+
+  // As in DidLookupRegistrationForMainResource, get the worker started
+  // before the job needs it.
+  if (version->running_status() != ServiceWorkerVersion::RUNNING)
+    version->StartWorker(base::Bind(&ServiceWorkerUtils::NoOpStatusCallback));
+
   job_->ForwardToServiceWorker();
 }
 
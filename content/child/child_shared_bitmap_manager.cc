@@ -14,6 +14,14 @@ namespace content {
 
 namespace {
 
+// Freed bitmaps no larger than this stay mapped and registered with the
+// host so a same-sized allocation can reuse them; large enough for
+// favicons, cursors and thumbnails, small enough to exclude whole frames.
+const size_t kMaxRecycledBufferSize = 1024 * 1024;
+
+// Upper bound on the number of freed bitmaps kept for reuse.
+const size_t kMaxRecycledBitmaps = 8;
+
 class ChildSharedBitmap : public SharedMemoryBitmap {
  public:
   ChildSharedBitmap(scoped_refptr<ThreadSafeSender> sender,
@@ -22,21 +30,32 @@ class ChildSharedBitmap : public SharedMemoryBitmap {
       : SharedMemoryBitmap(static_cast<uint8*>(shared_memory->memory()),
                            id,
                            shared_memory),
-        sender_(sender) {}
+        sender_(sender),
+        manager_(nullptr) {}
 
   ChildSharedBitmap(scoped_refptr<ThreadSafeSender> sender,
+                    ChildSharedBitmapManager* manager,
                     scoped_ptr<base::SharedMemory> shared_memory_holder,
                     const cc::SharedBitmapId& id)
       : ChildSharedBitmap(sender, shared_memory_holder.get(), id) {
+    manager_ = manager;
     shared_memory_holder_ = shared_memory_holder.Pass();
   }
 
   ~ChildSharedBitmap() override {
+    // Offer the buffer back to the manager; if it's kept for reuse the
+    // host side registration stays live under the same id.
+    if (manager_ &&
+        manager_->ReleaseSharedMemoryBitmap(shared_memory_holder_.Pass(),
+                                            id())) {
+      return;
+    }
     sender_->Send(new ChildProcessHostMsg_DeletedSharedBitmap(id()));
   }
 
  private:
   scoped_refptr<ThreadSafeSender> sender_;
+  ChildSharedBitmapManager* manager_;
   scoped_ptr<base::SharedMemory> shared_memory_holder_;
 };
 
@@ -80,7 +99,12 @@ ChildSharedBitmapManager::ChildSharedBitmapManager(
     : sender_(sender) {
 }
 
-ChildSharedBitmapManager::~ChildSharedBitmapManager() {}
+ChildSharedBitmapManager::~ChildSharedBitmapManager() {
+  for (std::deque<RecycledBitmap>::iterator it = recycled_bitmaps_.begin();
+       it != recycled_bitmaps_.end(); ++it) {
+    sender_->Send(new ChildProcessHostMsg_DeletedSharedBitmap(it->id));
+  }
+}
 
 scoped_ptr<cc::SharedBitmap> ChildSharedBitmapManager::AllocateSharedBitmap(
     const gfx::Size& size) {
@@ -101,6 +125,24 @@ ChildSharedBitmapManager::AllocateSharedMemoryBitmap(const gfx::Size& size) {
   size_t memory_size;
   if (!cc::SharedBitmap::SizeInBytes(size, &memory_size))
     return scoped_ptr<SharedMemoryBitmap>();
+
+  // Reuse a recently freed buffer of the same size if we have one; it is
+  // still mapped here and registered with the host, so no allocation or
+  // round trip is needed.
+  {
+    base::AutoLock lock(lock_);
+    for (std::deque<RecycledBitmap>::iterator it = recycled_bitmaps_.begin();
+         it != recycled_bitmaps_.end(); ++it) {
+      if (it->buffer_size != memory_size)
+        continue;
+      scoped_ptr<base::SharedMemory> memory(it->memory.release());
+      cc::SharedBitmapId recycled_id = it->id;
+      recycled_bitmaps_.erase(it);
+      return make_scoped_ptr(
+          new ChildSharedBitmap(sender_, this, memory.Pass(), recycled_id));
+    }
+  }
+
   cc::SharedBitmapId id = cc::SharedBitmap::GenerateId();
   scoped_ptr<base::SharedMemory> memory;
 #if defined(OS_POSIX)
@@ -128,7 +170,35 @@ ChildSharedBitmapManager::AllocateSharedMemoryBitmap(const gfx::Size& size) {
   sender_->Send(new ChildProcessHostMsg_AllocatedSharedBitmap(
       memory_size, handle_to_send, id));
 #endif
-  return make_scoped_ptr(new ChildSharedBitmap(sender_, memory.Pass(), id));
+  return make_scoped_ptr(
+      new ChildSharedBitmap(sender_, this, memory.Pass(), id));
+}
+
+bool ChildSharedBitmapManager::ReleaseSharedMemoryBitmap(
+    scoped_ptr<base::SharedMemory> memory,
+    const cc::SharedBitmapId& id) {
+  if (!memory || !memory->memory())
+    return false;
+  size_t buffer_size = memory->mapped_size();
+  if (buffer_size == 0 || buffer_size > kMaxRecycledBufferSize)
+    return false;
+
+  cc::SharedBitmapId evicted_id;
+  bool evicted = false;
+  {
+    base::AutoLock lock(lock_);
+    if (recycled_bitmaps_.size() >= kMaxRecycledBitmaps) {
+      evicted_id = recycled_bitmaps_.front().id;
+      evicted = true;
+      recycled_bitmaps_.pop_front();
+    }
+    RecycledBitmap bitmap = {make_linked_ptr(memory.release()), id,
+                             buffer_size};
+    recycled_bitmaps_.push_back(bitmap);
+  }
+  if (evicted)
+    sender_->Send(new ChildProcessHostMsg_DeletedSharedBitmap(evicted_id));
+  return true;
 }
 
 scoped_ptr<cc::SharedBitmap> ChildSharedBitmapManager::GetSharedBitmapFromId(
@@ -5,9 +5,13 @@
 #ifndef CONTENT_CHILD_CHILD_SHARED_BITMAP_MANAGER_H_
 #define CONTENT_CHILD_CHILD_SHARED_BITMAP_MANAGER_H_
 
+#include <deque>
+
+#include "base/memory/linked_ptr.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
 #include "base/memory/shared_memory.h"
+#include "base/synchronization/lock.h"
 #include "cc/resources/shared_bitmap_manager.h"
 #include "content/child/thread_safe_sender.h"
 
@@ -42,9 +46,27 @@ class ChildSharedBitmapManager : public cc::SharedBitmapManager {
   scoped_ptr<SharedMemoryBitmap> AllocateSharedMemoryBitmap(
       const gfx::Size& size);
 
+  // Takes back a deleted bitmap's shared memory so a later same-sized
+  // allocation can reuse it. Returns true if the buffer was kept, in which
+  // case its registration with the host stays live; otherwise the caller
+  // must notify the host of the deletion.
+  bool ReleaseSharedMemoryBitmap(scoped_ptr<base::SharedMemory> memory,
+                                 const cc::SharedBitmapId& id);
+
  private:
+  struct RecycledBitmap {
+    linked_ptr<base::SharedMemory> memory;
+    cc::SharedBitmapId id;
+    size_t buffer_size;
+  };
+
   scoped_refptr<ThreadSafeSender> sender_;
 
+  // Recently freed small bitmaps, oldest first, still registered with the
+  // host under their original ids.
+  base::Lock lock_;
+  std::deque<RecycledBitmap> recycled_bitmaps_;
+
   DISALLOW_COPY_AND_ASSIGN(ChildSharedBitmapManager);
 };
 
@@ -506,6 +506,8 @@ bool ChildThread::OnMessageReceived(const IPC::Message& msg) {
     IPC_MESSAGE_HANDLER(ChildProcessMsg_DumpHandles, OnDumpHandles)
     IPC_MESSAGE_HANDLER(ChildProcessMsg_SetProcessBackgrounded,
                         OnProcessBackgrounded)
+    IPC_MESSAGE_HANDLER(ChildProcessMsg_NotifyMemoryPressure,
+                        OnNotifyMemoryPressure)
 #if defined(USE_TCMALLOC)
     IPC_MESSAGE_HANDLER(ChildProcessMsg_GetTcmallocStats, OnGetTcmallocStats)
 #endif
@@ -628,4 +630,13 @@ void ChildThread::OnProcessBackgrounded(bool background) {
   base::MessageLoop::current()->SetTimerSlack(timer_slack);
 }
 
+void ChildThread::OnNotifyMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
+  // In single-process mode the browser's listeners have already seen the
+  // notification, so re-raising it here would bounce it back to the browser.
+  if (in_browser_process_)
+    return;
+  base::MemoryPressureListener::NotifyMemoryPressure(memory_pressure_level);
+}
+
 }  // namespace content
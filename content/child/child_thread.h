@@ -8,6 +8,7 @@
 #include <string>
 
 #include "base/basictypes.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/scoped_ptr.h"
 #include "base/memory/shared_memory.h"
 #include "base/memory/weak_ptr.h"
@@ -215,6 +216,8 @@ class CONTENT_EXPORT ChildThread : public IPC::Listener, public IPC::Sender {
   void OnGetChildProfilerData(int sequence_number);
   void OnDumpHandles();
   void OnProcessBackgrounded(bool background);
+  void OnNotifyMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
 #ifdef IPC_MESSAGE_LOG_ENABLED
   void OnSetIPCLoggingEnabled(bool enable);
 #endif
@@ -207,7 +207,12 @@ void IndexedDBDispatcher::RequestIDBCursorPrefetch(
     int32 ipc_cursor_id) {
   scoped_ptr<WebIDBCallbacks> callbacks(callbacks_ptr);
 
-  int32 ipc_callbacks_id = pending_callbacks_.Add(callbacks.release());
+  // A speculative refill has no callbacks; the cursor's cache absorbs the
+  // result when it arrives. Valid ids start at 1, so 0 never matches an
+  // entry in pending_callbacks_.
+  int32 ipc_callbacks_id = 0;
+  if (callbacks)
+    ipc_callbacks_id = pending_callbacks_.Add(callbacks.release());
   Send(new IndexedDBHostMsg_CursorPrefetch(
       ipc_cursor_id, CurrentWorkerId(), ipc_callbacks_id, n));
 }
@@ -687,10 +692,22 @@ void IndexedDBDispatcher::OnSuccessCursorPrefetch(
   if (cur_iter == cursors_.end())
     return;
 
-  cur_iter->second->SetPrefetchData(keys, primary_keys, values, blob_infos);
-
   WebIDBCallbacks* callbacks = pending_callbacks_.Lookup(ipc_callbacks_id);
-  DCHECK(callbacks);
+  if (!callbacks) {
+    // A speculative refill; there is no continue() waiting on it.
+    cur_iter->second->AppendPrefetchData(keys, primary_keys, values,
+                                         blob_infos);
+    return;
+  }
+
+  if (keys.empty()) {
+    // The cursor was already at the end of its range.
+    callbacks->onSuccess(WebData(), WebVector<WebBlobInfo>());
+    pending_callbacks_.Remove(ipc_callbacks_id);
+    return;
+  }
+
+  cur_iter->second->SetPrefetchData(keys, primary_keys, values, blob_infos);
   cur_iter->second->CachedContinue(callbacks);
   pending_callbacks_.Remove(ipc_callbacks_id);
 }
@@ -26,6 +26,9 @@ WebIDBCursorImpl::WebIDBCursorImpl(int32 ipc_cursor_id,
       used_prefetches_(0),
       pending_onsuccess_callbacks_(0),
       prefetch_amount_(kMinPrefetchAmount),
+      refill_watermark_(0),
+      refill_pending_(false),
+      refill_invalidated_(false),
       thread_safe_sender_(thread_safe_sender) {}
 
 WebIDBCursorImpl::~WebIDBCursorImpl() {
@@ -81,6 +84,15 @@ void WebIDBCursorImpl::continueFunction(const WebIDBKey& key,
       return;
     }
 
+    if (refill_pending_ && !refill_invalidated_) {
+      // The cache drained before the speculative refill landed. Hold the
+      // request rather than racing a second fetch; the refill's arrival
+      // will answer it.
+      DCHECK(!parked_callbacks_);
+      parked_callbacks_ = callbacks.Pass();
+      return;
+    }
+
     if (continue_count_ > kPrefetchContinueThreshold) {
       // Request pre-fetch.
       ++pending_onsuccess_callbacks_;
@@ -113,9 +125,10 @@ void WebIDBCursorImpl::postSuccessHandlerCallback() {
   // again, and that request was served by the prefetch cache, then
   // pending_onsuccess_callbacks_ would be incremented. If not, it means the
   // callback did something else, or nothing at all, in which case we need to
-  // reset the cache.
+  // reset the cache. A parked continue() is still waiting on a refill, so
+  // the cursor is very much in use.
 
-  if (pending_onsuccess_callbacks_ == 0)
+  if (pending_onsuccess_callbacks_ == 0 && !parked_callbacks_)
     ResetPrefetchCache();
 }
 
@@ -124,15 +137,58 @@ void WebIDBCursorImpl::SetPrefetchData(
     const std::vector<IndexedDBKey>& primary_keys,
     const std::vector<WebData>& values,
     const std::vector<blink::WebVector<blink::WebBlobInfo> >& blob_info) {
-  prefetch_keys_.assign(keys.begin(), keys.end());
-  prefetch_primary_keys_.assign(primary_keys.begin(), primary_keys.end());
-  prefetch_values_.assign(values.begin(), values.end());
-  prefetch_blob_info_.assign(blob_info.begin(), blob_info.end());
+  // A refill that was in flight when this batch was requested has already
+  // arrived (responses are ordered), so this can only extend the cache.
+  DCHECK(!parked_callbacks_);
+  prefetch_keys_.insert(prefetch_keys_.end(), keys.begin(), keys.end());
+  prefetch_primary_keys_.insert(
+      prefetch_primary_keys_.end(), primary_keys.begin(), primary_keys.end());
+  prefetch_values_.insert(prefetch_values_.end(), values.begin(), values.end());
+  prefetch_blob_info_.insert(
+      prefetch_blob_info_.end(), blob_info.begin(), blob_info.end());
+  refill_watermark_ = prefetch_keys_.size() / 2;
 
-  used_prefetches_ = 0;
   pending_onsuccess_callbacks_ = 0;
 }
 
+void WebIDBCursorImpl::AppendPrefetchData(
+    const std::vector<IndexedDBKey>& keys,
+    const std::vector<IndexedDBKey>& primary_keys,
+    const std::vector<WebData>& values,
+    const std::vector<blink::WebVector<blink::WebBlobInfo> >& blob_info) {
+  DCHECK(refill_pending_);
+  refill_pending_ = false;
+
+  if (refill_invalidated_) {
+    // The cache was invalidated after this batch was requested and the
+    // back end has already rewound past it.
+    refill_invalidated_ = false;
+    return;
+  }
+
+  if (keys.empty()) {
+    // The cursor reached the end of its range while refilling.
+    if (parked_callbacks_) {
+      scoped_ptr<WebIDBCallbacks> callbacks = parked_callbacks_.Pass();
+      callbacks->onSuccess(WebData(), blink::WebVector<blink::WebBlobInfo>());
+    }
+    return;
+  }
+
+  prefetch_keys_.insert(prefetch_keys_.end(), keys.begin(), keys.end());
+  prefetch_primary_keys_.insert(
+      prefetch_primary_keys_.end(), primary_keys.begin(), primary_keys.end());
+  prefetch_values_.insert(prefetch_values_.end(), values.begin(), values.end());
+  prefetch_blob_info_.insert(
+      prefetch_blob_info_.end(), blob_info.begin(), blob_info.end());
+  refill_watermark_ = prefetch_keys_.size() / 2;
+
+  if (parked_callbacks_) {
+    scoped_ptr<WebIDBCallbacks> callbacks = parked_callbacks_.Pass();
+    CachedContinue(callbacks.get());
+  }
+}
+
 void WebIDBCursorImpl::CachedAdvance(unsigned long count,
                                      WebIDBCallbacks* callbacks) {
   DCHECK_GE(prefetch_keys_.size(), count);
@@ -179,6 +235,22 @@ void WebIDBCursorImpl::CachedContinue(WebIDBCallbacks* callbacks) {
     ResetPrefetchCache();
   }
 
+  if (continue_count_ > kPrefetchContinueThreshold && !refill_pending_ &&
+      prefetch_keys_.size() <= refill_watermark_) {
+    // The cache is half drained; request the next batch now so it arrives
+    // while the remaining entries are being consumed.
+    IndexedDBDispatcher* dispatcher =
+        IndexedDBDispatcher::ThreadSpecificInstance(thread_safe_sender_.get());
+    dispatcher->RequestIDBCursorPrefetch(prefetch_amount_, NULL,
+                                         ipc_cursor_id_);
+    refill_pending_ = true;
+
+    // Increase prefetch_amount_ exponentially.
+    prefetch_amount_ *= 2;
+    if (prefetch_amount_ > kMaxPrefetchAmount)
+      prefetch_amount_ = kMaxPrefetchAmount;
+  }
+
   callbacks->onSuccess(WebIDBKeyBuilder::Build(key),
                        WebIDBKeyBuilder::Build(primary_key),
                        value,
@@ -189,8 +261,10 @@ void WebIDBCursorImpl::ResetPrefetchCache() {
   continue_count_ = 0;
   prefetch_amount_ = kMinPrefetchAmount;
 
-  if (!prefetch_keys_.size()) {
-    // No prefetch cache, so no need to reset the cursor in the back-end.
+  bool refill_in_flight = refill_pending_ && !refill_invalidated_;
+  if (prefetch_keys_.empty() && !refill_in_flight && !used_prefetches_) {
+    // The back end never moved past the last delivered record, so there is
+    // nothing to rewind.
     return;
   }
 
@@ -202,6 +276,24 @@ void WebIDBCursorImpl::ResetPrefetchCache() {
   prefetch_primary_keys_.clear();
   prefetch_values_.clear();
   prefetch_blob_info_.clear();
+  used_prefetches_ = 0;
+
+  if (refill_in_flight) {
+    // A batch requested before the reset is still on its way; it describes
+    // records the back end has now rewound past, so drop it on arrival.
+    refill_invalidated_ = true;
+  }
+
+  if (parked_callbacks_) {
+    // The back end was just rewound to the last record delivered, so the
+    // parked continue() can simply be re-issued as an ordinary continue.
+    dispatcher->RequestIDBCursorContinue(
+        IndexedDBKeyBuilder::Build(WebIDBKey::createNull()),
+        IndexedDBKeyBuilder::Build(WebIDBKey::createNull()),
+        parked_callbacks_.release(),
+        ipc_cursor_id_,
+        transaction_id_);
+  }
 
   pending_onsuccess_callbacks_ = 0;
 }
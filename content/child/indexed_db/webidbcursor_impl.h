@@ -12,6 +12,7 @@
 #include "base/compiler_specific.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/ref_counted.h"
+#include "base/memory/scoped_ptr.h"
 #include "content/common/content_export.h"
 #include "content/common/indexed_db/indexed_db_key.h"
 #include "third_party/WebKit/public/platform/WebData.h"
@@ -38,12 +39,23 @@ class CONTENT_EXPORT WebIDBCursorImpl
                                 blink::WebIDBCallbacks* callback);
   virtual void postSuccessHandlerCallback();
 
+  // Appends a prefetched batch that answers a pending continue(); the
+  // dispatcher calls CachedContinue() right afterwards to serve it.
   void SetPrefetchData(
       const std::vector<IndexedDBKey>& keys,
       const std::vector<IndexedDBKey>& primary_keys,
       const std::vector<blink::WebData>& values,
       const std::vector<blink::WebVector<blink::WebBlobInfo> >& blob_info);
 
+  // Appends a batch that arrived for a speculative refill, with no
+  // continue() waiting on it. An empty batch means the cursor reached the
+  // end of its range.
+  void AppendPrefetchData(
+      const std::vector<IndexedDBKey>& keys,
+      const std::vector<IndexedDBKey>& primary_keys,
+      const std::vector<blink::WebData>& values,
+      const std::vector<blink::WebVector<blink::WebBlobInfo> >& blob_info);
+
   void CachedAdvance(unsigned long count, blink::WebIDBCallbacks* callbacks);
   void CachedContinue(blink::WebIDBCallbacks* callbacks);
 
@@ -56,6 +68,8 @@ class CONTENT_EXPORT WebIDBCursorImpl
   FRIEND_TEST_ALL_PREFIXES(IndexedDBDispatcherTest, CursorReset);
   FRIEND_TEST_ALL_PREFIXES(IndexedDBDispatcherTest, CursorTransactionId);
   FRIEND_TEST_ALL_PREFIXES(WebIDBCursorImplTest, AdvancePrefetchTest);
+  FRIEND_TEST_ALL_PREFIXES(WebIDBCursorImplTest, PrefetchRefill);
+  FRIEND_TEST_ALL_PREFIXES(WebIDBCursorImplTest, PrefetchRefillInvalidation);
   FRIEND_TEST_ALL_PREFIXES(WebIDBCursorImplTest, PrefetchReset);
   FRIEND_TEST_ALL_PREFIXES(WebIDBCursorImplTest, PrefetchTest);
 
@@ -76,7 +90,9 @@ class CONTENT_EXPORT WebIDBCursorImpl
   // Number of continue calls that would qualify for a pre-fetch.
   int continue_count_;
 
-  // Number of items used from the last prefetch.
+  // Number of cached items served since the last prefetch reset. The
+  // back end keeps the matching position so an interrupted prefetch run
+  // can be rewound to the last record actually delivered.
   int used_prefetches_;
 
   // Number of onsuccess handlers we are waiting for.
@@ -85,6 +101,21 @@ class CONTENT_EXPORT WebIDBCursorImpl
   // Number of items to request in next prefetch.
   int prefetch_amount_;
 
+  // When the cache shrinks to this many items the next batch is requested
+  // speculatively, so the fetch overlaps with consumption of the tail.
+  size_t refill_watermark_;
+
+  // True while a speculative refill is in flight.
+  bool refill_pending_;
+
+  // True if the cache was invalidated after the speculative refill was
+  // requested; its results must be discarded when they arrive.
+  bool refill_invalidated_;
+
+  // A continue() that found the cache empty while a refill was already in
+  // flight; answered when the refill lands.
+  scoped_ptr<blink::WebIDBCallbacks> parked_callbacks_;
+
   scoped_refptr<ThreadSafeSender> thread_safe_sender_;
 };
 
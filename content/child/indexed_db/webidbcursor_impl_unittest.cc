@@ -96,8 +96,9 @@ class MockDispatcher : public IndexedDBDispatcher {
 class MockContinueCallbacks : public WebIDBCallbacks {
  public:
   MockContinueCallbacks(IndexedDBKey* key = 0,
-                        WebVector<WebBlobInfo>* webBlobInfo = 0)
-      : key_(key), webBlobInfo_(webBlobInfo) {}
+                        WebVector<WebBlobInfo>* webBlobInfo = 0,
+                        bool* end_reached = 0)
+      : key_(key), webBlobInfo_(webBlobInfo), end_reached_(end_reached) {}
 
   virtual void onSuccess(const WebIDBKey& key,
                          const WebIDBKey& primaryKey,
@@ -109,9 +110,17 @@ class MockContinueCallbacks : public WebIDBCallbacks {
       *webBlobInfo_ = webBlobInfo;
   }
 
+  // Called when the cursor runs off the end of its range.
+  virtual void onSuccess(const WebData& value,
+                         const WebVector<WebBlobInfo>& webBlobInfo) override {
+    if (end_reached_)
+      *end_reached_ = true;
+  }
+
  private:
   IndexedDBKey* key_;
   WebVector<WebBlobInfo>* webBlobInfo_;
+  bool* end_reached_;
 };
 
 }  // namespace
@@ -154,6 +163,12 @@ TEST_F(WebIDBCursorImplTest, PrefetchTest) {
       EXPECT_EQ(0, dispatcher_->prefetch_calls());
     }
 
+    // Initiate the first prefetch; every subsequent batch is requested
+    // speculatively while the current one is being consumed.
+    cursor.continueFunction(null_key_, new MockContinueCallbacks());
+    EXPECT_EQ(continue_calls, dispatcher_->continue_calls());
+    EXPECT_EQ(1, dispatcher_->prefetch_calls());
+
     // Do enough repetitions to verify that the count grows each time,
     // but not so many that the maximum limit is hit.
     const int kPrefetchRepetitions = 5;
@@ -162,9 +177,6 @@ TEST_F(WebIDBCursorImplTest, PrefetchTest) {
     int last_prefetch_count = 0;
     for (int repetitions = 0; repetitions < kPrefetchRepetitions;
          ++repetitions) {
-      // Initiate the prefetch
-      cursor.continueFunction(null_key_, new MockContinueCallbacks());
-      EXPECT_EQ(continue_calls, dispatcher_->continue_calls());
       EXPECT_EQ(repetitions + 1, dispatcher_->prefetch_calls());
 
       // Verify that the requested count has increased since last time.
@@ -182,25 +194,30 @@ TEST_F(WebIDBCursorImplTest, PrefetchTest) {
         blob_info.push_back(
             WebVector<WebBlobInfo>(static_cast<size_t>(expected_key + i)));
       }
-      cursor.SetPrefetchData(keys, primary_keys, values, blob_info);
-
-      // Note that the real dispatcher would call cursor->CachedContinue()
-      // immediately after cursor->SetPrefetchData() to service the request
-      // that initiated the prefetch.
+      if (repetitions == 0) {
+        // The first batch answers the continue() that initiated prefetching;
+        // the real dispatcher would call cursor->CachedContinue() right
+        // after cursor->SetPrefetchData() to service that request.
+        cursor.SetPrefetchData(keys, primary_keys, values, blob_info);
+      } else {
+        // Later batches arrive for speculative refills.
+        cursor.AppendPrefetchData(keys, primary_keys, values, blob_info);
+      }
 
-      // Verify that the cache is used for subsequent continue() calls.
+      // Verify that the cache is used for subsequent continue() calls, and
+      // that draining it past the watermark requests the next batch.
       for (int i = 0; i < prefetch_count; ++i) {
         IndexedDBKey key;
         WebVector<WebBlobInfo> web_blob_info;
         cursor.continueFunction(
             null_key_, new MockContinueCallbacks(&key, &web_blob_info));
         EXPECT_EQ(continue_calls, dispatcher_->continue_calls());
-        EXPECT_EQ(repetitions + 1, dispatcher_->prefetch_calls());
 
         EXPECT_EQ(WebIDBKeyTypeNumber, key.type());
         EXPECT_EQ(expected_key, static_cast<int>(web_blob_info.size()));
         EXPECT_EQ(expected_key++, key.number());
       }
+      EXPECT_EQ(repetitions + 2, dispatcher_->prefetch_calls());
     }
   }
 
@@ -260,9 +277,11 @@ TEST_F(WebIDBCursorImplTest, AdvancePrefetchTest) {
   cursor.advance(1, new MockContinueCallbacks(&key));
   EXPECT_EQ(1, key.number());
 
-  // IDBCursor.continue()
+  // IDBCursor.continue() - drains the cache to its refill watermark, so the
+  // next batch is requested speculatively.
   cursor.continueFunction(null_key_, new MockContinueCallbacks(&key));
   EXPECT_EQ(2, key.number());
+  EXPECT_EQ(2, dispatcher_->prefetch_calls());
 
   // IDBCursor.advance(2)
   cursor.advance(2, new MockContinueCallbacks(&key));
@@ -270,11 +289,13 @@ TEST_F(WebIDBCursorImplTest, AdvancePrefetchTest) {
 
   EXPECT_EQ(0, dispatcher_->advance_calls());
 
-  // IDBCursor.advance(lots) - beyond the fetched amount
+  // IDBCursor.advance(lots) - beyond the fetched amount. The in-flight
+  // refill is invalidated by the reset that precedes the advance.
   cursor.advance(WebIDBCursorImpl::kMaxPrefetchAmount,
                  new MockContinueCallbacks(&key));
   EXPECT_EQ(1, dispatcher_->advance_calls());
-  EXPECT_EQ(1, dispatcher_->prefetch_calls());
+  EXPECT_EQ(2, dispatcher_->prefetch_calls());
+  EXPECT_EQ(1, dispatcher_->reset_calls());
   EXPECT_EQ(static_cast<int>(WebIDBCursorImpl::kPrefetchContinueThreshold),
             dispatcher_->continue_calls());
 }
@@ -326,4 +347,127 @@ TEST_F(WebIDBCursorImplTest, PrefetchReset) {
   EXPECT_EQ(1, dispatcher_->last_used_count());
 }
 
+TEST_F(WebIDBCursorImplTest, PrefetchRefill) {
+  const int64 transaction_id = 1;
+  WebIDBCursorImpl cursor(WebIDBCursorImpl::kInvalidCursorId,
+                          transaction_id,
+                          thread_safe_sender_.get());
+
+  // Call continue() until prefetching kicks in, then initiate the prefetch.
+  for (int i = 0; i < WebIDBCursorImpl::kPrefetchContinueThreshold; ++i)
+    cursor.continueFunction(null_key_, new MockContinueCallbacks());
+  cursor.continueFunction(null_key_, new MockContinueCallbacks());
+  EXPECT_EQ(1, dispatcher_->prefetch_calls());
+
+  // Fill the prefetch cache as requested.
+  int prefetch_count = dispatcher_->last_prefetch_count();
+  int expected_key = 0;
+  std::vector<IndexedDBKey> keys;
+  std::vector<IndexedDBKey> primary_keys(prefetch_count);
+  std::vector<WebData> values(prefetch_count);
+  std::vector<WebVector<WebBlobInfo> > blob_info(prefetch_count);
+  for (int i = 0; i < prefetch_count; ++i)
+    keys.push_back(IndexedDBKey(i, WebIDBKeyTypeNumber));
+  cursor.SetPrefetchData(keys, primary_keys, values, blob_info);
+
+  // Consuming the batch past its watermark requests the next batch without
+  // any continue() leaving the renderer.
+  IndexedDBKey key;
+  for (int i = 0; i < prefetch_count; ++i) {
+    cursor.continueFunction(null_key_, new MockContinueCallbacks(&key));
+    EXPECT_EQ(expected_key++, key.number());
+  }
+  EXPECT_EQ(2, dispatcher_->prefetch_calls());
+  EXPECT_EQ(static_cast<int>(WebIDBCursorImpl::kPrefetchContinueThreshold),
+            dispatcher_->continue_calls());
+
+  // The cache is empty but a refill is in flight, so the next continue() is
+  // parked rather than racing a second fetch.
+  cursor.continueFunction(null_key_, new MockContinueCallbacks(&key));
+  EXPECT_TRUE(cursor.parked_callbacks_);
+  EXPECT_EQ(static_cast<int>(WebIDBCursorImpl::kPrefetchContinueThreshold),
+            dispatcher_->continue_calls());
+
+  // The refill's arrival answers the parked continue() directly.
+  int refill_count = dispatcher_->last_prefetch_count();
+  std::vector<IndexedDBKey> refill_keys;
+  std::vector<IndexedDBKey> refill_primary_keys(refill_count);
+  std::vector<WebData> refill_values(refill_count);
+  std::vector<WebVector<WebBlobInfo> > refill_blob_info(refill_count);
+  for (int i = 0; i < refill_count; ++i)
+    refill_keys.push_back(IndexedDBKey(expected_key + i, WebIDBKeyTypeNumber));
+  cursor.AppendPrefetchData(
+      refill_keys, refill_primary_keys, refill_values, refill_blob_info);
+  EXPECT_FALSE(cursor.parked_callbacks_);
+  EXPECT_EQ(expected_key++, key.number());
+
+  // An empty refill means the cursor reached the end of its range; a parked
+  // continue() is answered with the end-of-range signal.
+  while (cursor.prefetch_keys_.size() > cursor.refill_watermark_)
+    cursor.continueFunction(null_key_, new MockContinueCallbacks(&key));
+  EXPECT_EQ(3, dispatcher_->prefetch_calls());
+  while (!cursor.prefetch_keys_.empty())
+    cursor.continueFunction(null_key_, new MockContinueCallbacks(&key));
+  bool end_reached = false;
+  cursor.continueFunction(null_key_,
+                          new MockContinueCallbacks(NULL, NULL, &end_reached));
+  EXPECT_TRUE(cursor.parked_callbacks_);
+  cursor.AppendPrefetchData(std::vector<IndexedDBKey>(),
+                            std::vector<IndexedDBKey>(),
+                            std::vector<WebData>(),
+                            std::vector<WebVector<WebBlobInfo> >());
+  EXPECT_FALSE(cursor.parked_callbacks_);
+  EXPECT_TRUE(end_reached);
+  EXPECT_EQ(static_cast<int>(WebIDBCursorImpl::kPrefetchContinueThreshold),
+            dispatcher_->continue_calls());
+}
+
+TEST_F(WebIDBCursorImplTest, PrefetchRefillInvalidation) {
+  const int64 transaction_id = 1;
+  WebIDBCursorImpl cursor(WebIDBCursorImpl::kInvalidCursorId,
+                          transaction_id,
+                          thread_safe_sender_.get());
+
+  // Call continue() until prefetching kicks in, then initiate the prefetch.
+  for (int i = 0; i < WebIDBCursorImpl::kPrefetchContinueThreshold; ++i)
+    cursor.continueFunction(null_key_, new MockContinueCallbacks());
+  cursor.continueFunction(null_key_, new MockContinueCallbacks());
+  EXPECT_EQ(1, dispatcher_->prefetch_calls());
+
+  // Fill the prefetch cache and consume it, triggering a refill.
+  int prefetch_count = dispatcher_->last_prefetch_count();
+  std::vector<IndexedDBKey> keys;
+  std::vector<IndexedDBKey> primary_keys(prefetch_count);
+  std::vector<WebData> values(prefetch_count);
+  std::vector<WebVector<WebBlobInfo> > blob_info(prefetch_count);
+  for (int i = 0; i < prefetch_count; ++i)
+    keys.push_back(IndexedDBKey(i, WebIDBKeyTypeNumber));
+  cursor.SetPrefetchData(keys, primary_keys, values, blob_info);
+  for (int i = 0; i < prefetch_count; ++i)
+    cursor.continueFunction(null_key_, new MockContinueCallbacks());
+  EXPECT_EQ(2, dispatcher_->prefetch_calls());
+  EXPECT_EQ(0, dispatcher_->reset_calls());
+
+  // Invalidating the cache with a refill in flight rewinds the back end
+  // past every record delivered so far.
+  cursor.ResetPrefetchCache();
+  EXPECT_EQ(1, dispatcher_->reset_calls());
+  EXPECT_EQ(prefetch_count, dispatcher_->last_used_count());
+
+  // The stale batch must be discarded when it arrives.
+  int refill_count = dispatcher_->last_prefetch_count();
+  std::vector<IndexedDBKey> refill_keys;
+  std::vector<IndexedDBKey> refill_primary_keys(refill_count);
+  std::vector<WebData> refill_values(refill_count);
+  std::vector<WebVector<WebBlobInfo> > refill_blob_info(refill_count);
+  for (int i = 0; i < refill_count; ++i)
+    refill_keys.push_back(
+        IndexedDBKey(prefetch_count + i, WebIDBKeyTypeNumber));
+  cursor.AppendPrefetchData(
+      refill_keys, refill_primary_keys, refill_values, refill_blob_info);
+  EXPECT_TRUE(cursor.prefetch_keys_.empty());
+  EXPECT_FALSE(cursor.refill_pending_);
+  EXPECT_FALSE(cursor.refill_invalidated_);
+}
+
 }  // namespace content
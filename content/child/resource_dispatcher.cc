@@ -496,8 +496,34 @@ void ResourceDispatcher::OnReceivedData(int request_id,
   }
 
   // Acknowledge the reception of this data.
-  if (send_ack)
-    message_sender_->Send(new ResourceHostMsg_DataReceived_ACK(request_id));
+  if (send_ack) {
+    // The peer callback may have cancelled and removed the request. In that
+    // case acknowledge this chunk directly so the browser can recycle its
+    // buffer until the cancellation reaches it.
+    request_info = GetPendingRequestInfo(request_id);
+    if (!request_info) {
+      message_sender_->Send(
+          new ResourceHostMsg_DataReceived_ACK(request_id, 1));
+      return;
+    }
+    // Coalesce acknowledgments: when several DataReceived messages arrive in
+    // a burst, they are dispatched before the flush task runs and get covered
+    // by a single ACK message.
+    if (!request_info->pending_data_ack_count++) {
+      main_thread_task_runner_->PostTask(
+          FROM_HERE, base::Bind(&ResourceDispatcher::FlushDataReceivedAcks,
+                                weak_factory_.GetWeakPtr(), request_id));
+    }
+  }
+}
+
+void ResourceDispatcher::FlushDataReceivedAcks(int request_id) {
+  PendingRequestInfo* request_info = GetPendingRequestInfo(request_id);
+  if (!request_info || !request_info->pending_data_ack_count)
+    return;
+  message_sender_->Send(new ResourceHostMsg_DataReceived_ACK(
+      request_id, request_info->pending_data_ack_count));
+  request_info->pending_data_ack_count = 0;
 }
 
 void ResourceDispatcher::OnDownloadedData(int request_id,
@@ -613,6 +639,10 @@ bool ResourceDispatcher::RemovePendingRequest(int request_id) {
 
   PendingRequestInfo& request_info = it->second;
 
+  // Make sure any coalesced acknowledgments reach the browser so it can
+  // recycle its shared buffer.
+  FlushDataReceivedAcks(request_id);
+
   bool release_downloaded_file = request_info.download_to_file;
 
   ReleaseResourcesInMessageQueue(&request_info.deferred_message_queue);
@@ -690,7 +720,8 @@ ResourceDispatcher::PendingRequestInfo::PendingRequestInfo()
       is_deferred(false),
       download_to_file(false),
       blocked_response(false),
-      buffer_size(0) {
+      buffer_size(0),
+      pending_data_ack_count(0) {
 }
 
 ResourceDispatcher::PendingRequestInfo::PendingRequestInfo(
@@ -710,7 +741,8 @@ ResourceDispatcher::PendingRequestInfo::PendingRequestInfo(
       response_url(request_url),
       download_to_file(download_to_file),
       request_start(base::TimeTicks::Now()),
-      blocked_response(false) {}
+      blocked_response(false),
+      pending_data_ack_count(0) {}
 
 ResourceDispatcher::PendingRequestInfo::~PendingRequestInfo() {
   if (threaded_data_provider)
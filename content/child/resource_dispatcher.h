@@ -149,6 +149,10 @@ class CONTENT_EXPORT ResourceDispatcher : public IPC::Listener {
     linked_ptr<SiteIsolationResponseMetaData> site_isolation_metadata;
     bool blocked_response;
     int buffer_size;
+    // Number of DataReceived messages processed but not yet acknowledged to
+    // the browser. Acknowledgments are coalesced and sent from a posted task
+    // so a burst of data chunks produces a single ACK message.
+    int pending_data_ack_count;
   };
   typedef base::hash_map<int, PendingRequestInfo> PendingRequestList;
 
@@ -186,6 +190,10 @@ class CONTENT_EXPORT ResourceDispatcher : public IPC::Listener {
   // again in the deferred state.
   void FlushDeferredMessages(int request_id);
 
+  // Sends a single DataReceived_ACK covering all data chunks processed for
+  // the given request since the last acknowledgment.
+  void FlushDataReceivedAcks(int request_id);
+
   void ToResourceResponseInfo(const PendingRequestInfo& request_info,
                               const ResourceResponseHead& browser_info,
                               ResourceResponseInfo* renderer_info) const;
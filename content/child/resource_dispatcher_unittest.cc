@@ -199,13 +199,18 @@ class ResourceDispatcherTest : public testing::Test, public IPC::Sender {
     message_queue_.erase(message_queue_.begin());
   }
 
-  void ConsumeDataReceived_ACK(int expected_request_id) {
+  // Acknowledgments are coalesced and sent from a posted task, so the message
+  // loop must be run before consuming them.
+  void ConsumeDataReceived_ACK(int expected_request_id,
+                               int expected_number_of_chunks) {
+    base::RunLoop().RunUntilIdle();
     ASSERT_FALSE(message_queue_.empty());
-    Tuple<int> args;
+    Tuple<int, int> args;
     ASSERT_EQ(ResourceHostMsg_DataReceived_ACK::ID, message_queue_[0].type());
     ASSERT_TRUE(ResourceHostMsg_DataReceived_ACK::Read(
         &message_queue_[0], &args));
     EXPECT_EQ(expected_request_id, get<0>(args));
+    EXPECT_EQ(expected_number_of_chunks, get<1>(args));
     message_queue_.erase(message_queue_.begin());
   }
 
@@ -365,11 +370,11 @@ TEST_F(ResourceDispatcherTest, RoundTrip) {
 
   NotifySetDataBuffer(id, strlen(kTestPageContents));
   NotifyDataReceived(id, std::string(kTestPageContents, kFirstReceiveSize));
-  ConsumeDataReceived_ACK(id);
+  ConsumeDataReceived_ACK(id, 1);
   EXPECT_EQ(0u, queued_messages());
 
   NotifyDataReceived(id, kTestPageContents + kFirstReceiveSize);
-  ConsumeDataReceived_ACK(id);
+  ConsumeDataReceived_ACK(id, 1);
   EXPECT_EQ(0u, queued_messages());
 
   NotifyRequestComplete(id, strlen(kTestPageContents));
@@ -403,10 +408,10 @@ TEST_F(ResourceDispatcherTest, MultipleRequests) {
 
   NotifySetDataBuffer(id2, strlen(kTestPageContents2));
   NotifyDataReceived(id2, kTestPageContents2);
-  ConsumeDataReceived_ACK(id2);
+  ConsumeDataReceived_ACK(id2, 1);
   NotifySetDataBuffer(id1, strlen(kTestPageContents));
   NotifyDataReceived(id1, kTestPageContents);
-  ConsumeDataReceived_ACK(id1);
+  ConsumeDataReceived_ACK(id1, 1);
   EXPECT_EQ(0u, queued_messages());
 
   NotifyRequestComplete(id1, strlen(kTestPageContents));
@@ -492,7 +497,7 @@ TEST_F(ResourceDispatcherTest, Redirect) {
 
   NotifySetDataBuffer(id, strlen(kTestPageContents));
   NotifyDataReceived(id, kTestPageContents);
-  ConsumeDataReceived_ACK(id);
+  ConsumeDataReceived_ACK(id, 1);
 
   NotifyRequestComplete(id, strlen(kTestPageContents));
   EXPECT_EQ(kTestPageContents, peer.data());
@@ -558,7 +563,7 @@ TEST_F(ResourceDispatcherTest, Defer) {
   bridge->SetDefersLoading(false);
   base::RunLoop().RunUntilIdle();
 
-  ConsumeDataReceived_ACK(id);
+  ConsumeDataReceived_ACK(id, 1);
   EXPECT_EQ(0u, queued_messages());
   EXPECT_TRUE(peer.received_response());
   EXPECT_EQ(kTestPageContents, peer.data());
@@ -596,7 +601,7 @@ TEST_F(ResourceDispatcherTest, DeferOnRedirect) {
   base::RunLoop().RunUntilIdle();
 
   ConsumeFollowRedirect(id);
-  ConsumeDataReceived_ACK(id);
+  ConsumeDataReceived_ACK(id, 1);
 
   EXPECT_EQ(0u, queued_messages());
   EXPECT_TRUE(peer.received_response());
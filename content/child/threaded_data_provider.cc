@@ -281,7 +281,7 @@ void ThreadedDataProvider::ForwardAndACKData(const char* data,
   // (or earlier on the I/O thread), otherwise once SiteIsolationPolicy does
   // actual blocking as opposed to just UMA logging this will bypass it.
   threaded_data_receiver_->acceptData(data, data_length);
-  ipc_channel_->Send(new ResourceHostMsg_DataReceived_ACK(request_id_));
+  ipc_channel_->Send(new ResourceHostMsg_DataReceived_ACK(request_id_, 1));
 }
 
 }  // namespace content
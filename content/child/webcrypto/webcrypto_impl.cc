@@ -5,6 +5,7 @@
 #include "content/child/webcrypto/webcrypto_impl.h"
 
 #include "base/bind.h"
+#include "base/containers/mru_cache.h"
 #include "base/lazy_instance.h"
 #include "base/location.h"
 #include "base/logging.h"
@@ -21,6 +22,7 @@
 #include "content/child/webcrypto/status.h"
 #include "content/child/webcrypto/webcrypto_util.h"
 #include "content/child/worker_thread_task_runner.h"
+#include "third_party/WebKit/public/platform/WebCryptoAlgorithmParams.h"
 #include "third_party/WebKit/public/platform/WebCryptoKeyAlgorithm.h"
 #include "third_party/WebKit/public/platform/WebString.h"
 
@@ -150,6 +152,133 @@ scoped_refptr<base::TaskRunner> GetCurrentBlinkThread() {
   return WorkerThreadTaskRunner::current();
 }
 
+// ---------------------
+// Synchronous fast paths
+// ---------------------
+//
+// For very small inputs the two thread hops cost considerably more than the
+// operation itself, which hurts pages that verify many small signatures.
+//
+// Digesting involves no key at all (createDigestor() already runs on the
+// calling thread for the same reason). HMAC is computed from the immutable
+// raw bytes held by the key handle and does not modify the key in either
+// back-end, so it is safe to run on the calling thread even if the crypto
+// thread is concurrently operating on the same key. No other operations are
+// run synchronously: the remaining algorithms use key handles which must
+// only be touched from the crypto thread.
+
+// The largest input (in bytes) completed synchronously on the calling
+// thread. Hashing this much takes on the order of ten microseconds, which is
+// still cheaper than a round trip through the worker pool.
+const unsigned int kMaxSyncOperationBytes = 4096;
+
+bool CanDoKeyedOperationSynchronously(const blink::WebCryptoKey& key,
+                                      unsigned int data_size) {
+  return data_size <= kMaxSyncOperationBytes && !key.isNull() &&
+         key.algorithm().id() == blink::WebCryptoAlgorithmIdHmac;
+}
+
+// ---------------------
+// Imported key memoization
+// ---------------------
+//
+// Callers commonly re-import identical key material (for instance the same
+// JWK for every signature to verify). The resulting WebCryptoKey is
+// immutable and threadsafe, so repeated imports can be served from a small
+// MRU cache rather than re-parsing and re-creating the key each time. The
+// cache is only touched from the sequenced crypto thread, so it needs no
+// locking.
+//
+// Only secret key imports whose import parameters are fully described by the
+// algorithm id plus the optional inner hash (HMAC and AES variants) are
+// memoized; the cache key is the exact import tuple, so a hit can only occur
+// for a byte-for-byte identical request.
+class ImportedKeyCache {
+ public:
+  ImportedKeyCache() : cache_(kMaxEntries) {}
+
+  // Builds the cache key for an import request in |cache_key|. Returns false
+  // if the request is not cacheable.
+  static bool GetCacheKey(blink::WebCryptoKeyFormat format,
+                          const std::vector<uint8_t>& key_data,
+                          const blink::WebCryptoAlgorithm& algorithm,
+                          bool extractable,
+                          blink::WebCryptoKeyUsageMask usages,
+                          std::string* cache_key) {
+    if (key_data.size() > kMaxKeyDataBytes)
+      return false;
+
+    uint32_t hash_id = 0;
+    bool has_length_bits = false;
+    uint32_t length_bits = 0;
+    switch (algorithm.id()) {
+      case blink::WebCryptoAlgorithmIdHmac: {
+        const blink::WebCryptoHmacImportParams* params =
+            algorithm.hmacImportParams();
+        if (!params)
+          return false;
+        hash_id = params->hash().id();
+        // An explicit length is part of the key's identity: the same bytes
+        // imported with different lengths are different keys.
+        has_length_bits = params->hasLengthBits();
+        length_bits = params->optionalLengthBits();
+        break;
+      }
+      case blink::WebCryptoAlgorithmIdAesCbc:
+      case blink::WebCryptoAlgorithmIdAesGcm:
+      case blink::WebCryptoAlgorithmIdAesCtr:
+      case blink::WebCryptoAlgorithmIdAesKw:
+        break;
+      default:
+        return false;
+    }
+
+    cache_key->clear();
+    cache_key->reserve(28 + key_data.size());
+    AppendUint32(static_cast<uint32_t>(format), cache_key);
+    AppendUint32(static_cast<uint32_t>(algorithm.id()), cache_key);
+    AppendUint32(hash_id, cache_key);
+    AppendUint32(has_length_bits ? 1 : 0, cache_key);
+    AppendUint32(length_bits, cache_key);
+    AppendUint32((usages << 1) | (extractable ? 1 : 0), cache_key);
+    cache_key->append(reinterpret_cast<const char*>(vector_as_array(&key_data)),
+                      key_data.size());
+    return true;
+  }
+
+  bool Get(const std::string& cache_key, blink::WebCryptoKey* key) {
+    KeyCache::iterator it = cache_.Get(cache_key);
+    if (it == cache_.end())
+      return false;
+    *key = it->second;
+    return true;
+  }
+
+  void Put(const std::string& cache_key, const blink::WebCryptoKey& key) {
+    cache_.Put(cache_key, key);
+  }
+
+ private:
+  enum {
+    kMaxEntries = 32,
+    kMaxKeyDataBytes = 1024,
+  };
+
+  typedef base::MRUCache<std::string, blink::WebCryptoKey> KeyCache;
+
+  static void AppendUint32(uint32_t value, std::string* out) {
+    out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  KeyCache cache_;
+
+  DISALLOW_COPY_AND_ASSIGN(ImportedKeyCache);
+};
+
+// Only accessed from the crypto thread.
+base::LazyInstance<ImportedKeyCache>::Leaky imported_key_cache =
+    LAZY_INSTANCE_INITIALIZER;
+
 // --------------------------------------------------------------------
 // State
 // --------------------------------------------------------------------
@@ -454,9 +583,20 @@ void DoImportKey(scoped_ptr<ImportKeyState> passed_state) {
   ImportKeyState* state = passed_state.get();
   if (state->cancelled())
     return;
-  state->status = webcrypto::ImportKey(
-      state->format, webcrypto::CryptoData(state->key_data), state->algorithm,
-      state->extractable, state->usages, &state->key);
+
+  std::string cache_key;
+  const bool cacheable = ImportedKeyCache::GetCacheKey(
+      state->format, state->key_data, state->algorithm, state->extractable,
+      state->usages, &cache_key);
+  if (cacheable && imported_key_cache.Get().Get(cache_key, &state->key)) {
+    state->status = Status::Success();
+  } else {
+    state->status = webcrypto::ImportKey(
+        state->format, webcrypto::CryptoData(state->key_data), state->algorithm,
+        state->extractable, state->usages, &state->key);
+    if (state->status.IsSuccess() && cacheable)
+      imported_key_cache.Get().Put(cache_key, state->key);
+  }
   if (state->status.IsSuccess()) {
     DCHECK(state->key.handle());
     DCHECK(!state->key.algorithm().isNull());
@@ -638,6 +778,14 @@ void WebCryptoImpl::digest(const blink::WebCryptoAlgorithm& algorithm,
                            blink::WebCryptoResult result) {
   DCHECK(!algorithm.isNull());
 
+  if (data_size <= kMaxSyncOperationBytes) {
+    std::vector<uint8_t> buffer;
+    Status status = webcrypto::Digest(
+        algorithm, webcrypto::CryptoData(data, data_size), &buffer);
+    CompleteWithBufferOrError(status, buffer, &result);
+    return;
+  }
+
   scoped_ptr<DigestState> state(new DigestState(
       algorithm, blink::WebCryptoKey::createNull(), data, data_size, result));
   if (!CryptoThreadPool::PostTask(FROM_HERE,
@@ -690,6 +838,14 @@ void WebCryptoImpl::sign(const blink::WebCryptoAlgorithm& algorithm,
                          const unsigned char* data,
                          unsigned int data_size,
                          blink::WebCryptoResult result) {
+  if (CanDoKeyedOperationSynchronously(key, data_size)) {
+    std::vector<uint8_t> buffer;
+    Status status = webcrypto::Sign(
+        algorithm, key, webcrypto::CryptoData(data, data_size), &buffer);
+    CompleteWithBufferOrError(status, buffer, &result);
+    return;
+  }
+
   scoped_ptr<SignState> state(
       new SignState(algorithm, key, data, data_size, result));
   if (!CryptoThreadPool::PostTask(FROM_HERE,
@@ -705,6 +861,18 @@ void WebCryptoImpl::verifySignature(const blink::WebCryptoAlgorithm& algorithm,
                                     const unsigned char* data,
                                     unsigned int data_size,
                                     blink::WebCryptoResult result) {
+  if (CanDoKeyedOperationSynchronously(key, data_size)) {
+    bool verify_result = false;
+    Status status = webcrypto::Verify(
+        algorithm, key, webcrypto::CryptoData(signature, signature_size),
+        webcrypto::CryptoData(data, data_size), &verify_result);
+    if (status.IsError())
+      CompleteWithError(status, &result);
+    else
+      result.completeWithBoolean(verify_result);
+    return;
+  }
+
   scoped_ptr<VerifySignatureState> state(new VerifySignatureState(
       algorithm, key, signature, signature_size, data, data_size, result));
   if (!CryptoThreadPool::PostTask(FROM_HERE,
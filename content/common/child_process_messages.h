@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/shared_memory.h"
 #include "base/tracked_objects.h"
 #include "base/values.h"
@@ -16,6 +17,10 @@
 #include "ipc/ipc_message_macros.h"
 #include "ui/gfx/gpu_memory_buffer.h"
 
+IPC_ENUM_TRAITS_MAX_VALUE(
+    base::MemoryPressureListener::MemoryPressureLevel,
+    base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL)
+
 IPC_ENUM_TRAITS_MAX_VALUE(tracked_objects::ThreadData::Status,
                           tracked_objects::ThreadData::STATUS_LAST)
 
@@ -112,6 +117,12 @@ IPC_MESSAGE_CONTROL0(ChildProcessMsg_DumpHandles)
 IPC_MESSAGE_CONTROL1(ChildProcessMsg_SetProcessBackgrounded,
                      bool /* background */)
 
+// Sent to child processes when the browser observes memory pressure, so that
+// they release memory as well.
+IPC_MESSAGE_CONTROL1(
+    ChildProcessMsg_NotifyMemoryPressure,
+    base::MemoryPressureListener::MemoryPressureLevel /* level */)
+
 #if defined(USE_TCMALLOC)
 // Sent to child process to request tcmalloc stats.
 IPC_MESSAGE_CONTROL0(ChildProcessMsg_GetTcmallocStats)
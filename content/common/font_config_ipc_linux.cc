@@ -12,10 +12,15 @@
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include "base/basictypes.h"
 #include "base/debug/trace_event.h"
+#include "base/files/file.h"
 #include "base/files/file_util.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/memory/ref_counted.h"
 #include "base/pickle.h"
 #include "base/posix/unix_domain_socket_linux.h"
+#include "base/threading/thread_restrictions.h"
 #include "skia/ext/refptr.h"
 #include "skia/ext/skia_utils_base.h"
 #include "third_party/skia/include/core/SkData.h"
@@ -23,20 +28,62 @@
 
 namespace content {
 
-// Return a stream from the file descriptor, or NULL on failure.
-SkStream* StreamFromFD(int fd) {
-  skia::RefPtr<SkData> data = skia::AdoptRef(SkData::NewFromFD(fd));
-  if (!data) {
-    return NULL;
-  }
-  return new SkMemoryStream(data.get());
-}
-
 void CloseFD(int fd) {
   int err = IGNORE_EINTR(close(fd));
   DCHECK(!err);
 }
 
+// Wraps a font file mapped into memory. The mapping lives as long as any
+// SkStream created from it, so all typefaces for the same font share one
+// copy of the data. The mapping is read-only, which also lets the kernel
+// share the backing pages with every other process mapping the same file.
+class FontConfigIPC::MappedFontFile
+    : public base::RefCountedThreadSafe<FontConfigIPC::MappedFontFile> {
+ public:
+  MappedFontFile(FontConfigIPC* font_config, uint32_t font_id)
+      : font_config_(font_config), font_id_(font_id) {}
+
+  uint32_t font_id() const { return font_id_; }
+
+  // Maps the font file referred to by |fd|, taking ownership of |fd|.
+  bool Initialize(int fd) {
+    base::ThreadRestrictions::ScopedAllowIO allow_mmap;
+    base::File file(fd);
+    return mapped_font_file_.Initialize(file.Pass());
+  }
+
+  SkMemoryStream* CreateMemoryStream() {
+    DCHECK(mapped_font_file_.IsValid());
+    skia::RefPtr<SkData> data = skia::AdoptRef(
+        SkData::NewWithProc(mapped_font_file_.data(),
+                            mapped_font_file_.length(),
+                            &MappedFontFile::ReleaseProc, this));
+    if (!data)
+      return NULL;
+    // The SkData holds a reference to this, released in ReleaseProc().
+    AddRef();
+    return new SkMemoryStream(data.get());
+  }
+
+ private:
+  friend class base::RefCountedThreadSafe<MappedFontFile>;
+
+  ~MappedFontFile() {
+    font_config_->RemoveMappedFontFile(this);
+  }
+
+  static void ReleaseProc(const void* ptr, size_t length, void* context) {
+    base::ThreadRestrictions::ScopedAllowIO allow_munmap;
+    static_cast<MappedFontFile*>(context)->Release();
+  }
+
+  FontConfigIPC* const font_config_;
+  const uint32_t font_id_;
+  base::MemoryMappedFile mapped_font_file_;
+
+  DISALLOW_COPY_AND_ASSIGN(MappedFontFile);
+};
+
 FontConfigIPC::FontConfigIPC(int fd)
     : fd_(fd) {
 }
@@ -96,6 +143,15 @@ bool FontConfigIPC::matchFamilyName(const char familyName[],
 
 SkStream* FontConfigIPC::openStream(const FontIdentity& identity) {
   TRACE_EVENT0("sandbox_ipc", "FontConfigIPC::openStream");
+
+  {
+    base::AutoLock lock(lock_);
+    MappedFontFiles::iterator mapped_font_files_it =
+        mapped_font_files_.find(identity.fID);
+    if (mapped_font_files_it != mapped_font_files_.end())
+      return mapped_font_files_it->second->CreateMemoryStream();
+  }
+
   Pickle request;
   request.WriteInt(METHOD_OPEN);
   request.WriteUInt32(identity.fID);
@@ -118,9 +174,29 @@ SkStream* FontConfigIPC::openStream(const FontIdentity& identity) {
     return NULL;
   }
 
-  SkStream* stream = StreamFromFD(result_fd);
-  CloseFD(result_fd);
-  return stream;
+  scoped_refptr<MappedFontFile> mapped_font_file(
+      new MappedFontFile(this, identity.fID));
+  if (!mapped_font_file->Initialize(result_fd))
+    return NULL;
+
+  {
+    base::AutoLock lock(lock_);
+    MappedFontFiles::iterator mapped_font_files_it =
+        mapped_font_files_.insert(
+            std::make_pair(mapped_font_file->font_id(),
+                           mapped_font_file.get())).first;
+    // Always hand out a stream from the file that is in the map; if another
+    // thread raced us here its mapping wins and ours is dropped on return.
+    return mapped_font_files_it->second->CreateMemoryStream();
+  }
+}
+
+void FontConfigIPC::RemoveMappedFontFile(MappedFontFile* mapped_font_file) {
+  base::AutoLock lock(lock_);
+  MappedFontFiles::iterator it =
+      mapped_font_files_.find(mapped_font_file->font_id());
+  if (it != mapped_font_files_.end() && it->second == mapped_font_file)
+    mapped_font_files_.erase(it);
 }
 
 }  // namespace content
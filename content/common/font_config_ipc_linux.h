@@ -6,6 +6,8 @@
 #define CONTENT_COMMON_FONT_CONFIG_IPC_LINUX_H_
 
 #include "base/compiler_specific.h"
+#include "base/containers/hash_tables.h"
+#include "base/synchronization/lock.h"
 #include "third_party/skia/include/ports/SkFontConfigInterface.h"
 
 #include <string>
@@ -25,6 +27,10 @@ class FontConfigIPC : public SkFontConfigInterface {
                        SkString* outFamilyName,
                        SkTypeface::Style* outStyle) override;
 
+  // Returns a new SkStream instance for the given identity. The font file is
+  // mapped once per process and the mapping is shared by all streams returned
+  // for the same identity, so repeated typeface instantiations neither
+  // round-trip to the sandbox host nor duplicate the font data.
   SkStream* openStream(const FontIdentity&) override;
 
   enum Method {
@@ -37,7 +43,19 @@ class FontConfigIPC : public SkFontConfigInterface {
   };
 
  private:
+  // Marks the end of the lifetime of a mapped font file, removing it from
+  // |mapped_font_files_|. Called by ~MappedFontFile().
+  class MappedFontFile;
+  void RemoveMappedFontFile(MappedFontFile* mapped_font_file);
+
   const int fd_;
+
+  base::Lock lock_;
+  // Maps font identity IDs to the mapping of the corresponding font file.
+  // The values are owned by the SkStreams handed out by openStream(); an
+  // entry removes itself when its last stream goes away.
+  typedef base::hash_map<uint32_t, MappedFontFile*> MappedFontFiles;
+  MappedFontFiles mapped_font_files_;
 };
 
 }  // namespace content
@@ -78,6 +78,8 @@ GpuMemoryBufferImpl* GpuMemoryBufferImpl::FromClientBuffer(
 // static
 size_t GpuMemoryBufferImpl::BytesPerPixel(Format format) {
   switch (format) {
+    case RGBA_4444:
+      return 2;
     case RGBA_8888:
     case RGBX_8888:
     case BGRA_8888:
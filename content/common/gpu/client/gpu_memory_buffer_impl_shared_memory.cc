@@ -88,6 +88,7 @@ GpuMemoryBufferImplSharedMemory::CreateFromHandle(
 // static
 bool GpuMemoryBufferImplSharedMemory::IsFormatSupported(Format format) {
   switch (format) {
+    case RGBA_4444:
     case RGBA_8888:
     case BGRA_8888:
       return true;
@@ -32,6 +32,7 @@
 #include "gpu/command_buffer/service/logger.h"
 #include "gpu/command_buffer/service/mailbox_manager.h"
 #include "gpu/command_buffer/service/memory_tracking.h"
+#include "gpu/command_buffer/service/program_cache.h"
 #include "gpu/command_buffer/service/query_manager.h"
 #include "gpu/command_buffer/service/sync_point_manager.h"
 #include "gpu/command_buffer/service/valuebuffer_manager.h"
@@ -111,6 +112,11 @@ const int64 kHandleMoreWorkPeriodBusyMs = 1;
 // Prevents idle work from being starved.
 const int64 kMaxTimeSinceIdleMs = 10;
 
+// Decoding a single command buffer yields after this long so other contexts'
+// pending flushes get a turn on the GPU thread. The channel requeues a flush
+// for the remaining commands.
+const int64 kMaxDecodeTimeSliceMs = 2;
+
 class DevToolsChannelData : public base::debug::ConvertableToTraceFormat {
  public:
   static scoped_refptr<base::debug::ConvertableToTraceFormat> CreateForChannel(
@@ -471,6 +477,8 @@ void GpuCommandBufferStub::OnInitialize(
                                          decoder_.get()));
   if (preemption_flag_.get())
     scheduler_->SetPreemptByFlag(preemption_flag_);
+  scheduler_->SetMaxDecodeTimeSlice(
+      base::TimeDelta::FromMilliseconds(kMaxDecodeTimeSliceMs));
 
   decoder_->set_engine(scheduler_.get());
 
@@ -554,8 +562,16 @@ void GpuCommandBufferStub::OnInitialize(
     total_gpu_memory_ = 0;
 
   if (!context_group_->has_program_cache()) {
-    context_group_->set_program_cache(
-        channel_->gpu_channel_manager()->program_cache());
+    gpu::gles2::ProgramCache* program_cache =
+        channel_->gpu_channel_manager()->program_cache();
+    if (program_cache) {
+      // The context is current here, so key cached program binaries to the
+      // active driver; binaries warmed up from disk after a driver change
+      // will no longer match and get recompiled.
+      program_cache->SetDriverIdentity(context->GetGLVersion() + '\n' +
+                                       context->GetGLRenderer());
+    }
+    context_group_->set_program_cache(program_cache);
   }
 
   // Initialize the decoder with either the view or pbuffer GLContext.
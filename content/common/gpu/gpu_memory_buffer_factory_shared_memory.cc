@@ -21,6 +21,7 @@ void GpuMemoryBufferFactorySharedMemory::
     GetSupportedGpuMemoryBufferConfigurations(
         std::vector<Configuration>* configurations) {
   const Configuration supported_configurations[] = {
+    { gfx::GpuMemoryBuffer::RGBA_4444, gfx::GpuMemoryBuffer::MAP },
     { gfx::GpuMemoryBuffer::RGBA_8888, gfx::GpuMemoryBuffer::MAP },
     { gfx::GpuMemoryBuffer::BGRA_8888, gfx::GpuMemoryBuffer::MAP }
   };
@@ -19,6 +19,9 @@
 
 #if defined(USE_SECCOMP_BPF)
 
+// For the complete sock_filter type behind CodeGen::Program.
+#include <linux/filter.h>
+
 #include "base/files/scoped_file.h"
 #include "base/memory/scoped_ptr.h"
 #include "base/posix/eintr_wrapper.h"
@@ -62,7 +65,8 @@ namespace content {
 namespace {
 
 void StartSandboxWithPolicy(sandbox::bpf_dsl::Policy* policy,
-                            base::ScopedFD proc_task_fd);
+                            base::ScopedFD proc_task_fd,
+                            scoped_ptr<sandbox::CodeGen::Program> program);
 
 inline bool IsChromeOS() {
 #if defined(OS_CHROMEOS)
@@ -146,9 +150,12 @@ void RunSandboxSanityChecks(const std::string& process_type) {
 }
 
 
-// This function takes ownership of |policy|.
+// This function takes ownership of |policy|. If |program| is non-NULL, it
+// must have been assembled from |policy| and is installed as-is instead of
+// compiling the policy again.
 void StartSandboxWithPolicy(sandbox::bpf_dsl::Policy* policy,
-                            base::ScopedFD proc_task_fd) {
+                            base::ScopedFD proc_task_fd,
+                            scoped_ptr<sandbox::CodeGen::Program> program) {
   // Starting the sandbox is a one-way operation. The kernel doesn't allow
   // us to unload a sandbox policy after it has been started. Nonetheless,
   // in order to make the use of the "Sandbox" object easier, we allow for
@@ -156,6 +163,8 @@ void StartSandboxWithPolicy(sandbox::bpf_dsl::Policy* policy,
   // doing so does not stop the sandbox.
   SandboxBPF sandbox(policy);
 
+  if (program)
+    sandbox.SetPreassembledFilter(program.Pass());
   sandbox.SetProcTaskFd(proc_task_fd.Pass());
   CHECK(sandbox.StartSandbox(SandboxBPF::SeccompLevel::SINGLE_THREADED));
 }
@@ -163,6 +172,13 @@ void StartSandboxWithPolicy(sandbox::bpf_dsl::Policy* policy,
 // nacl_helper needs to be tiny and includes only part of content/
 // in its dependencies. Make sure to not link things that are not needed.
 #if !defined(IN_NACL_HELPER)
+
+// BPF filter program compiled from the renderer policy in the zygote,
+// before any children are forked. Forked renderers inherit it and install
+// it without paying the compilation cost again. Leaked in the zygote so it
+// stays available for every subsequent fork.
+sandbox::CodeGen::Program* g_renderer_program = NULL;
+
 scoped_ptr<SandboxBPFBasePolicy> GetGpuProcessSandbox() {
   const base::CommandLine& command_line =
       *base::CommandLine::ForCurrentProcess();
@@ -189,11 +205,16 @@ bool StartBPFSandbox(const base::CommandLine& command_line,
                      const std::string& process_type,
                      base::ScopedFD proc_task_fd) {
   scoped_ptr<SandboxBPFBasePolicy> policy;
+  scoped_ptr<sandbox::CodeGen::Program> program;
 
   if (process_type == switches::kGpuProcess) {
     policy.reset(GetGpuProcessSandbox().release());
   } else if (process_type == switches::kRendererProcess) {
     policy.reset(new RendererProcessPolicy);
+    // Use the filter program that the zygote compiled for us, if there is
+    // one. This process owns the (copy-on-write) copy it inherited.
+    program.reset(g_renderer_program);
+    g_renderer_program = NULL;
   } else if (process_type == switches::kPpapiPluginProcess) {
     policy.reset(new PpapiProcessPolicy);
   } else if (process_type == switches::kUtilityProcess) {
@@ -204,7 +225,7 @@ bool StartBPFSandbox(const base::CommandLine& command_line,
   }
 
   CHECK(policy->PreSandboxHook());
-  StartSandboxWithPolicy(policy.release(), proc_task_fd.Pass());
+  StartSandboxWithPolicy(policy.release(), proc_task_fd.Pass(), program.Pass());
 
   RunSandboxSanityChecks(process_type);
   return true;
@@ -286,13 +307,31 @@ bool SandboxSeccompBPF::StartSandbox(const std::string& process_type,
   return false;
 }
 
+// static
+void SandboxSeccompBPF::PrecompileSandbox() {
+#if defined(USE_SECCOMP_BPF) && !defined(IN_NACL_HELPER)
+  if (!IsSeccompBPFDesired() ||
+      !ShouldEnableSeccompBPF(switches::kRendererProcess) ||
+      !SupportsSandbox()) {
+    return;
+  }
+  DCHECK(!g_renderer_program);
+  // Compiling also registers the policy's SIGSYS handlers with the global
+  // trap registry, which forked children inherit along with the program.
+  SandboxBPF sandbox(new RendererProcessPolicy);
+  g_renderer_program =
+      sandbox.AssembleFilter(false /* force_verification */).release();
+#endif  // defined(USE_SECCOMP_BPF) && !defined(IN_NACL_HELPER)
+}
+
 bool SandboxSeccompBPF::StartSandboxWithExternalPolicy(
     scoped_ptr<sandbox::bpf_dsl::Policy> policy,
     base::ScopedFD proc_task_fd) {
 #if defined(USE_SECCOMP_BPF)
   if (IsSeccompBPFDesired() && SupportsSandbox()) {
     CHECK(policy);
-    StartSandboxWithPolicy(policy.release(), proc_task_fd.Pass());
+    StartSandboxWithPolicy(policy.release(), proc_task_fd.Pass(),
+                           scoped_ptr<sandbox::CodeGen::Program>());
     return true;
   }
 #endif  // defined(USE_SECCOMP_BPF)
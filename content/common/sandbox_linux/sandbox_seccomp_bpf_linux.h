@@ -40,6 +40,11 @@ class SandboxSeccompBPF {
   // command line switches.
   static bool StartSandbox(const std::string& process_type,
                            base::ScopedFD proc_task_fd);
+  // Compile the renderer policy into a BPF filter program ahead of time.
+  // The zygote calls this before it starts forking, so that every renderer
+  // inherits the compiled program and StartSandbox() does not have to
+  // compile the policy again in each child.
+  static void PrecompileSandbox();
 
   // This is the API to enable a seccomp-bpf sandbox by using an
   // external policy.
@@ -602,6 +602,11 @@ IPC_MESSAGE_ROUTED1(ViewMsg_UpdateWebPreferences,
 // Informs the renderer that the timezone has changed.
 IPC_MESSAGE_CONTROL0(ViewMsg_TimezoneChange)
 
+// Asks the renderer to initialize Blink and its V8 isolate ahead of the first
+// message that needs them, so the work overlaps with process launch instead
+// of delaying the first navigation.
+IPC_MESSAGE_CONTROL0(ViewMsg_WarmupWebKit)
+
 // Tells the render view to close.
 // Expects a Close_ACK message when finished.
 IPC_MESSAGE_ROUTED0(ViewMsg_Close)
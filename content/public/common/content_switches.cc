@@ -573,6 +573,10 @@ const char kLogNetLog[]                     = "log-net-log";
 // Make plugin processes log their sent and received messages to VLOG(1).
 const char kLogPluginMessages[]             = "log-plugin-messages";
 
+// Record tasks that run for too long on the browser UI and IO threads into
+// a ring buffer, together with their posting site, for jank attribution.
+const char kLongTaskWatchdog[]              = "long-task-watchdog";
+
 // Sets the width and height above which a composited layer will get tiled.
 const char kMaxUntiledLayerHeight[]         = "max-untiled-layer-height";
 const char kMaxUntiledLayerWidth[]          = "max-untiled-layer-width";
@@ -104,6 +104,7 @@
 #include "content/renderer/render_view_impl.h"
 #include "content/renderer/renderer_blink_platform_impl.h"
 #include "content/renderer/scheduler/renderer_scheduler.h"
+#include "content/renderer/scheduler/v8_idle_task_runner_impl.h"
 #include "content/renderer/service_worker/embedded_worker_context_message_filter.h"
 #include "content/renderer/service_worker/embedded_worker_dispatcher.h"
 #include "content/renderer/shared_worker/embedded_shared_worker_stub.h"
@@ -209,6 +210,18 @@ const size_t kEmulatedDiscardableMemoryBytesToKeepWhenWidgetsHidden =
 base::LazyInstance<base::ThreadLocalPointer<RenderThreadImpl> >
     lazy_tls = LAZY_INSTANCE_INITIALIZER;
 
+// Runs a V8 garbage collection step sized to the idle period deadline, then
+// reposts itself for the next idle period. Idle tasks only run while the
+// scheduler has idle time to hand out, so the unconditional repost does not
+// busy-loop; when V8 has nothing to collect the notification returns quickly.
+void V8IdleNotificationTask(v8::Isolate* isolate,
+                            gin::V8IdleTaskRunner* idle_task_runner,
+                            double deadline_in_seconds) {
+  isolate->IdleNotificationDeadline(deadline_in_seconds);
+  idle_task_runner->PostIdleTask(
+      base::Bind(&V8IdleNotificationTask, isolate, idle_task_runner));
+}
+
 class RenderViewZoomer : public RenderViewVisitor {
  public:
   RenderViewZoomer(const std::string& scheme,
@@ -969,6 +982,15 @@ void RenderThreadImpl::EnsureWebKitInitialized() {
   isolate->SetCreateHistogramFunction(CreateHistogram);
   isolate->SetAddHistogramSampleFunction(AddHistogramSample);
 
+  if (!command_line.HasSwitch(switches::kDisableBlinkScheduler)) {
+    // Donate scheduler idle time to V8, so garbage collection steps run
+    // between frames with a deadline instead of on the crude idle timer.
+    v8_idle_task_runner_.reset(
+        new V8IdleTaskRunnerImpl(renderer_scheduler_->IdleTaskRunner()));
+    v8_idle_task_runner_->PostIdleTask(base::Bind(
+        &V8IdleNotificationTask, isolate, v8_idle_task_runner_.get()));
+  }
+
   main_thread_compositor_task_runner_ =
       renderer_scheduler_->CompositorTaskRunner();
 
@@ -1144,7 +1166,9 @@ void RenderThreadImpl::IdleHandler() {
   // something is left to do.
   bool continue_timer = !webkit_shared_timer_suspended_;
 
-  if (blink::mainThreadIsolate() &&
+  // When the scheduler donates real idle time to V8 the timer-based
+  // notification with its made-up budget is redundant.
+  if (!v8_idle_task_runner_ && blink::mainThreadIsolate() &&
       !blink::mainThreadIsolate()->IdleNotification(1000)) {
     continue_timer = true;
   }
@@ -1477,6 +1501,7 @@ bool RenderThreadImpl::OnControlMessageReceived(const IPC::Message& msg) {
     // TODO(port): removed from render_messages_internal.h;
     // is there a new non-windows message I should add here?
     IPC_MESSAGE_HANDLER(ViewMsg_New, OnCreateNewView)
+    IPC_MESSAGE_HANDLER(ViewMsg_WarmupWebKit, OnWarmupWebKit)
     IPC_MESSAGE_HANDLER(ViewMsg_NetworkTypeChanged, OnNetworkTypeChanged)
     IPC_MESSAGE_HANDLER(ViewMsg_TempCrashWithData, OnTempCrashWithData)
     IPC_MESSAGE_HANDLER(WorkerProcessMsg_CreateWorker, OnCreateNewSharedWorker)
@@ -1525,6 +1550,11 @@ void RenderThreadImpl::OnCreateNewView(const ViewMsg_New_Params& params) {
   RenderViewImpl::Create(params, compositor_deps, false);
 }
 
+void RenderThreadImpl::OnWarmupWebKit() {
+  TRACE_EVENT0("startup", "RenderThreadImpl::OnWarmupWebKit");
+  EnsureWebKitInitialized();
+}
+
 GpuChannelHost* RenderThreadImpl::EstablishGpuChannelSync(
     CauseForGpuLaunch cause_for_gpu_launch) {
   TRACE_EVENT0("gpu", "RenderThreadImpl::EstablishGpuChannelSync");
@@ -1760,6 +1790,8 @@ void RenderThreadImpl::WidgetHidden() {
   hidden_widget_count_++;
 
   if (widget_count_ && hidden_widget_count_ == widget_count_) {
+    renderer_scheduler_->OnRendererHidden();
+
     // TODO(reveman): Remove this when we have a better mechanism to prevent
     // total discardable memory used by all renderers from growing too large.
     base::internal::DiscardableMemoryEmulated::
@@ -1774,6 +1806,7 @@ void RenderThreadImpl::WidgetHidden() {
 void RenderThreadImpl::WidgetRestored() {
   DCHECK_GT(hidden_widget_count_, 0);
   hidden_widget_count_--;
+  renderer_scheduler_->OnRendererVisible();
 
   if (!GetContentClient()->renderer()->RunIdleHandlerWhenWidgetsHidden()) {
     return;
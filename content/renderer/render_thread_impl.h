@@ -63,6 +63,10 @@ class AudioHardwareConfig;
 class GpuVideoAcceleratorFactories;
 }
 
+namespace gin {
+class V8IdleTaskRunner;
+}
+
 namespace v8 {
 class Extension;
 }
@@ -438,6 +442,7 @@ class CONTENT_EXPORT RenderThreadImpl
                                    const std::string& host,
                                    double zoom_level);
   void OnCreateNewView(const ViewMsg_New_Params& params);
+  void OnWarmupWebKit();
   void OnTransferBitmap(const SkBitmap& bitmap, int resource_id);
 #if defined(ENABLE_PLUGINS)
   void OnPurgePluginListCache(bool reload_pages);
@@ -468,6 +473,9 @@ class CONTENT_EXPORT RenderThreadImpl
   scoped_ptr<DomStorageDispatcher> dom_storage_dispatcher_;
   scoped_ptr<IndexedDBDispatcher> main_thread_indexed_db_dispatcher_;
   scoped_ptr<RendererScheduler> renderer_scheduler_;
+  // Set when the renderer scheduler donates idle time to V8 for garbage
+  // collection; the timer-based idle notification is skipped while it is set.
+  scoped_ptr<gin::V8IdleTaskRunner> v8_idle_task_runner_;
   scoped_ptr<RendererBlinkPlatformImpl> blink_platform_impl_;
   scoped_ptr<EmbeddedWorkerDispatcher> embedded_worker_dispatcher_;
 
@@ -73,6 +73,12 @@ void NullRendererScheduler::DidReceiveInputEventOnCompositorThread(
 void NullRendererScheduler::DidAnimateForInputOnCompositorThread() {
 }
 
+void NullRendererScheduler::OnRendererHidden() {
+}
+
+void NullRendererScheduler::OnRendererVisible() {
+}
+
 bool NullRendererScheduler::ShouldYieldForHighPriorityWork() {
   return false;
 }
@@ -23,6 +23,8 @@ class NullRendererScheduler : public RendererScheduler {
   void DidReceiveInputEventOnCompositorThread(
       blink::WebInputEvent::Type type) override;
   void DidAnimateForInputOnCompositorThread() override;
+  void OnRendererHidden() override;
+  void OnRendererVisible() override;
   bool ShouldYieldForHighPriorityWork() override;
   void Shutdown() override;
 
@@ -49,6 +49,18 @@ class CONTENT_EXPORT RendererScheduler {
   // a fling). Called by the compositor (impl) thread.
   virtual void DidAnimateForInputOnCompositorThread() = 0;
 
+  // Tells the scheduler that all the renderer's widgets are hidden, e.g.
+  // because its tabs are in the background.  The scheduler throttles the
+  // default task queue to a coarse, aligned tick until the renderer becomes
+  // visible again, so hidden pages cannot wake the CPU at a fine cadence.
+  // Must be called on the main thread.
+  virtual void OnRendererHidden() = 0;
+
+  // Tells the scheduler that at least one of the renderer's widgets is
+  // visible again, ending the throttling of the default task queue.  Must be
+  // called on the main thread.
+  virtual void OnRendererVisible() = 0;
+
   // Returns true if there is high priority work pending on the main thread
   // and the caller should yield to let the scheduler service that work.
   // Must be called from the main thread.
@@ -28,6 +28,7 @@ RendererSchedulerImpl::RendererSchedulerImpl(
       compositor_task_runner_(
           task_queue_manager_->TaskRunnerForQueue(COMPOSITOR_TASK_QUEUE)),
       current_policy_(NORMAL_PRIORITY_POLICY),
+      renderer_hidden_(false),
       policy_may_need_update_(&incoming_signals_lock_),
       weak_factory_(this) {
   weak_renderer_scheduler_ptr_ = weak_factory_.GetWeakPtr();
@@ -35,6 +36,9 @@ RendererSchedulerImpl::RendererSchedulerImpl(
                                       weak_renderer_scheduler_ptr_);
   end_idle_period_closure_.Reset(base::Bind(
       &RendererSchedulerImpl::EndIdlePeriod, weak_renderer_scheduler_ptr_));
+  pump_throttled_tasks_closure_.Reset(
+      base::Bind(&RendererSchedulerImpl::PumpThrottledTasks,
+                 weak_renderer_scheduler_ptr_));
   idle_task_runner_ = make_scoped_refptr(new SingleThreadIdleTaskRunner(
       task_queue_manager_->TaskRunnerForQueue(IDLE_TASK_QUEUE),
       base::Bind(&RendererSchedulerImpl::CurrentIdleTaskDeadlineCallback,
@@ -127,6 +131,58 @@ void RendererSchedulerImpl::DidAnimateForInputOnCompositorThread() {
   UpdateForInputEvent();
 }
 
+void RendererSchedulerImpl::OnRendererHidden() {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("renderer.scheduler"),
+               "RendererSchedulerImpl::OnRendererHidden");
+  main_thread_checker_.CalledOnValidThread();
+  if (!task_queue_manager_ || renderer_hidden_)
+    return;
+
+  renderer_hidden_ = true;
+  task_queue_manager_->SetAutoPump(DEFAULT_TASK_QUEUE, false);
+  SchedulePumpThrottledTasks();
+}
+
+void RendererSchedulerImpl::OnRendererVisible() {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("renderer.scheduler"),
+               "RendererSchedulerImpl::OnRendererVisible");
+  main_thread_checker_.CalledOnValidThread();
+  if (!task_queue_manager_ || !renderer_hidden_)
+    return;
+
+  renderer_hidden_ = false;
+  pump_throttled_tasks_closure_.Cancel();
+  // Re-enabling automatic pumping releases any tasks batched up while hidden.
+  task_queue_manager_->SetAutoPump(DEFAULT_TASK_QUEUE, true);
+}
+
+void RendererSchedulerImpl::SchedulePumpThrottledTasks() {
+  main_thread_checker_.CalledOnValidThread();
+  base::TimeDelta interval =
+      base::TimeDelta::FromMilliseconds(kBackgroundPumpIntervalMillis);
+  // Wake up on the next whole multiple of the pump interval.  TimeTicks
+  // shares an epoch between processes, so hidden renderers which compute
+  // their delays this way all wake on the same tick.
+  base::TimeDelta time_since_epoch = Now() - base::TimeTicks();
+  base::TimeDelta delay =
+      interval - base::TimeDelta::FromMicroseconds(
+                     time_since_epoch.InMicroseconds() %
+                     interval.InMicroseconds());
+  control_task_runner_->PostDelayedTask(
+      FROM_HERE, pump_throttled_tasks_closure_.callback(), delay);
+}
+
+void RendererSchedulerImpl::PumpThrottledTasks() {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("renderer.scheduler"),
+               "RendererSchedulerImpl::PumpThrottledTasks");
+  main_thread_checker_.CalledOnValidThread();
+  if (!task_queue_manager_ || !renderer_hidden_)
+    return;
+
+  task_queue_manager_->PumpQueue(DEFAULT_TASK_QUEUE);
+  SchedulePumpThrottledTasks();
+}
+
 void RendererSchedulerImpl::UpdateForInputEvent() {
   base::AutoLock lock(incoming_signals_lock_);
   if (last_input_time_.is_null()) {
@@ -304,6 +360,7 @@ RendererSchedulerImpl::AsValueLocked(base::TimeTicks optional_now) const {
       new base::debug::TracedValue();
 
   state->SetString("current_policy", PolicyToString(current_policy_));
+  state->SetBoolean("renderer_hidden", renderer_hidden_);
   state->SetDouble("now", (optional_now - base::TimeTicks()).InMillisecondsF());
   state->SetDouble("last_input_time",
                    (last_input_time_ - base::TimeTicks()).InMillisecondsF());
@@ -38,6 +38,8 @@ class CONTENT_EXPORT RendererSchedulerImpl : public RendererScheduler {
   void DidReceiveInputEventOnCompositorThread(
       blink::WebInputEvent::Type type) override;
   void DidAnimateForInputOnCompositorThread() override;
+  void OnRendererHidden() override;
+  void OnRendererVisible() override;
   bool ShouldYieldForHighPriorityWork() override;
   void Shutdown() override;
 
@@ -90,6 +92,11 @@ class CONTENT_EXPORT RendererSchedulerImpl : public RendererScheduler {
   // The time we should stay in CompositorPriority mode for after a touch event.
   static const int kCompositorPriorityAfterTouchMillis = 100;
 
+  // While the renderer is hidden, the default task queue is pumped once per
+  // this interval, on ticks aligned across all renderers so that a host full
+  // of background tabs wakes the CPU in one burst rather than a drizzle.
+  static const int kBackgroundPumpIntervalMillis = 1000;
+
   // IdleTaskDeadlineSupplier Implementation:
   void CurrentIdleTaskDeadlineCallback(base::TimeTicks* deadline_out) const;
 
@@ -113,6 +120,14 @@ class CONTENT_EXPORT RendererSchedulerImpl : public RendererScheduler {
   void StartIdlePeriod();
   void EndIdlePeriod();
 
+  // Schedules the next aligned pump of the throttled default queue while the
+  // renderer is hidden.
+  void SchedulePumpThrottledTasks();
+
+  // Releases the tasks batched up while the renderer is hidden and schedules
+  // the next pump.
+  void PumpThrottledTasks();
+
   base::ThreadChecker main_thread_checker_;
   scoped_ptr<RendererTaskQueueSelector> renderer_task_queue_selector_;
   scoped_ptr<TaskQueueManager> task_queue_manager_;
@@ -123,10 +138,15 @@ class CONTENT_EXPORT RendererSchedulerImpl : public RendererScheduler {
 
   base::Closure update_policy_closure_;
   CancelableClosureHolder end_idle_period_closure_;
+  CancelableClosureHolder pump_throttled_tasks_closure_;
 
   // Don't access current_policy_ directly, instead use SchedulerPolicy().
   Policy current_policy_;
 
+  // True while the renderer is hidden and the default queue is throttled.
+  // Only accessed on the main thread.
+  bool renderer_hidden_;
+
   base::TimeTicks estimated_next_frame_begin_;
 
   // The incoming_signals_lock_ mutex protects access to last_input_time_
@@ -536,4 +536,73 @@ TEST_F(RendererSchedulerImplTest, TestShouldYield) {
   EXPECT_TRUE(should_yield_after);
 }
 
+TEST_F(RendererSchedulerImplTest, TestRendererHiddenThrottlesDefaultTasks) {
+  std::vector<std::string> order;
+
+  scheduler_->OnRendererHidden();
+  default_task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&AppendToVectorTestTask, &order, std::string("D1")));
+  default_task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&AppendToVectorTestTask, &order, std::string("D2")));
+
+  // The default queue is no longer pumped automatically, so the tasks should
+  // be held back until the next aligned pump.
+  RunUntilIdle();
+  EXPECT_TRUE(order.empty());
+
+  // Running up to just before the next multiple of the pump interval should
+  // still not release the tasks.
+  mock_task_runner_->RunForPeriod(base::TimeDelta::FromMilliseconds(900));
+  EXPECT_TRUE(order.empty());
+
+  // Crossing the aligned tick pumps the queue and runs everything batched up.
+  mock_task_runner_->RunForPeriod(base::TimeDelta::FromMilliseconds(200));
+  EXPECT_THAT(order,
+              testing::ElementsAre(std::string("D1"), std::string("D2")));
+}
+
+TEST_F(RendererSchedulerImplTest, TestRendererVisibleReleasesThrottledTasks) {
+  std::vector<std::string> order;
+
+  scheduler_->OnRendererHidden();
+  default_task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&AppendToVectorTestTask, &order, std::string("D1")));
+  RunUntilIdle();
+  EXPECT_TRUE(order.empty());
+
+  // Becoming visible again should release the batched tasks immediately,
+  // without waiting for the next aligned tick.
+  scheduler_->OnRendererVisible();
+  RunUntilIdle();
+  EXPECT_THAT(order, testing::ElementsAre(std::string("D1")));
+
+  // The queue should be back to normal auto-pumping behavior.
+  default_task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&AppendToVectorTestTask, &order, std::string("D2")));
+  RunUntilIdle();
+  EXPECT_THAT(order,
+              testing::ElementsAre(std::string("D1"), std::string("D2")));
+}
+
+TEST_F(RendererSchedulerImplTest, TestRendererHiddenCompositorTasksUnaffected) {
+  std::vector<std::string> order;
+
+  scheduler_->OnRendererHidden();
+  default_task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&AppendToVectorTestTask, &order, std::string("D1")));
+  compositor_task_runner_->PostTask(
+      FROM_HERE,
+      base::Bind(&AppendToVectorTestTask, &order, std::string("C1")));
+
+  // Only the default queue is throttled while hidden; the compositor task
+  // should run straight away.
+  RunUntilIdle();
+  EXPECT_THAT(order, testing::ElementsAre(std::string("C1")));
+}
+
 }  // namespace content
@@ -0,0 +1,37 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "content/renderer/scheduler/v8_idle_task_runner_impl.h"
+
+#include "base/bind.h"
+#include "base/location.h"
+#include "base/time/time.h"
+
+namespace content {
+namespace {
+
+void RunIdleTask(const gin::V8IdleTaskRunner::IdleTask& idle_task,
+                 base::TimeTicks deadline) {
+  // The deadline is converted to the timebase used by
+  // v8::Platform::MonotonicallyIncreasingTime().
+  idle_task.Run(deadline.ToInternalValue() /
+                static_cast<double>(base::Time::kMicrosecondsPerSecond));
+}
+
+}  // namespace
+
+V8IdleTaskRunnerImpl::V8IdleTaskRunnerImpl(
+    scoped_refptr<SingleThreadIdleTaskRunner> idle_task_runner)
+    : idle_task_runner_(idle_task_runner) {
+}
+
+V8IdleTaskRunnerImpl::~V8IdleTaskRunnerImpl() {
+}
+
+void V8IdleTaskRunnerImpl::PostIdleTask(const IdleTask& idle_task) {
+  idle_task_runner_->PostIdleTask(FROM_HERE,
+                                  base::Bind(&RunIdleTask, idle_task));
+}
+
+}  // namespace content
@@ -0,0 +1,35 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CONTENT_RENDERER_SCHEDULER_V8_IDLE_TASK_RUNNER_IMPL_H_
+#define CONTENT_RENDERER_SCHEDULER_V8_IDLE_TASK_RUNNER_IMPL_H_
+
+#include "base/memory/ref_counted.h"
+#include "content/common/content_export.h"
+#include "content/renderer/scheduler/single_thread_idle_task_runner.h"
+#include "gin/public/v8_idle_task_runner.h"
+
+namespace content {
+
+// Feeds gin idle tasks into the renderer scheduler's idle task runner,
+// converting the scheduler's base::TimeTicks deadline into the seconds
+// timebase V8 expects.
+class CONTENT_EXPORT V8IdleTaskRunnerImpl : public gin::V8IdleTaskRunner {
+ public:
+  explicit V8IdleTaskRunnerImpl(
+      scoped_refptr<SingleThreadIdleTaskRunner> idle_task_runner);
+  ~V8IdleTaskRunnerImpl() override;
+
+  // gin::V8IdleTaskRunner implementation:
+  void PostIdleTask(const IdleTask& idle_task) override;
+
+ private:
+  scoped_refptr<SingleThreadIdleTaskRunner> idle_task_runner_;
+
+  DISALLOW_COPY_AND_ASSIGN(V8IdleTaskRunnerImpl);
+};
+
+}  // namespace content
+
+#endif  // CONTENT_RENDERER_SCHEDULER_V8_IDLE_TASK_RUNNER_IMPL_H_
@@ -32,6 +32,7 @@
 #include "content/common/child_process_sandbox_support_impl_linux.h"
 #include "content/common/font_config_ipc_linux.h"
 #include "content/common/sandbox_linux/sandbox_linux.h"
+#include "content/common/sandbox_linux/sandbox_seccomp_bpf_linux.h"
 #include "content/common/zygote_commands_linux.h"
 #include "content/public/common/content_switches.h"
 #include "content/public/common/main_function_params.h"
@@ -638,6 +639,11 @@ bool ZygoteMain(const MainFunctionParams& params,
   extra_fds.push_back(sancov_socket_fds[1]);
 #endif
 
+  // Compile the renderer's seccomp policy up front, so the work is done
+  // once here rather than in every forked renderer. This matters most when
+  // many renderers are started in a burst, e.g. during session restore.
+  SandboxSeccompBPF::PrecompileSandbox();
+
   int sandbox_flags = linux_sandbox->GetStatus();
   bool setuid_sandbox_engaged = sandbox_flags & kSandboxLinuxSUID;
   CHECK_EQ(must_enable_setuid_sandbox, setuid_sandbox_engaged);
@@ -14,11 +14,15 @@
 
 #include "courgette/ensemble.h"
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
 #include "base/basictypes.h"
 #include "base/logging.h"
+#include "base/memory/scoped_vector.h"
+#include "base/sys_info.h"
+#include "base/threading/simple_thread.h"
 #include "base/time/time.h"
 
 #include "courgette/crc.h"
@@ -238,6 +242,35 @@ void FreeGenerators(std::vector<TransformationPatchGenerator*>* generators) {
   generators->clear();
 }
 
+// Transforms one element on a worker thread.  Each element's transform only
+// touches that element's own programs and streams, so the elements of an
+// ensemble can be transformed in parallel.
+class TransformWorkItem : public base::DelegateSimpleThread::Delegate {
+ public:
+  explicit TransformWorkItem(TransformationPatchGenerator* generator)
+      : generator_(generator), status_(C_GENERAL_ERROR) {}
+
+  SourceStreamSet* parameters() { return &parameters_; }
+  SinkStreamSet* predicted() { return &predicted_; }
+  SinkStreamSet* corrected() { return &corrected_; }
+  Status status() const { return status_; }
+
+  virtual void Run() {
+    status_ = generator_->Transform(&parameters_, &predicted_, &corrected_);
+    if (status_ == C_OK && !parameters_.Empty())
+      status_ = C_STREAM_NOT_CONSUMED;
+  }
+
+ private:
+  TransformationPatchGenerator* generator_;
+  SourceStreamSet parameters_;
+  SinkStreamSet predicted_;
+  SinkStreamSet corrected_;
+  Status status_;
+
+  DISALLOW_COPY_AND_ASSIGN(TransformWorkItem);
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Status GenerateEnsemblePatch(SourceStream* base,
@@ -324,6 +357,9 @@ Status GenerateEnsemblePatch(SourceStream* base,
   if (delta1_status != C_OK)
     return delta1_status;
 
+  // Last use, free storage.
+  linearized_predicted_parameters.Retire();
+
   //
   // Generate sub-patch for elements.
   //
@@ -335,31 +371,44 @@ Status GenerateEnsemblePatch(SourceStream* base,
   SinkStreamSet predicted_transformed_elements;
   SinkStreamSet corrected_transformed_elements;
 
+  // The transforms are independent of each other and dominate the time taken
+  // to generate the patch, so hand them to a pool of worker threads, one work
+  // item per element.
+  ScopedVector<TransformWorkItem> work_items;
   for (size_t i = 0;  i < number_of_transformations;  ++i) {
-    SourceStreamSet single_parameters;
-    if (!corrected_parameters_source_set.ReadSet(&single_parameters))
+    work_items.push_back(new TransformWorkItem(generators[i]));
+    if (!corrected_parameters_source_set.ReadSet(work_items[i]->parameters()))
       return C_STREAM_ERROR;
-    SinkStreamSet single_predicted_transformed_element;
-    SinkStreamSet single_corrected_transformed_element;
-    Status status = generators[i]->Transform(
-        &single_parameters,
-        &single_predicted_transformed_element,
-        &single_corrected_transformed_element);
+  }
+
+  if (!corrected_parameters_source_set.Empty())
+    return C_STREAM_NOT_CONSUMED;
+
+  if (number_of_transformations == 1) {
+    // Don't pay for thread start-up to transform a single element.
+    work_items[0]->Run();
+  } else if (number_of_transformations > 1) {
+    int number_of_workers =
+        std::min(static_cast<int>(number_of_transformations),
+                 base::SysInfo::NumberOfProcessors());
+    base::DelegateSimpleThreadPool pool("CourgetteTransform",
+                                        number_of_workers);
+    for (size_t i = 0;  i < number_of_transformations;  ++i)
+      pool.AddWork(work_items[i]);
+    pool.Start();
+    pool.JoinAll();
+  }
+
+  for (size_t i = 0;  i < number_of_transformations;  ++i) {
+    Status status = work_items[i]->status();
     if (status != C_OK)
       return status;
-    if (!single_parameters.Empty())
-      return C_STREAM_NOT_CONSUMED;
-    if (!predicted_transformed_elements.WriteSet(
-            &single_predicted_transformed_element))
+    if (!predicted_transformed_elements.WriteSet(work_items[i]->predicted()))
       return C_STREAM_ERROR;
-    if (!corrected_transformed_elements.WriteSet(
-            &single_corrected_transformed_element))
+    if (!corrected_transformed_elements.WriteSet(work_items[i]->corrected()))
       return C_STREAM_ERROR;
   }
 
-  if (!corrected_parameters_source_set.Empty())
-    return C_STREAM_NOT_CONSUMED;
-
   SinkStream linearized_predicted_transformed_elements;
   SinkStream linearized_corrected_transformed_elements;
 
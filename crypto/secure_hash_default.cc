@@ -4,11 +4,27 @@
 
 #include "crypto/secure_hash.h"
 
+#include "base/basictypes.h"
 #include "base/logging.h"
 #include "base/pickle.h"
+#include "build/build_config.h"
 #include "crypto/third_party/nss/chromium-blapi.h"
 #include "crypto/third_party/nss/chromium-sha256.h"
 
+// See the matching block in base/sha1_portable.cc: the Intel SHA extensions
+// are only reachable through the target attribute, which MSVC lacks.
+#if defined(ARCH_CPU_X86_FAMILY) && !defined(OS_NACL) && \
+    (defined(__clang__) || defined(__GNUC__))
+#define CRYPTO_USE_SHA_NI
+#define CRYPTO_TARGET_SHA_NI __attribute__((target("sha,sse4.1")))
+#endif
+
+#if defined(CRYPTO_USE_SHA_NI)
+#include <immintrin.h>
+
+#include "base/cpu.h"
+#endif
+
 namespace crypto {
 
 namespace {
@@ -38,7 +54,7 @@ class SecureHashSHA256NSS : public SecureHash {
   bool Serialize(Pickle* pickle) override;
   bool Deserialize(PickleIterator* data_iterator) override;
 
- private:
+ protected:
   SHA256Context ctx_;
 };
 
@@ -79,11 +95,153 @@ bool SecureHashSHA256NSS::Deserialize(PickleIterator* data_iterator) {
   return true;
 }
 
+#if defined(CRYPTO_USE_SHA_NI)
+
+bool ShaNiSupported() {
+  static bool has_sha = base::CPU().has_sha();
+  return has_sha;
+}
+
+const PRUint32 kSHA256RoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+// Runs the SHA-256 block transform over |blocks| 64-byte blocks of |data|,
+// updating the eight word state in |h| (in host byte order, matching
+// SHA256Context). sha256rnds2 performs two rounds at a time and expects the
+// state split across two registers as (A, B, E, F) and (C, D, G, H).
+CRYPTO_TARGET_SHA_NI
+void SHA256TransformShaNi(PRUint32* h, const unsigned char* data,
+                          size_t blocks) {
+  const __m128i kByteSwapMask =
+      _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+  __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h));
+  __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + 4));
+  tmp = _mm_shuffle_epi32(tmp, 0xB1);        // CDAB
+  state1 = _mm_shuffle_epi32(state1, 0x1B);  // EFGH
+  __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);    // ABEF
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0);         // CDGH
+
+  while (blocks--) {
+    const __m128i state0_save = state0;
+    const __m128i state1_save = state1;
+
+    // m0..m3 hold the next sixteen words of the message schedule.
+    __m128i m0 = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)),
+        kByteSwapMask);
+    __m128i m1 = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)),
+        kByteSwapMask);
+    __m128i m2 = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)),
+        kByteSwapMask);
+    __m128i m3 = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)),
+        kByteSwapMask);
+
+    for (int i = 0; i < 16; ++i) {
+      const __m128i k = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(kSHA256RoundConstants + 4 * i));
+      __m128i msg = _mm_add_epi32(m0, k);
+      state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+      msg = _mm_shuffle_epi32(msg, 0x0E);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+      if (i < 12) {
+        // W[t+16..t+19] from W[t..t+15], per the sha256msg1/msg2 split.
+        const __m128i next = _mm_sha256msg2_epu32(
+            _mm_add_epi32(_mm_sha256msg1_epu32(m0, m1),
+                          _mm_alignr_epi8(m3, m2, 4)),
+            m3);
+        m0 = m1;
+        m1 = m2;
+        m2 = m3;
+        m3 = next;
+      } else {
+        m0 = m1;
+        m1 = m2;
+        m2 = m3;
+      }
+    }
+
+    state0 = _mm_add_epi32(state0, state0_save);
+    state1 = _mm_add_epi32(state1, state1_save);
+    data += 64;
+  }
+
+  tmp = _mm_shuffle_epi32(state0, 0x1B);     // FEBA
+  state1 = _mm_shuffle_epi32(state1, 0xB1);  // DCHG
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0);        // DCBA
+  state1 = _mm_alignr_epi8(state1, tmp, 8);           // HGFE
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(h), state0);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(h + 4), state1);
+}
+
+// Feeds whole blocks to the SHA extensions while keeping |ctx_| in exactly
+// the state the scalar code would leave it in, so the inherited Serialize()
+// and Deserialize() stay wire-compatible with SecureHashSHA256NSS. Partial
+// blocks and padding still go through the NSS routines.
+class SecureHashSHA256ShaNi : public SecureHashSHA256NSS {
+ public:
+  void Update(const void* input, size_t len) override {
+    const unsigned char* data = static_cast<const unsigned char*>(input);
+
+    // Let the scalar code top up (and maybe compress) a partial block.
+    unsigned int in_buf = ctx_.sizeLo & 0x3f;
+    if (in_buf) {
+      unsigned int todo = SHA256_BLOCK_LENGTH - in_buf;
+      if (len < todo)
+        todo = static_cast<unsigned int>(len);
+      SHA256_Update(&ctx_, data, todo);
+      data += todo;
+      len -= todo;
+    }
+
+    size_t bulk = len & ~static_cast<size_t>(SHA256_BLOCK_LENGTH - 1);
+    if (bulk) {
+      SHA256TransformShaNi(ctx_.h, data, bulk / SHA256_BLOCK_LENGTH);
+      // Maintain the byte count the way SHA256_Update does.
+      PRUint32 lo = static_cast<PRUint32>(bulk);
+      if ((ctx_.sizeLo += lo) < lo)
+        ctx_.sizeHi++;
+      ctx_.sizeHi += static_cast<PRUint32>(static_cast<uint64>(bulk) >> 32);
+      data += bulk;
+      len -= bulk;
+    }
+
+    if (len)
+      SHA256_Update(&ctx_, data, static_cast<unsigned int>(len));
+  }
+};
+
+#endif  // defined(CRYPTO_USE_SHA_NI)
+
 }  // namespace
 
 SecureHash* SecureHash::Create(Algorithm algorithm) {
   switch (algorithm) {
     case SHA256:
+#if defined(CRYPTO_USE_SHA_NI)
+      if (ShaNiSupported())
+        return new SecureHashSHA256ShaNi();
+#endif
       return new SecureHashSHA256NSS();
     default:
       NOTIMPLEMENTED();
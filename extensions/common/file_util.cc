@@ -31,6 +31,8 @@
 #include "extensions/common/manifest_handlers/icons_handler.h"
 #include "extensions/common/message_bundle.h"
 #include "grit/extensions_strings.h"
+#include "ipc/ipc_message.h"
+#include "ipc/ipc_message_utils.h"
 #include "net/base/escape.h"
 #include "ui/base/l10n/l10n_util.h"
 #include "url/gurl.h"
@@ -51,6 +53,63 @@ bool ValidateFilePath(const base::FilePath& path) {
   return true;
 }
 
+// A parsed manifest is cached on disk in the extension's _metadata directory
+// so that warm starts deserialize a pickle instead of re-parsing JSON. The
+// cache records the manifest's size and mtime and is ignored (and rewritten)
+// when they no longer match, so unpacked extensions that edit their manifest
+// are re-parsed as before.
+const base::FilePath::CharType kManifestCacheFilename[] =
+    FILE_PATH_LITERAL("manifest_cache.bin");
+
+// Bump when the cache layout below changes.
+const int kManifestCacheVersion = 1;
+
+base::FilePath GetManifestCachePath(const base::FilePath& extension_path) {
+  return extension_path.Append(kMetadataFolder).Append(kManifestCacheFilename);
+}
+
+base::DictionaryValue* ReadManifestCache(const base::FilePath& extension_path,
+                                         const base::File::Info& manifest_info) {
+  std::string data;
+  if (!base::ReadFileToString(GetManifestCachePath(extension_path), &data))
+    return NULL;
+
+  IPC::Message pickle(data.data(), data.size());
+  PickleIterator iter(pickle);
+  int version = 0;
+  int64 size = 0;
+  int64 mtime = 0;
+  if (!iter.ReadInt(&version) || version != kManifestCacheVersion ||
+      !iter.ReadInt64(&size) || size != manifest_info.size ||
+      !iter.ReadInt64(&mtime) ||
+      mtime != manifest_info.last_modified.ToInternalValue()) {
+    return NULL;
+  }
+
+  scoped_ptr<base::DictionaryValue> manifest(new base::DictionaryValue);
+  if (!IPC::ReadParam(&pickle, &iter, manifest.get()))
+    return NULL;
+  return manifest.release();
+}
+
+void WriteManifestCache(const base::FilePath& extension_path,
+                        const base::File::Info& manifest_info,
+                        const base::DictionaryValue& manifest) {
+  IPC::Message pickle;
+  pickle.WriteInt(kManifestCacheVersion);
+  pickle.WriteInt64(manifest_info.size);
+  pickle.WriteInt64(manifest_info.last_modified.ToInternalValue());
+  IPC::WriteParam(&pickle, manifest);
+
+  // Failure just means the next start parses the JSON again.
+  base::FilePath cache_path = GetManifestCachePath(extension_path);
+  if (!base::CreateDirectory(cache_path.DirName()))
+    return;
+  base::WriteFile(cache_path,
+                  static_cast<const char*>(pickle.data()),
+                  pickle.size());
+}
+
 }  // namespace
 
 const base::FilePath::CharType kTempDirectoryName[] = FILE_PATH_LITERAL("Temp");
@@ -155,7 +214,22 @@ scoped_refptr<Extension> LoadExtension(const base::FilePath& extension_path,
 
 base::DictionaryValue* LoadManifest(const base::FilePath& extension_path,
                                     std::string* error) {
-  return LoadManifest(extension_path, kManifestFilename, error);
+  base::File::Info manifest_info;
+  bool have_manifest_info =
+      base::GetFileInfo(extension_path.Append(kManifestFilename),
+                        &manifest_info);
+  if (have_manifest_info) {
+    base::DictionaryValue* cached =
+        ReadManifestCache(extension_path, manifest_info);
+    if (cached)
+      return cached;
+  }
+
+  base::DictionaryValue* manifest =
+      LoadManifest(extension_path, kManifestFilename, error);
+  if (manifest && have_manifest_info)
+    WriteManifestCache(extension_path, manifest_info, *manifest);
+  return manifest;
 }
 
 base::DictionaryValue* LoadManifest(
@@ -260,7 +334,8 @@ bool CheckForIllegalFilenames(const base::FilePath& extension_path,
                               std::string* error) {
   // Reserved underscore names.
   static const base::FilePath::CharType* reserved_names[] = {
-      kLocaleFolder, kPlatformSpecificFolder, FILE_PATH_LITERAL("__MACOSX"), };
+      kLocaleFolder, kPlatformSpecificFolder, kMetadataFolder,
+      FILE_PATH_LITERAL("__MACOSX"), };
   CR_DEFINE_STATIC_LOCAL(
       std::set<base::FilePath::StringType>,
       reserved_underscore_names,
@@ -59,6 +59,19 @@ v8::Local<v8::FunctionTemplate> PerIsolateData::GetFunctionTemplate(
   return it->second.Get(isolate_);
 }
 
+void PerIsolateData::SetUnboundScript(const std::string& source,
+                                      v8::Local<v8::UnboundScript> script) {
+  unbound_scripts_[source] = Eternal<v8::UnboundScript>(isolate_, script);
+}
+
+v8::Local<v8::UnboundScript> PerIsolateData::GetUnboundScript(
+    const std::string& source) {
+  UnboundScriptMap::iterator it = unbound_scripts_.find(source);
+  if (it == unbound_scripts_.end())
+    return v8::Local<v8::UnboundScript>();
+  return it->second.Get(isolate_);
+}
+
 void PerIsolateData::SetIndexedPropertyInterceptor(
     WrappableBase* base,
     IndexedPropertyInterceptor* interceptor) {
@@ -6,6 +6,7 @@
 #define GIN_PER_ISOLATE_DATA_H_
 
 #include <map>
+#include <string>
 
 #include "base/basictypes.h"
 #include "base/memory/ref_counted.h"
@@ -47,6 +48,14 @@ class GIN_EXPORT PerIsolateData {
   v8::Local<v8::ObjectTemplate> GetObjectTemplate(WrapperInfo* info);
   v8::Local<v8::FunctionTemplate> GetFunctionTemplate(WrapperInfo* info);
 
+  // Compiled scripts are cached per isolate, keyed by their source, so that
+  // embedders running the same source in many contexts only pay the
+  // compilation cost once; the cached script is context-independent and is
+  // bound to the current context by the caller.
+  void SetUnboundScript(const std::string& source,
+                        v8::Local<v8::UnboundScript> script);
+  v8::Local<v8::UnboundScript> GetUnboundScript(const std::string& source);
+
   // We maintain a map from Wrappable objects that derive from one of the
   // interceptor interfaces to the interceptor interface pointers.
   void SetIndexedPropertyInterceptor(WrappableBase* base,
@@ -78,6 +87,8 @@ class GIN_EXPORT PerIsolateData {
       IndexedPropertyInterceptorMap;
   typedef std::map<WrappableBase*, NamedPropertyInterceptor*>
       NamedPropertyInterceptorMap;
+  typedef std::map<std::string, v8::Eternal<v8::UnboundScript> >
+      UnboundScriptMap;
 
   // PerIsolateData doesn't actually own |isolate_|. Instead, the isolate is
   // owned by the IsolateHolder, which also owns the PerIsolateData.
@@ -87,6 +98,7 @@ class GIN_EXPORT PerIsolateData {
   FunctionTemplateMap function_templates_;
   IndexedPropertyInterceptorMap indexed_interceptors_;
   NamedPropertyInterceptorMap named_interceptors_;
+  UnboundScriptMap unbound_scripts_;
   scoped_refptr<base::MessageLoopProxy> message_loop_proxy_;
 
   DISALLOW_COPY_AND_ASSIGN(PerIsolateData);
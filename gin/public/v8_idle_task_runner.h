@@ -0,0 +1,29 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef GIN_PUBLIC_V8_IDLE_TASK_RUNNER_H_
+#define GIN_PUBLIC_V8_IDLE_TASK_RUNNER_H_
+
+#include "base/callback.h"
+
+namespace gin {
+
+// Interface through which the embedder donates idle time to V8. Idle tasks
+// take a deadline in seconds, on the same timebase as
+// v8::Platform::MonotonicallyIncreasingTime(), and are expected to finish
+// their work before the deadline passes. Embedders with a scheduler that
+// knows when the thread is idle (e.g. between frames in a renderer) can use
+// this to run garbage collection steps sized to the available idle time.
+class V8IdleTaskRunner {
+ public:
+  typedef base::Callback<void(double deadline_in_seconds)> IdleTask;
+
+  virtual ~V8IdleTaskRunner() {}
+
+  virtual void PostIdleTask(const IdleTask& idle_task) = 0;
+};
+
+}  // namespace gin
+
+#endif  // GIN_PUBLIC_V8_IDLE_TASK_RUNNER_H_
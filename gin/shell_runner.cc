@@ -7,6 +7,7 @@
 #include "gin/converter.h"
 #include "gin/modules/module_registry.h"
 #include "gin/per_context_data.h"
+#include "gin/per_isolate_data.h"
 #include "gin/public/context_holder.h"
 #include "gin/try_catch.h"
 
@@ -67,14 +68,26 @@ void ShellRunner::Run(const std::string& source,
                       const std::string& resource_name) {
   TryCatch try_catch;
   v8::Isolate* isolate = GetContextHolder()->isolate();
-  v8::Handle<Script> script = Script::Compile(
-      StringToV8(isolate, source), StringToV8(isolate, resource_name));
-  if (try_catch.HasCaught()) {
-    delegate_->UnhandledException(this, try_catch);
-    return;
+  // Compilation is context-independent, so scripts are cached per isolate
+  // and only bound to the current context here. Running the same source in
+  // many contexts then compiles it just once.
+  PerIsolateData* isolate_data = PerIsolateData::From(isolate);
+  v8::Local<v8::UnboundScript> unbound_script =
+      isolate_data->GetUnboundScript(source);
+  if (unbound_script.IsEmpty()) {
+    v8::ScriptCompiler::Source script_source(
+        StringToV8(isolate, source),
+        v8::ScriptOrigin(StringToV8(isolate, resource_name)));
+    unbound_script = v8::ScriptCompiler::CompileUnbound(isolate,
+                                                        &script_source);
+    if (try_catch.HasCaught()) {
+      delegate_->UnhandledException(this, try_catch);
+      return;
+    }
+    isolate_data->SetUnboundScript(source, unbound_script);
   }
 
-  Run(script);
+  Run(unbound_script->BindToCurrentContext());
 }
 
 v8::Handle<v8::Value> ShellRunner::Call(v8::Handle<v8::Function> function,
@@ -6,6 +6,8 @@
 
 #include "gpu/command_buffer/client/cmd_buffer_helper.h"
 
+#include <algorithm>
+
 #include "base/logging.h"
 #include "base/time/time.h"
 #include "gpu/command_buffer/common/command_buffer.h"
@@ -29,11 +31,13 @@ CommandBufferHelper::CommandBufferHelper(CommandBuffer* command_buffer)
       usable_(true),
       context_lost_(false),
       flush_automatically_(true),
+      auto_flush_divisor_(kAutoFlushSmall),
       flush_generation_(0) {
 }
 
 void CommandBufferHelper::SetAutomaticFlushes(bool enabled) {
   flush_automatically_ = enabled;
+  auto_flush_divisor_ = kAutoFlushSmall;
   CalcImmediateEntries(0);
 }
 
@@ -66,7 +70,7 @@ void CommandBufferHelper::CalcImmediateEntries(int waiting_count) {
   if (flush_automatically_) {
     int32 limit =
         total_entry_count_ /
-        ((curr_get == last_put_sent_) ? kAutoFlushSmall : kAutoFlushBig);
+        ((curr_get == last_put_sent_) ? auto_flush_divisor_ : kAutoFlushBig);
 
     int32 pending =
         (put_ + total_entry_count_ - last_put_sent_) % total_entry_count_;
@@ -145,13 +149,39 @@ bool CommandBufferHelper::WaitForGetOffsetInRange(int32 start, int32 end) {
   return command_buffer_->GetLastError() == gpu::error::kNoError;
 }
 
+void CommandBufferHelper::UpdateAutoFlushLimit(base::TimeTicks flush_time) {
+  if (!total_entry_count_)
+    return;
+
+  int32 flushed_entries =
+      (put_ + total_entry_count_ - last_put_sent_) % total_entry_count_;
+  bool small_flush = flushed_entries < total_entry_count_ / kAutoFlushSmall;
+  base::TimeDelta time_since_last_flush = flush_time - last_flush_time_;
+
+  if (small_flush &&
+      time_since_last_flush < base::TimeDelta::FromMicroseconds(
+                                  kAutoFlushCoalesceDelayInMicroseconds)) {
+    // A stream of tiny flushes in rapid succession; each one wakes the
+    // service for little work, so widen the limit to batch them.
+    auto_flush_divisor_ = std::max(auto_flush_divisor_ / 2, kAutoFlushBig);
+  } else if (!small_flush || time_since_last_flush >
+                                 base::TimeDelta::FromMicroseconds(
+                                     kAutoFlushCoalesceDelayInMicroseconds)) {
+    // Isolated or reasonably sized flushes; go back to flushing eagerly so
+    // an idle service picks new work up quickly.
+    auto_flush_divisor_ = kAutoFlushSmall;
+  }
+}
+
 void CommandBufferHelper::Flush() {
   // Wrap put_ before flush.
   if (put_ == total_entry_count_)
     put_ = 0;
 
   if (usable() && last_put_sent_ != put_) {
-    last_flush_time_ = base::TimeTicks::Now();
+    base::TimeTicks flush_time = base::TimeTicks::Now();
+    UpdateAutoFlushLimit(flush_time);
+    last_flush_time_ = flush_time;
     last_put_sent_ = put_;
     command_buffer_->Flush(put_);
     ++flush_generation_;
@@ -28,6 +28,11 @@ const int kPeriodicFlushDelayInMicroseconds =
 const int kAutoFlushSmall = 16;  // 1/16 of the buffer
 const int kAutoFlushBig = 2;     // 1/2 of the buffer
 
+// Auto flushes that send less than 1/kAutoFlushSmall of the buffer and follow
+// the previous flush within this interval indicate a stream of tiny batches;
+// the auto flush limit is widened in response to coalesce them.
+const int kAutoFlushCoalesceDelayInMicroseconds = 500;
+
 // Command buffer helper class. This class simplifies ring buffer management:
 // it will allocate the buffer, give it to the buffer interface, and let the
 // user add commands to it, while taking care of the synchronization (put and
@@ -303,6 +308,11 @@ class GPU_EXPORT CommandBufferHelper {
   bool AllocateRingBuffer();
   void FreeResources();
 
+  // Adjusts the divisor used for the automatic flush limit based on the size
+  // and spacing of flushes, so rapid streams of tiny flushes get batched into
+  // fewer, larger ones.
+  void UpdateAutoFlushLimit(base::TimeTicks flush_time);
+
   // Waits for the get offset to be in a specific range, inclusive. Returns
   // false if there was an error.
   bool WaitForGetOffsetInRange(int32 start, int32 end);
@@ -331,6 +341,10 @@ class GPU_EXPORT CommandBufferHelper {
   bool context_lost_;
   bool flush_automatically_;
 
+  // Current divisor for the automatic flush limit when the service is caught
+  // up. Ranges from kAutoFlushSmall (eager) down to kAutoFlushBig (batched).
+  int32 auto_flush_divisor_;
+
   base::TimeTicks last_flush_time_;
 
   // Incremented every time the helper flushes the command buffer.
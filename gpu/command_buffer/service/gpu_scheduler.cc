@@ -94,6 +94,12 @@ void GpuScheduler::PutChanged() {
 
     if (unscheduled_count_ > 0)
       break;
+
+    if (max_decode_time_slice_ != base::TimeDelta() &&
+        base::TimeTicks::HighResNow() - begin_time > max_decode_time_slice_) {
+      TRACE_EVENT0("gpu", "GpuScheduler::PutChanged::TimeSliceExpired");
+      break;
+    }
   }
 
   if (decoder_) {
@@ -15,6 +15,7 @@
 #include "base/memory/scoped_ptr.h"
 #include "base/memory/shared_memory.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "gpu/command_buffer/service/cmd_buffer_engine.h"
 #include "gpu/command_buffer/service/cmd_parser.h"
 #include "gpu/command_buffer/service/command_buffer_service.h"
@@ -64,6 +65,15 @@ class GPU_EXPORT GpuScheduler
     preemption_flag_ = flag;
   }
 
+  // Limits how long a single PutChanged call decodes before yielding, so that
+  // on a GPU thread shared by many contexts one context's long command stream
+  // does not stall decoding for all the others. Remaining commands are left in
+  // the buffer and the owner is responsible for flushing again to resume. A
+  // zero |limit| (the default) decodes without a time limit.
+  void SetMaxDecodeTimeSlice(base::TimeDelta limit) {
+    max_decode_time_slice_ = limit;
+  }
+
   // Sets whether commands should be processed by this scheduler. Setting to
   // false unschedules. Setting to true reschedules. Whether or not the
   // scheduler is currently scheduled is "reference counted". Every call with
@@ -138,6 +148,9 @@ class GPU_EXPORT GpuScheduler
   scoped_refptr<PreemptionFlag> preemption_flag_;
   bool was_preempted_;
 
+  // If non-zero, exit PutChanged after decoding for this long.
+  base::TimeDelta max_decode_time_slice_;
+
   // A factory for outstanding rescheduling tasks that is invalidated whenever
   // the scheduler is rescheduled.
   base::WeakPtrFactory<GpuScheduler> reschedule_task_factory_;
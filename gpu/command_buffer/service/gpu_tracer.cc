@@ -8,6 +8,7 @@
 
 #include "base/bind.h"
 #include "base/debug/trace_event.h"
+#include "base/metrics/histogram.h"
 #include "base/strings/string_util.h"
 #include "base/time/time.h"
 #include "gpu/command_buffer/common/gles2_cmd_utils.h"
@@ -16,6 +17,9 @@ namespace gpu {
 namespace gles2 {
 
 static const unsigned int kProcessInterval = 16;
+// With tracing off, one decode burst out of this many is timed with a device
+// timer query so GPU load can be attributed fleet-wide through histograms.
+static const unsigned int kDeviceTimeSamplePeriod = 16;
 static TraceOutputter* g_outputter_thread = NULL;
 
 CPUTime::CPUTime() {
@@ -213,7 +217,8 @@ void GPUTrace::Process() {
 }
 
 GPUTracer::GPUTracer(gles2::GLES2Decoder* decoder)
-    : gpu_trace_srv_category(TRACE_EVENT_API_GET_CATEGORY_GROUP_ENABLED(
+    : decode_count_(0),
+      gpu_trace_srv_category(TRACE_EVENT_API_GET_CATEGORY_GROUP_ENABLED(
           TRACE_DISABLED_BY_DEFAULT("gpu.service"))),
       gpu_trace_dev_category(TRACE_EVENT_API_GET_CATEGORY_GROUP_ENABLED(
           TRACE_DISABLED_BY_DEFAULT("gpu.device"))),
@@ -273,6 +278,14 @@ bool GPUTracer::BeginDecoding() {
         trace_marker.trace_->Start(*gpu_trace_srv_category != 0);
       }
     }
+  } else if (tracer_type_ != kTracerTypeInvalid &&
+             (++decode_count_ % kDeviceTimeSamplePeriod) == 0) {
+    // Tracing is off; periodically sample how much device time this decode
+    // burst takes. The result is reported as a histogram in ProcessTraces.
+    sampling_trace_ = new GPUTrace(outputter_, cpu_time_, "gpu",
+                                   "DeviceTimeSample", timer_offset_,
+                                   tracer_type_);
+    sampling_trace_->Start(false);
   }
   return true;
 }
@@ -298,6 +311,15 @@ bool GPUTracer::EndDecoding() {
     IssueProcessTask();
   }
 
+  if (sampling_trace_.get()) {
+    sampling_trace_->End(false);
+    if (sampling_trace_->IsEnabled()) {
+      sampling_traces_.push_back(sampling_trace_);
+      IssueProcessTask();
+    }
+    sampling_trace_ = NULL;
+  }
+
   gpu_executing_ = false;
 
   // NOTE(vmiura): glFlush() here can help give better trace results,
@@ -414,6 +436,7 @@ void GPUTracer::Process() {
 void GPUTracer::ProcessTraces() {
   if (tracer_type_ == kTracerTypeInvalid) {
     traces_.clear();
+    sampling_traces_.clear();
     return;
   }
 
@@ -423,6 +446,7 @@ void GPUTracer::ProcessTraces() {
   if (!decoder_->MakeCurrent()) {
     // Skip subsequent GL calls if MakeCurrent fails
     traces_.clear();
+    sampling_traces_.clear();
     return;
   }
 
@@ -430,8 +454,10 @@ void GPUTracer::ProcessTraces() {
   if (tracer_type_ == kTracerTypeDisjointTimer) {
     GLint disjoint_value = 0;
     glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint_value);
-    if (disjoint_value)
+    if (disjoint_value) {
       traces_.clear();
+      sampling_traces_.clear();
+    }
   }
 
   while (!traces_.empty() && traces_.front()->IsAvailable()) {
@@ -439,10 +465,22 @@ void GPUTracer::ProcessTraces() {
     traces_.pop_front();
   }
 
+  while (!sampling_traces_.empty() && sampling_traces_.front()->IsAvailable()) {
+    scoped_refptr<GPUTrace> trace = sampling_traces_.front();
+    sampling_traces_.pop_front();
+    trace->Process();
+    UMA_HISTOGRAM_CUSTOM_COUNTS(
+        "GPU.DeviceTimePerDecodeBurstUs",
+        static_cast<int>(trace->end_time() - trace->start_time()), 1, 100000,
+        50);
+  }
+
   // Clear pending traces if there were are any errors
   GLenum err = glGetError();
-  if (err != GL_NO_ERROR)
+  if (err != GL_NO_ERROR) {
     traces_.clear();
+    sampling_traces_.clear();
+  }
 }
 
 void GPUTracer::CalculateTimerOffset() {
@@ -483,7 +521,7 @@ void GPUTracer::CalculateTimerOffset() {
 }
 
 void GPUTracer::IssueProcessTask() {
-  if (traces_.empty() || process_posted_)
+  if ((traces_.empty() && sampling_traces_.empty()) || process_posted_)
     return;
 
   process_posted_ = true;
@@ -112,6 +112,12 @@ class GPU_EXPORT GPUTracer
   std::vector<TraceMarker> markers_[NUM_TRACER_SOURCES];
   std::deque<scoped_refptr<GPUTrace> > traces_;
 
+  // Sampled device-time measurements taken while tracing is off, reported
+  // as histograms rather than trace events.
+  std::deque<scoped_refptr<GPUTrace> > sampling_traces_;
+  scoped_refptr<GPUTrace> sampling_trace_;
+  unsigned int decode_count_;
+
   const unsigned char* gpu_trace_srv_category;
   const unsigned char* gpu_trace_dev_category;
   gles2::GLES2Decoder* decoder_;
@@ -190,6 +196,10 @@ class GPU_EXPORT GPUTrace
   bool IsAvailable();
   void Process();
 
+  // Only valid after Process() has run.
+  int64 start_time() const { return start_time_; }
+  int64 end_time() const { return end_time_; }
+
  private:
   ~GPUTrace();
 
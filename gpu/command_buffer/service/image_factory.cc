@@ -51,6 +51,7 @@ bool ImageFactory::IsImageFormatCompatibleWithGpuMemoryBufferFormat(
       switch (format) {
         case gfx::GpuMemoryBuffer::RGBX_8888:
           return true;
+        case gfx::GpuMemoryBuffer::RGBA_4444:
         case gfx::GpuMemoryBuffer::RGBA_8888:
         case gfx::GpuMemoryBuffer::BGRA_8888:
           return false;
@@ -61,6 +62,7 @@ bool ImageFactory::IsImageFormatCompatibleWithGpuMemoryBufferFormat(
       switch (format) {
         case gfx::GpuMemoryBuffer::RGBX_8888:
           return false;
+        case gfx::GpuMemoryBuffer::RGBA_4444:
         case gfx::GpuMemoryBuffer::RGBA_8888:
         case gfx::GpuMemoryBuffer::BGRA_8888:
           return true;
@@ -11,9 +11,18 @@
 namespace gpu {
 namespace gles2 {
 
-ProgramCache::ProgramCache() {}
+ProgramCache::ProgramCache() {
+  memset(driver_hash_, 0, sizeof(driver_hash_));
+}
+
 ProgramCache::~ProgramCache() {}
 
+void ProgramCache::SetDriverIdentity(const std::string& identity) {
+  base::SHA1HashBytes(
+      reinterpret_cast<const unsigned char*>(identity.c_str()),
+      identity.length(), reinterpret_cast<unsigned char*>(driver_hash_));
+}
+
 void ProgramCache::Clear() {
   ClearBackend();
   link_status_.clear();
@@ -105,15 +114,18 @@ void ProgramCache::ComputeProgramHash(
     char* result) const {
   const size_t shader0_size = kHashLength;
   const size_t shader1_size = kHashLength;
+  const size_t driver_size = kHashLength;
   const size_t map_size = CalculateMapSize(bind_attrib_location_map);
-  const size_t total_size = shader0_size + shader1_size + map_size;
+  const size_t total_size =
+      shader0_size + shader1_size + driver_size + map_size;
 
   scoped_ptr<unsigned char[]> buffer(new unsigned char[total_size]);
   memcpy(buffer.get(), hashed_shader_0, shader0_size);
   memcpy(&buffer[shader0_size], hashed_shader_1, shader1_size);
+  memcpy(&buffer[shader0_size + shader1_size], driver_hash_, driver_size);
   if (map_size != 0) {
     // copy our map
-    size_t current_pos = shader0_size + shader1_size;
+    size_t current_pos = shader0_size + shader1_size + driver_size;
     std::map<std::string, GLint>::const_iterator it;
     for (it = bind_attrib_location_map->begin();
          it != bind_attrib_location_map->end();
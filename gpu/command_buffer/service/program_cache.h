@@ -40,6 +40,12 @@ class GPU_EXPORT ProgramCache {
   ProgramCache();
   virtual ~ProgramCache();
 
+  // Mixes a description of the active GL driver (e.g. the GL_VERSION and
+  // GL_RENDERER strings) into program hashes. Program binaries loaded from
+  // disk that were produced by a different driver then stop matching and are
+  // recompiled instead of failing in glProgramBinary on every lookup.
+  void SetDriverIdentity(const std::string& identity);
+
   LinkedProgramStatus GetLinkedProgramStatus(
       const std::string& untranslated_shader_a,
       const ShaderTranslatorInterface* translator_a,
@@ -109,6 +115,10 @@ class GPU_EXPORT ProgramCache {
 
   LinkStatusMap link_status_;
 
+  // Hash of the driver identity, folded into every program hash. All zeros
+  // until SetDriverIdentity is called.
+  char driver_hash_[kHashLength];
+
   DISALLOW_COPY_AND_ASSIGN(ProgramCache);
 };
 
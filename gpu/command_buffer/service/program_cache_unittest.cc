@@ -117,6 +117,21 @@ TEST_F(ProgramCacheTest, LinkUnknownOnFragmentSourceChange) {
             cache_->GetLinkedProgramStatus(shader1, NULL, shader2, NULL, NULL));
 }
 
+TEST_F(ProgramCacheTest, LinkUnknownOnDriverIdentityChange) {
+  const std::string shader1 = "abcd1234";
+  const std::string shader2 = "abcda sda b1~#4 bbbbb1234";
+  cache_->SetDriverIdentity("OpenGL ES 2.0 driver v1\nsome renderer");
+  cache_->SaySuccessfullyCached(shader1, NULL, shader2, NULL, NULL);
+
+  cache_->SetDriverIdentity("OpenGL ES 2.0 driver v2\nsome renderer");
+  EXPECT_EQ(ProgramCache::LINK_UNKNOWN,
+            cache_->GetLinkedProgramStatus(shader1, NULL, shader2, NULL, NULL));
+
+  cache_->SetDriverIdentity("OpenGL ES 2.0 driver v1\nsome renderer");
+  EXPECT_EQ(ProgramCache::LINK_SUCCEEDED,
+            cache_->GetLinkedProgramStatus(shader1, NULL, shader2, NULL, NULL));
+}
+
 TEST_F(ProgramCacheTest, LinkUnknownOnVertexSourceChange) {
   std::string shader1 = "abcd1234";
   const std::string shader2 = "abcda sda b1~#4 bbbbb1234";
@@ -40,6 +40,8 @@ namespace {
 
 size_t BytesPerPixel(gfx::GpuMemoryBuffer::Format format) {
   switch (format) {
+    case gfx::GpuMemoryBuffer::RGBA_4444:
+      return 2;
     case gfx::GpuMemoryBuffer::RGBA_8888:
     case gfx::GpuMemoryBuffer::BGRA_8888:
       return 4;
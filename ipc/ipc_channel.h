@@ -85,7 +85,12 @@ class IPC_EXPORT Channel : public Sender {
     // The client will return the message with hops = 1, *after* it
     // has received the message that contains the FD. When we
     // receive it again on the sender side, we close the FD.
-    CLOSE_FD_MESSAGE_TYPE = HELLO_MESSAGE_TYPE - 1
+    CLOSE_FD_MESSAGE_TYPE = HELLO_MESSAGE_TYPE - 1,
+    // The SHMEM_MESSAGE_TYPE is used on POSIX to carry an oversized
+    // message out of band: its payload is spilled into anonymous shared
+    // memory and only the descriptor and the payload size travel through
+    // the pipe.
+    SHMEM_MESSAGE_TYPE = CLOSE_FD_MESSAGE_TYPE - 1
   };
 
   // The maximum message size in bytes. Attempting to receive a message of this
@@ -10,11 +10,8 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
-#include <unistd.h>
-
-#if defined(OS_OPENBSD)
 #include <sys/uio.h>
-#endif
+#include <unistd.h>
 
 #if !defined(OS_NACL_NONSFI)
 #include <sys/un.h>
@@ -29,6 +26,7 @@
 #include "base/location.h"
 #include "base/logging.h"
 #include "base/memory/scoped_ptr.h"
+#include "base/memory/shared_memory.h"
 #include "base/memory/singleton.h"
 #include "base/posix/eintr_wrapper.h"
 #include "base/posix/global_descriptors.h"
@@ -64,6 +62,16 @@ namespace IPC {
 //------------------------------------------------------------------------------
 namespace {
 
+// Maximum number of queued messages gathered into one sendmsg() call when
+// none of them carry file descriptors. POSIX guarantees support for at least
+// 16 iovecs per call.
+const size_t kMaxSendmsgBatchSize = 16;
+
+// Messages bigger than this are copied into anonymous shared memory and only
+// the descriptor travels through the pipe, so a multi-megabyte payload does
+// not monopolize the channel while smaller messages wait behind it.
+const size_t kMessageShmemThreshold = 256 * 1024;
+
 // The PipeMap class works around this quirk related to unit tests:
 //
 // When running as a server, we install the client socket in a
@@ -425,8 +433,10 @@ bool ChannelPosix::ProcessOutgoingMessages() {
         message_send_bytes_written_;
 
     struct msghdr msgh = {0};
-    struct iovec iov = {const_cast<char*>(out_bytes), amt_to_write};
-    msgh.msg_iov = &iov;
+    struct iovec iov[kMaxSendmsgBatchSize];
+    iov[0].iov_base = const_cast<char*>(out_bytes);
+    iov[0].iov_len = amt_to_write;
+    msgh.msg_iov = iov;
     msgh.msg_iovlen = 1;
     char buf[CMSG_SPACE(
         sizeof(int) * FileDescriptorSet::kMaxDescriptorsPerMessage)];
@@ -475,13 +485,30 @@ bool ChannelPosix::ProcessOutgoingMessages() {
         fd_written = fd_pipe_.get();
         bytes_written =
             HANDLE_EINTR(sendmsg(fd_pipe_.get(), &msgh, MSG_DONTWAIT));
-        msgh.msg_iov = &iov;
+        msgh.msg_iov = iov;
         msgh.msg_controllen = 0;
         if (bytes_written > 0) {
           CloseFileDescriptors(msg);
         }
       }
 #endif  // IPC_USES_READWRITE
+    } else {
+      // Messages without descriptors need no control data, so consecutive
+      // ones can share a single sendmsg() call with one iovec per message.
+      // Small messages are common enough that this saves a syscall each.
+      size_t num_iovs = 1;
+      for (std::deque<Message*>::const_iterator it =
+               output_queue_.begin() + 1;
+           it != output_queue_.end() && num_iovs < kMaxSendmsgBatchSize &&
+               (*it)->file_descriptor_set()->empty();
+           ++it) {
+        iov[num_iovs].iov_base =
+            const_cast<char*>(reinterpret_cast<const char*>((*it)->data()));
+        iov[num_iovs].iov_len = (*it)->size();
+        amt_to_write += (*it)->size();
+        ++num_iovs;
+      }
+      msgh.msg_iovlen = num_iovs;
     }
 
     if (bytes_written == 1) {
@@ -492,7 +519,7 @@ bool ChannelPosix::ProcessOutgoingMessages() {
       }
       if (!msgh.msg_controllen) {
         bytes_written =
-            HANDLE_EINTR(write(pipe_.get(), out_bytes, amt_to_write));
+            HANDLE_EINTR(writev(pipe_.get(), iov, msgh.msg_iovlen));
       } else
 #endif  // IPC_USES_READWRITE
       {
@@ -527,8 +554,22 @@ bool ChannelPosix::ProcessOutgoingMessages() {
 
     if (static_cast<size_t>(bytes_written) != amt_to_write) {
       if (bytes_written > 0) {
-        // If write() fails with EAGAIN then bytes_written will be -1.
-        message_send_bytes_written_ += bytes_written;
+        // If write() fails with EAGAIN then bytes_written will be -1. A short
+        // write may still have completed whole messages from the batch; pop
+        // those and track the offset into the first unfinished one.
+        size_t written = static_cast<size_t>(bytes_written);
+        while (written > 0) {
+          Message* sent = output_queue_.front();
+          size_t sent_remaining = sent->size() - message_send_bytes_written_;
+          if (written < sent_remaining) {
+            message_send_bytes_written_ += written;
+            break;
+          }
+          written -= sent_remaining;
+          message_send_bytes_written_ = 0;
+          delete sent;
+          output_queue_.pop_front();
+        }
       }
 
       // Tell libevent to call us back once things are unblocked.
@@ -543,17 +584,45 @@ bool ChannelPosix::ProcessOutgoingMessages() {
     } else {
       message_send_bytes_written_ = 0;
 
-      // Message sent OK!
-      DVLOG(2) << "sent message @" << msg << " on channel @" << this
-               << " with type " << msg->type() << " on fd " << pipe_.get();
-      delete output_queue_.front();
-      output_queue_.pop();
+      // Every message covered by the iovec array was sent in full.
+      for (size_t i = 0; i < static_cast<size_t>(msgh.msg_iovlen); ++i) {
+        Message* sent = output_queue_.front();
+        DVLOG(2) << "sent message @" << sent << " on channel @" << this
+                 << " with type " << sent->type() << " on fd " << pipe_.get();
+        delete sent;
+        output_queue_.pop_front();
+      }
     }
   }
   return true;
 }
 
+Message* ChannelPosix::MaybeSpillToSharedMemory(Message* message) {
+  if (message->size() <= kMessageShmemThreshold ||
+      !message->file_descriptor_set()->empty())
+    return message;
+
+  base::SharedMemory shared_memory;
+  if (!shared_memory.CreateAndMapAnonymous(message->size()))
+    return message;
+  memcpy(shared_memory.memory(), message->data(), message->size());
+
+  scoped_ptr<Message> wrapper(new Message(
+      MSG_ROUTING_NONE, SHMEM_MESSAGE_TYPE, Message::PRIORITY_NORMAL));
+  wrapper->WriteUInt32(static_cast<uint32>(message->size()));
+  base::ScopedFD descriptor(HANDLE_EINTR(dup(shared_memory.handle().fd)));
+  if (!descriptor.is_valid() || !wrapper->WriteFile(descriptor.Pass()))
+    return message;
+
+  DVLOG(2) << "spilled message @" << message << " of size " << message->size()
+           << " to shared memory on channel @" << this;
+  delete message;
+  return wrapper.release();
+}
+
 bool ChannelPosix::Send(Message* message) {
+  message = MaybeSpillToSharedMemory(message);
+
   DVLOG(2) << "sending message @" << message << " on channel @" << this
            << " with type " << message->type()
            << " (" << output_queue_.size() << " in queue)";
@@ -563,7 +632,7 @@ bool ChannelPosix::Send(Message* message) {
 #endif  // IPC_MESSAGE_LOG_ENABLED
 
   message->TraceMessageBegin();
-  output_queue_.push(message);
+  output_queue_.push_back(message);
   if (!is_blocked_on_write_ && !waiting_connect_) {
     return ProcessOutgoingMessages();
   }
@@ -620,7 +689,7 @@ void ChannelPosix::ResetToAcceptingConnectionState() {
 
   while (!output_queue_.empty()) {
     Message* m = output_queue_.front();
-    output_queue_.pop();
+    output_queue_.pop_front();
     delete m;
   }
 
@@ -798,7 +867,7 @@ void ChannelPosix::QueueHelloMessage() {
     DCHECK_EQ(msg->file_descriptor_set()->size(), 1U);
   }
 #endif  // IPC_USES_READWRITE
-  output_queue_.push(msg.release());
+  output_queue_.push_back(msg.release());
 }
 
 ChannelPosix::ReadState ChannelPosix::ReadData(
@@ -984,7 +1053,7 @@ void ChannelPosix::QueueCloseFDMessage(int fd, int hops) {
         NOTREACHED() << "Unable to pickle close fd.";
       }
       // Send(msg.release());
-      output_queue_.push(msg.release());
+      output_queue_.push_back(msg.release());
       break;
     }
 
@@ -1025,6 +1094,50 @@ void ChannelPosix::HandleInternalMessage(const Message& msg) {
       listener()->OnChannelConnected(pid);
       break;
 
+    case Channel::SHMEM_MESSAGE_TYPE: {
+      // An oversized message whose payload was spilled into shared memory by
+      // the sender; reconstitute it and dispatch it like any other message.
+      uint32 payload_size;
+      base::ScopedFD descriptor;
+      if (!iter.ReadUInt32(&payload_size) ||
+          !msg.ReadFile(&iter, &descriptor) ||
+          payload_size > Channel::kMaximumMessageSize) {
+        NOTREACHED();
+        break;
+      }
+      // |payload_size| only says how big the sender claims the segment is.
+      // Check the segment's real size before touching it, since reading past
+      // the end of a short file-backed mapping raises SIGBUS.
+      struct stat segment_stat;
+      if (fstat(descriptor.get(), &segment_stat) != 0 ||
+          segment_stat.st_size < 0 ||
+          static_cast<uint64>(segment_stat.st_size) < payload_size) {
+        LOG(ERROR) << "Spilled message payload segment is too small";
+        break;
+      }
+      base::SharedMemory shared_memory(
+          base::SharedMemoryHandle(descriptor.release(), true /* auto_close */),
+          true /* read_only */);
+      if (!shared_memory.Map(payload_size)) {
+        LOG(ERROR) << "Failed to map spilled message payload";
+        break;
+      }
+      // Copy the payload out of the mapping before validating or parsing it.
+      // The sender may keep its own writable mapping of the segment, so
+      // anything read directly from shared memory can change between the
+      // validation and the reads that follow.
+      scoped_ptr<char[]> data(new char[payload_size]);
+      memcpy(data.get(), shared_memory.memory(), payload_size);
+      if (Message::FindNext(data.get(), data.get() + payload_size) !=
+          data.get() + payload_size) {
+        LOG(ERROR) << "Malformed spilled message payload";
+        break;
+      }
+      Message payload(data.get(), static_cast<int>(payload_size));
+      listener()->OnMessageReceived(payload);
+      break;
+    }
+
 #if defined(OS_MACOSX)
     case Channel::CLOSE_FD_MESSAGE_TYPE:
       int fd, hops;
@@ -9,7 +9,7 @@
 
 #include <sys/socket.h>  // for CMSG macros
 
-#include <queue>
+#include <deque>
 #include <set>
 #include <string>
 #include <vector>
@@ -92,6 +92,12 @@ class IPC_EXPORT ChannelPosix : public Channel,
  private:
   bool CreatePipe(const IPC::ChannelHandle& channel_handle);
 
+  // Replaces an oversized descriptor-free message with a small internal
+  // message whose payload lives in anonymous shared memory, so that
+  // multi-megabyte sends do not monopolize the pipe. Returns |message|
+  // unchanged when it is not eligible or shared memory allocation fails.
+  Message* MaybeSpillToSharedMemory(Message* message);
+
   bool ProcessOutgoingMessages();
 
   bool AcceptConnection();
@@ -171,8 +177,10 @@ class IPC_EXPORT ChannelPosix : public Channel,
   // the pipe.  On POSIX it's used as a key in a local map of file descriptors.
   std::string pipe_name_;
 
-  // Messages to be sent are queued here.
-  std::queue<Message*> output_queue_;
+  // Messages to be sent are queued here. A deque so that
+  // ProcessOutgoingMessages() can look past the front message when gathering
+  // several descriptor-free messages into a single sendmsg() call.
+  std::deque<Message*> output_queue_;
 
   // We assume a worst case: kReadBufferSize bytes of messages, where each
   // message has no payload and a full complement of descriptors.
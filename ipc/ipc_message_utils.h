@@ -17,6 +17,7 @@
 #include "base/memory/scoped_ptr.h"
 #include "base/memory/scoped_vector.h"
 #include "base/strings/string16.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/tuple.h"
@@ -250,6 +251,24 @@ struct ParamTraits<std::string> {
   IPC_EXPORT static void Log(const param_type& p, std::string* l);
 };
 
+// Reads a string as a zero-copy slice of the message payload. The wire format
+// matches ParamTraits<std::string>, so senders keep writing std::string and
+// consumers that hold on to the Message (e.g. handlers that process the
+// payload synchronously) can opt in to avoid the copy. The StringPiece is only
+// valid for the lifetime of the message; do not keep it around.
+template <>
+struct ParamTraits<base::StringPiece> {
+  typedef base::StringPiece param_type;
+  static void Write(Message* m, const param_type& p) {
+    m->WriteData(p.data(), static_cast<int>(p.size()));
+  }
+  static bool Read(const Message* m, PickleIterator* iter,
+                   param_type* r) {
+    return iter->ReadStringPiece(r);
+  }
+  IPC_EXPORT static void Log(const param_type& p, std::string* l);
+};
+
 template <>
 struct ParamTraits<std::wstring> {
   typedef std::wstring param_type;
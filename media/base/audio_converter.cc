@@ -192,24 +192,23 @@ void AudioConverter::SourceCallback(int fifo_frame_delay, AudioBus* dest) {
         fifo_frame_delay * input_frame_duration_.InMicroseconds());
   }
 
-  // If we only have a single input, avoid an extra copy.
-  AudioBus* const provide_input_dest =
-      transform_inputs_.size() == 1 ? temp_dest : mixer_input_audio_bus_.get();
-
   // Have each mixer render its data into an output buffer then mix the result.
+  // The first input renders directly into |temp_dest| to avoid a copy; the
+  // rest render into |mixer_input_audio_bus_| and are mixed in.
   for (auto* input : transform_inputs_) {
+    const bool is_first_input = input == transform_inputs_.front();
+    AudioBus* const provide_input_dest =
+        is_first_input ? temp_dest : mixer_input_audio_bus_.get();
     const float volume = input->ProvideInput(provide_input_dest, buffer_delay);
 
     // Optimize the most common single input, full volume case.
-    if (input == transform_inputs_.front()) {
+    if (is_first_input) {
       if (volume == 1.0f) {
-        if (temp_dest != provide_input_dest)
-          provide_input_dest->CopyTo(temp_dest);
+        // Data is already in place.
       } else if (volume > 0) {
-        for (int i = 0; i < provide_input_dest->channels(); ++i) {
-          vector_math::FMUL(
-              provide_input_dest->channel(i), volume,
-              provide_input_dest->frames(), temp_dest->channel(i));
+        for (int i = 0; i < temp_dest->channels(); ++i) {
+          vector_math::FMUL(temp_dest->channel(i), volume, temp_dest->frames(),
+                            temp_dest->channel(i));
         }
       } else {
         // Zero |temp_dest| otherwise, so we're mixing into a clean buffer.
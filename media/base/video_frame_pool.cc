@@ -70,10 +70,10 @@ scoped_refptr<VideoFrame> VideoFramePool::PoolImpl::CreateFrame(
       scoped_refptr<VideoFrame> pool_frame = frames_.front();
       frames_.pop_front();
 
+      // Only the format and coded size determine the backing allocation, so
+      // frames can be recycled across visible rect and natural size changes.
       if (pool_frame->format() == format &&
-          pool_frame->coded_size() == coded_size &&
-          pool_frame->visible_rect() == visible_rect &&
-          pool_frame->natural_size() == natural_size) {
+          pool_frame->coded_size() == coded_size) {
         frame = pool_frame;
         frame->set_timestamp(timestamp);
         break;
@@ -81,12 +81,14 @@ scoped_refptr<VideoFrame> VideoFramePool::PoolImpl::CreateFrame(
   }
 
   if (!frame.get()) {
+    // Allocate with the full coded area visible so that the wrapper below
+    // can carve out whatever visible rect is requested on reuse.
     frame = VideoFrame::CreateFrame(
-        format, coded_size, visible_rect, natural_size, timestamp);
+        format, coded_size, gfx::Rect(coded_size), natural_size, timestamp);
   }
 
   return VideoFrame::WrapVideoFrame(
-      frame, frame->visible_rect(), frame->natural_size(),
+      frame, visible_rect, natural_size,
       base::Bind(&VideoFramePool::PoolImpl::FrameReleased, this, frame));
 }
 
@@ -51,6 +51,24 @@ TEST_F(VideoFramePoolTest, SimpleFrameReuse) {
   EXPECT_EQ(old_y_data, new_frame->data(VideoFrame::kYPlane));
 }
 
+TEST_F(VideoFramePoolTest, FrameReuseAcrossVisibleRectChange) {
+  scoped_refptr<VideoFrame> frame = CreateFrame(VideoFrame::YV12, 10);
+  const uint8* old_y_data = frame->data(VideoFrame::kYPlane);
+
+  // Clear frame reference to return the frame to the pool.
+  frame = NULL;
+
+  // A frame with the same coded size but a smaller visible rect should
+  // still reuse the pooled memory.
+  gfx::Size coded_size(320, 240);
+  gfx::Rect visible_rect(0, 0, 300, 220);
+  scoped_refptr<VideoFrame> new_frame = pool_->CreateFrame(
+      VideoFrame::YV12, coded_size, visible_rect, coded_size,
+      base::TimeDelta::FromMilliseconds(20));
+  EXPECT_EQ(visible_rect, new_frame->visible_rect());
+  EXPECT_EQ(old_y_data, new_frame->data(VideoFrame::kYPlane));
+}
+
 TEST_F(VideoFramePoolTest, SimpleFormatChange) {
   scoped_refptr<VideoFrame> frame_a = CreateFrame(VideoFrame::YV12, 10);
   scoped_refptr<VideoFrame> frame_b = CreateFrame(VideoFrame::YV12, 10);
@@ -16,9 +16,10 @@ using blink::WebFrame;
 namespace {
 
 // BufferedDataSource has an intermediate buffer, this value governs the initial
-// size of that buffer. It is set to 32KB because this is a typical read size
-// of FFmpeg.
-const int kInitialReadBufferSize = 32768;
+// size of that buffer. It is set to 64KB to match the AVIO buffer size used by
+// FFmpegGlue, which is the typical read size, so the first read does not have
+// to resize the buffer.
+const int kInitialReadBufferSize = 65536;
 
 // Number of cache misses or read failures we allow for a single Read() before
 // signaling an error.
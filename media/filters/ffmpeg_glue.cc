@@ -13,11 +13,12 @@
 
 namespace media {
 
-// Internal buffer size used by AVIO for reading.
-// TODO(dalecurtis): Experiment with this buffer size and measure impact on
-// performance.  Currently we want to use 32kb to preserve existing behavior
-// with the previous URLProtocol based approach.
-enum { kBufferSize = 32 * 1024 };
+// Internal buffer size used by AVIO for reading.  Each AVIO read is a
+// blocking round trip from the demuxer thread to the data source, so a
+// larger buffer means fewer round trips; 64kb keeps high-bitrate content
+// from being dominated by read calls without noticeably raising per-stream
+// memory usage.
+enum { kBufferSize = 64 * 1024 };
 
 static int AVIOReadOperation(void* opaque, uint8_t* buf, int buf_size) {
   FFmpegURLProtocol* protocol = reinterpret_cast<FFmpegURLProtocol*>(opaque);
@@ -406,6 +406,13 @@ void SourceBufferStream::RemoveInternal(
     if (range->GetStartTimestamp() >= end)
       break;
 
+    // Ranges that lie entirely before the removal range are unaffected; skip
+    // the split and truncate machinery for them.
+    if (range->GetEndTimestamp() < start) {
+      ++itr;
+      continue;
+    }
+
     // Split off any remaining end piece and add it to |ranges_|.
     SourceBufferRange* new_range = range->SplitRange(end, is_exclusive);
     if (new_range) {
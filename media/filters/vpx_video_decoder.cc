@@ -18,6 +18,7 @@
 #include "base/stl_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/sys_byteorder.h"
+#include "base/sys_info.h"
 #include "media/base/bind_to_current_loop.h"
 #include "media/base/decoder_buffer.h"
 #include "media/base/demuxer_stream.h"
@@ -62,6 +63,11 @@ static int GetThreadCount(const VideoDecoderConfig& config) {
         decode_threads = 8;
       else if (config.coded_size().width() >= 1024)
         decode_threads = 4;
+
+      // Never ask libvpx for more threads than the machine has cores;
+      // oversubscribed tile workers just preempt each other.
+      decode_threads =
+          std::min(decode_threads, base::SysInfo::NumberOfProcessors());
     }
 
     return decode_threads;
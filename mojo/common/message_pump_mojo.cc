@@ -187,6 +187,25 @@ bool MessagePumpMojo::DoInternalWork(const RunState& run_state, bool block) {
     handlers_[wait_state.handles[index]].handler->OnHandleReady(
         wait_state.handles[index]);
     DidSignalHandler();
+
+    // WaitMany() only reports the first ready handle, but one wakeup often
+    // leaves several handles signalled (e.g. a burst of IPC). Dispatch every
+    // handle that is already ready before waiting again so we don't pay a
+    // wakeup per handle.
+    for (size_t i = index + 1; i < wait_state.handles.size(); ++i) {
+      // Dispatching above may have added or removed handlers; |wait_state| is
+      // a snapshot, so verify the handle is still registered.
+      HandleToHandler::const_iterator it =
+          handlers_.find(wait_state.handles[i]);
+      if (it == handlers_.end() ||
+          Wait(wait_state.handles[i], it->second.wait_signals, 0) !=
+              MOJO_RESULT_OK) {
+        continue;
+      }
+      WillSignalHandler();
+      it->second.handler->OnHandleReady(wait_state.handles[i]);
+      DidSignalHandler();
+    }
   } else {
     switch (result) {
       case MOJO_RESULT_CANCELLED:
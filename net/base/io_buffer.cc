@@ -4,26 +4,162 @@
 
 #include "net/base/io_buffer.h"
 
+#include <string.h>
+
+#include "base/lazy_instance.h"
 #include "base/logging.h"
+#include "base/threading/thread_local_storage.h"
 
 namespace net {
 
+namespace {
+
+// The read/write paths allocate and free buffers many times per request, all
+// on the same thread. To keep that churn away from the allocator, freed
+// buffers of moderate size are parked on a per-thread free list, bucketed
+// into power-of-two size classes, and handed back on the next allocation
+// from that thread. Buffers above the largest class, or small enough that
+// rounding up would waste most of the block, keep using plain new/delete.
+const int kMinPooledBufferSize = 1024;
+const int kMaxPooledBufferSize = 65536;
+const int kNumBufferSizeClasses = 7;  // 1K, 2K, 4K, 8K, 16K, 32K, 64K.
+const size_t kMaxFreeBuffersPerClass = 8;
+
+class IOBufferPool {
+ public:
+  // Returns a buffer of at least |size| bytes. On return, |*pooled_size| is
+  // the size the buffer must be released under, or 0 if the buffer is not
+  // pool-managed and must be released with delete[].
+  char* Allocate(int size, int* pooled_size) {
+    int index = SizeClassIndex(size);
+    if (index < 0) {
+      *pooled_size = 0;
+      return new char[size];
+    }
+    *pooled_size = kMinPooledBufferSize << index;
+    char* data = GetFreeLists()->Pop(index);
+    if (!data)
+      data = new char[*pooled_size];
+    return data;
+  }
+
+  // Returns |data|, previously obtained from Allocate() with |pooled_size|,
+  // to the current thread's free list.
+  void Free(char* data, int pooled_size) {
+    int index = SizeClassIndex(pooled_size);
+    DCHECK_GE(index, 0);
+    DCHECK_EQ(kMinPooledBufferSize << index, pooled_size);
+    if (!GetFreeLists()->Push(index, data))
+      delete[] data;
+  }
+
+ private:
+  friend struct base::DefaultLazyInstanceTraits<IOBufferPool>;
+
+  // The free lists of one thread; owned by the TLS slot.
+  class FreeLists {
+   public:
+    FreeLists() {
+      memset(sizes_, 0, sizeof(sizes_));
+    }
+
+    ~FreeLists() {
+      for (int i = 0; i < kNumBufferSizeClasses; ++i) {
+        for (size_t j = 0; j < sizes_[i]; ++j)
+          delete[] buffers_[i][j];
+      }
+    }
+
+    char* Pop(int index) {
+      if (sizes_[index] == 0)
+        return NULL;
+      return buffers_[index][--sizes_[index]];
+    }
+
+    // Returns false if the list for this class is already full.
+    bool Push(int index, char* data) {
+      if (sizes_[index] == kMaxFreeBuffersPerClass)
+        return false;
+      buffers_[index][sizes_[index]++] = data;
+      return true;
+    }
+
+   private:
+    char* buffers_[kNumBufferSizeClasses][kMaxFreeBuffersPerClass];
+    size_t sizes_[kNumBufferSizeClasses];
+  };
+
+  IOBufferPool() {
+    tls_index_.Initialize(ReleaseFreeLists);
+  }
+
+  ~IOBufferPool() {
+    NOTREACHED();  // LeakyLazyInstance is not destructed.
+  }
+
+  // Returns the size class whose buffers hold at least |size| bytes, or -1
+  // if buffers of |size| bytes are not pooled.
+  static int SizeClassIndex(int size) {
+    if (size < kMinPooledBufferSize || size > kMaxPooledBufferSize)
+      return -1;
+    int index = 0;
+    while ((kMinPooledBufferSize << index) < size)
+      ++index;
+    return index;
+  }
+
+  FreeLists* GetFreeLists() const {
+    FreeLists* lists = static_cast<FreeLists*>(tls_index_.Get());
+    if (!lists) {
+      lists = new FreeLists;
+      tls_index_.Set(lists);
+    }
+    return lists;
+  }
+
+  // Called per-thread, at thread death, to release that thread's lists.
+  static void ReleaseFreeLists(void* value) {
+    delete static_cast<FreeLists*>(value);
+  }
+
+  // A TLS slot to the FreeLists of the current thread.
+  static base::ThreadLocalStorage::StaticSlot tls_index_;
+
+  DISALLOW_COPY_AND_ASSIGN(IOBufferPool);
+};
+
+// static
+base::ThreadLocalStorage::StaticSlot IOBufferPool::tls_index_ =
+    TLS_INITIALIZER;
+
+base::LazyInstance<IOBufferPool>::Leaky g_io_buffer_pool =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
 IOBuffer::IOBuffer()
-    : data_(NULL) {
+    : data_(NULL),
+      pooled_size_(0) {
 }
 
 IOBuffer::IOBuffer(int buffer_size) {
   CHECK_GE(buffer_size, 0);
-  data_ = new char[buffer_size];
+  data_ = g_io_buffer_pool.Get().Allocate(buffer_size, &pooled_size_);
 }
 
 IOBuffer::IOBuffer(char* data)
-    : data_(data) {
+    : data_(data),
+      pooled_size_(0) {
 }
 
 IOBuffer::~IOBuffer() {
-  delete[] data_;
-  data_ = NULL;
+  if (data_) {
+    if (pooled_size_ > 0)
+      g_io_buffer_pool.Get().Free(data_, pooled_size_);
+    else
+      delete[] data_;
+    data_ = NULL;
+  }
 }
 
 IOBufferWithSize::IOBufferWithSize(int size)
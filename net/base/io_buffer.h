@@ -87,6 +87,11 @@ class NET_EXPORT IOBuffer : public base::RefCountedThreadSafe<IOBuffer> {
   virtual ~IOBuffer();
 
   char* data_;
+
+  // When |data_| was acquired from the per-thread buffer pool, the rounded
+  // size it must be returned under; 0 whenever |data_| is not pool-managed
+  // (including all of the IOBuffer(char*) subclasses).
+  int pooled_size_;
 };
 
 // This version stores the size of the buffer so that the creator of the object
@@ -0,0 +1,87 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/base/net_log_ring_buffer.h"
+
+#include "base/logging.h"
+#include "base/values.h"
+
+namespace net {
+
+NetLogRingBuffer::NetLogRingBuffer(size_t capacity)
+    : capacity_(capacity),
+      records_(capacity),
+      next_(0),
+      size_(0),
+      sampling_period_(1),
+      events_until_sample_(1) {
+  CHECK_GT(capacity, 0u);
+}
+
+NetLogRingBuffer::~NetLogRingBuffer() {
+}
+
+void NetLogRingBuffer::set_sampling_period(size_t period) {
+  DCHECK_GT(period, 0u);
+  base::AutoLock lock(lock_);
+  sampling_period_ = period;
+  events_until_sample_ = 1;
+}
+
+base::ListValue* NetLogRingBuffer::EntriesToValue() const {
+  base::AutoLock lock(lock_);
+  base::ListValue* list = new base::ListValue();
+  // The oldest record is at |next_| once the ring has wrapped, and at index
+  // 0 before that.
+  size_t index = (size_ == capacity_) ? next_ : 0;
+  for (size_t i = 0; i < size_; ++i) {
+    const Record& record = records_[index];
+    base::DictionaryValue* entry_dict = new base::DictionaryValue();
+    entry_dict->SetString("time", NetLog::TickCountToString(record.time));
+    base::DictionaryValue* source_dict = new base::DictionaryValue();
+    source_dict->SetInteger("id", record.source_id);
+    source_dict->SetInteger("type", record.source_type);
+    entry_dict->Set("source", source_dict);
+    entry_dict->SetInteger("type", record.type);
+    entry_dict->SetInteger("phase", record.phase);
+    list->Append(entry_dict);
+    index = (index + 1) % capacity_;
+  }
+  return list;
+}
+
+size_t NetLogRingBuffer::GetSize() const {
+  base::AutoLock lock(lock_);
+  return size_;
+}
+
+void NetLogRingBuffer::Clear() {
+  base::AutoLock lock(lock_);
+  next_ = 0;
+  size_ = 0;
+  events_until_sample_ = 1;
+}
+
+void NetLogRingBuffer::OnAddEntry(const NetLog::Entry& entry) {
+  // Only the fixed-size portion of |entry| is read; in particular the
+  // parameters callback is never run, so its bound arguments are not
+  // touched.
+  base::AutoLock lock(lock_);
+  if (--events_until_sample_ > 0)
+    return;
+  events_until_sample_ = sampling_period_;
+
+  Record* record = &records_[next_];
+  record->type = static_cast<int32>(entry.type());
+  record->source_type = static_cast<int32>(entry.source().type);
+  record->source_id = entry.source().id;
+  record->phase = static_cast<int32>(entry.phase());
+  record->time = base::TimeTicks::Now();
+
+  next_ = (next_ + 1) % capacity_;
+  if (size_ < capacity_)
+    ++size_;
+}
+
+}  // namespace net
@@ -0,0 +1,88 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_BASE_NET_LOG_RING_BUFFER_H_
+#define NET_BASE_NET_LOG_RING_BUFFER_H_
+
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
+#include "net/base/net_export.h"
+#include "net/base/net_log.h"
+
+namespace base {
+class ListValue;
+}
+
+namespace net {
+
+// NetLogRingBuffer is a NetLog::ThreadSafeObserver that records events into a
+// preallocated ring of fixed-size binary records, overwriting the oldest
+// record once the ring is full. Unlike the Value-building observers, adding
+// an entry is just a few stores under a lock: no allocation happens and the
+// event parameters are never materialized. This keeps the observer cheap
+// enough to leave attached in production, at the cost of capturing only the
+// core event tuple (type, source, phase, time).
+//
+// The records are converted to the Value format of NetLog::Entry::ToValue()
+// only when the buffer is exported with EntriesToValue().
+class NET_EXPORT NetLogRingBuffer : public NetLog::ThreadSafeObserver {
+ public:
+  // Creates a buffer holding up to |capacity| records; the backing store is
+  // allocated up front.
+  explicit NetLogRingBuffer(size_t capacity);
+  ~NetLogRingBuffer() override;
+
+  // Records every |period|-th event instead of all of them, to further bound
+  // the observer's cost on busy fleets. The default period is 1.
+  void set_sampling_period(size_t period);
+
+  // Returns the buffered records, oldest first, in the same format that
+  // NetLog::Entry::ToValue() produces (minus the "params" key, which is
+  // never captured). Caller takes ownership of the returned value.
+  base::ListValue* EntriesToValue() const;
+
+  // Returns the number of records currently buffered.
+  size_t GetSize() const;
+
+  void Clear();
+
+  // NetLog::ThreadSafeObserver implementation:
+  void OnAddEntry(const NetLog::Entry& entry) override;
+
+ private:
+  // One logged event. Source strings and event names are not stored; the
+  // enums are resolved against the NetLog constants on export.
+  struct Record {
+    int32 type;         // NetLog::EventType
+    int32 source_type;  // NetLog::SourceType
+    uint32 source_id;
+    int32 phase;        // NetLog::EventPhase
+    base::TimeTicks time;
+  };
+
+  // Protects all of the fields below, since entries may be added on any
+  // thread.
+  mutable base::Lock lock_;
+
+  const size_t capacity_;
+  std::vector<Record> records_;
+
+  // Index of the slot the next record is written to.
+  size_t next_;
+
+  // Number of valid records, at most |capacity_|.
+  size_t size_;
+
+  size_t sampling_period_;
+  size_t events_until_sample_;
+
+  DISALLOW_COPY_AND_ASSIGN(NetLogRingBuffer);
+};
+
+}  // namespace net
+
+#endif  // NET_BASE_NET_LOG_RING_BUFFER_H_
@@ -0,0 +1,106 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/base/net_log_ring_buffer.h"
+
+#include "base/memory/scoped_ptr.h"
+#include "base/values.h"
+#include "net/base/net_log.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace net {
+
+namespace {
+
+void AddCancelledEvent(NetLog* net_log) {
+  net_log->AddGlobalEntry(NetLog::TYPE_CANCELLED);
+}
+
+// Returns the integer "type" field of the |index|-th entry in |list|.
+int GetEntryType(const base::ListValue* list, size_t index) {
+  const base::DictionaryValue* dict = NULL;
+  EXPECT_TRUE(list->GetDictionary(index, &dict));
+  int type = -1;
+  EXPECT_TRUE(dict->GetInteger("type", &type));
+  return type;
+}
+
+TEST(NetLogRingBufferTest, Basic) {
+  NetLog net_log;
+  NetLogRingBuffer buffer(10);
+  net_log.AddThreadSafeObserver(&buffer, NetLog::LOG_ALL_BUT_BYTES);
+
+  EXPECT_EQ(0u, buffer.GetSize());
+
+  AddCancelledEvent(&net_log);
+  EXPECT_EQ(1u, buffer.GetSize());
+
+  scoped_ptr<base::ListValue> list(buffer.EntriesToValue());
+  ASSERT_EQ(1u, list->GetSize());
+  const base::DictionaryValue* dict = NULL;
+  ASSERT_TRUE(list->GetDictionary(0, &dict));
+  EXPECT_TRUE(dict->HasKey("time"));
+  EXPECT_EQ(static_cast<int>(NetLog::TYPE_CANCELLED),
+            GetEntryType(list.get(), 0));
+  int phase = -1;
+  EXPECT_TRUE(dict->GetInteger("phase", &phase));
+  EXPECT_EQ(static_cast<int>(NetLog::PHASE_NONE), phase);
+  const base::DictionaryValue* source_dict = NULL;
+  ASSERT_TRUE(dict->GetDictionary("source", &source_dict));
+  int source_type = -1;
+  EXPECT_TRUE(source_dict->GetInteger("type", &source_type));
+  EXPECT_EQ(static_cast<int>(NetLog::SOURCE_NONE), source_type);
+  // Parameters are never captured.
+  EXPECT_FALSE(dict->HasKey("params"));
+
+  buffer.Clear();
+  EXPECT_EQ(0u, buffer.GetSize());
+
+  net_log.RemoveThreadSafeObserver(&buffer);
+}
+
+// When more events are logged than the buffer holds, the oldest ones are
+// overwritten and export returns the survivors oldest first.
+TEST(NetLogRingBufferTest, Wraparound) {
+  NetLog net_log;
+  NetLogRingBuffer buffer(3);
+  net_log.AddThreadSafeObserver(&buffer, NetLog::LOG_ALL_BUT_BYTES);
+
+  net_log.AddGlobalEntry(NetLog::TYPE_CANCELLED);
+  net_log.AddGlobalEntry(NetLog::TYPE_REQUEST_ALIVE);
+  net_log.AddGlobalEntry(NetLog::TYPE_CANCELLED);
+  net_log.AddGlobalEntry(NetLog::TYPE_REQUEST_ALIVE);
+  net_log.AddGlobalEntry(NetLog::TYPE_REQUEST_ALIVE);
+  EXPECT_EQ(3u, buffer.GetSize());
+
+  scoped_ptr<base::ListValue> list(buffer.EntriesToValue());
+  ASSERT_EQ(3u, list->GetSize());
+  EXPECT_EQ(static_cast<int>(NetLog::TYPE_CANCELLED),
+            GetEntryType(list.get(), 0));
+  EXPECT_EQ(static_cast<int>(NetLog::TYPE_REQUEST_ALIVE),
+            GetEntryType(list.get(), 1));
+  EXPECT_EQ(static_cast<int>(NetLog::TYPE_REQUEST_ALIVE),
+            GetEntryType(list.get(), 2));
+
+  net_log.RemoveThreadSafeObserver(&buffer);
+}
+
+TEST(NetLogRingBufferTest, Sampling) {
+  NetLog net_log;
+  NetLogRingBuffer buffer(100);
+  buffer.set_sampling_period(3);
+  net_log.AddThreadSafeObserver(&buffer, NetLog::LOG_ALL_BUT_BYTES);
+
+  for (int i = 0; i < 9; ++i)
+    AddCancelledEvent(&net_log);
+
+  // Every third event is recorded, starting with the first.
+  EXPECT_EQ(3u, buffer.GetSize());
+
+  net_log.RemoveThreadSafeObserver(&buffer);
+}
+
+}  // namespace
+
+}  // namespace net
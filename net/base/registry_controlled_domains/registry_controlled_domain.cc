@@ -46,6 +46,7 @@
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 
 #include "base/logging.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "net/base/net_module.h"
@@ -200,14 +201,14 @@ int LookupString(const unsigned char* graph, size_t length, const char* key,
 }
 
 size_t GetRegistryLengthImpl(
-    const std::string& host,
+    const base::StringPiece& host,
     UnknownRegistryFilter unknown_filter,
     PrivateRegistryFilter private_filter) {
   DCHECK(!host.empty());
 
   // Skip leading dots.
   const size_t host_check_begin = host.find_first_not_of('.');
-  if (host_check_begin == std::string::npos)
+  if (host_check_begin == base::StringPiece::npos)
     return 0;  // Host is only dots.
 
   // A single trailing dot isn't relevant in this determination, but does need
@@ -223,10 +224,10 @@ size_t GetRegistryLengthImpl(
 
   // Walk up the domain tree, most specific to least specific,
   // looking for matches at each level.
-  size_t prev_start = std::string::npos;
+  size_t prev_start = base::StringPiece::npos;
   size_t curr_start = host_check_begin;
   size_t next_dot = host.find('.', curr_start);
-  if (next_dot >= host_check_len)  // Catches std::string::npos as well.
+  if (next_dot >= host_check_len)  // Catches base::StringPiece::npos as well.
     return 0;  // This can't have a registry + domain.
   while (1) {
     const char* domain_str = host.data() + curr_start;
@@ -241,7 +242,7 @@ size_t GetRegistryLengthImpl(
     if (do_check) {
       // Exception rules override wildcard rules when the domain is an exact
       // match, but wildcards take precedence when there's a subdomain.
-      if (type & kWildcardRule && (prev_start != std::string::npos)) {
+      if (type & kWildcardRule && (prev_start != base::StringPiece::npos)) {
         // If prev_start == host_check_begin, then the host is the registry
         // itself, so return 0.
         return (prev_start == host_check_begin) ? 0
@@ -249,7 +250,7 @@ size_t GetRegistryLengthImpl(
       }
 
       if (type & kExceptionRule) {
-        if (next_dot == std::string::npos) {
+        if (next_dot == base::StringPiece::npos) {
           // If we get here, we had an exception rule with no dots (e.g.
           // "!foo").  This would only be valid if we had a corresponding
           // wildcard rule, which would have to be "*".  But we explicitly
@@ -266,7 +267,7 @@ size_t GetRegistryLengthImpl(
                                               : (host.length() - curr_start);
     }
 
-    if (next_dot >= host_check_len)  // Catches std::string::npos as well.
+    if (next_dot >= host_check_len)  // Catches base::StringPiece::npos as well.
       break;
 
     prev_start = curr_start;
@@ -281,43 +282,54 @@ size_t GetRegistryLengthImpl(
       (host.length() - curr_start) : 0;
 }
 
-std::string GetDomainAndRegistryImpl(
-    const std::string& host, PrivateRegistryFilter private_filter) {
+// Returns the domain and registry as a piece of |host|, so the caller must
+// copy the result before |host|'s backing store goes away.
+base::StringPiece GetDomainAndRegistryImpl(
+    const base::StringPiece& host, PrivateRegistryFilter private_filter) {
   DCHECK(!host.empty());
 
   // Find the length of the registry for this host.
   const size_t registry_length =
       GetRegistryLengthImpl(host, INCLUDE_UNKNOWN_REGISTRIES, private_filter);
   if ((registry_length == std::string::npos) || (registry_length == 0))
-    return std::string();  // No registry.
+    return base::StringPiece();  // No registry.
   // The "2" in this next line is 1 for the dot, plus a 1-char minimum preceding
   // subcomponent length.
   DCHECK(host.length() >= 2);
   if (registry_length > (host.length() - 2)) {
     NOTREACHED() <<
         "Host does not have at least one subcomponent before registry!";
-    return std::string();
+    return base::StringPiece();
   }
 
   // Move past the dot preceding the registry, and search for the next previous
   // dot.  Return the host from after that dot, or the whole host when there is
   // no dot.
   const size_t dot = host.rfind('.', host.length() - registry_length - 2);
-  if (dot == std::string::npos)
+  if (dot == base::StringPiece::npos)
     return host;
   return host.substr(dot + 1);
 }
 
+// Returns the host of |gurl| as a piece of its spec, or an empty piece if the
+// host is empty or an IP address.
+base::StringPiece HostAsStringPiece(const GURL& gurl) {
+  const url::Component host = gurl.parsed_for_possibly_invalid_spec().host;
+  if ((host.len <= 0) || gurl.HostIsIPAddress())
+    return base::StringPiece();
+  return base::StringPiece(gurl.possibly_invalid_spec().data() + host.begin,
+                           host.len);
+}
+
 }  // namespace
 
 std::string GetDomainAndRegistry(
     const GURL& gurl,
     PrivateRegistryFilter filter) {
-  const url::Component host = gurl.parsed_for_possibly_invalid_spec().host;
-  if ((host.len <= 0) || gurl.HostIsIPAddress())
+  base::StringPiece host = HostAsStringPiece(gurl);
+  if (host.empty())
     return std::string();
-  return GetDomainAndRegistryImpl(std::string(
-      gurl.possibly_invalid_spec().data() + host.begin, host.len), filter);
+  return GetDomainAndRegistryImpl(host, filter).as_string();
 }
 
 std::string GetDomainAndRegistry(
@@ -327,7 +339,7 @@ std::string GetDomainAndRegistry(
   const std::string canon_host(CanonicalizeHost(host, &host_info));
   if (canon_host.empty() || host_info.IsIPAddress())
     return std::string();
-  return GetDomainAndRegistryImpl(canon_host, filter);
+  return GetDomainAndRegistryImpl(canon_host, filter).as_string();
 }
 
 bool SameDomainOrHost(
@@ -335,9 +347,14 @@ bool SameDomainOrHost(
     const GURL& gurl2,
     PrivateRegistryFilter filter) {
   // See if both URLs have a known domain + registry, and those values are the
-  // same.
-  const std::string domain1(GetDomainAndRegistry(gurl1, filter));
-  const std::string domain2(GetDomainAndRegistry(gurl2, filter));
+  // same. The domains are pieces of the GURLs' specs, so no copies are made.
+  const base::StringPiece host_piece1 = HostAsStringPiece(gurl1);
+  const base::StringPiece host_piece2 = HostAsStringPiece(gurl2);
+  base::StringPiece domain1, domain2;
+  if (!host_piece1.empty())
+    domain1 = GetDomainAndRegistryImpl(host_piece1, filter);
+  if (!host_piece2.empty())
+    domain2 = GetDomainAndRegistryImpl(host_piece2, filter);
   if (!domain1.empty() || !domain2.empty())
     return domain1 == domain2;
 
@@ -361,7 +378,8 @@ size_t GetRegistryLength(
   if (gurl.HostIsIPAddress())
     return 0;
   return GetRegistryLengthImpl(
-      std::string(gurl.possibly_invalid_spec().data() + host.begin, host.len),
+      base::StringPiece(gurl.possibly_invalid_spec().data() + host.begin,
+                        host.len),
       unknown_filter,
       private_filter);
 }
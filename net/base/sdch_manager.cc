@@ -71,18 +71,6 @@ SdchManager::Dictionary::Dictionary(const std::string& dictionary_text,
       clock_(new base::DefaultClock) {
 }
 
-SdchManager::Dictionary::Dictionary(const SdchManager::Dictionary& rhs)
-    : text_(rhs.text_),
-      client_hash_(rhs.client_hash_),
-      server_hash_(rhs.server_hash_),
-      url_(rhs.url_),
-      domain_(rhs.domain_),
-      path_(rhs.path_),
-      expiration_(rhs.expiration_),
-      ports_(rhs.ports_),
-      clock_(new base::DefaultClock) {
-}
-
 SdchManager::Dictionary::~Dictionary() {}
 
 // Security functions restricting loads and use of dictionaries.
@@ -221,7 +209,7 @@ std::string SdchManager::DictionarySet::GetDictionaryClientHashList() const {
     if (!first)
       result.append(",");
 
-    result.append(entry.second->data.client_hash());
+    result.append(entry.second->client_hash());
     first = false;
   }
   return result;
@@ -233,7 +221,7 @@ const SdchManager::Dictionary* SdchManager::DictionarySet::GetDictionary(
   if (it == dictionaries_.end())
     return NULL;
 
-  return &it->second->data;
+  return it->second.get();
 }
 
 bool SdchManager::DictionarySet::Empty() const {
@@ -242,8 +230,7 @@ bool SdchManager::DictionarySet::Empty() const {
 
 void SdchManager::DictionarySet::AddDictionary(
     const std::string& server_hash,
-    const scoped_refptr<base::RefCountedData<SdchManager::Dictionary>>&
-    dictionary) {
+    const scoped_refptr<SdchManager::Dictionary>& dictionary) {
   DCHECK(dictionaries_.end() == dictionaries_.find(server_hash));
 
   dictionaries_[server_hash] = dictionary;
@@ -430,9 +417,9 @@ SdchManager::GetDictionarySet(const GURL& target_url) {
   int count = 0;
   scoped_ptr<SdchManager::DictionarySet> result(new DictionarySet);
   for (const auto& entry: dictionaries_) {
-    if (entry.second->data.CanUse(target_url) != SDCH_OK)
+    if (entry.second->CanUse(target_url) != SDCH_OK)
       continue;
-    if (entry.second->data.Expired())
+    if (entry.second->Expired())
       continue;
     ++count;
     result->AddDictionary(entry.first, entry.second);
@@ -458,7 +445,7 @@ SdchManager::GetDictionarySetByHash(
   if (it == dictionaries_.end())
     return result;
 
-  *problem_code = it->second->data.CanUse(target_url);
+  *problem_code = it->second->CanUse(target_url);
   if (*problem_code != SDCH_OK)
     return result;
 
@@ -594,11 +581,10 @@ SdchProblemCode SdchManager::AddSdchDictionary(
   UMA_HISTOGRAM_COUNTS("Sdch3.Dictionary size loaded", dictionary_text.size());
   DVLOG(1) << "Loaded dictionary with client hash " << client_hash
            << " and server hash " << server_hash;
-  Dictionary dictionary(dictionary_text, header_end + 2, client_hash,
-                        server_hash, dictionary_url_normalized, domain, path,
-                        expiration, ports);
   dictionaries_[server_hash] =
-      new base::RefCountedData<Dictionary>(dictionary);
+      new Dictionary(dictionary_text, header_end + 2, client_hash, server_hash,
+                     dictionary_url_normalized, domain, path, expiration,
+                     ports);
   if (server_hash_p)
     *server_hash_p = server_hash;
 
@@ -639,14 +625,14 @@ base::Value* SdchManager::SdchInfoToValue() const {
   base::ListValue* entry_list = new base::ListValue();
   for (const auto& entry: dictionaries_) {
     base::DictionaryValue* entry_dict = new base::DictionaryValue();
-    entry_dict->SetString("url", entry.second->data.url().spec());
-    entry_dict->SetString("client_hash", entry.second->data.client_hash());
-    entry_dict->SetString("domain", entry.second->data.domain());
-    entry_dict->SetString("path", entry.second->data.path());
+    entry_dict->SetString("url", entry.second->url().spec());
+    entry_dict->SetString("client_hash", entry.second->client_hash());
+    entry_dict->SetString("domain", entry.second->domain());
+    entry_dict->SetString("path", entry.second->path());
     base::ListValue* port_list = new base::ListValue();
     for (std::set<int>::const_iterator port_it =
-             entry.second->data.ports().begin();
-         port_it != entry.second->data.ports().end(); ++port_it) {
+             entry.second->ports().begin();
+         port_it != entry.second->ports().end(); ++port_it) {
       port_list->AppendInteger(*port_it);
     }
     entry_dict->Set("ports", port_list);
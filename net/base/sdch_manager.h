@@ -56,10 +56,13 @@ class SdchObserver;
 class NET_EXPORT SdchManager {
  public:
   class Dictionary;
-  typedef std::map<std::string, scoped_refptr<base::RefCountedData<Dictionary>>>
-      DictionaryMap;
+  typedef std::map<std::string, scoped_refptr<Dictionary>> DictionaryMap;
 
-  class NET_EXPORT_PRIVATE Dictionary {
+  // Dictionaries are refcounted so that the (possibly large) dictionary
+  // text is shared by the manager and any DictionarySets that name it,
+  // rather than copied into each holder.
+  class NET_EXPORT_PRIVATE Dictionary
+      : public base::RefCounted<Dictionary> {
    public:
     // Construct a vc-diff usable dictionary from the dictionary_text starting
     // at the given offset. The supplied client_hash should be used to
@@ -74,8 +77,6 @@ class NET_EXPORT SdchManager {
                const base::Time& expiration,
                const std::set<int>& ports);
 
-    ~Dictionary();
-
     // Sdch filters can get our text to use in decoding compressed data.
     const std::string& text() const { return text_; }
 
@@ -111,12 +112,9 @@ class NET_EXPORT SdchManager {
     void SetClockForTesting(scoped_ptr<base::Clock> clock);
 
    private:
-    friend class base::RefCountedData<Dictionary>;
+    friend class base::RefCounted<Dictionary>;
 
-    // Private copy-constructor to support RefCountedData<>, which requires
-    // that an object stored in it be either DefaultConstructible or
-    // CopyConstructible
-    Dictionary(const Dictionary& rhs);
+    ~Dictionary();
 
     // The actual text of the dictionary.
     std::string text_;
@@ -143,7 +141,7 @@ class NET_EXPORT SdchManager {
 
     scoped_ptr<base::Clock> clock_;
 
-    void operator=(const Dictionary&) = delete;
+    DISALLOW_COPY_AND_ASSIGN(Dictionary);
   };
 
   // A handle for one or more dictionaries which will keep the dictionaries
@@ -168,9 +166,9 @@ class NET_EXPORT SdchManager {
     friend class SdchManager;
 
     DictionarySet();
-    void AddDictionary(const std::string& server_hash,
-                       const scoped_refptr<base::RefCountedData<
-                           SdchManager::Dictionary>>& dictionary);
+    void AddDictionary(
+        const std::string& server_hash,
+        const scoped_refptr<SdchManager::Dictionary>& dictionary);
 
     DictionaryMap dictionaries_;
 
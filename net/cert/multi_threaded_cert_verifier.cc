@@ -4,14 +4,18 @@
 
 #include "net/cert/multi_threaded_cert_verifier.h"
 
+#include <string.h>
+
 #include <algorithm>
 
+#include "base/base64.h"
 #include "base/bind.h"
 #include "base/bind_helpers.h"
 #include "base/compiler_specific.h"
 #include "base/message_loop/message_loop.h"
 #include "base/metrics/histogram.h"
 #include "base/stl_util.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/synchronization/lock.h"
 #include "base/threading/worker_pool.h"
 #include "base/time/time.h"
@@ -80,6 +84,66 @@ const unsigned kMaxCacheEntries = 256;
 // The number of seconds for which we'll cache a cache entry.
 const unsigned kTTLSecs = 1800;  // 30 minutes.
 
+// Dictionary keys for cache entries serialized by GetCacheAsListValue().
+const char kHostnameKey[] = "hostname";
+const char kFlagsKey[] = "flags";
+const char kRequestHashesKey[] = "request_hashes";
+const char kErrorKey[] = "error";
+const char kCertStatusKey[] = "cert_status";
+const char kHasMD2Key[] = "has_md2";
+const char kHasMD4Key[] = "has_md4";
+const char kHasMD5Key[] = "has_md5";
+const char kHasSHA1Key[] = "has_sha1";
+const char kIsIssuedByKnownRootKey[] = "is_issued_by_known_root";
+const char kIsIssuedByAdditionalTrustAnchorKey[] =
+    "is_issued_by_additional_trust_anchor";
+const char kCommonNameFallbackUsedKey[] = "common_name_fallback_used";
+const char kCertChainKey[] = "cert_chain";
+const char kPublicKeyHashesKey[] = "public_key_hashes";
+const char kVerificationTimeKey[] = "verification_time";
+const char kExpirationTimeKey[] = "expiration_time";
+
+// Appends |cert| and its intermediates to |out| as base64-encoded DER
+// certificates. Returns false if any certificate fails to encode.
+bool SerializeCertificateChain(X509Certificate* cert, base::ListValue* out) {
+  std::string der;
+  std::string encoded;
+  if (!X509Certificate::GetDEREncoded(cert->os_cert_handle(), &der))
+    return false;
+  base::Base64Encode(der, &encoded);
+  out->AppendString(encoded);
+  const X509Certificate::OSCertHandles& intermediates =
+      cert->GetIntermediateCertificates();
+  for (size_t i = 0; i < intermediates.size(); ++i) {
+    if (!X509Certificate::GetDEREncoded(intermediates[i], &der))
+      return false;
+    base::Base64Encode(der, &encoded);
+    out->AppendString(encoded);
+  }
+  return true;
+}
+
+// Inverse of SerializeCertificateChain(). Returns NULL if |encoded_chain|
+// does not decode to a valid certificate chain.
+scoped_refptr<X509Certificate> DeserializeCertificateChain(
+    const base::ListValue& encoded_chain) {
+  std::vector<std::string> der_chain;
+  der_chain.reserve(encoded_chain.GetSize());
+  for (size_t i = 0; i < encoded_chain.GetSize(); ++i) {
+    std::string encoded;
+    std::string der;
+    if (!encoded_chain.GetString(i, &encoded) ||
+        !base::Base64Decode(encoded, &der)) {
+      return scoped_refptr<X509Certificate>();
+    }
+    der_chain.push_back(der);
+  }
+  std::vector<base::StringPiece> der_pieces(der_chain.begin(),
+                                            der_chain.end());
+  return scoped_refptr<X509Certificate>(
+      X509Certificate::CreateFromDERCertChain(der_pieces));
+}
+
 base::Value* CertVerifyResultCallback(const CertVerifyResult& verify_result,
                                       NetLog::LogLevel log_level) {
   base::DictionaryValue* results = new base::DictionaryValue();
@@ -453,6 +517,177 @@ void MultiThreadedCertVerifier::SetCertTrustAnchorProvider(
   trust_anchor_provider_ = trust_anchor_provider;
 }
 
+void MultiThreadedCertVerifier::GetCacheAsListValue(
+    base::ListValue* entry_list) const {
+  DCHECK(CalledOnValidThread());
+
+  base::Time now = base::Time::Now();
+  for (CertVerifierCache::Iterator it(cache_); it.HasNext(); it.Advance()) {
+    if (it.expiration().expiration_time <= now)
+      continue;
+    const RequestParams& params = it.key();
+    const CachedResult& cached = it.value();
+
+    scoped_ptr<base::DictionaryValue> entry_dict(new base::DictionaryValue());
+    entry_dict->SetString(kHostnameKey, params.hostname);
+    entry_dict->SetInteger(kFlagsKey, params.flags);
+
+    base::ListValue* request_hashes = new base::ListValue();
+    for (size_t i = 0; i < params.hash_values.size(); ++i) {
+      request_hashes->AppendString(base::HexEncode(
+          params.hash_values[i].data, sizeof(params.hash_values[i].data)));
+    }
+    entry_dict->Set(kRequestHashesKey, request_hashes);
+
+    base::ListValue* cert_chain = new base::ListValue();
+    if (cached.result.verified_cert.get() &&
+        !SerializeCertificateChain(cached.result.verified_cert.get(),
+                                   cert_chain)) {
+      delete cert_chain;
+      continue;
+    }
+    entry_dict->Set(kCertChainKey, cert_chain);
+
+    entry_dict->SetInteger(kErrorKey, cached.error);
+    entry_dict->SetString(
+        kCertStatusKey,
+        base::Int64ToString(static_cast<int64>(cached.result.cert_status)));
+    entry_dict->SetBoolean(kHasMD2Key, cached.result.has_md2);
+    entry_dict->SetBoolean(kHasMD4Key, cached.result.has_md4);
+    entry_dict->SetBoolean(kHasMD5Key, cached.result.has_md5);
+    entry_dict->SetBoolean(kHasSHA1Key, cached.result.has_sha1);
+    entry_dict->SetBoolean(kIsIssuedByKnownRootKey,
+                           cached.result.is_issued_by_known_root);
+    entry_dict->SetBoolean(kIsIssuedByAdditionalTrustAnchorKey,
+                           cached.result.is_issued_by_additional_trust_anchor);
+    entry_dict->SetBoolean(kCommonNameFallbackUsedKey,
+                           cached.result.common_name_fallback_used);
+
+    base::ListValue* public_key_hashes = new base::ListValue();
+    for (size_t i = 0; i < cached.result.public_key_hashes.size(); ++i)
+      public_key_hashes->AppendString(
+          cached.result.public_key_hashes[i].ToString());
+    entry_dict->Set(kPublicKeyHashesKey, public_key_hashes);
+
+    entry_dict->SetString(
+        kVerificationTimeKey,
+        base::Int64ToString(
+            it.expiration().verification_time.ToInternalValue()));
+    entry_dict->SetString(
+        kExpirationTimeKey,
+        base::Int64ToString(it.expiration().expiration_time.ToInternalValue()));
+
+    entry_list->Append(entry_dict.release());
+  }
+}
+
+bool MultiThreadedCertVerifier::RestoreCacheFromListValue(
+    const base::ListValue& entries) {
+  DCHECK(CalledOnValidThread());
+
+  base::Time now = base::Time::Now();
+  for (size_t i = 0; i < entries.GetSize(); ++i) {
+    const base::DictionaryValue* entry_dict;
+    if (!entries.GetDictionary(i, &entry_dict))
+      return false;
+
+    std::string hostname;
+    int flags = 0;
+    int error = 0;
+    std::string cert_status_str;
+    std::string verification_time_str;
+    std::string expiration_time_str;
+    const base::ListValue* request_hashes = NULL;
+    const base::ListValue* cert_chain = NULL;
+    const base::ListValue* public_key_hashes = NULL;
+    CertVerifyResult result;
+    if (!entry_dict->GetString(kHostnameKey, &hostname) ||
+        !entry_dict->GetInteger(kFlagsKey, &flags) ||
+        !entry_dict->GetList(kRequestHashesKey, &request_hashes) ||
+        !entry_dict->GetList(kCertChainKey, &cert_chain) ||
+        !entry_dict->GetInteger(kErrorKey, &error) ||
+        !entry_dict->GetString(kCertStatusKey, &cert_status_str) ||
+        !entry_dict->GetBoolean(kHasMD2Key, &result.has_md2) ||
+        !entry_dict->GetBoolean(kHasMD4Key, &result.has_md4) ||
+        !entry_dict->GetBoolean(kHasMD5Key, &result.has_md5) ||
+        !entry_dict->GetBoolean(kHasSHA1Key, &result.has_sha1) ||
+        !entry_dict->GetBoolean(kIsIssuedByKnownRootKey,
+                                &result.is_issued_by_known_root) ||
+        !entry_dict->GetBoolean(kIsIssuedByAdditionalTrustAnchorKey,
+                                &result.is_issued_by_additional_trust_anchor) ||
+        !entry_dict->GetBoolean(kCommonNameFallbackUsedKey,
+                                &result.common_name_fallback_used) ||
+        !entry_dict->GetList(kPublicKeyHashesKey, &public_key_hashes) ||
+        !entry_dict->GetString(kVerificationTimeKey, &verification_time_str) ||
+        !entry_dict->GetString(kExpirationTimeKey, &expiration_time_str)) {
+      return false;
+    }
+
+    int64 cert_status = 0;
+    int64 verification_time_internal = 0;
+    int64 expiration_time_internal = 0;
+    if (!base::StringToInt64(cert_status_str, &cert_status) ||
+        !base::StringToInt64(verification_time_str,
+                             &verification_time_internal) ||
+        !base::StringToInt64(expiration_time_str, &expiration_time_internal)) {
+      return false;
+    }
+    result.cert_status = static_cast<CertStatus>(cert_status);
+
+    base::Time expiration_time =
+        base::Time::FromInternalValue(expiration_time_internal);
+    if (expiration_time <= now)
+      continue;
+
+    std::vector<SHA1HashValue> hash_values;
+    hash_values.reserve(request_hashes->GetSize());
+    for (size_t j = 0; j < request_hashes->GetSize(); ++j) {
+      std::string hash_str;
+      std::vector<uint8> hash_bytes;
+      SHA1HashValue hash_value;
+      if (!request_hashes->GetString(j, &hash_str) ||
+          !base::HexStringToBytes(hash_str, &hash_bytes) ||
+          hash_bytes.size() != sizeof(hash_value.data)) {
+        return false;
+      }
+      memcpy(hash_value.data, &hash_bytes[0], sizeof(hash_value.data));
+      hash_values.push_back(hash_value);
+    }
+
+    for (size_t j = 0; j < public_key_hashes->GetSize(); ++j) {
+      std::string hash_str;
+      HashValue hash_value;
+      if (!public_key_hashes->GetString(j, &hash_str) ||
+          !hash_value.FromString(hash_str)) {
+        return false;
+      }
+      result.public_key_hashes.push_back(hash_value);
+    }
+
+    if (cert_chain->GetSize() > 0) {
+      result.verified_cert = DeserializeCertificateChain(*cert_chain);
+      if (!result.verified_cert.get())
+        return false;
+    }
+
+    RequestParams key(hostname, flags, hash_values);
+
+    // A result obtained this session always beats a persisted one.
+    if (cache_.Get(key, CacheValidityPeriod(now)))
+      continue;
+
+    CachedResult cached_result;
+    cached_result.error = error;
+    cached_result.result = result;
+    cache_.Put(
+        key, cached_result, CacheValidityPeriod(now),
+        CacheValidityPeriod(
+            base::Time::FromInternalValue(verification_time_internal),
+            expiration_time));
+  }
+  return true;
+}
+
 int MultiThreadedCertVerifier::Verify(X509Certificate* cert,
                                       const std::string& hostname,
                                       int flags,
@@ -551,6 +786,15 @@ MultiThreadedCertVerifier::RequestParams::RequestParams(
     hash_values.push_back(additional_trust_anchors[i]->fingerprint());
 }
 
+MultiThreadedCertVerifier::RequestParams::RequestParams(
+    const std::string& hostname_arg,
+    int flags_arg,
+    const std::vector<SHA1HashValue>& hash_values_arg)
+    : hostname(hostname_arg),
+      flags(flags_arg),
+      hash_values(hash_values_arg) {
+}
+
 MultiThreadedCertVerifier::RequestParams::~RequestParams() {}
 
 bool MultiThreadedCertVerifier::RequestParams::operator<(
@@ -22,6 +22,10 @@
 #include "net/cert/cert_verify_result.h"
 #include "net/cert/x509_cert_types.h"
 
+namespace base {
+class ListValue;
+}
+
 namespace net {
 
 class CertTrustAnchorProvider;
@@ -53,6 +57,20 @@ class NET_EXPORT_PRIVATE MultiThreadedCertVerifier
   void SetCertTrustAnchorProvider(
       CertTrustAnchorProvider* trust_anchor_provider);
 
+  // Serializes the unexpired entries of the verification cache into
+  // |entry_list| so that an embedder may persist them across restarts.
+  // Expirations are recorded as wall-clock times, matching how the cache
+  // already measures validity.
+  void GetCacheAsListValue(base::ListValue* entry_list) const;
+
+  // Adds the entries serialized in |entries| (the output of a previous
+  // GetCacheAsListValue() call) to the verification cache. Entries that
+  // have expired, or whose key already has a result from this session, are
+  // skipped. Returns false if |entries| is malformed. Embedders must
+  // discard persisted entries whenever the system trust store may have
+  // changed; within a session the cache is cleared on CA cert changes.
+  bool RestoreCacheFromListValue(const base::ListValue& entries);
+
   // CertVerifier implementation
   int Verify(X509Certificate* cert,
              const std::string& hostname,
@@ -76,6 +94,8 @@ class NET_EXPORT_PRIVATE MultiThreadedCertVerifier
   FRIEND_TEST_ALL_PREFIXES(MultiThreadedCertVerifierTest, CancelRequest);
   FRIEND_TEST_ALL_PREFIXES(MultiThreadedCertVerifierTest,
                            RequestParamsComparators);
+  FRIEND_TEST_ALL_PREFIXES(MultiThreadedCertVerifierTest,
+                           SerializeAndRestoreCache);
   FRIEND_TEST_ALL_PREFIXES(MultiThreadedCertVerifierTest,
                            CertTrustAnchorProvider);
 
@@ -86,6 +106,11 @@ class NET_EXPORT_PRIVATE MultiThreadedCertVerifier
                   const std::string& hostname_arg,
                   int flags_arg,
                   const CertificateList& additional_trust_anchors);
+    // Used when restoring a persisted cache entry, where only the already
+    // computed hash values are available.
+    RequestParams(const std::string& hostname_arg,
+                  int flags_arg,
+                  const std::vector<SHA1HashValue>& hash_values_arg);
     ~RequestParams();
 
     bool operator<(const RequestParams& other) const;
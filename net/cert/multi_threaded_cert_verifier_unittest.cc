@@ -8,6 +8,7 @@
 #include "base/files/file_path.h"
 #include "base/format_macros.h"
 #include "base/strings/stringprintf.h"
+#include "base/values.h"
 #include "net/base/net_errors.h"
 #include "net/base/net_log.h"
 #include "net/base/test_completion_callback.h"
@@ -308,6 +309,65 @@ TEST_F(MultiThreadedCertVerifierTest, MAYBE_CancelRequestThenQuit) {
   // Destroy |verifier| by going out of scope.
 }
 
+// Tests that the verification cache can be serialized and restored into
+// another verifier, and that restored entries satisfy requests
+// synchronously without consulting the CertVerifyProc.
+TEST_F(MultiThreadedCertVerifierTest, SerializeAndRestoreCache) {
+  base::FilePath certs_dir = GetTestCertsDirectory();
+  scoped_refptr<X509Certificate> test_cert(
+      ImportCertFromFile(certs_dir, "ok_cert.pem"));
+  ASSERT_NE(static_cast<X509Certificate*>(NULL), test_cert.get());
+
+  int error;
+  CertVerifyResult verify_result;
+  TestCompletionCallback callback;
+  CertVerifier::RequestHandle request_handle;
+
+  error = verifier_.Verify(test_cert.get(),
+                           "www.example.com",
+                           0,
+                           NULL,
+                           &verify_result,
+                           callback.callback(),
+                           &request_handle,
+                           BoundNetLog());
+  ASSERT_EQ(ERR_IO_PENDING, error);
+  error = callback.WaitForResult();
+  ASSERT_TRUE(IsCertificateError(error));
+  ASSERT_EQ(1u, verifier_.GetCacheSize());
+
+  base::ListValue serialized;
+  verifier_.GetCacheAsListValue(&serialized);
+  ASSERT_EQ(1u, serialized.GetSize());
+
+  MultiThreadedCertVerifier restored_verifier(new MockCertVerifyProc());
+  ASSERT_TRUE(restored_verifier.RestoreCacheFromListValue(serialized));
+  ASSERT_EQ(1u, restored_verifier.GetCacheSize());
+
+  // The restored entry must satisfy an identical request synchronously.
+  CertVerifyResult restored_result;
+  error = restored_verifier.Verify(test_cert.get(),
+                                   "www.example.com",
+                                   0,
+                                   NULL,
+                                   &restored_result,
+                                   callback.callback(),
+                                   &request_handle,
+                                   BoundNetLog());
+  ASSERT_NE(ERR_IO_PENDING, error);
+  ASSERT_TRUE(IsCertificateError(error));
+  ASSERT_TRUE(request_handle == NULL);
+  ASSERT_EQ(1u, restored_verifier.cache_hits());
+  EXPECT_EQ(verify_result.cert_status, restored_result.cert_status);
+  ASSERT_TRUE(restored_result.verified_cert.get());
+  EXPECT_TRUE(restored_result.verified_cert->Equals(test_cert.get()));
+
+  // Malformed data is rejected.
+  base::ListValue malformed;
+  malformed.AppendString("not-a-dictionary");
+  EXPECT_FALSE(restored_verifier.RestoreCacheFromListValue(malformed));
+}
+
 TEST_F(MultiThreadedCertVerifierTest, RequestParamsComparators) {
   SHA1HashValue a_key;
   memset(a_key.data, 'a', sizeof(a_key.data));
@@ -4,6 +4,7 @@
 
 #include "net/disk_cache/memory/mem_backend_impl.h"
 
+#include "base/bind.h"
 #include "base/logging.h"
 #include "base/sys_info.h"
 #include "net/base/net_errors.h"
@@ -29,7 +30,13 @@ int LowWaterAdjust(int high_water) {
 namespace disk_cache {
 
 MemBackendImpl::MemBackendImpl(net::NetLog* net_log)
-    : max_size_(0), current_size_(0), net_log_(net_log), weak_factory_(this) {
+    : max_size_(0),
+      current_size_(0),
+      net_log_(net_log),
+      memory_pressure_listener_(
+          base::Bind(&MemBackendImpl::OnMemoryPressure,
+                     base::Unretained(this))),
+      weak_factory_(this) {
 }
 
 MemBackendImpl::~MemBackendImpl() {
@@ -92,7 +99,7 @@ void MemBackendImpl::InternalDoomEntry(MemEntryImpl* entry) {
   // Only parent entries can be passed into this method.
   DCHECK(entry->type() == MemEntryImpl::kParentEntry);
 
-  rankings_.Remove(entry);
+  GetListForEntry(entry)->Remove(entry);
   EntryMap::iterator it = entries_.find(entry->GetKey());
   if (it != entries_.end())
     entries_.erase(it);
@@ -103,7 +110,7 @@ void MemBackendImpl::InternalDoomEntry(MemEntryImpl* entry) {
 }
 
 void MemBackendImpl::UpdateRank(MemEntryImpl* node) {
-  rankings_.UpdateRank(node);
+  GetListForEntry(node)->UpdateRank(node);
 }
 
 void MemBackendImpl::ModifyStorageSize(int32 old_size, int32 new_size) {
@@ -118,11 +125,11 @@ int MemBackendImpl::MaxFileSize() const {
 }
 
 void MemBackendImpl::InsertIntoRankingList(MemEntryImpl* entry) {
-  rankings_.Insert(entry);
+  GetListForEntry(entry)->Insert(entry);
 }
 
 void MemBackendImpl::RemoveFromRankingList(MemEntryImpl* entry) {
-  rankings_.Remove(entry);
+  GetListForEntry(entry)->Remove(entry);
 }
 
 net::CacheType MemBackendImpl::GetCacheType() const {
@@ -184,7 +191,7 @@ int MemBackendImpl::DoomEntriesSince(const base::Time initial_time,
 class MemBackendImpl::MemIterator : public Backend::Iterator {
  public:
   explicit MemIterator(base::WeakPtr<MemBackendImpl> backend)
-      : backend_(backend), current_(NULL) {
+      : backend_(backend), list_(NUM_LISTS - 1), current_(NULL) {
   }
 
   int OpenNextEntry(Entry** next_entry,
@@ -192,11 +199,20 @@ class MemBackendImpl::MemIterator : public Backend::Iterator {
     if (!backend_)
       return net::ERR_FAILED;
 
-    MemEntryImpl* node = backend_->rankings_.GetNext(current_);
-    // We should never return a child entry so iterate until we hit a parent
-    // entry.
-    while (node && node->type() != MemEntryImpl::kParentEntry)
-      node = backend_->rankings_.GetNext(node);
+    // Walk the eviction lists in reverse order so that the most valuable
+    // entries (HIGH_USE) are returned first.
+    MemEntryImpl* node = NULL;
+    while (list_ >= 0) {
+      node = backend_->rankings_[list_].GetNext(current_);
+      // We should never return a child entry so iterate until we hit a parent
+      // entry.
+      while (node && node->type() != MemEntryImpl::kParentEntry)
+        node = backend_->rankings_[list_].GetNext(node);
+      if (node)
+        break;
+      list_--;
+      current_ = NULL;
+    }
     *next_entry = node;
     current_ = node;
 
@@ -209,6 +225,7 @@ class MemBackendImpl::MemIterator : public Backend::Iterator {
 
  private:
   base::WeakPtr<MemBackendImpl> backend_;
+  int list_;
   MemEntryImpl* current_;
 };
 
@@ -220,7 +237,7 @@ scoped_ptr<Backend::Iterator> MemBackendImpl::CreateIterator() {
 void MemBackendImpl::OnExternalCacheHit(const std::string& key) {
   EntryMap::iterator it = entries_.find(key);
   if (it != entries_.end()) {
-    UpdateRank(it->second);
+    OnEntryOpened(it->second);
   }
 }
 
@@ -230,6 +247,7 @@ bool MemBackendImpl::OpenEntry(const std::string& key, Entry** entry) {
     return false;
 
   it->second->Open();
+  OnEntryOpened(it->second);
 
   *entry = it->second;
   return true;
@@ -246,7 +264,7 @@ bool MemBackendImpl::CreateEntry(const std::string& key, Entry** entry) {
     return false;
   }
 
-  rankings_.Insert(cache_entry);
+  rankings_[NO_USE].Insert(cache_entry);
   entries_[key] = cache_entry;
 
   *entry = cache_entry;
@@ -275,58 +293,96 @@ bool MemBackendImpl::DoomEntriesBetween(const Time initial_time,
 
   DCHECK(end_time >= initial_time);
 
-  MemEntryImpl* node = rankings_.GetNext(NULL);
-  // Last valid entry before |node|.
-  // Note, that entries after |node| may become invalid during |node| doom in
-  // case when they are child entries of it. It is guaranteed that
-  // parent node will go prior to it childs in ranking list (see
-  // InternalReadSparseData and InternalWriteSparseData).
-  MemEntryImpl* last_valid = NULL;
-
-  // rankings_ is ordered by last used, this will descend through the cache
-  // and start dooming items before the end_time, and will stop once it reaches
-  // an item used before the initial time.
-  while (node) {
-    if (node->GetLastUsed() < initial_time)
-      break;
-
-    if (node->GetLastUsed() < end_time)
-      node->Doom();
-    else
-      last_valid = node;
-    node = rankings_.GetNext(last_valid);
+  // The lists are not strictly ordered by last used time once an entry has
+  // been promoted, so every node of every list is visited.
+  for (int i = NUM_LISTS - 1; i >= 0; i--) {
+    MemEntryImpl* node = rankings_[i].GetNext(NULL);
+    // Last valid entry before |node|.
+    // Note, that entries after |node| may become invalid during |node| doom in
+    // case when they are child entries of it. It is guaranteed that
+    // parent node will go prior to it childs in ranking list (see
+    // InternalReadSparseData and InternalWriteSparseData).
+    MemEntryImpl* last_valid = NULL;
+
+    while (node) {
+      if (node->GetLastUsed() >= initial_time &&
+          node->GetLastUsed() < end_time) {
+        node->Doom();
+      } else {
+        last_valid = node;
+      }
+      node = rankings_[i].GetNext(last_valid);
+    }
   }
 
   return true;
 }
 
 bool MemBackendImpl::DoomEntriesSince(const Time initial_time) {
-  for (;;) {
-    // Get the entry in the front.
-    Entry* entry = rankings_.GetNext(NULL);
-
-    // Break the loop when there are no more entries or the entry is too old.
-    if (!entry || entry->GetLastUsed() < initial_time)
-      return true;
-    entry->Doom();
+  for (int i = NUM_LISTS - 1; i >= 0; i--) {
+    MemEntryImpl* node = rankings_[i].GetNext(NULL);
+    // Last valid entry before |node|; see DoomEntriesBetween().
+    MemEntryImpl* last_valid = NULL;
+
+    while (node) {
+      if (node->GetLastUsed() >= initial_time)
+        node->Doom();
+      else
+        last_valid = node;
+      node = rankings_[i].GetNext(last_valid);
+    }
   }
+
+  return true;
+}
+
+MemRankings* MemBackendImpl::GetListForEntry(MemEntryImpl* entry) {
+  return &rankings_[entry->reuse_count() ? HIGH_USE : NO_USE];
+}
+
+void MemBackendImpl::OnEntryOpened(MemEntryImpl* entry) {
+  if (!entry->reuse_count()) {
+    rankings_[NO_USE].Remove(entry);
+    rankings_[HIGH_USE].Insert(entry);
+  } else {
+    rankings_[HIGH_USE].UpdateRank(entry);
+  }
+  if (entry->reuse_count() < kint32max)
+    entry->increment_reuse_count();
 }
 
 void MemBackendImpl::TrimCache(bool empty) {
-  MemEntryImpl* next = rankings_.GetPrev(NULL);
-  if (!next)
-    return;
-
-  int target_size = empty ? 0 : LowWaterAdjust(max_size_);
-  while (current_size_ > target_size && next) {
-    MemEntryImpl* node = next;
-    next = rankings_.GetPrev(next);
-    if (!node->InUse() || empty) {
-      node->Doom();
+  TrimToSize(empty ? 0 : LowWaterAdjust(max_size_), empty);
+}
+
+void MemBackendImpl::TrimToSize(int target_size, bool empty) {
+  // Evict single-use entries before touching the frequently used ones.
+  for (int i = 0; i < NUM_LISTS; i++) {
+    MemEntryImpl* next = rankings_[i].GetPrev(NULL);
+    while (current_size_ > target_size && next) {
+      MemEntryImpl* node = next;
+      next = rankings_[i].GetPrev(next);
+      if (!node->InUse() || empty) {
+        node->Doom();
+      }
     }
+    if (current_size_ <= target_size)
+      return;
   }
+}
 
-  return;
+void MemBackendImpl::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
+  switch (memory_pressure_level) {
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
+      break;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
+      TrimToSize(max_size_ / 2, false);
+      break;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
+      TrimToSize(max_size_ / 10, false);
+      break;
+  }
 }
 
 void MemBackendImpl::AddStorageSize(int32 bytes) {
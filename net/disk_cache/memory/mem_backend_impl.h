@@ -9,6 +9,7 @@
 
 #include "base/compiler_specific.h"
 #include "base/containers/hash_tables.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/weak_ptr.h"
 #include "net/disk_cache/disk_cache.h"
 #include "net/disk_cache/memory/mem_rankings.h"
@@ -90,6 +91,16 @@ class NET_EXPORT_PRIVATE MemBackendImpl : public Backend {
 
   typedef base::hash_map<std::string, MemEntryImpl*> EntryMap;
 
+  // Eviction lists, in the order they are scanned when trimming the cache.
+  // An entry starts on the NO_USE list and moves to the HIGH_USE list the
+  // first time it is reused, so a burst of single-use entries cannot evict
+  // the frequently used working set.
+  enum EvictionList {
+    NO_USE = 0,
+    HIGH_USE,
+    NUM_LISTS
+  };
+
   // Old Backend interface.
   bool OpenEntry(const std::string& key, Entry** entry);
   bool CreateEntry(const std::string& key, Entry** entry);
@@ -99,22 +110,39 @@ class NET_EXPORT_PRIVATE MemBackendImpl : public Backend {
                           const base::Time end_time);
   bool DoomEntriesSince(const base::Time initial_time);
 
+  // Returns the eviction list that |entry| belongs to.
+  MemRankings* GetListForEntry(MemEntryImpl* entry);
+
+  // Called every time an existing entry is opened again. The first reuse
+  // moves the entry from the NO_USE list to the HIGH_USE list.
+  void OnEntryOpened(MemEntryImpl* entry);
+
   // Deletes entries from the cache until the current size is below the limit.
   // If empty is true, the whole cache will be trimmed, regardless of being in
   // use.
   void TrimCache(bool empty);
 
+  // Deletes entries from the cache until the current size is below
+  // |target_size|, evicting single-use entries first.
+  void TrimToSize(int target_size, bool empty);
+
+  // Reacts to system memory pressure by evicting more aggressively.
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
+
   // Handles the used storage count.
   void AddStorageSize(int32 bytes);
   void SubstractStorageSize(int32 bytes);
 
   EntryMap entries_;
-  MemRankings rankings_;  // Rankings to be able to trim the cache.
-  int32 max_size_;        // Maximum data size for this instance.
+  MemRankings rankings_[NUM_LISTS];  // Rankings to be able to trim the cache.
+  int32 max_size_;                   // Maximum data size for this instance.
   int32 current_size_;
 
   net::NetLog* net_log_;
 
+  base::MemoryPressureListener memory_pressure_listener_;
+
   base::WeakPtrFactory<MemBackendImpl> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(MemBackendImpl);
@@ -63,6 +63,7 @@ MemEntryImpl::MemEntryImpl(MemBackendImpl* backend) {
   doomed_ = false;
   backend_ = backend;
   ref_count_ = 0;
+  reuse_count_ = 0;
   parent_ = NULL;
   child_id_ = 0;
   child_first_pos_ = 0;
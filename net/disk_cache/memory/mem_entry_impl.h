@@ -78,6 +78,16 @@ class MemEntryImpl : public Entry {
     prev_ = prev;
   }
 
+  // Number of times this entry has been reused since it was created. The
+  // backend uses it to pick the eviction list the entry belongs to.
+  int reuse_count() const {
+    return reuse_count_;
+  }
+
+  void increment_reuse_count() {
+    reuse_count_++;
+  }
+
   EntryType type() const {
     return parent_ ? kChildEntry : kParentEntry;
   }
@@ -173,6 +183,7 @@ class MemEntryImpl : public Entry {
   std::vector<char> data_[NUM_STREAMS];  // User data.
   int32 data_size_[NUM_STREAMS];
   int ref_count_;
+  int reuse_count_;
 
   int child_id_;              // The ID of a child entry.
   int child_first_pos_;       // The position of the first byte in a child
@@ -57,6 +57,13 @@ const char kThreadNamePrefix[] = "SimpleCache";
 // Maximum fraction of the cache that one entry can consume.
 const int kMaxFileRatio = 8;
 
+// Overall limit on mass doom shards, and the number of doomed entries below
+// which an additional shard is not worth a worker pool task. Entry hashes
+// are uniformly distributed, so fixed-stride slicing partitions the entry
+// set evenly.
+const size_t kMaxDoomEntrySetShards = 4;
+const size_t kMinDoomedEntriesPerShard = 64;
+
 // A global sequenced worker pool to use for launching all tasks.
 SequencedWorkerPool* g_sequenced_worker_pool = NULL;
 
@@ -328,9 +335,16 @@ void SimpleBackendImpl::DoomEntries(std::vector<uint64>* entry_hashes,
     mass_doom_entry_hashes->resize(mass_doom_entry_hashes->size() - 1);
   }
 
+  // Shard the mass doom among several worker tasks. The pool is not
+  // sequenced, so independent shards delete their files in parallel on
+  // disks with queue depth to spare.
+  const size_t shard_count =
+      std::min(mass_doom_entry_hashes->size() / kMinDoomedEntriesPerShard,
+               kMaxDoomEntrySetShards - 1) + 1;
+
   net::CompletionCallback barrier_callback =
-      MakeBarrierCompletionCallback(to_doom_individually_hashes.size() + 1,
-                                    callback);
+      MakeBarrierCompletionCallback(
+          to_doom_individually_hashes.size() + shard_count, callback);
   for (std::vector<uint64>::const_iterator
            it = to_doom_individually_hashes.begin(),
            end = to_doom_individually_hashes.end(); it != end; ++it) {
@@ -346,19 +360,26 @@ void SimpleBackendImpl::DoomEntries(std::vector<uint64>* entry_hashes,
     OnDoomStart(*it);
   }
 
-  // Taking this pointer here avoids undefined behaviour from calling
-  // base::Passed before mass_doom_entry_hashes.get().
-  std::vector<uint64>* mass_doom_entry_hashes_ptr =
-      mass_doom_entry_hashes.get();
-  PostTaskAndReplyWithResult(worker_pool_.get(),
-                             FROM_HERE,
-                             base::Bind(&SimpleSynchronousEntry::DoomEntrySet,
-                                        mass_doom_entry_hashes_ptr,
-                                        path_),
-                             base::Bind(&SimpleBackendImpl::DoomEntriesComplete,
-                                        AsWeakPtr(),
-                                        base::Passed(&mass_doom_entry_hashes),
-                                        barrier_callback));
+  for (size_t shard = 0; shard < shard_count; ++shard) {
+    scoped_ptr<std::vector<uint64> > shard_hashes(new std::vector<uint64>());
+    for (size_t i = shard; i < mass_doom_entry_hashes->size();
+         i += shard_count) {
+      shard_hashes->push_back((*mass_doom_entry_hashes)[i]);
+    }
+    // Taking this pointer here avoids undefined behaviour from calling
+    // base::Passed before shard_hashes.get().
+    std::vector<uint64>* shard_hashes_ptr = shard_hashes.get();
+    PostTaskAndReplyWithResult(
+        worker_pool_.get(),
+        FROM_HERE,
+        base::Bind(&SimpleSynchronousEntry::DoomEntrySet,
+                   shard_hashes_ptr,
+                   path_),
+        base::Bind(&SimpleBackendImpl::DoomEntriesComplete,
+                   AsWeakPtr(),
+                   base::Passed(&shard_hashes),
+                   barrier_callback));
+  }
 }
 
 net::CacheType SimpleBackendImpl::GetCacheType() const {
@@ -474,9 +495,21 @@ class SimpleBackendImpl::SimpleIterator final : public Iterator {
  public:
   explicit SimpleIterator(base::WeakPtr<SimpleBackendImpl> backend)
       : backend_(backend),
+        prefetched_entry_(NULL),
+        prefetched_result_(net::ERR_FAILED),
+        prefetch_in_flight_(false),
+        has_prefetched_result_(false),
+        consumer_next_entry_(NULL),
         weak_factory_(this) {
   }
 
+  ~SimpleIterator() override {
+    if (has_prefetched_result_ && prefetched_result_ == net::OK &&
+        prefetched_entry_) {
+      prefetched_entry_->Close();
+    }
+  }
+
   // From Backend::Iterator:
   int OpenNextEntry(Entry** next_entry,
                     const CompletionCallback& callback) override {
@@ -500,6 +533,27 @@ class SimpleBackendImpl::SimpleIterator final : public Iterator {
     if (!hashes_to_enumerate_)
       hashes_to_enumerate_ = backend_->index()->GetAllHashes().Pass();
 
+    if (prefetch_in_flight_) {
+      // The speculative open of the next entry has not completed yet; its
+      // result will be delivered to this caller.
+      consumer_next_entry_ = next_entry;
+      consumer_callback_ = callback;
+      return;
+    }
+
+    if (has_prefetched_result_) {
+      has_prefetched_result_ = false;
+      if (prefetched_result_ == net::OK) {
+        *next_entry = prefetched_entry_;
+        prefetched_entry_ = NULL;
+        StartPrefetch();
+        callback.Run(net::OK);
+        return;
+      }
+      // The prefetched entry vanished before it could be opened; keep
+      // enumerating the remaining hashes below.
+    }
+
     while (!hashes_to_enumerate_->empty()) {
       uint64 entry_hash = hashes_to_enumerate_->back();
       hashes_to_enumerate_->pop_back();
@@ -516,6 +570,8 @@ class SimpleBackendImpl::SimpleIterator final : public Iterator {
         if (error_code_open == net::ERR_IO_PENDING)
           return;
         if (error_code_open != net::ERR_FAILED) {
+          if (error_code_open == net::OK)
+            StartPrefetch();
           callback.Run(error_code_open);
           return;
         }
@@ -531,12 +587,97 @@ class SimpleBackendImpl::SimpleIterator final : public Iterator {
       OpenNextEntry(entry, callback);
       return;
     }
+    if (error_code == net::OK)
+      StartPrefetch();
     callback.Run(error_code);
   }
 
  private:
+  // Speculatively opens the next entry to be enumerated, overlapping its
+  // disk IO with the consumer's use of the entry just delivered.
+  void StartPrefetch() {
+    DCHECK(!prefetch_in_flight_);
+    DCHECK(!has_prefetched_result_);
+    if (!backend_)
+      return;
+    while (!hashes_to_enumerate_->empty()) {
+      uint64 entry_hash = hashes_to_enumerate_->back();
+      hashes_to_enumerate_->pop_back();
+      if (!backend_->index()->Has(entry_hash))
+        continue;
+      // The out pointer is owned by the callback rather than the iterator,
+      // because the backend writes through it even if the iterator has been
+      // destroyed by the time the open completes.
+      Entry** prefetched = new Entry*(NULL);
+      prefetch_in_flight_ = true;
+      const int rv = backend_->OpenEntryFromHash(
+          entry_hash,
+          prefetched,
+          base::Bind(&SimpleIterator::OnPrefetchComplete,
+                     weak_factory_.GetWeakPtr(),
+                     base::Owned(prefetched)));
+      if (rv == net::ERR_IO_PENDING)
+        return;
+      // Synchronous opens only fail; try the next hash.
+      DCHECK_NE(net::OK, rv);
+      prefetch_in_flight_ = false;
+    }
+  }
+
+  static void OnPrefetchComplete(const base::WeakPtr<SimpleIterator>& iterator,
+                                 Entry** prefetched,
+                                 int result) {
+    if (iterator) {
+      iterator->HandlePrefetchResult(*prefetched, result);
+    } else if (result == net::OK && *prefetched) {
+      // The iterator was destroyed while the open was in flight; nobody is
+      // left to consume the entry.
+      (*prefetched)->Close();
+    }
+  }
+
+  void HandlePrefetchResult(Entry* entry, int result) {
+    prefetch_in_flight_ = false;
+    if (!consumer_callback_.is_null()) {
+      // A consumer is already waiting on this result.
+      Entry** next_entry = consumer_next_entry_;
+      CompletionCallback callback = consumer_callback_;
+      consumer_next_entry_ = NULL;
+      consumer_callback_.Reset();
+      if (result == net::OK) {
+        *next_entry = entry;
+        StartPrefetch();
+        callback.Run(net::OK);
+      } else {
+        // The entry disappeared between the index snapshot and the open;
+        // keep enumerating on behalf of the waiting consumer.
+        OpenNextEntryImpl(next_entry, callback, net::OK);
+      }
+      return;
+    }
+    if (result != net::OK) {
+      StartPrefetch();
+      return;
+    }
+    prefetched_entry_ = entry;
+    prefetched_result_ = result;
+    has_prefetched_result_ = true;
+  }
+
   base::WeakPtr<SimpleBackendImpl> backend_;
   scoped_ptr<std::vector<uint64> > hashes_to_enumerate_;
+
+  // Result of the speculative open of the entry to be returned next, valid
+  // when |has_prefetched_result_| is set.
+  Entry* prefetched_entry_;
+  int prefetched_result_;
+  bool prefetch_in_flight_;
+  bool has_prefetched_result_;
+
+  // Caller waiting for an in-flight prefetched open to finish.
+  Entry** consumer_next_entry_;
+  CompletionCallback consumer_callback_;
+
   base::WeakPtrFactory<SimpleIterator> weak_factory_;
 };
 
@@ -48,6 +48,10 @@ struct NET_EXPORT_PRIVATE SimpleFileHeader {
 struct NET_EXPORT_PRIVATE SimpleFileEOF {
   enum Flags {
     FLAG_HAS_CRC32 = (1U << 0),
+    // The stream data is stored deflated, prefixed with a uint32 holding the
+    // inflated size. Only ever set on stream 0, which is read and written as
+    // a whole. |data_crc32| and |stream_size| describe the stored bytes.
+    FLAG_DATA_DEFLATED = (1U << 1),
   };
 
   SimpleFileEOF();
@@ -0,0 +1,269 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/disk_cache/simple/simple_index_epoch_file.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "base/files/file.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/logging.h"
+#include "base/port.h"
+#include "base/time/time.h"
+#include "net/disk_cache/simple/simple_index_file.h"
+#include "net/disk_cache/simple/simple_util.h"
+#include "third_party/zlib/zlib.h"
+
+using base::File;
+
+namespace disk_cache {
+namespace {
+
+const uint64 kEpochFileMagicNumber = GG_UINT64_C(0x656e74657220796e);
+const uint32 kEpochFileVersion = 1;
+
+const int kNumEpochs = 2;
+
+// Capacities are kept in this range and doubled on demand, so the file is
+// not rewritten from scratch on every small change in entry count.
+const uint64 kMinEpochCapacity = 1024;
+const uint64 kMaxEpochCapacity = 100000000;
+
+struct FileHeader {
+  uint64 magic_number;
+  uint32 version;
+  uint32 unused;
+  uint64 capacity;  // Maximum number of entries per epoch.
+};
+COMPILE_ASSERT(sizeof(FileHeader) == 24, file_header_size_mismatch);
+
+struct EpochHeader {
+  uint64 sequence;  // Zero means the epoch was never written.
+  uint64 number_of_entries;
+  uint64 cache_size;  // Total cache storage size in bytes.
+  uint32 payload_crc;
+  uint32 header_crc;  // Over this header with |header_crc| set to zero.
+};
+COMPILE_ASSERT(sizeof(EpochHeader) == 32, epoch_header_size_mismatch);
+
+COMPILE_ASSERT(sizeof(SimpleIndexEpochFile::Entry) == 24, entry_size_mismatch);
+
+uint32 CalculateCrc(const void* data, size_t size) {
+  return crc32(crc32(0, Z_NULL, 0),
+               static_cast<const Bytef*>(data), size);
+}
+
+uint32 CalculateEpochHeaderCrc(const EpochHeader& header) {
+  EpochHeader copy = header;
+  copy.header_crc = 0;
+  return CalculateCrc(&copy, sizeof(copy));
+}
+
+int64 EpochOffset(uint64 capacity, int epoch) {
+  return sizeof(FileHeader) +
+      epoch * (sizeof(EpochHeader) +
+               capacity * sizeof(SimpleIndexEpochFile::Entry));
+}
+
+uint64 CapacityForEntryCount(size_t entry_count) {
+  uint64 capacity = kMinEpochCapacity;
+  while (capacity < entry_count)
+    capacity *= 2;
+  return capacity;
+}
+
+bool CheckFileHeader(const FileHeader& header) {
+  return header.magic_number == kEpochFileMagicNumber &&
+      header.version == kEpochFileVersion &&
+      header.capacity >= kMinEpochCapacity &&
+      header.capacity <= kMaxEpochCapacity;
+}
+
+// Returns the sequence number of the epoch whose header is |header|, after
+// validating the header checksum. Invalid and never-written epochs both
+// report sequence zero.
+uint64 CheckedEpochSequence(const EpochHeader& header) {
+  if (header.header_crc != CalculateEpochHeaderCrc(header))
+    return 0;
+  return header.sequence;
+}
+
+}  // namespace
+
+// static
+scoped_ptr<SimpleIndexEpochFile::EntryArray>
+SimpleIndexEpochFile::BuildEntryArray(const SimpleIndex::EntrySet& entries) {
+  scoped_ptr<EntryArray> array(new EntryArray());
+  array->reserve(entries.size());
+  for (SimpleIndex::EntrySet::const_iterator it = entries.begin();
+       it != entries.end(); ++it) {
+    Entry entry;
+    entry.hash = it->first;
+    entry.last_used_time = it->second.GetLastUsedTime().ToInternalValue();
+    entry.entry_size = it->second.GetEntrySize();
+    array->push_back(entry);
+  }
+  return array.Pass();
+}
+
+// static
+void SimpleIndexEpochFile::SyncWriteEpoch(
+    const base::FilePath& epoch_file_path,
+    uint64 cache_size,
+    scoped_ptr<EntryArray> entries) {
+  const uint64 entry_count = entries->size();
+  const uint64 payload_size = entry_count * sizeof(Entry);
+  if (entry_count > kMaxEpochCapacity ||
+      payload_size > static_cast<uint64>(std::numeric_limits<int>::max()))
+    return;
+
+  File file(epoch_file_path,
+            File::FLAG_OPEN_ALWAYS | File::FLAG_READ | File::FLAG_WRITE |
+                File::FLAG_SHARE_DELETE);
+  if (!file.IsValid())
+    return;
+
+  FileHeader file_header;
+  bool recreate =
+      file.Read(0, reinterpret_cast<char*>(&file_header),
+                sizeof(file_header)) != static_cast<int>(sizeof(file_header)) ||
+      !CheckFileHeader(file_header) ||
+      file_header.capacity < entry_count;
+
+  EpochHeader epoch_headers[kNumEpochs];
+  memset(epoch_headers, 0, sizeof(epoch_headers));
+  if (recreate) {
+    // Lay out a fresh file: the file header followed by |kNumEpochs| zeroed
+    // epochs. SetLength() guarantees the epoch headers read back as never
+    // written, so stale bytes from a previous layout cannot validate.
+    file_header.magic_number = kEpochFileMagicNumber;
+    file_header.version = kEpochFileVersion;
+    file_header.unused = 0;
+    file_header.capacity = CapacityForEntryCount(entry_count);
+    if (!file.SetLength(0) ||
+        !file.SetLength(EpochOffset(file_header.capacity, kNumEpochs)) ||
+        file.Write(0, reinterpret_cast<const char*>(&file_header),
+                   sizeof(file_header)) !=
+            static_cast<int>(sizeof(file_header))) {
+      simple_util::SimpleCacheDeleteFile(epoch_file_path);
+      return;
+    }
+  } else {
+    for (int i = 0; i < kNumEpochs; ++i) {
+      file.Read(EpochOffset(file_header.capacity, i),
+                reinterpret_cast<char*>(&epoch_headers[i]),
+                sizeof(epoch_headers[i]));
+    }
+  }
+
+  // Overwrite the epoch with the lowest (possibly invalid) sequence, and
+  // write its payload before the header that validates it: a crash in
+  // between leaves the other epoch as the newest valid one.
+  uint64 sequences[kNumEpochs];
+  for (int i = 0; i < kNumEpochs; ++i)
+    sequences[i] = CheckedEpochSequence(epoch_headers[i]);
+  int target = 0;
+  uint64 highest_sequence = 0;
+  for (int i = 0; i < kNumEpochs; ++i) {
+    if (sequences[i] < sequences[target])
+      target = i;
+    highest_sequence = std::max(highest_sequence, sequences[i]);
+  }
+
+  const int64 target_offset = EpochOffset(file_header.capacity, target);
+  if (payload_size > 0 &&
+      file.Write(target_offset + sizeof(EpochHeader),
+                 reinterpret_cast<const char*>(&(*entries)[0]),
+                 static_cast<int>(payload_size)) !=
+          static_cast<int>(payload_size)) {
+    simple_util::SimpleCacheDeleteFile(epoch_file_path);
+    return;
+  }
+
+  EpochHeader header;
+  header.sequence = highest_sequence + 1;
+  header.number_of_entries = entry_count;
+  header.cache_size = cache_size;
+  header.payload_crc =
+      payload_size > 0 ? CalculateCrc(&(*entries)[0], payload_size)
+                       : CalculateCrc(NULL, 0);
+  header.header_crc = CalculateEpochHeaderCrc(header);
+  if (file.Write(target_offset, reinterpret_cast<const char*>(&header),
+                 sizeof(header)) != static_cast<int>(sizeof(header))) {
+    simple_util::SimpleCacheDeleteFile(epoch_file_path);
+    return;
+  }
+}
+
+// static
+bool SimpleIndexEpochFile::SyncLoad(const base::FilePath& epoch_file_path,
+                                    SimpleIndexLoadResult* out_result) {
+  out_result->Reset();
+
+  File file(epoch_file_path,
+            File::FLAG_OPEN | File::FLAG_READ | File::FLAG_SHARE_DELETE);
+  if (!file.IsValid())
+    return false;
+
+  base::MemoryMappedFile epoch_file_map;
+  if (!epoch_file_map.Initialize(file.Pass()) ||
+      epoch_file_map.length() < sizeof(FileHeader)) {
+    return false;
+  }
+
+  const FileHeader* file_header =
+      reinterpret_cast<const FileHeader*>(epoch_file_map.data());
+  if (!CheckFileHeader(*file_header) ||
+      static_cast<int64>(epoch_file_map.length()) <
+          EpochOffset(file_header->capacity, kNumEpochs)) {
+    return false;
+  }
+
+  // Pick the newest epoch whose header and payload both check out. The
+  // payload CRC rejects epochs torn by a crash mid-write.
+  int newest = -1;
+  uint64 newest_sequence = 0;
+  const Entry* newest_payload = NULL;
+  for (int i = 0; i < kNumEpochs; ++i) {
+    const char* epoch_data = reinterpret_cast<const char*>(
+        epoch_file_map.data()) + EpochOffset(file_header->capacity, i);
+    const EpochHeader* header =
+        reinterpret_cast<const EpochHeader*>(epoch_data);
+    const uint64 sequence = CheckedEpochSequence(*header);
+    if (sequence <= newest_sequence ||
+        header->number_of_entries > file_header->capacity)
+      continue;
+    const Entry* payload =
+        reinterpret_cast<const Entry*>(epoch_data + sizeof(EpochHeader));
+    if (header->payload_crc !=
+        CalculateCrc(payload, header->number_of_entries * sizeof(Entry)))
+      continue;
+    newest = i;
+    newest_sequence = sequence;
+    newest_payload = payload;
+  }
+  if (newest < 0)
+    return false;
+
+  const EpochHeader* header = reinterpret_cast<const EpochHeader*>(
+      reinterpret_cast<const char*>(epoch_file_map.data()) +
+      EpochOffset(file_header->capacity, newest));
+  for (uint64 i = 0; i < header->number_of_entries; ++i) {
+    const Entry& entry = newest_payload[i];
+    SimpleIndex::InsertInEntrySet(
+        entry.hash,
+        EntryMetadata(base::Time::FromInternalValue(entry.last_used_time),
+                      entry.entry_size),
+        &out_result->entries);
+  }
+  out_result->did_load = true;
+  // The mirror may lag the cache; write a fresh pickled index soon.
+  out_result->flush_required = true;
+  return true;
+}
+
+}  // namespace disk_cache
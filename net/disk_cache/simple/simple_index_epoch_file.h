@@ -0,0 +1,68 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_DISK_CACHE_SIMPLE_SIMPLE_INDEX_EPOCH_FILE_H_
+#define NET_DISK_CACHE_SIMPLE_SIMPLE_INDEX_EPOCH_FILE_H_
+
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/files/file_path.h"
+#include "base/memory/scoped_ptr.h"
+#include "net/base/net_export.h"
+#include "net/disk_cache/simple/simple_index.h"
+
+namespace disk_cache {
+
+struct SimpleIndexLoadResult;
+
+// Maintains a crash-tolerant mirror of the index ("index-epochs") next to
+// the pickled index file. The mirror holds two fixed-layout, checksummed
+// copies ("epochs") of the entry set and every flush overwrites the older
+// one in place, so at least one epoch survives an unclean shutdown. When
+// the pickled index is stale or corrupt the mirror is loaded through a
+// memory mapping instead of rescanning the whole cache directory.
+//
+// An epoch may lag the true state of the cache by up to one flush delay.
+// That is no worse than the existing tolerance for concurrent updates:
+// entries are verified when they are opened, and a load from the mirror
+// always requests an index flush to converge.
+class NET_EXPORT_PRIVATE SimpleIndexEpochFile {
+ public:
+  // Flat image of one index entry as stored in an epoch. The fields mirror
+  // EntryMetadata, widened to fixed sizes for a stable on-disk layout.
+  struct Entry {
+    uint64 hash;
+    int64 last_used_time;  // base::Time internal value.
+    uint64 entry_size;
+  };
+  typedef std::vector<Entry> EntryArray;
+
+  // Flattens |entries| into the form consumed by SyncWriteEpoch(). Performs
+  // no IO, so it is cheap enough for the IO thread.
+  static scoped_ptr<EntryArray> BuildEntryArray(
+      const SimpleIndex::EntrySet& entries);
+
+  // Writes |entries| over the older of the two epochs in |epoch_file_path|,
+  // creating or resizing the file as needed. The payload is written before
+  // the epoch header that validates it, so a crash mid-write leaves the
+  // other epoch as the newest valid one. Performs IO.
+  static void SyncWriteEpoch(const base::FilePath& epoch_file_path,
+                             uint64 cache_size,
+                             scoped_ptr<EntryArray> entries);
+
+  // Loads the newest epoch that passes its checksums into |out_result|.
+  // Returns false if the file is missing, malformed or holds no valid
+  // epoch. On success |out_result->flush_required| is set because the
+  // mirror may lag the state of the cache. Performs IO.
+  static bool SyncLoad(const base::FilePath& epoch_file_path,
+                       SimpleIndexLoadResult* out_result);
+
+ private:
+  DISALLOW_IMPLICIT_CONSTRUCTORS(SimpleIndexEpochFile);
+};
+
+}  // namespace disk_cache
+
+#endif  // NET_DISK_CACHE_SIMPLE_SIMPLE_INDEX_EPOCH_FILE_H_
@@ -19,6 +19,7 @@
 #include "net/disk_cache/simple/simple_entry_format.h"
 #include "net/disk_cache/simple/simple_histogram_macros.h"
 #include "net/disk_cache/simple/simple_index.h"
+#include "net/disk_cache/simple/simple_index_epoch_file.h"
 #include "net/disk_cache/simple/simple_synchronous_entry.h"
 #include "net/disk_cache/simple/simple_util.h"
 #include "third_party/zlib/zlib.h"
@@ -58,7 +59,8 @@ enum IndexInitMethod {
   INITIALIZE_METHOD_RECOVERED = 0,
   INITIALIZE_METHOD_LOADED = 1,
   INITIALIZE_METHOD_NEWCACHE = 2,
-  INITIALIZE_METHOD_MAX = 3,
+  INITIALIZE_METHOD_EPOCHS = 3,
+  INITIALIZE_METHOD_MAX = 4,
 };
 
 void UmaRecordIndexInitMethod(IndexInitMethod method,
@@ -152,6 +154,8 @@ const char SimpleIndexFile::kIndexFileName[] = "the-real-index";
 const char SimpleIndexFile::kIndexDirectory[] = "index-dir";
 // static
 const char SimpleIndexFile::kTempIndexFileName[] = "temp-index";
+// static
+const char SimpleIndexFile::kEpochIndexFileName[] = "index-epochs";
 
 SimpleIndexFile::IndexMetadata::IndexMetadata()
     : magic_number_(kSimpleIndexMagicNumber),
@@ -260,7 +264,9 @@ SimpleIndexFile::SimpleIndexFile(
       index_file_(cache_directory_.AppendASCII(kIndexDirectory)
                       .AppendASCII(kIndexFileName)),
       temp_index_file_(cache_directory_.AppendASCII(kIndexDirectory)
-                           .AppendASCII(kTempIndexFileName)) {
+                           .AppendASCII(kTempIndexFileName)),
+      epoch_index_file_(cache_directory_.AppendASCII(kIndexDirectory)
+                            .AppendASCII(kEpochIndexFileName)) {
 }
 
 SimpleIndexFile::~SimpleIndexFile() {}
@@ -271,7 +277,7 @@ void SimpleIndexFile::LoadIndexEntries(base::Time cache_last_modified,
   base::Closure task = base::Bind(&SimpleIndexFile::SyncLoadIndexEntries,
                                   cache_type_,
                                   cache_last_modified, cache_directory_,
-                                  index_file_, out_result);
+                                  index_file_, epoch_index_file_, out_result);
   worker_pool_->PostTaskAndReply(FROM_HERE, task, callback);
 }
 
@@ -282,14 +288,23 @@ void SimpleIndexFile::WriteToDisk(const SimpleIndex::EntrySet& entry_set,
                                   const base::Closure& callback) {
   IndexMetadata index_metadata(entry_set.size(), cache_size);
   scoped_ptr<Pickle> pickle = Serialize(index_metadata, entry_set);
+  scoped_ptr<SimpleIndexEpochFile::EntryArray> epoch_entries =
+      SimpleIndexEpochFile::BuildEntryArray(entry_set);
   base::Closure task =
       base::Bind(&SimpleIndexFile::SyncWriteToDisk,
                  cache_type_, cache_directory_, index_file_, temp_index_file_,
                  base::Passed(&pickle), start, app_on_background);
+  cache_thread_->PostTask(FROM_HERE, task);
+  // Refresh the crash-tolerant mirror with the same entry set. The cache
+  // thread runs tasks in order, so the mirror is written after the index
+  // file is in place and its directory exists.
+  base::Closure epoch_task =
+      base::Bind(&SimpleIndexEpochFile::SyncWriteEpoch,
+                 epoch_index_file_, cache_size, base::Passed(&epoch_entries));
   if (callback.is_null())
-    cache_thread_->PostTask(FROM_HERE, task);
+    cache_thread_->PostTask(FROM_HERE, epoch_task);
   else
-    cache_thread_->PostTaskAndReply(FROM_HERE, task, callback);
+    cache_thread_->PostTaskAndReply(FROM_HERE, epoch_task, callback);
 }
 
 // static
@@ -298,6 +313,7 @@ void SimpleIndexFile::SyncLoadIndexEntries(
     base::Time cache_last_modified,
     const base::FilePath& cache_directory,
     const base::FilePath& index_file_path,
+    const base::FilePath& epoch_index_file_path,
     SimpleIndexLoadResult* out_result) {
   // Load the index and find its age.
   base::Time last_cache_seen_by_index;
@@ -324,7 +340,19 @@ void SimpleIndexFile::SyncLoadIndexEntries(
     UmaRecordIndexFileState(INDEX_STATE_STALE, cache_type);
   }
 
-  // Reconstruct the index by scanning the disk for entries.
+  // Before falling back to the expensive directory scan, try the epoch
+  // mirror: it is overwritten in place and checksummed, so it usually
+  // survives the unclean shutdown that left the index stale or corrupt.
+  if (SimpleIndexEpochFile::SyncLoad(epoch_index_file_path, out_result)) {
+    SIMPLE_CACHE_UMA(COUNTS, "IndexEntriesRestored", cache_type,
+                     out_result->entries.size());
+    UmaRecordIndexInitMethod(INITIALIZE_METHOD_EPOCHS, cache_type);
+    return;
+  }
+
+  // Reconstruct the index by scanning the disk for entries. The epoch
+  // mirror was of no help, so drop it along with the index file.
+  simple_util::SimpleCacheDeleteFile(epoch_index_file_path);
   const base::TimeTicks start = base::TimeTicks::Now();
   SyncRestoreFromDisk(cache_directory, index_file_path, out_result);
   SIMPLE_CACHE_UMA(MEDIUM_TIMES, "IndexRestoreTime", cache_type,
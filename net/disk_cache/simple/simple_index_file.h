@@ -19,6 +19,7 @@
 #include "net/base/cache_type.h"
 #include "net/base/net_export.h"
 #include "net/disk_cache/simple/simple_index.h"
+#include "net/disk_cache/simple/simple_index_epoch_file.h"
 
 namespace base {
 class SingleThreadTaskRunner;
@@ -108,6 +109,7 @@ class NET_EXPORT_PRIVATE SimpleIndexFile {
                                    base::Time cache_last_modified,
                                    const base::FilePath& cache_directory,
                                    const base::FilePath& index_file_path,
+                                   const base::FilePath& epoch_index_file_path,
                                    SimpleIndexLoadResult* out_result);
 
   // Load the index file from disk returning an EntrySet.
@@ -176,10 +178,12 @@ class NET_EXPORT_PRIVATE SimpleIndexFile {
   const base::FilePath cache_directory_;
   const base::FilePath index_file_;
   const base::FilePath temp_index_file_;
+  const base::FilePath epoch_index_file_;
 
   static const char kIndexDirectory[];
   static const char kIndexFileName[];
   static const char kTempIndexFileName[];
+  static const char kEpochIndexFileName[];
 
   DISALLOW_COPY_AND_ASSIGN(SimpleIndexFile);
 };
@@ -21,6 +21,7 @@
 #include "net/disk_cache/simple/simple_backend_version.h"
 #include "net/disk_cache/simple/simple_entry_format.h"
 #include "net/disk_cache/simple/simple_index.h"
+#include "net/disk_cache/simple/simple_index_epoch_file.h"
 #include "net/disk_cache/simple/simple_index_file.h"
 #include "net/disk_cache/simple/simple_util.h"
 #include "net/disk_cache/simple/simple_version_upgrade.h"
@@ -85,6 +86,10 @@ class WrappedSimpleIndexFile : public SimpleIndexFile {
     return index_file_;
   }
 
+  const base::FilePath& GetEpochIndexFilePath() const {
+    return epoch_index_file_;
+  }
+
   bool CreateIndexFileDirectory() const {
     return base::CreateDirectory(index_file_.DirName());
   }
@@ -211,6 +216,85 @@ TEST_F(SimpleIndexFileTest, WriteThenLoadIndex) {
     EXPECT_EQ(1U, load_index_result.entries.count(kHashes[i]));
 }
 
+TEST_F(SimpleIndexFileTest, LoadEpochsWhenIndexIsLost) {
+  base::ScopedTempDir cache_dir;
+  ASSERT_TRUE(cache_dir.CreateUniqueTempDir());
+
+  SimpleIndex::EntrySet entries;
+  static const uint64 kHashes[] = { 11, 22, 33 };
+  static const size_t kNumHashes = arraysize(kHashes);
+  for (size_t i = 0; i < kNumHashes; ++i) {
+    uint64 hash = kHashes[i];
+    SimpleIndex::InsertInEntrySet(hash, EntryMetadata(Time(), hash), &entries);
+  }
+
+  net::TestClosure closure;
+  WrappedSimpleIndexFile simple_index_file(cache_dir.path());
+  simple_index_file.WriteToDisk(entries, 456U, base::TimeTicks(), false,
+                                closure.closure());
+  closure.WaitForResult();
+  EXPECT_TRUE(base::PathExists(simple_index_file.GetEpochIndexFilePath()));
+
+  // Lose the index file, as an unclean shutdown mid-write would. A directory
+  // rescan of this cache would find no entries; recovering the written ones
+  // proves they came from the epoch mirror.
+  ASSERT_TRUE(
+      base::DeleteFile(simple_index_file.GetIndexFilePath(), false));
+  base::Time fake_cache_mtime;
+  ASSERT_TRUE(simple_util::GetMTime(cache_dir.path(), &fake_cache_mtime));
+  SimpleIndexLoadResult load_index_result;
+  simple_index_file.LoadIndexEntries(fake_cache_mtime, closure.closure(),
+                                     &load_index_result);
+  closure.WaitForResult();
+
+  EXPECT_TRUE(load_index_result.did_load);
+  EXPECT_TRUE(load_index_result.flush_required);
+  EXPECT_EQ(kNumHashes, load_index_result.entries.size());
+  for (size_t i = 0; i < kNumHashes; ++i)
+    EXPECT_EQ(1U, load_index_result.entries.count(kHashes[i]));
+}
+
+TEST_F(SimpleIndexFileTest, EpochsSurviveTornWrite) {
+  base::ScopedTempDir cache_dir;
+  ASSERT_TRUE(cache_dir.CreateUniqueTempDir());
+  const base::FilePath epochs_path =
+      cache_dir.path().AppendASCII("index-epochs");
+
+  SimpleIndexLoadResult load_result;
+  EXPECT_FALSE(SimpleIndexEpochFile::SyncLoad(epochs_path, &load_result));
+
+  SimpleIndex::EntrySet old_entries;
+  SimpleIndex::InsertInEntrySet(11, EntryMetadata(Time(), 11), &old_entries);
+  SimpleIndexEpochFile::SyncWriteEpoch(
+      epochs_path, 456U, SimpleIndexEpochFile::BuildEntryArray(old_entries));
+
+  SimpleIndex::EntrySet new_entries;
+  SimpleIndex::InsertInEntrySet(22, EntryMetadata(Time(), 22), &new_entries);
+  SimpleIndex::InsertInEntrySet(33, EntryMetadata(Time(), 33), &new_entries);
+  SimpleIndexEpochFile::SyncWriteEpoch(
+      epochs_path, 456U, SimpleIndexEpochFile::BuildEntryArray(new_entries));
+
+  EXPECT_TRUE(SimpleIndexEpochFile::SyncLoad(epochs_path, &load_result));
+  EXPECT_EQ(2U, load_result.entries.size());
+  EXPECT_EQ(1U, load_result.entries.count(22));
+
+  // Flip a byte in the second epoch, which the second write targeted. Its
+  // checksums no longer match, so the load must fall back to the first one.
+  std::string contents;
+  ASSERT_TRUE(base::ReadFileToString(epochs_path, &contents));
+  const size_t second_epoch_offset = 24 + (contents.size() - 24) / 2;
+  ASSERT_LT(second_epoch_offset, contents.size());
+  contents[second_epoch_offset] ^= 0xff;
+  ASSERT_EQ(implicit_cast<int>(contents.size()),
+            base::WriteFile(epochs_path, contents.data(), contents.size()));
+
+  EXPECT_TRUE(SimpleIndexEpochFile::SyncLoad(epochs_path, &load_result));
+  EXPECT_TRUE(load_result.did_load);
+  EXPECT_TRUE(load_result.flush_required);
+  EXPECT_EQ(1U, load_result.entries.size());
+  EXPECT_EQ(1U, load_result.entries.count(11));
+}
+
 TEST_F(SimpleIndexFileTest, LoadCorruptIndex) {
   base::ScopedTempDir cache_dir;
   ASSERT_TRUE(cache_dir.CreateUniqueTempDir());
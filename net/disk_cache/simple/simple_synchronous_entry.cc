@@ -110,6 +110,32 @@ bool CanOmitEmptyFile(int file_index) {
   return file_index == disk_cache::simple_util::GetFileIndexFromStreamIndex(2);
 }
 
+// Deflates the |data_size| bytes at |data| into |*out_deflated|, prefixed
+// with a uint32 holding the inflated size. Returns false (leaving
+// |*out_deflated| in an unspecified state) if storing the stream deflated
+// would not save any space.
+bool DeflateStream0Data(const char* data,
+                        int data_size,
+                        std::vector<char>* out_deflated) {
+  if (data_size <= static_cast<int>(sizeof(uint32)))
+    return false;
+  uLongf deflated_size = compressBound(data_size);
+  out_deflated->resize(sizeof(uint32) + deflated_size);
+  if (compress2(reinterpret_cast<Bytef*>(&(*out_deflated)[sizeof(uint32)]),
+                &deflated_size,
+                reinterpret_cast<const Bytef*>(data),
+                data_size,
+                Z_DEFAULT_COMPRESSION) != Z_OK) {
+    return false;
+  }
+  if (sizeof(uint32) + deflated_size >= static_cast<size_t>(data_size))
+    return false;
+  const uint32 inflated_size = data_size;
+  memcpy(&(*out_deflated)[0], &inflated_size, sizeof(inflated_size));
+  out_deflated->resize(sizeof(uint32) + deflated_size);
+  return true;
+}
+
 }  // namespace
 
 namespace disk_cache {
@@ -598,9 +624,10 @@ void SimpleSynchronousEntry::CheckEOFRecord(int index,
   DCHECK(initialized_);
   uint32 crc32;
   bool has_crc32;
+  bool data_deflated;
   int stream_size;
-  *out_result =
-      GetEOFRecordData(index, entry_stat, &has_crc32, &crc32, &stream_size);
+  *out_result = GetEOFRecordData(
+      index, entry_stat, &has_crc32, &data_deflated, &crc32, &stream_size);
   if (*out_result != net::OK) {
     Doom();
     return;
@@ -620,41 +647,87 @@ void SimpleSynchronousEntry::Close(
     scoped_ptr<std::vector<CRCRecord> > crc32s_to_write,
     net::GrowableIOBuffer* stream_0_data) {
   DCHECK(stream_0_data);
+
+  // Stream 0 is read and written as a whole, so it can be stored deflated
+  // without the rest of the cache having to know. HTTP response metadata
+  // typically deflates to around half its size, which adds up over a large
+  // cache.
+  const char* stream_0_to_write = stream_0_data->data();
+  int stream_0_write_size = entry_stat.data_size(0);
+  std::vector<char> deflated_stream_0;
+  const bool stream_0_deflated = DeflateStream0Data(
+      stream_0_data->data(), entry_stat.data_size(0), &deflated_stream_0);
+  if (stream_0_deflated) {
+    stream_0_to_write = &deflated_stream_0[0];
+    stream_0_write_size = static_cast<int>(deflated_stream_0.size());
+  }
+
+  // The offsets of stream 0 and of its EOF record depend on the size that is
+  // actually stored on disk.
+  SimpleEntryStat on_disk_entry_stat(entry_stat);
+  on_disk_entry_stat.set_data_size(0, stream_0_write_size);
+
   // Write stream 0 data.
-  int stream_0_offset = entry_stat.GetOffsetInFile(key_, 0, 0);
-  if (files_[0].Write(stream_0_offset, stream_0_data->data(),
-                      entry_stat.data_size(0)) !=
-      entry_stat.data_size(0)) {
+  int stream_0_offset = on_disk_entry_stat.GetOffsetInFile(key_, 0, 0);
+  if (files_[0].Write(stream_0_offset, stream_0_to_write,
+                      stream_0_write_size) != stream_0_write_size) {
     RecordCloseResult(cache_type_, CLOSE_RESULT_WRITE_FAILURE);
     DVLOG(1) << "Could not write stream 0 data.";
     Doom();
   }
 
+  // The EOF record for stream 0 locates the stream within the file, and the
+  // stored size can differ from |entry_stat|'s whenever the stream deflates,
+  // so the record is rewritten on every close whether or not the stream was
+  // modified. The CRC covers the bytes as stored.
+  {
+    SimpleFileEOF eof_record;
+    eof_record.final_magic_number = kSimpleFinalMagicNumber;
+    eof_record.flags = SimpleFileEOF::FLAG_HAS_CRC32;
+    if (stream_0_deflated)
+      eof_record.flags |= SimpleFileEOF::FLAG_DATA_DEFLATED;
+    eof_record.stream_size = stream_0_write_size;
+    eof_record.data_crc32 =
+        stream_0_write_size == 0
+            ? crc32(0, Z_NULL, 0)
+            : crc32(crc32(0, Z_NULL, 0),
+                    reinterpret_cast<const Bytef*>(stream_0_to_write),
+                    stream_0_write_size);
+    int eof_offset = on_disk_entry_stat.GetEOFOffsetInFile(key_, 0);
+    // If stream 0 changed size, the file needs to be resized, otherwise the
+    // next open will yield wrong stream sizes. On stream 1 and stream 2 proper
+    // resizing of the file is handled in SimpleSynchronousEntry::WriteData().
+    if (!files_[0].SetLength(eof_offset)) {
+      RecordCloseResult(cache_type_, CLOSE_RESULT_WRITE_FAILURE);
+      DVLOG(1) << "Could not truncate stream 0 file.";
+      Doom();
+    } else if (files_[0].Write(eof_offset,
+                               reinterpret_cast<const char*>(&eof_record),
+                               sizeof(eof_record)) !=
+               sizeof(eof_record)) {
+      RecordCloseResult(cache_type_, CLOSE_RESULT_WRITE_FAILURE);
+      DVLOG(1) << "Could not write stream 0 eof record.";
+      Doom();
+    }
+  }
+
   for (std::vector<CRCRecord>::const_iterator it = crc32s_to_write->begin();
        it != crc32s_to_write->end(); ++it) {
     const int stream_index = it->index;
+    if (stream_index == 0)
+      continue;  // The EOF record for stream 0 was written above.
     const int file_index = GetFileIndexFromStreamIndex(stream_index);
     if (empty_file_omitted_[file_index])
       continue;
 
     SimpleFileEOF eof_record;
-    eof_record.stream_size = entry_stat.data_size(stream_index);
+    eof_record.stream_size = on_disk_entry_stat.data_size(stream_index);
     eof_record.final_magic_number = kSimpleFinalMagicNumber;
     eof_record.flags = 0;
     if (it->has_crc32)
       eof_record.flags |= SimpleFileEOF::FLAG_HAS_CRC32;
     eof_record.data_crc32 = it->data_crc32;
-    int eof_offset = entry_stat.GetEOFOffsetInFile(key_, stream_index);
-    // If stream 0 changed size, the file needs to be resized, otherwise the
-    // next open will yield wrong stream sizes. On stream 1 and stream 2 proper
-    // resizing of the file is handled in SimpleSynchronousEntry::WriteData().
-    if (stream_index == 0 &&
-        !files_[file_index].SetLength(eof_offset)) {
-      RecordCloseResult(cache_type_, CLOSE_RESULT_WRITE_FAILURE);
-      DVLOG(1) << "Could not truncate stream 0 file.";
-      Doom();
-      break;
-    }
+    int eof_offset = on_disk_entry_stat.GetEOFOffsetInFile(key_, stream_index);
     if (files_[file_index].Write(eof_offset,
                                  reinterpret_cast<const char*>(&eof_record),
                                  sizeof(eof_record)) !=
@@ -670,7 +743,7 @@ void SimpleSynchronousEntry::Close(
       continue;
 
     files_[i].Close();
-    const int64 file_size = entry_stat.GetFileSize(key_, i);
+    const int64 file_size = on_disk_entry_stat.GetFileSize(key_, i);
     SIMPLE_CACHE_UMA(CUSTOM_COUNTS,
                      "LastClusterSize", cache_type_,
                      file_size % 4096, 0, 4097, 50);
@@ -1005,17 +1078,18 @@ bool SimpleSynchronousEntry::InitializeCreatedFile(
   header.key_length = key_.size();
   header.key_hash = base::Hash(key_);
 
-  int bytes_written = files_[file_index].Write(
-      0, reinterpret_cast<char*>(&header), sizeof(header));
-  if (bytes_written != sizeof(header)) {
-    *out_result = CREATE_ENTRY_CANT_WRITE_HEADER;
-    return false;
-  }
-
-  bytes_written = files_[file_index].Write(sizeof(header), key_.data(),
-                                           key_.size());
-  if (bytes_written != implicit_cast<int>(key_.size())) {
-    *out_result = CREATE_ENTRY_CANT_WRITE_KEY;
+  // Write the header and the key with one gathered write.
+  base::File::ConstMemoryRange ranges[2];
+  ranges[0].data = reinterpret_cast<const char*>(&header);
+  ranges[0].size = sizeof(header);
+  ranges[1].data = key_.data();
+  ranges[1].size = key_.size();
+  int bytes_written =
+      files_[file_index].WriteGather(0, ranges, arraysize(ranges));
+  if (bytes_written != implicit_cast<int>(sizeof(header) + key_.size())) {
+    *out_result = bytes_written < implicit_cast<int>(sizeof(header))
+                      ? CREATE_ENTRY_CANT_WRITE_HEADER
+                      : CREATE_ENTRY_CANT_WRITE_KEY;
     return false;
   }
 
@@ -1056,10 +1130,12 @@ int SimpleSynchronousEntry::ReadAndValidateStream0(
   out_entry_stat->set_data_size(1, total_data_size - sizeof(SimpleFileEOF));
 
   bool has_crc32;
+  bool data_deflated;
   uint32 read_crc32;
   int stream_0_size;
   int ret_value_crc32 = GetEOFRecordData(
-      0, *out_entry_stat, &has_crc32, &read_crc32, &stream_0_size);
+      0, *out_entry_stat, &has_crc32, &data_deflated, &read_crc32,
+      &stream_0_size);
   if (ret_value_crc32 != net::OK)
     return ret_value_crc32;
 
@@ -1094,6 +1170,38 @@ int SimpleSynchronousEntry::ReadAndValidateStream0(
     return net::ERR_FAILED;
   }
   *out_stream_0_crc32 = expected_crc32;
+
+  if (data_deflated) {
+    // The stream was stored deflated, prefixed with its inflated size.
+    // Replace the stored bytes with the inflated stream, and report the CRC
+    // of the inflated bytes, which is what the stream holds from here on.
+    if (stream_0_size < static_cast<int>(sizeof(uint32)))
+      return net::ERR_FAILED;
+    uint32 inflated_size;
+    memcpy(&inflated_size, (*stream_0_data)->data(), sizeof(inflated_size));
+    if (static_cast<int32>(inflated_size) < 0)
+      return net::ERR_FAILED;
+    scoped_refptr<net::GrowableIOBuffer> inflated_data =
+        new net::GrowableIOBuffer();
+    inflated_data->SetCapacity(inflated_size);
+    uLongf inflated_written = inflated_size;
+    if (uncompress(reinterpret_cast<Bytef*>(inflated_data->data()),
+                   &inflated_written,
+                   reinterpret_cast<const Bytef*>((*stream_0_data)->data() +
+                                                  sizeof(uint32)),
+                   stream_0_size - sizeof(uint32)) != Z_OK ||
+        inflated_written != inflated_size) {
+      DVLOG(1) << "Could not inflate stream 0.";
+      return net::ERR_FAILED;
+    }
+    *stream_0_data = inflated_data;
+    out_entry_stat->set_data_size(0, inflated_size);
+    *out_stream_0_crc32 =
+        crc32(crc32(0, Z_NULL, 0),
+              reinterpret_cast<const Bytef*>(inflated_data->data()),
+              inflated_size);
+  }
+
   RecordCheckEOFResult(cache_type_, CHECK_EOF_RESULT_SUCCESS);
   return net::OK;
 }
@@ -1101,6 +1209,7 @@ int SimpleSynchronousEntry::ReadAndValidateStream0(
 int SimpleSynchronousEntry::GetEOFRecordData(int index,
                                              const SimpleEntryStat& entry_stat,
                                              bool* out_has_crc32,
+                                             bool* out_data_deflated,
                                              uint32* out_crc32,
                                              int* out_data_size) const {
   SimpleFileEOF eof_record;
@@ -1122,6 +1231,8 @@ int SimpleSynchronousEntry::GetEOFRecordData(int index,
 
   *out_has_crc32 = (eof_record.flags & SimpleFileEOF::FLAG_HAS_CRC32) ==
                    SimpleFileEOF::FLAG_HAS_CRC32;
+  *out_data_deflated = (eof_record.flags & SimpleFileEOF::FLAG_DATA_DEFLATED) ==
+                       SimpleFileEOF::FLAG_DATA_DEFLATED;
   *out_crc32 = eof_record.data_crc32;
   *out_data_size = eof_record.stream_size;
   SIMPLE_CACHE_UMA(BOOLEAN, "SyncCheckEOFHasCrc", cache_type_, *out_has_crc32);
@@ -1406,22 +1517,21 @@ bool SimpleSynchronousEntry::AppendSparseRange(int64 offset,
   header.length = len;
   header.data_crc32 = data_crc32;
 
-  int bytes_written = sparse_file_.Write(sparse_tail_offset_,
-                                         reinterpret_cast<char*>(&header),
-                                         sizeof(header));
-  if (bytes_written != implicit_cast<int>(sizeof(header))) {
-    DLOG(WARNING) << "Could not append sparse range header.";
-    return false;
-  }
-  sparse_tail_offset_ += bytes_written;
-
-  bytes_written = sparse_file_.Write(sparse_tail_offset_, buf, len);
-  if (bytes_written < len) {
-    DLOG(WARNING) << "Could not append sparse range data.";
+  // Append the range header and its data with one gathered write.
+  base::File::ConstMemoryRange ranges[2];
+  ranges[0].data = reinterpret_cast<const char*>(&header);
+  ranges[0].size = sizeof(header);
+  ranges[1].data = buf;
+  ranges[1].size = len;
+  int bytes_written =
+      sparse_file_.WriteGather(sparse_tail_offset_, ranges, arraysize(ranges));
+  if (bytes_written != implicit_cast<int>(sizeof(header)) + len) {
+    DLOG(WARNING) << "Could not append sparse range.";
     return false;
   }
+  sparse_tail_offset_ += sizeof(header);
   int64 data_file_offset = sparse_tail_offset_;
-  sparse_tail_offset_ += bytes_written;
+  sparse_tail_offset_ += len;
 
   SparseRange range;
   range.offset = offset;
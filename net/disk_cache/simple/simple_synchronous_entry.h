@@ -257,6 +257,7 @@ class SimpleSynchronousEntry {
   int GetEOFRecordData(int index,
                        const SimpleEntryStat& entry_stat,
                        bool* out_has_crc32,
+                       bool* out_data_deflated,
                        uint32* out_crc32,
                        int* out_data_size) const;
   void Doom() const;
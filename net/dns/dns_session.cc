@@ -74,10 +74,13 @@ DnsSession::RttBuckets::RttBuckets() : base::BucketRanges(kRTTBucketCount + 1) {
 DnsSession::SocketLease::SocketLease(scoped_refptr<DnsSession> session,
                                      unsigned server_index,
                                      scoped_ptr<DatagramClientSocket> socket)
-    : session_(session), server_index_(server_index), socket_(socket.Pass()) {}
+    : session_(session),
+      server_index_(server_index),
+      socket_(socket.Pass()),
+      exchange_complete_(false) {}
 
 DnsSession::SocketLease::~SocketLease() {
-  session_->FreeSocket(server_index_, socket_.Pass());
+  session_->FreeSocket(server_index_, socket_.Pass(), exchange_complete_);
 }
 
 DnsSession::DnsSession(const DnsConfig& config,
@@ -244,12 +247,13 @@ scoped_ptr<StreamSocket> DnsSession::CreateTCPSocket(
 
 // Release a socket.
 void DnsSession::FreeSocket(unsigned server_index,
-                            scoped_ptr<DatagramClientSocket> socket) {
+                            scoped_ptr<DatagramClientSocket> socket,
+                            bool exchange_complete) {
   DCHECK(socket.get());
 
   socket->NetLog().EndEvent(NetLog::TYPE_SOCKET_IN_USE);
 
-  socket_pool_->FreeSocket(server_index, socket.Pass());
+  socket_pool_->FreeSocket(server_index, socket.Pass(), exchange_complete);
 }
 
 base::TimeDelta DnsSession::NextTimeoutFromJacobson(unsigned server_index,
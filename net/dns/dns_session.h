@@ -49,10 +49,16 @@ class NET_EXPORT_PRIVATE DnsSession
 
     DatagramClientSocket* socket() { return socket_.get(); }
 
+    // Marks the last exchange on the socket as completed: a matching
+    // response was read, so no stray datagram for it can arrive later and
+    // the socket pool may reuse the socket.
+    void MarkExchangeComplete() { exchange_complete_ = true; }
+
    private:
     scoped_refptr<DnsSession> session_;
     unsigned server_index_;
     scoped_ptr<DatagramClientSocket> socket_;
+    bool exchange_complete_;
 
     DISALLOW_COPY_AND_ASSIGN(SocketLease);
   };
@@ -112,7 +118,8 @@ class NET_EXPORT_PRIVATE DnsSession
 
   // Release a socket.
   void FreeSocket(unsigned server_index,
-                  scoped_ptr<DatagramClientSocket> socket);
+                  scoped_ptr<DatagramClientSocket> socket,
+                  bool exchange_complete);
 
   // Return the timeout using the TCP timeout method.
   base::TimeDelta NextTimeoutFromJacobson(unsigned server_index, int attempt);
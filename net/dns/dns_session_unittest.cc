@@ -101,7 +101,8 @@ class MockDnsSocketPool : public DnsSocketPool {
   }
 
   void FreeSocket(unsigned server_index,
-                  scoped_ptr<DatagramClientSocket> socket) override {
+                  scoped_ptr<DatagramClientSocket> socket,
+                  bool exchange_complete) override {
     test_->OnSocketFreed(server_index);
   }
 
@@ -21,19 +21,27 @@ namespace {
 
 // When we initialize the SocketPool, we allocate kInitialPoolSize sockets.
 // When we allocate a socket, we ensure we have at least kAllocateMinSize
-// sockets to choose from.  Freed sockets are not retained.
+// sockets to choose from.  Freed sockets whose last exchange completed are
+// retained for reuse, up to kMaxRetainedSockets per server.
 
 // On Windows, we can't request specific (random) ports, since that will
 // trigger firewall prompts, so request default ones, but keep a pile of
-// them.  Everywhere else, request fresh, random ports each time.
+// them.  Since per-query unpredictability comes from picking at random out
+// of that pile, reuse preserves it, and retaining freed sockets spares a
+// fresh socket() and Connect() per query.  Everywhere else, request fresh,
+// random ports each time; retaining sockets there would pin later queries
+// to ports an off-path attacker may have already observed, so freed sockets
+// are discarded.
 #if defined(OS_WIN)
 const DatagramSocket::BindType kBindType = DatagramSocket::DEFAULT_BIND;
 const unsigned kInitialPoolSize = 256;
 const unsigned kAllocateMinSize = 256;
+const unsigned kMaxRetainedSockets = 256;
 #else
 const DatagramSocket::BindType kBindType = DatagramSocket::RANDOM_BIND;
 const unsigned kInitialPoolSize = 0;
 const unsigned kAllocateMinSize = 1;
+const unsigned kMaxRetainedSockets = 0;
 #endif
 
 } // namespace
@@ -106,7 +114,8 @@ class NullDnsSocketPool : public DnsSocketPool {
   }
 
   void FreeSocket(unsigned server_index,
-                  scoped_ptr<DatagramClientSocket> socket) override {}
+                  scoped_ptr<DatagramClientSocket> socket,
+                  bool exchange_complete) override {}
 
  private:
   DISALLOW_COPY_AND_ASSIGN(NullDnsSocketPool);
@@ -133,7 +142,8 @@ class DefaultDnsSocketPool : public DnsSocketPool {
       unsigned server_index) override;
 
   void FreeSocket(unsigned server_index,
-                  scoped_ptr<DatagramClientSocket> socket) override;
+                  scoped_ptr<DatagramClientSocket> socket,
+                  bool exchange_complete) override;
 
  private:
   void FillPool(unsigned server_index, unsigned size);
@@ -198,8 +208,14 @@ scoped_ptr<DatagramClientSocket> DefaultDnsSocketPool::AllocateSocket(
 
 void DefaultDnsSocketPool::FreeSocket(
     unsigned server_index,
-    scoped_ptr<DatagramClientSocket> socket) {
+    scoped_ptr<DatagramClientSocket> socket,
+    bool exchange_complete) {
   DCHECK_LT(server_index, pools_.size());
+
+  // See the comment on kMaxRetainedSockets above for when retention is safe.
+  SocketVector& pool = pools_[server_index];
+  if (exchange_complete && pool.size() < kMaxRetainedSockets)
+    pool.push_back(socket.release());
 }
 
 void DefaultDnsSocketPool::FillPool(unsigned server_index, unsigned size) {
@@ -56,10 +56,13 @@ class NET_EXPORT_PRIVATE DnsSocketPool {
       unsigned server_index) = 0;
 
   // Frees a socket allocated by AllocateSocket.  |server_index| must be the
-  // same index passed to AllocateSocket.
+  // same index passed to AllocateSocket.  |exchange_complete| is true if the
+  // last query on the socket read a matching response, so no stray datagram
+  // for it can arrive later; only such sockets may be handed out again.
   virtual void FreeSocket(
       unsigned server_index,
-      scoped_ptr<DatagramClientSocket> socket) = 0;
+      scoped_ptr<DatagramClientSocket> socket,
+      bool exchange_complete) = 0;
 
   // Creates a StreamSocket from the factory for a transaction over TCP. These
   // sockets are not pooled.
@@ -260,6 +260,9 @@ class DnsUDPAttempt : public DnsAttempt {
       next_state_ = STATE_READ_RESPONSE;
       return OK;
     }
+    // The response matches the query, so nothing more will arrive on this
+    // socket for it and the socket can safely be handed out again.
+    socket_lease_->MarkExchangeComplete();
     if (response_->flags() & dns_protocol::kFlagTC)
       return ERR_DNS_SERVER_REQUIRES_TCP;
     // TODO(szym): Extract TTL for NXDOMAIN results. http://crbug.com/115051
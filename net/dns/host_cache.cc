@@ -4,14 +4,36 @@
 
 #include "net/dns/host_cache.h"
 
+#include <algorithm>
+
 #include "base/logging.h"
 #include "base/metrics/field_trial.h"
 #include "base/metrics/histogram.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/values.h"
 #include "net/base/net_errors.h"
+#include "net/base/net_util.h"
 
 namespace net {
 
+namespace {
+
+// Upper bound on the time to live given to a restored cache entry. The wall
+// clock may have moved arbitrarily between sessions, so entries loaded from
+// disk are only trusted briefly; a fresh resolution replaces them as soon as
+// the clamped TTL runs out.
+const int kPersistedEntryTTLClampSeconds = 60;
+
+// Dictionary keys for a serialized cache entry.
+const char kHostnameKey[] = "hostname";
+const char kAddressFamilyKey[] = "address_family";
+const char kFlagsKey[] = "flags";
+const char kErrorKey[] = "error";
+const char kAddressesKey[] = "addresses";
+const char kExpirationKey[] = "expiration";
+
+}  // namespace
+
 //-----------------------------------------------------------------------------
 
 HostCache::Entry::Entry(int error, const AddressList& addrlist,
@@ -65,6 +87,103 @@ void HostCache::clear() {
   entries_.Clear();
 }
 
+void HostCache::GetAsListValue(base::ListValue* entry_list,
+                               base::TimeTicks now) const {
+  DCHECK(CalledOnValidThread());
+  DCHECK(entry_list);
+
+  // Expirations are persisted in wall-clock time, since TimeTicks do not
+  // survive a restart.
+  base::Time now_time = base::Time::Now();
+  for (EntryMap::Iterator it(entries_); it.HasNext(); it.Advance()) {
+    if (it.expiration() <= now)
+      continue;
+
+    base::DictionaryValue* entry_dict = new base::DictionaryValue();
+    entry_dict->SetString(kHostnameKey, it.key().hostname);
+    entry_dict->SetInteger(kAddressFamilyKey,
+                           static_cast<int>(it.key().address_family));
+    entry_dict->SetInteger(kFlagsKey, it.key().host_resolver_flags);
+    entry_dict->SetInteger(kErrorKey, it.value().error);
+    entry_dict->SetString(
+        kExpirationKey,
+        base::Int64ToString(
+            (now_time + (it.expiration() - now)).ToInternalValue()));
+
+    base::ListValue* address_list = new base::ListValue();
+    const AddressList& addresses = it.value().addrlist;
+    for (size_t i = 0; i < addresses.size(); ++i)
+      address_list->AppendString(addresses[i].ToStringWithoutPort());
+    entry_dict->Set(kAddressesKey, address_list);
+
+    entry_list->Append(entry_dict);
+  }
+}
+
+bool HostCache::RestoreFromListValue(const base::ListValue& old_cache) {
+  DCHECK(CalledOnValidThread());
+  if (caching_is_disabled())
+    return true;
+
+  base::TimeTicks now = base::TimeTicks::Now();
+  base::Time now_time = base::Time::Now();
+  for (size_t i = 0; i < old_cache.GetSize(); ++i) {
+    const base::DictionaryValue* entry_dict;
+    if (!old_cache.GetDictionary(i, &entry_dict))
+      return false;
+
+    std::string hostname;
+    int address_family;
+    int flags;
+    int error;
+    std::string expiration;
+    const base::ListValue* address_list;
+    if (!entry_dict->GetString(kHostnameKey, &hostname) ||
+        !entry_dict->GetInteger(kAddressFamilyKey, &address_family) ||
+        !entry_dict->GetInteger(kFlagsKey, &flags) ||
+        !entry_dict->GetInteger(kErrorKey, &error) ||
+        !entry_dict->GetString(kExpirationKey, &expiration) ||
+        !entry_dict->GetList(kAddressesKey, &address_list)) {
+      return false;
+    }
+
+    int64 expiration_int64;
+    if (!base::StringToInt64(expiration, &expiration_int64))
+      return false;
+    base::TimeDelta remaining_ttl =
+        base::Time::FromInternalValue(expiration_int64) - now_time;
+    if (remaining_ttl <= base::TimeDelta())
+      continue;
+    remaining_ttl = std::min(
+        remaining_ttl,
+        base::TimeDelta::FromSeconds(kPersistedEntryTTLClampSeconds));
+
+    AddressList addresses;
+    bool malformed_address = false;
+    for (size_t j = 0; j < address_list->GetSize(); ++j) {
+      std::string address;
+      IPAddressNumber ip_number;
+      if (!address_list->GetString(j, &address) ||
+          !ParseIPLiteralToNumber(address, &ip_number)) {
+        malformed_address = true;
+        break;
+      }
+      // The cached port is irrelevant; lookups fix up the port to match the
+      // request.
+      addresses.push_back(IPEndPoint(ip_number, 0));
+    }
+    if (malformed_address)
+      return false;
+
+    Key key(hostname, static_cast<AddressFamily>(address_family), flags);
+    // A resolution made this session always beats a persisted one.
+    if (entries_.Get(key, now))
+      continue;
+    entries_.Put(key, Entry(error, addresses), now, now + remaining_ttl);
+  }
+  return true;
+}
+
 size_t HostCache::size() const {
   DCHECK(CalledOnValidThread());
   return entries_.size();
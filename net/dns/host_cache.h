@@ -17,6 +17,10 @@
 #include "net/base/expiring_cache.h"
 #include "net/base/net_export.h"
 
+namespace base {
+class ListValue;
+}
+
 namespace net {
 
 // Cache used by HostResolver to map hostnames to their resolved result.
@@ -93,6 +97,18 @@ class NET_EXPORT HostCache : NON_EXPORTED_BASE(public base::NonThreadSafe) {
   // Empties the cache
   void clear();
 
+  // Appends a serialized representation of each unexpired entry to
+  // |entry_list|, suitable for persisting the cache across sessions with
+  // RestoreFromListValue().
+  void GetAsListValue(base::ListValue* entry_list, base::TimeTicks now) const;
+
+  // Repopulates the cache from entries written by GetAsListValue() in an
+  // earlier session. Entries whose persisted expiration has already passed
+  // are dropped, and the remaining time to live is clamped; existing cache
+  // entries are never overwritten. Returns false if |old_cache| is
+  // malformed, in which case entries restored up to that point are kept.
+  bool RestoreFromListValue(const base::ListValue& old_cache);
+
   // Returns the number of entries in the cache.
   size_t size() const;
 
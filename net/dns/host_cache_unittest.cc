@@ -8,7 +8,9 @@
 #include "base/stl_util.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
+#include "base/values.h"
 #include "net/base/net_errors.h"
+#include "net/base/net_util.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace net {
@@ -296,6 +298,62 @@ TEST(HostCacheTest, Clear) {
   EXPECT_EQ(0u, cache.size());
 }
 
+TEST(HostCacheTest, SerializeAndRestore) {
+  const base::TimeDelta kTTL = base::TimeDelta::FromSeconds(10);
+
+  HostCache cache(kMaxCacheEntries);
+
+  // The serialized expiration is computed against the wall clock, so these
+  // tests must use the real tick count rather than t=0.
+  base::TimeTicks now = base::TimeTicks::Now();
+
+  IPAddressNumber ip_number;
+  ASSERT_TRUE(ParseIPLiteralToNumber("192.168.1.1", &ip_number));
+  AddressList addresses;
+  addresses.push_back(IPEndPoint(ip_number, 0));
+
+  cache.Set(Key("foobar.com"), HostCache::Entry(OK, addresses), now, kTTL);
+  cache.Set(Key("foobar2.com"), HostCache::Entry(OK, AddressList()), now,
+            kTTL);
+
+  base::ListValue serialized_cache;
+  cache.GetAsListValue(&serialized_cache, now);
+  EXPECT_EQ(2u, serialized_cache.GetSize());
+
+  // An entry resolved in the restoring session must not be clobbered.
+  HostCache restored_cache(kMaxCacheEntries);
+  IPAddressNumber fresher_ip_number;
+  ASSERT_TRUE(ParseIPLiteralToNumber("192.168.1.2", &fresher_ip_number));
+  AddressList fresher_addresses;
+  fresher_addresses.push_back(IPEndPoint(fresher_ip_number, 0));
+  restored_cache.Set(Key("foobar.com"),
+                     HostCache::Entry(OK, fresher_addresses), now, kTTL);
+
+  EXPECT_TRUE(restored_cache.RestoreFromListValue(serialized_cache));
+  EXPECT_EQ(2u, restored_cache.size());
+
+  now = base::TimeTicks::Now();
+  const HostCache::Entry* entry = restored_cache.Lookup(Key("foobar.com"),
+                                                        now);
+  ASSERT_TRUE(entry);
+  ASSERT_EQ(1u, entry->addrlist.size());
+  EXPECT_EQ("192.168.1.2", entry->addrlist.front().ToStringWithoutPort());
+
+  entry = restored_cache.Lookup(Key("foobar2.com"), now);
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(OK, entry->error);
+  EXPECT_TRUE(entry->addrlist.empty());
+}
+
+TEST(HostCacheTest, RestoreRejectsMalformedEntries) {
+  HostCache cache(kMaxCacheEntries);
+
+  base::ListValue serialized_cache;
+  serialized_cache.AppendString("not a dictionary");
+  EXPECT_FALSE(cache.RestoreFromListValue(serialized_cache));
+  EXPECT_EQ(0u, cache.size());
+}
+
 // Tests the less than and equal operators for HostCache::Key work.
 TEST(HostCacheTest, KeyComparators) {
   struct {
@@ -65,8 +65,11 @@ const size_t kMaxHostLength = 4096;
 // Default TTL for successful resolutions with ProcTask.
 const unsigned kCacheEntryTTLSeconds = 60;
 
-// Default TTL for unsuccessful resolutions with ProcTask.
-const unsigned kNegativeCacheEntryTTLSeconds = 0;
+// Default TTL for unsuccessful resolutions with ProcTask. Short, but long
+// enough that a burst of lookups for the same missing name (e.g. generated
+// by filtered subresources on one page load) is served by the cache instead
+// of each allocating a Job and a getaddrinfo call.
+const unsigned kNegativeCacheEntryTTLSeconds = 5;
 
 // Minimum TTL for successful resolutions with DnsTask.
 const unsigned kMinimumTTLSeconds = kCacheEntryTTLSeconds;
@@ -24,7 +24,9 @@
 #include "net/filter/filter.h"
 
 #include "base/files/file_path.h"
+#include "base/lazy_instance.h"
 #include "base/strings/string_util.h"
+#include "base/threading/thread_local_storage.h"
 #include "net/base/filename_util_unsafe.h"
 #include "net/base/io_buffer.h"
 #include "net/base/mime_util.h"
@@ -56,6 +58,80 @@ const char kTextHtml[]             = "text/html";
 // Buffer size allocated when de-compressing data.
 const int kFilterBufSize = 32 * 1024;
 
+// Stream buffers are all allocated at kFilterBufSize and torn down with the
+// filter chain after every response, so the allocator is paid a 32K
+// round-trip per filter per response. Like the inflate contexts in
+// gzip_filter.cc, idle buffers are parked on a per-thread free list between
+// responses instead.
+const size_t kMaxFreeStreamBuffers = 4;
+
+class StreamBufferPool {
+ public:
+  // Returns a buffer of kFilterBufSize, reusing a parked one if available.
+  scoped_refptr<IOBuffer> Acquire() {
+    FreeList* free_list = GetFreeList();
+    if (!free_list->empty()) {
+      scoped_refptr<IOBuffer> buffer = free_list->back();
+      free_list->pop_back();
+      return buffer;
+    }
+    return new IOBuffer(kFilterBufSize);
+  }
+
+  // Parks the buffer held in |*buffer|, clearing |*buffer|. Buffers that a
+  // caller still holds a reference to (the filter owner may retain the
+  // stream buffer past the filter's lifetime) are left to die normally
+  // rather than be handed out again.
+  void Release(scoped_refptr<IOBuffer>* buffer) {
+    scoped_refptr<IOBuffer> doomed;
+    doomed.swap(*buffer);
+    if (!doomed->HasOneRef())
+      return;
+    FreeList* free_list = GetFreeList();
+    if (free_list->size() < kMaxFreeStreamBuffers)
+      free_list->push_back(doomed);
+  }
+
+ private:
+  friend struct base::DefaultLazyInstanceTraits<StreamBufferPool>;
+
+  typedef std::vector<scoped_refptr<IOBuffer> > FreeList;
+
+  StreamBufferPool() {
+    tls_index_.Initialize(ReleaseFreeList);
+  }
+
+  ~StreamBufferPool() {
+    NOTREACHED();  // LeakyLazyInstance is not destructed.
+  }
+
+  FreeList* GetFreeList() const {
+    FreeList* free_list = static_cast<FreeList*>(tls_index_.Get());
+    if (!free_list) {
+      free_list = new FreeList;
+      tls_index_.Set(free_list);
+    }
+    return free_list;
+  }
+
+  // Called per-thread, at thread death, to release that thread's buffers.
+  static void ReleaseFreeList(void* value) {
+    delete static_cast<FreeList*>(value);
+  }
+
+  // A TLS slot to the FreeList of the current thread.
+  static base::ThreadLocalStorage::StaticSlot tls_index_;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamBufferPool);
+};
+
+// static
+base::ThreadLocalStorage::StaticSlot StreamBufferPool::tls_index_ =
+    TLS_INITIALIZER;
+
+base::LazyInstance<StreamBufferPool>::Leaky g_stream_buffer_pool =
+    LAZY_INSTANCE_INITIALIZER;
+
 void LogSdchProblem(const FilterContext& filter_context,
                     SdchProblemCode problem) {
   SdchManager::SdchErrorRecovery(problem);
@@ -87,7 +163,10 @@ std::string FilterTypeAsString(Filter::FilterType type_id) {
 FilterContext::~FilterContext() {
 }
 
-Filter::~Filter() {}
+Filter::~Filter() {
+  if (stream_buffer_.get() && stream_buffer_size_ == kFilterBufSize)
+    g_stream_buffer_pool.Get().Release(&stream_buffer_);
+}
 
 // static
 Filter* Filter::Factory(const std::vector<FilterType>& filter_types,
@@ -446,7 +525,12 @@ Filter* Filter::PrependNewFilter(FilterType type_id,
 void Filter::InitBuffer(int buffer_size) {
   DCHECK(!stream_buffer());
   DCHECK_GT(buffer_size, 0);
-  stream_buffer_ = new IOBuffer(buffer_size);
+  // Tests construct filters with custom buffer sizes; only the standard size
+  // goes through the per-thread pool.
+  if (buffer_size == kFilterBufSize)
+    stream_buffer_ = g_stream_buffer_pool.Get().Acquire();
+  else
+    stream_buffer_ = new IOBuffer(buffer_size);
   stream_buffer_size_ = buffer_size;
 }
 
@@ -4,12 +4,108 @@
 
 #include "net/filter/gzip_filter.h"
 
+#include <vector>
+
+#include "base/lazy_instance.h"
 #include "base/logging.h"
+#include "base/threading/thread_local_storage.h"
 #include "net/filter/gzip_header.h"
 #include "third_party/zlib/zlib.h"
 
 namespace net {
 
+namespace {
+
+// An initialized inflate context owns a sliding window on top of its
+// internal state, which makes inflateInit2/inflateEnd per filtered response
+// a measurable cost. Instead of tearing contexts down, idle ones are parked
+// on a per-thread free list and revived with inflateReset2(), which keeps
+// the allocated window and merely rewinds the state (and can switch between
+// raw-deflate and zlib framing as needed).
+const size_t kMaxFreeInflateContexts = 4;
+
+class InflateContextPool {
+ public:
+  // Returns a z_stream initialized for |window_bits|, reviving a parked
+  // context when one is available. Returns NULL on failure.
+  z_stream* Acquire(int window_bits) {
+    std::vector<z_stream*>* free_list = GetFreeList();
+    while (!free_list->empty()) {
+      z_stream* stream = free_list->back();
+      free_list->pop_back();
+      if (inflateReset2(stream, window_bits) == Z_OK)
+        return stream;
+      DestroyContext(stream);
+    }
+
+    scoped_ptr<z_stream> stream(new z_stream);
+    memset(stream.get(), 0, sizeof(z_stream));
+    if (inflateInit2(stream.get(), window_bits) != Z_OK)
+      return NULL;
+    return stream.release();
+  }
+
+  // Parks |stream|, previously obtained from Acquire(), on the current
+  // thread's free list. The stream may be in any state.
+  void Release(z_stream* stream) {
+    std::vector<z_stream*>* free_list = GetFreeList();
+    if (free_list->size() < kMaxFreeInflateContexts) {
+      free_list->push_back(stream);
+      return;
+    }
+    DestroyContext(stream);
+  }
+
+ private:
+  friend struct base::DefaultLazyInstanceTraits<InflateContextPool>;
+
+  typedef std::vector<z_stream*> FreeList;
+
+  InflateContextPool() {
+    tls_index_.Initialize(ReleaseFreeList);
+  }
+
+  ~InflateContextPool() {
+    NOTREACHED();  // LeakyLazyInstance is not destructed.
+  }
+
+  static void DestroyContext(z_stream* stream) {
+    inflateEnd(stream);
+    delete stream;
+  }
+
+  FreeList* GetFreeList() const {
+    FreeList* free_list = static_cast<FreeList*>(tls_index_.Get());
+    if (!free_list) {
+      free_list = new FreeList;
+      tls_index_.Set(free_list);
+    }
+    return free_list;
+  }
+
+  // Called per-thread, at thread death, to release that thread's contexts.
+  static void ReleaseFreeList(void* value) {
+    FreeList* free_list = static_cast<FreeList*>(value);
+    for (size_t i = 0; i < free_list->size(); ++i)
+      DestroyContext((*free_list)[i]);
+    delete free_list;
+  }
+
+  // A TLS slot to the FreeList of the current thread.
+  static base::ThreadLocalStorage::StaticSlot tls_index_;
+
+  DISALLOW_COPY_AND_ASSIGN(InflateContextPool);
+};
+
+// static
+base::ThreadLocalStorage::StaticSlot InflateContextPool::tls_index_ =
+    TLS_INITIALIZER;
+
+base::LazyInstance<InflateContextPool>::Leaky g_inflate_context_pool =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
 GZipFilter::GZipFilter(FilterType type)
     : Filter(type),
       decoding_status_(DECODING_UNINITIALIZED),
@@ -21,25 +117,19 @@ GZipFilter::GZipFilter(FilterType type)
 }
 
 GZipFilter::~GZipFilter() {
-  if (decoding_status_ != DECODING_UNINITIALIZED) {
-    inflateEnd(zlib_stream_.get());
-  }
+  if (decoding_status_ != DECODING_UNINITIALIZED)
+    g_inflate_context_pool.Get().Release(zlib_stream_.release());
 }
 
 bool GZipFilter::InitDecoding(Filter::FilterType filter_type) {
   if (decoding_status_ != DECODING_UNINITIALIZED)
     return false;
 
-  // Initialize zlib control block
-  zlib_stream_.reset(new z_stream);
-  if (!zlib_stream_.get())
-    return false;
-  memset(zlib_stream_.get(), 0, sizeof(z_stream));
-
-  // Set decoding mode
+  // Set decoding mode and acquire a matching inflate context.
   switch (filter_type) {
     case Filter::FILTER_TYPE_DEFLATE: {
-      if (inflateInit(zlib_stream_.get()) != Z_OK)
+      zlib_stream_.reset(g_inflate_context_pool.Get().Acquire(MAX_WBITS));
+      if (!zlib_stream_.get())
         return false;
       decoding_mode_ = DECODE_MODE_DEFLATE;
       break;
@@ -51,7 +141,8 @@ bool GZipFilter::InitDecoding(Filter::FilterType filter_type) {
       gzip_header_.reset(new GZipHeader());
       if (!gzip_header_.get())
         return false;
-      if (inflateInit2(zlib_stream_.get(), -MAX_WBITS) != Z_OK)
+      zlib_stream_.reset(g_inflate_context_pool.Get().Acquire(-MAX_WBITS));
+      if (!zlib_stream_.get())
         return false;
       decoding_mode_ = DECODE_MODE_GZIP;
       break;
@@ -67,24 +67,34 @@ HttpChunkedDecoder::HttpChunkedDecoder()
 }
 
 int HttpChunkedDecoder::FilterBuf(char* buf, int buf_len) {
-  int result = 0;
+  // Chunk data is compacted towards the start of |buf| as the framing
+  // around it is consumed.  Keeping the write position separate from the
+  // read position means each data byte is moved at most once, no matter
+  // how many chunks the buffer spans.
+  char* const buf_start = buf;
+  char* write_ptr = buf;
 
   while (buf_len) {
     if (chunk_remaining_) {
       int num = std::min(chunk_remaining_, buf_len);
 
-      buf_len -= num;
       chunk_remaining_ -= num;
-
-      result += num;
+      if (write_ptr != buf)
+        memmove(write_ptr, buf, num);
+      write_ptr += num;
       buf += num;
+      buf_len -= num;
 
       // After each chunk's data there should be a CRLF
       if (!chunk_remaining_)
         chunk_terminator_remaining_ = true;
       continue;
     } else if (reached_eof_) {
+      // Anything seen after the final chunk must stay contiguous with the
+      // decoded data; the stream parser stashes it for the next response.
       bytes_after_eof_ += buf_len;
+      if (write_ptr != buf)
+        memmove(write_ptr, buf, buf_len);
       break;  // Done!
     }
 
@@ -92,12 +102,11 @@ int HttpChunkedDecoder::FilterBuf(char* buf, int buf_len) {
     if (bytes_consumed < 0)
       return bytes_consumed; // Error
 
+    buf += bytes_consumed;
     buf_len -= bytes_consumed;
-    if (buf_len)
-      memmove(buf, buf + bytes_consumed, buf_len);
   }
 
-  return result;
+  return write_ptr - buf_start;
 }
 
 int HttpChunkedDecoder::ScanForChunkRemaining(const char* buf, int buf_len) {
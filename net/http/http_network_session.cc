@@ -74,6 +74,7 @@ HttpNetworkSession::Params::Params()
       enable_tcp_fast_open_for_ssl(false),
       force_spdy_single_domain(false),
       enable_spdy_compression(true),
+      enable_spdy_write_batching(false),
       enable_spdy_ping_based_connection_checking(true),
       spdy_default_protocol(kProtoUnknown),
       spdy_stream_initial_recv_window_size(0),
@@ -91,6 +92,7 @@ HttpNetworkSession::Params::Params()
       quic_load_server_info_timeout_ms(0),
       quic_disable_loading_server_info_for_new_servers(false),
       quic_load_server_info_timeout_srtt_multiplier(0.0f),
+      quic_preload_server_info_count(0),
       quic_enable_truncated_connection_ids(false),
       quic_clock(NULL),
       quic_random(NULL),
@@ -137,6 +139,7 @@ HttpNetworkSession::HttpNetworkSession(const Params& params)
           params.quic_load_server_info_timeout_ms,
           params.quic_disable_loading_server_info_for_new_servers,
           params.quic_load_server_info_timeout_srtt_multiplier,
+          params.quic_preload_server_info_count,
           params.quic_enable_truncated_connection_ids,
           params.quic_connection_options),
       spdy_session_pool_(params.host_resolver,
@@ -145,6 +148,7 @@ HttpNetworkSession::HttpNetworkSession(const Params& params)
                          params.transport_security_state,
                          params.force_spdy_single_domain,
                          params.enable_spdy_compression,
+                         params.enable_spdy_write_batching,
                          params.enable_spdy_ping_based_connection_checking,
                          params.spdy_default_protocol,
                          params.spdy_stream_initial_recv_window_size,
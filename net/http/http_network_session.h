@@ -88,6 +88,7 @@ class NET_EXPORT HttpNetworkSession
 
     bool force_spdy_single_domain;
     bool enable_spdy_compression;
+    bool enable_spdy_write_batching;
     bool enable_spdy_ping_based_connection_checking;
     NextProto spdy_default_protocol;
     // The protocols supported by NPN (next protocol negotiation) during the
@@ -119,6 +120,7 @@ class NET_EXPORT HttpNetworkSession
     int quic_load_server_info_timeout_ms;
     bool quic_disable_loading_server_info_for_new_servers;
     float quic_load_server_info_timeout_srtt_multiplier;
+    size_t quic_preload_server_info_count;
     bool quic_enable_truncated_connection_ids;
     HostPortPair origin_to_force_quic_on;
     QuicClock* quic_clock;  // Will be owned by QuicStreamFactory.
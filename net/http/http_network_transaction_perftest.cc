@@ -0,0 +1,198 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// End-to-end throughput benchmark for HttpNetworkTransaction.  An in-process
+// EmbeddedTestServer serves a fixed-size body over real sockets while a set
+// of concurrent clients issues back-to-back GET requests through a shared
+// HttpNetworkSession, so the numbers cover the full transaction, socket pool
+// and connection reuse paths rather than mocked reads.
+
+#include <string>
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/bind.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/memory/scoped_vector.h"
+#include "base/message_loop/message_loop.h"
+#include "base/run_loop.h"
+#include "base/strings/stringprintf.h"
+#include "base/timer/elapsed_timer.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+#include "net/base/request_priority.h"
+#include "net/http/http_network_session.h"
+#include "net/http/http_network_transaction.h"
+#include "net/http/http_request_info.h"
+#include "net/http/http_status_code.h"
+#include "net/http/http_transaction_factory.h"
+#include "net/test/embedded_test_server/embedded_test_server.h"
+#include "net/test/embedded_test_server/http_request.h"
+#include "net/test/embedded_test_server/http_response.h"
+#include "net/url_request/url_request_test_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_test.h"
+
+namespace net {
+
+namespace {
+
+const int kResponseBodySize = 16 * 1024;
+const int kReadBufferSize = 16 * 1024;
+
+// Requests issued per client at each concurrency level.  Each client reuses
+// its connection, so beyond the first request this measures steady-state
+// transaction throughput.
+const int kRequestsPerClient = 200;
+
+const int kConcurrencyLevels[] = {1, 8, 32};
+
+// Issues |kRequestsPerClient| GET requests for |url| one after another,
+// running each transaction to completion before starting the next.  Invokes
+// |done_closure| once the last response body has been consumed.
+class TransactionDriver {
+ public:
+  TransactionDriver(HttpNetworkSession* session,
+                    const GURL& url,
+                    const base::Closure& done_closure)
+      : session_(session),
+        done_closure_(done_closure),
+        read_buffer_(new IOBuffer(kReadBufferSize)),
+        requests_remaining_(kRequestsPerClient) {
+    request_info_.url = url;
+    request_info_.method = "GET";
+  }
+
+  void Start() {
+    transaction_.reset(
+        new HttpNetworkTransaction(DEFAULT_PRIORITY, session_));
+    int rv = transaction_->Start(
+        &request_info_,
+        base::Bind(&TransactionDriver::OnStartComplete,
+                   base::Unretained(this)),
+        BoundNetLog());
+    if (rv != ERR_IO_PENDING)
+      OnStartComplete(rv);
+  }
+
+ private:
+  void OnStartComplete(int result) {
+    ASSERT_EQ(OK, result);
+    ReadBody();
+  }
+
+  void ReadBody() {
+    int rv;
+    do {
+      rv = transaction_->Read(
+          read_buffer_.get(), kReadBufferSize,
+          base::Bind(&TransactionDriver::OnReadComplete,
+                     base::Unretained(this)));
+    } while (rv > 0);
+    if (rv != ERR_IO_PENDING)
+      OnReadComplete(rv);
+  }
+
+  void OnReadComplete(int result) {
+    ASSERT_GE(result, 0);
+    if (result > 0) {
+      ReadBody();
+      return;
+    }
+    // Response complete.  Destroy the transaction to return its socket to
+    // the pool before starting the next request.
+    transaction_.reset();
+    if (--requests_remaining_ > 0)
+      Start();
+    else
+      done_closure_.Run();
+  }
+
+  HttpNetworkSession* session_;
+  base::Closure done_closure_;
+  HttpRequestInfo request_info_;
+  scoped_refptr<IOBuffer> read_buffer_;
+  scoped_ptr<HttpNetworkTransaction> transaction_;
+  int requests_remaining_;
+
+  DISALLOW_COPY_AND_ASSIGN(TransactionDriver);
+};
+
+class HttpNetworkTransactionPerfTest : public testing::Test {
+ public:
+  HttpNetworkTransactionPerfTest() : clients_outstanding_(0) {}
+
+  void SetUp() override {
+    server_.reset(new test_server::EmbeddedTestServer);
+    ASSERT_TRUE(server_->InitializeAndWaitUntilReady());
+    server_->RegisterRequestHandler(
+        base::Bind(&HttpNetworkTransactionPerfTest::HandleRequest,
+                   base::Unretained(this)));
+    context_.reset(new TestURLRequestContext());
+  }
+
+  void TearDown() override {
+    ASSERT_TRUE(server_->ShutdownAndWaitUntilComplete());
+  }
+
+ protected:
+  scoped_ptr<test_server::HttpResponse> HandleRequest(
+      const test_server::HttpRequest& request) {
+    scoped_ptr<test_server::BasicHttpResponse> http_response(
+        new test_server::BasicHttpResponse);
+    http_response->set_code(HTTP_OK);
+    http_response->set_content(std::string(kResponseBodySize, 'a'));
+    http_response->set_content_type("text/plain");
+    return http_response.Pass();
+  }
+
+  // Runs |concurrency| clients to completion and reports requests/sec.
+  void RunClients(int concurrency) {
+    HttpNetworkSession* session =
+        context_->http_transaction_factory()->GetSession();
+    GURL url = server_->GetURL("/body");
+
+    base::RunLoop run_loop;
+    clients_outstanding_ = concurrency;
+    ScopedVector<TransactionDriver> drivers;
+    for (int i = 0; i < concurrency; ++i) {
+      drivers.push_back(new TransactionDriver(
+          session, url,
+          base::Bind(&HttpNetworkTransactionPerfTest::OnClientDone,
+                     base::Unretained(this), run_loop.QuitClosure())));
+    }
+
+    base::ElapsedTimer timer;
+    for (size_t i = 0; i < drivers.size(); ++i)
+      drivers[i]->Start();
+    run_loop.Run();
+    const base::TimeDelta elapsed = timer.Elapsed();
+
+    const int total_requests = concurrency * kRequestsPerClient;
+    perf_test::PrintResult(
+        "http_transaction_throughput", "",
+        base::StringPrintf("http11_%d_clients", concurrency),
+        total_requests / elapsed.InSecondsF(), "requests/s", true);
+  }
+
+  void OnClientDone(const base::Closure& quit_closure) {
+    if (--clients_outstanding_ == 0)
+      quit_closure.Run();
+  }
+
+  base::MessageLoopForIO message_loop_;
+  scoped_ptr<test_server::EmbeddedTestServer> server_;
+  scoped_ptr<TestURLRequestContext> context_;
+  int clients_outstanding_;
+};
+
+TEST_F(HttpNetworkTransactionPerfTest, Throughput) {
+  for (size_t i = 0; i < arraysize(kConcurrencyLevels); ++i)
+    RunClients(kConcurrencyLevels[i]);
+}
+
+}  // namespace
+
+}  // namespace net
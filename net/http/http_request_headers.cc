@@ -5,6 +5,7 @@
 #include "net/http/http_request_headers.h"
 
 #include "base/logging.h"
+#include "base/strings/string_builder.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
@@ -174,18 +175,18 @@ void HttpRequestHeaders::MergeFrom(const HttpRequestHeaders& other) {
 }
 
 std::string HttpRequestHeaders::ToString() const {
-  std::string output;
+  // This serializes the headers of every request; build the result with a
+  // single allocation instead of growing it header by header.
+  base::StringBuilder builder;
   for (HeaderVector::const_iterator it = headers_.begin();
        it != headers_.end(); ++it) {
-    if (!it->value.empty()) {
-      base::StringAppendF(&output, "%s: %s\r\n",
-                          it->key.c_str(), it->value.c_str());
-    } else {
-      base::StringAppendF(&output, "%s:\r\n", it->key.c_str());
-    }
+    builder.Append(it->key);
+    builder.Append(it->value.empty() ? ":" : ": ");
+    builder.Append(it->value);
+    builder.Append("\r\n");
   }
-  output.append("\r\n");
-  return output;
+  builder.Append("\r\n");
+  return builder.ToString();
 }
 
 base::Value* HttpRequestHeaders::NetLogCallback(
@@ -434,6 +434,15 @@ void HttpResponseHeaders::Parse(const std::string& raw_input) {
   // Adjust to point at the null byte following the status line
   line_end = raw_headers_.begin() + status_line_len - 1;
 
+  // Every header line ends in a null, so the null count bounds the number of
+  // headers from below; reserving up front avoids regrowing |parsed_| while
+  // responses with hundreds of headers are parsed. Values split on commas
+  // grow past this on demand.
+  parsed_.reserve(std::count(line_end + 1,
+                             static_cast<std::string::const_iterator>(
+                                 raw_headers_.end()),
+                             '\0'));
+
   HttpUtil::HeadersIterator headers(line_end + 1, raw_headers_.end(),
                                     std::string(1, '\0'));
   while (headers.GetNext()) {
@@ -16,9 +16,13 @@
 #endif
 
 #include <algorithm>
+#include <set>
+#include <vector>
 
 #include "base/base64.h"
 #include "base/build_time.h"
+#include "base/hash.h"
+#include "base/lazy_instance.h"
 #include "base/logging.h"
 #include "base/memory/scoped_ptr.h"
 #include "base/metrics/histogram.h"
@@ -603,8 +607,231 @@ bool DecodeHSTSPreloadRaw(const std::string& hostname,
   }
 }
 
+// CollectPreloadSuffixKeys walks the node of the preloaded trie at
+// |bit_offset| and inserts, into |keys|, the final two labels of every entry
+// name below it. |*name| contains the characters of the entry names decoded
+// so far (in reversed order, since the trie matches hostnames backwards) and
+// |num_dots| counts the dots among them. Subtrees below the second dot are
+// pruned because every entry that they contain shares the same final two
+// labels. Returns false on internal error and true otherwise.
+bool CollectPreloadSuffixKeys(HuffmanDecoder* huffman,
+                              size_t bit_offset,
+                              std::string* name,
+                              size_t num_dots,
+                              std::set<std::string>* keys) {
+  static const char kEndOfString = 0;
+  static const char kEndOfTable = 127;
+
+  BitReader reader(kPreloadedHSTSData, kPreloadedHSTSBits);
+  if (!reader.Seek(bit_offset)) {
+    return false;
+  }
+
+  size_t prefix_length;
+  if (!reader.Unary(&prefix_length)) {
+    return false;
+  }
+
+  const size_t base_length = name->size();
+  bool pruned = false;
+  bool ok = true;
+
+  for (size_t i = 0; i < prefix_length; ++i) {
+    char c;
+    if (!huffman->Decode(&reader, &c)) {
+      name->resize(base_length);
+      return false;
+    }
+    if (c == '.' && ++num_dots == 2) {
+      keys->insert(std::string(name->rbegin(), name->rend()));
+      pruned = true;
+      break;
+    }
+    name->push_back(c);
+  }
+
+  bool is_first_offset = true;
+  size_t current_offset = 0;
+
+  while (!pruned) {
+    char c;
+    if (!huffman->Decode(&reader, &c)) {
+      ok = false;
+      break;
+    }
+    if (c == kEndOfTable) {
+      break;
+    }
+
+    if (c == kEndOfString) {
+      // Skip over the entry's value to stay in sync with the bit stream.
+      bool sts_include_subdomains, force_https, has_pins;
+      if (!reader.Next(&sts_include_subdomains) ||
+          !reader.Next(&force_https) ||
+          !reader.Next(&has_pins)) {
+        ok = false;
+        break;
+      }
+      if (has_pins) {
+        uint32 ignored;
+        bool pkp_include_subdomains;
+        if (!reader.Read(4, &ignored) ||
+            !reader.Read(9, &ignored) ||
+            (!sts_include_subdomains &&
+             !reader.Next(&pkp_include_subdomains))) {
+          ok = false;
+          break;
+        }
+      }
+      keys->insert(std::string(name->rbegin(), name->rend()));
+      continue;
+    }
+
+    // The offset decoding matches DecodeHSTSPreloadRaw, above.
+    if (is_first_offset) {
+      uint32 jump_delta_bits;
+      uint32 jump_delta;
+      if (!reader.Read(5, &jump_delta_bits) ||
+          !reader.Read(jump_delta_bits, &jump_delta) ||
+          bit_offset < jump_delta) {
+        ok = false;
+        break;
+      }
+      current_offset = bit_offset - jump_delta;
+      is_first_offset = false;
+    } else {
+      uint32 is_long_jump;
+      if (!reader.Read(1, &is_long_jump)) {
+        ok = false;
+        break;
+      }
+      uint32 jump_delta;
+      if (!is_long_jump) {
+        if (!reader.Read(7, &jump_delta)) {
+          ok = false;
+          break;
+        }
+      } else {
+        uint32 jump_delta_bits;
+        if (!reader.Read(4, &jump_delta_bits) ||
+            !reader.Read(jump_delta_bits + 8, &jump_delta)) {
+          ok = false;
+          break;
+        }
+      }
+      current_offset += jump_delta;
+      if (current_offset >= bit_offset) {
+        ok = false;
+        break;
+      }
+    }
+
+    if (c == '.' && num_dots + 1 == 2) {
+      // Every entry in this child shares the same final two labels.
+      keys->insert(std::string(name->rbegin(), name->rend()));
+      continue;
+    }
+
+    name->push_back(c);
+    ok = CollectPreloadSuffixKeys(huffman, current_offset, name,
+                                  num_dots + (c == '.' ? 1 : 0), keys);
+    name->resize(name->size() - 1);
+    if (!ok) {
+      break;
+    }
+  }
+
+  name->resize(base_length);
+  return ok;
+}
+
+// PreloadSuffixFilter is a Bloom filter over the final two labels of every
+// entry name in the preloaded data. The large majority of hostnames have no
+// preloaded entry, and two probes of a small bitmap are enough to establish
+// that without walking the trie; false positives simply fall through to the
+// full lookup.
+class PreloadSuffixFilter {
+ public:
+  PreloadSuffixFilter() : enabled_(false), mask_(0) {
+    HuffmanDecoder huffman(kHSTSHuffmanTree, sizeof(kHSTSHuffmanTree));
+    std::set<std::string> keys;
+    std::string name;
+    if (!CollectPreloadSuffixKeys(&huffman, kHSTSRootPosition, &name, 0,
+                                  &keys)) {
+      // On internal error, every lookup falls through to the trie.
+      NOTREACHED();
+      return;
+    }
+    // Size the bitmap at roughly sixteen bits per key, rounded up to a power
+    // of two, for a false positive rate of about one percent.
+    size_t num_bits = 256;
+    while (num_bits < 16 * keys.size())
+      num_bits *= 2;
+    bitmap_.resize(num_bits / 8);
+    mask_ = num_bits - 1;
+    for (std::set<std::string>::const_iterator i = keys.begin();
+         i != keys.end(); ++i) {
+      uint32 h1, h2;
+      HashKey(i->data(), i->size(), &h1, &h2);
+      bitmap_[(h1 & mask_) / 8] |= 1 << ((h1 & mask_) % 8);
+      bitmap_[(h2 & mask_) / 8] |= 1 << ((h2 & mask_) % 8);
+    }
+    enabled_ = true;
+  }
+
+  // Returns false only if |hostname| cannot have an entry in the preloaded
+  // data; if it returns true the trie must still be consulted.
+  bool MayHavePreloadedEntry(const std::string& hostname) const {
+    if (!enabled_ || hostname.empty()) {
+      return true;
+    }
+    const size_t last_dot = hostname.rfind('.');
+    if (last_dot == std::string::npos) {
+      return Contains(hostname.data(), hostname.size());
+    }
+    // The final label alone covers single-label entries that include
+    // subdomains.
+    if (Contains(hostname.data() + last_dot + 1,
+                 hostname.size() - last_dot - 1)) {
+      return true;
+    }
+    const size_t second_dot =
+        last_dot == 0 ? std::string::npos : hostname.rfind('.', last_dot - 1);
+    const size_t start = second_dot == std::string::npos ? 0 : second_dot + 1;
+    return Contains(hostname.data() + start, hostname.size() - start);
+  }
+
+ private:
+  static void HashKey(const char* data, size_t size, uint32* h1, uint32* h2) {
+    *h1 = base::Hash(data, size);
+    // The second probe position is derived from the first; the constant is
+    // the golden ratio in 32 bits.
+    *h2 = (*h1 >> 15 | *h1 << 17) * 0x9e3779b9;
+  }
+
+  bool Contains(const char* data, size_t size) const {
+    uint32 h1, h2;
+    HashKey(data, size, &h1, &h2);
+    return (bitmap_[(h1 & mask_) / 8] & (1 << ((h1 & mask_) % 8))) &&
+           (bitmap_[(h2 & mask_) / 8] & (1 << ((h2 & mask_) % 8)));
+  }
+
+  bool enabled_;
+  uint32 mask_;
+  std::vector<uint8> bitmap_;
+
+  DISALLOW_COPY_AND_ASSIGN(PreloadSuffixFilter);
+};
+
+base::LazyInstance<PreloadSuffixFilter>::Leaky g_preload_suffix_filter =
+    LAZY_INSTANCE_INITIALIZER;
+
 bool DecodeHSTSPreload(const std::string& hostname,
                        PreloadResult* out) {
+  if (!g_preload_suffix_filter.Get().MayHavePreloadedEntry(hostname)) {
+    return false;
+  }
+
   bool found;
   if (!DecodeHSTSPreloadRaw(hostname, &found, out)) {
     DCHECK(false) << "Internal error in DecodeHSTSPreloadRaw for hostname "
@@ -0,0 +1,166 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/proxy/proxy_resolver_pool.h"
+
+#include "base/bind.h"
+#include "base/hash.h"
+#include "base/logging.h"
+#include "net/base/net_errors.h"
+#include "url/gurl.h"
+
+namespace net {
+
+struct ProxyResolverPool::PoolRequest {
+  PoolRequest(ProxyResolver* resolver, const CompletionCallback& callback)
+      : resolver(resolver), inner_handle(NULL), user_callback(callback) {}
+
+  // The backend servicing this request, and its handle for the request.
+  ProxyResolver* resolver;
+  RequestHandle inner_handle;
+  CompletionCallback user_callback;
+};
+
+ProxyResolverPool::ProxyResolverPool(ScopedVector<ProxyResolver> resolvers)
+    : ProxyResolver((*resolvers.begin())->expects_pac_bytes()),
+      resolvers_(resolvers.Pass()),
+      num_outstanding_pac_loads_(0),
+      set_pac_script_result_(OK) {
+  DCHECK(!resolvers_.empty());
+  for (size_t i = 0; i < resolvers_.size(); ++i)
+    DCHECK_EQ(expects_pac_bytes(), resolvers_[i]->expects_pac_bytes());
+  set_pac_script_pending_.resize(resolvers_.size(), false);
+}
+
+ProxyResolverPool::~ProxyResolverPool() {
+  // All requests should have been cancelled or completed
+  // (ProxyService guarantees this before deleting the resolver).
+  CHECK(outstanding_requests_.empty());
+  CHECK(set_pac_script_callback_.is_null());
+}
+
+int ProxyResolverPool::GetProxyForURL(const GURL& url,
+                                      ProxyInfo* results,
+                                      const CompletionCallback& callback,
+                                      RequestHandle* request,
+                                      const BoundNetLog& net_log) {
+  DCHECK(CalledOnValidThread());
+  DCHECK(!callback.is_null());
+  DCHECK(set_pac_script_callback_.is_null());
+
+  ProxyResolver* resolver = PickResolverForURL(url);
+  scoped_ptr<PoolRequest> pool_request(new PoolRequest(resolver, callback));
+  int rv = resolver->GetProxyForURL(
+      url,
+      results,
+      base::Bind(&ProxyResolverPool::OnRequestComplete,
+                 base::Unretained(this),
+                 pool_request.get()),
+      &pool_request->inner_handle,
+      net_log);
+  if (rv != ERR_IO_PENDING)
+    return rv;
+
+  if (request)
+    *request = pool_request.get();
+  outstanding_requests_.insert(pool_request.release());
+  return ERR_IO_PENDING;
+}
+
+void ProxyResolverPool::CancelRequest(RequestHandle request) {
+  DCHECK(CalledOnValidThread());
+  PoolRequest* pool_request = reinterpret_cast<PoolRequest*>(request);
+  DCHECK(outstanding_requests_.count(pool_request));
+
+  pool_request->resolver->CancelRequest(pool_request->inner_handle);
+  outstanding_requests_.erase(pool_request);
+  delete pool_request;
+}
+
+LoadState ProxyResolverPool::GetLoadState(RequestHandle request) const {
+  DCHECK(CalledOnValidThread());
+  const PoolRequest* pool_request = reinterpret_cast<PoolRequest*>(request);
+  DCHECK(outstanding_requests_.count(const_cast<PoolRequest*>(pool_request)));
+
+  return pool_request->resolver->GetLoadState(pool_request->inner_handle);
+}
+
+void ProxyResolverPool::CancelSetPacScript() {
+  DCHECK(CalledOnValidThread());
+  DCHECK(!set_pac_script_callback_.is_null());
+
+  for (size_t i = 0; i < resolvers_.size(); ++i) {
+    if (set_pac_script_pending_[i]) {
+      resolvers_[i]->CancelSetPacScript();
+      set_pac_script_pending_[i] = false;
+    }
+  }
+  num_outstanding_pac_loads_ = 0;
+  set_pac_script_callback_.Reset();
+}
+
+int ProxyResolverPool::SetPacScript(
+    const scoped_refptr<ProxyResolverScriptData>& script_data,
+    const CompletionCallback& callback) {
+  DCHECK(CalledOnValidThread());
+  DCHECK(!callback.is_null());
+
+  // There should be neither an outstanding script load, nor outstanding
+  // requests (ProxyService guarantees this).
+  DCHECK(set_pac_script_callback_.is_null());
+  DCHECK(outstanding_requests_.empty());
+
+  set_pac_script_callback_ = callback;
+  set_pac_script_result_ = OK;
+  num_outstanding_pac_loads_ = resolvers_.size();
+
+  for (size_t i = 0; i < resolvers_.size(); ++i) {
+    set_pac_script_pending_[i] = true;
+    int rv = resolvers_[i]->SetPacScript(
+        script_data,
+        base::Bind(&ProxyResolverPool::OnSetPacScriptComplete,
+                   base::Unretained(this),
+                   i));
+    DCHECK_EQ(ERR_IO_PENDING, rv);
+  }
+
+  return ERR_IO_PENDING;
+}
+
+ProxyResolver* ProxyResolverPool::PickResolverForURL(const GURL& url) {
+  // Pinning each host to one backend keeps any per-host state the script
+  // has built up (cached DNS results in particular) on the backend that
+  // will see that host again, while distinct hosts spread across the pool.
+  const std::string& host = url.host();
+  return resolvers_[base::Hash(host) % resolvers_.size()];
+}
+
+void ProxyResolverPool::OnRequestComplete(PoolRequest* pool_request,
+                                          int result) {
+  DCHECK(outstanding_requests_.count(pool_request));
+
+  CompletionCallback callback = pool_request->user_callback;
+  outstanding_requests_.erase(pool_request);
+  delete pool_request;
+  callback.Run(result);
+}
+
+void ProxyResolverPool::OnSetPacScriptComplete(size_t resolver_index,
+                                               int result) {
+  DCHECK(set_pac_script_pending_[resolver_index]);
+  DCHECK_GT(num_outstanding_pac_loads_, 0u);
+
+  set_pac_script_pending_[resolver_index] = false;
+  if (set_pac_script_result_ == OK && result != OK)
+    set_pac_script_result_ = result;
+
+  if (--num_outstanding_pac_loads_ > 0)
+    return;
+
+  CompletionCallback callback = set_pac_script_callback_;
+  set_pac_script_callback_.Reset();
+  callback.Run(set_pac_script_result_);
+}
+
+}  // namespace net
@@ -0,0 +1,82 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef NET_PROXY_PROXY_RESOLVER_POOL_H_
+#define NET_PROXY_PROXY_RESOLVER_POOL_H_
+
+#include <set>
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_vector.h"
+#include "base/threading/non_thread_safe.h"
+#include "net/base/net_export.h"
+#include "net/proxy/proxy_resolver.h"
+
+namespace net {
+
+// ProxyResolverPool fans GetProxyForURL() requests out over a set of
+// asynchronous ProxyResolver backends so that slow PAC evaluations do not
+// serialize behind each other. Requests are assigned to backends by a hash
+// of the URL's host, so repeated lookups for one host always reach the same
+// backend and benefit from whatever per-host state it has accumulated.
+//
+// SetPacScript() is broadcast to every backend, and completes once all of
+// them have finished loading the script. If any backend fails, the first
+// failure is reported (after all backends have completed).
+//
+// The backends must complete GetProxyForURL() and SetPacScript()
+// asynchronously (i.e. return ERR_IO_PENDING), which is the case for
+// ProxyResolverV8Tracing, the intended backend.
+class NET_EXPORT_PRIVATE ProxyResolverPool
+    : public ProxyResolver,
+      NON_EXPORTED_BASE(public base::NonThreadSafe) {
+ public:
+  // |resolvers| must be non-empty, and all of its entries must agree on
+  // expects_pac_bytes().
+  explicit ProxyResolverPool(ScopedVector<ProxyResolver> resolvers);
+
+  ~ProxyResolverPool() override;
+
+  // ProxyResolver implementation:
+  int GetProxyForURL(const GURL& url,
+                     ProxyInfo* results,
+                     const CompletionCallback& callback,
+                     RequestHandle* request,
+                     const BoundNetLog& net_log) override;
+  void CancelRequest(RequestHandle request) override;
+  LoadState GetLoadState(RequestHandle request) const override;
+  void CancelSetPacScript() override;
+  int SetPacScript(const scoped_refptr<ProxyResolverScriptData>& script_data,
+                   const CompletionCallback& callback) override;
+
+ private:
+  struct PoolRequest;
+
+  // Returns the backend that requests for |url| are pinned to.
+  ProxyResolver* PickResolverForURL(const GURL& url);
+
+  void OnRequestComplete(PoolRequest* pool_request, int result);
+  void OnSetPacScriptComplete(size_t resolver_index, int result);
+
+  ScopedVector<ProxyResolver> resolvers_;
+
+  // Outstanding requests, owned by this class. Entries are removed when the
+  // backend completes the request or when the caller cancels it.
+  std::set<PoolRequest*> outstanding_requests_;
+
+  // State for the in-progress SetPacScript() broadcast, if any.
+  // |set_pac_script_pending_| parallels |resolvers_|.
+  std::vector<bool> set_pac_script_pending_;
+  size_t num_outstanding_pac_loads_;
+  int set_pac_script_result_;
+  CompletionCallback set_pac_script_callback_;
+
+  DISALLOW_COPY_AND_ASSIGN(ProxyResolverPool);
+};
+
+}  // namespace net
+
+#endif  // NET_PROXY_PROXY_RESOLVER_POOL_H_
@@ -0,0 +1,149 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/proxy/proxy_resolver_pool.h"
+
+#include <vector>
+
+#include "base/memory/scoped_ptr.h"
+#include "base/memory/scoped_vector.h"
+#include "base/message_loop/message_loop.h"
+#include "net/base/net_errors.h"
+#include "net/base/net_log.h"
+#include "net/base/test_completion_callback.h"
+#include "net/proxy/mock_proxy_resolver.h"
+#include "net/proxy/proxy_info.h"
+#include "net/proxy/proxy_resolver_script_data.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace net {
+
+namespace {
+
+const size_t kNumResolvers = 3;
+
+class ProxyResolverPoolTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ScopedVector<ProxyResolver> resolvers;
+    for (size_t i = 0; i < kNumResolvers; ++i) {
+      // The pool takes ownership; |mocks_| holds observing pointers.
+      MockAsyncProxyResolverExpectsBytes* mock =
+          new MockAsyncProxyResolverExpectsBytes;
+      mocks_.push_back(mock);
+      resolvers.push_back(mock);
+    }
+    pool_.reset(new ProxyResolverPool(resolvers.Pass()));
+  }
+
+  base::MessageLoop message_loop_;
+  std::vector<MockAsyncProxyResolverExpectsBytes*> mocks_;
+  scoped_ptr<ProxyResolverPool> pool_;
+};
+
+TEST_F(ProxyResolverPoolTest, SetPacScriptBroadcast) {
+  TestCompletionCallback callback;
+  scoped_refptr<ProxyResolverScriptData> script_data =
+      ProxyResolverScriptData::FromUTF8("pac-script");
+
+  EXPECT_EQ(ERR_IO_PENDING,
+            pool_->SetPacScript(script_data, callback.callback()));
+
+  // Every backend should have been given the same script.
+  for (size_t i = 0; i < mocks_.size(); ++i) {
+    ASSERT_TRUE(mocks_[i]->has_pending_set_pac_script_request());
+    EXPECT_EQ(script_data.get(),
+              mocks_[i]->pending_set_pac_script_request()->script_data());
+  }
+
+  // The load must not complete until the last backend has finished.
+  for (size_t i = 0; i + 1 < mocks_.size(); ++i) {
+    mocks_[i]->pending_set_pac_script_request()->CompleteNow(OK);
+    EXPECT_FALSE(callback.have_result());
+  }
+  mocks_.back()->pending_set_pac_script_request()->CompleteNow(OK);
+  EXPECT_EQ(OK, callback.WaitForResult());
+}
+
+TEST_F(ProxyResolverPoolTest, SetPacScriptReportsFirstError) {
+  TestCompletionCallback callback;
+  scoped_refptr<ProxyResolverScriptData> script_data =
+      ProxyResolverScriptData::FromUTF8("pac-script");
+
+  EXPECT_EQ(ERR_IO_PENDING,
+            pool_->SetPacScript(script_data, callback.callback()));
+
+  mocks_[0]->pending_set_pac_script_request()->CompleteNow(OK);
+  mocks_[1]->pending_set_pac_script_request()->CompleteNow(
+      ERR_PAC_SCRIPT_FAILED);
+  EXPECT_FALSE(callback.have_result());
+  mocks_[2]->pending_set_pac_script_request()->CompleteNow(OK);
+  EXPECT_EQ(ERR_PAC_SCRIPT_FAILED, callback.WaitForResult());
+}
+
+TEST_F(ProxyResolverPoolTest, SameHostGoesToSameBackend) {
+  ProxyInfo info1;
+  ProxyInfo info2;
+  TestCompletionCallback callback1;
+  TestCompletionCallback callback2;
+
+  EXPECT_EQ(ERR_IO_PENDING,
+            pool_->GetProxyForURL(GURL("http://www.example.com/one"),
+                                  &info1,
+                                  callback1.callback(),
+                                  NULL,
+                                  BoundNetLog()));
+  EXPECT_EQ(ERR_IO_PENDING,
+            pool_->GetProxyForURL(GURL("http://www.example.com/two"),
+                                  &info2,
+                                  callback2.callback(),
+                                  NULL,
+                                  BoundNetLog()));
+
+  // Both requests must have reached the same backend.
+  MockAsyncProxyResolverExpectsBytes* backend = NULL;
+  for (size_t i = 0; i < mocks_.size(); ++i) {
+    if (mocks_[i]->pending_requests().empty())
+      continue;
+    EXPECT_FALSE(backend) << "Requests for one host hit several backends";
+    backend = mocks_[i];
+  }
+  ASSERT_TRUE(backend);
+  ASSERT_EQ(2u, backend->pending_requests().size());
+
+  backend->pending_requests()[0]->CompleteNow(OK);
+  backend->pending_requests()[0]->CompleteNow(OK);
+  EXPECT_EQ(OK, callback1.WaitForResult());
+  EXPECT_EQ(OK, callback2.WaitForResult());
+}
+
+TEST_F(ProxyResolverPoolTest, CancelRequest) {
+  ProxyInfo info;
+  TestCompletionCallback callback;
+  ProxyResolver::RequestHandle request;
+
+  EXPECT_EQ(ERR_IO_PENDING,
+            pool_->GetProxyForURL(GURL("http://www.example.com/"),
+                                  &info,
+                                  callback.callback(),
+                                  &request,
+                                  BoundNetLog()));
+
+  pool_->CancelRequest(request);
+
+  size_t num_pending = 0;
+  size_t num_cancelled = 0;
+  for (size_t i = 0; i < mocks_.size(); ++i) {
+    num_pending += mocks_[i]->pending_requests().size();
+    num_cancelled += mocks_[i]->cancelled_requests().size();
+  }
+  EXPECT_EQ(0u, num_pending);
+  EXPECT_EQ(1u, num_cancelled);
+  EXPECT_FALSE(callback.have_result());
+}
+
+}  // namespace
+
+}  // namespace net
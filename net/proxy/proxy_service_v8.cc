@@ -5,13 +5,26 @@
 #include "net/proxy/proxy_service_v8.h"
 
 #include "base/logging.h"
+#include "base/memory/scoped_vector.h"
 #include "net/proxy/network_delegate_error_observer.h"
 #include "net/proxy/proxy_resolver.h"
+#include "net/proxy/proxy_resolver_pool.h"
 #include "net/proxy/proxy_resolver_v8_tracing.h"
 #include "net/proxy/proxy_service.h"
 
 namespace net {
 
+namespace {
+
+// Number of ProxyResolverV8Tracing backends (each running the script on its
+// own worker thread) that PAC evaluations are spread across. Script contexts
+// share a single v8::Isolate, so pure Javascript execution still serializes
+// on the isolate lock; the win is that evaluations blocked in dnsResolve()
+// (which release the lock) no longer stall every other resolution.
+const size_t kNumPacResolvers = 4;
+
+}  // namespace
+
 // static
 ProxyService* CreateProxyServiceUsingV8ProxyResolver(
     ProxyConfigService* proxy_config_service,
@@ -25,11 +38,17 @@ ProxyService* CreateProxyServiceUsingV8ProxyResolver(
   DCHECK(dhcp_proxy_script_fetcher);
   DCHECK(host_resolver);
 
-  ProxyResolverErrorObserver* error_observer = new NetworkDelegateErrorObserver(
-      network_delegate, base::MessageLoopProxy::current().get());
-
-  ProxyResolver* proxy_resolver =
-      new ProxyResolverV8Tracing(host_resolver, error_observer, net_log);
+  ScopedVector<ProxyResolver> resolvers;
+  for (size_t i = 0; i < kNumPacResolvers; ++i) {
+    // Each backend takes ownership of its own error observer.
+    ProxyResolverErrorObserver* error_observer =
+        new NetworkDelegateErrorObserver(
+            network_delegate, base::MessageLoopProxy::current().get());
+    resolvers.push_back(
+        new ProxyResolverV8Tracing(host_resolver, error_observer, net_log));
+  }
+
+  ProxyResolver* proxy_resolver = new ProxyResolverPool(resolvers.Pass());
 
   ProxyService* proxy_service =
       new ProxyService(proxy_config_service, proxy_resolver, net_log);
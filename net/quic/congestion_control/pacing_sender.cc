@@ -12,6 +12,7 @@ PacingSender::PacingSender(SendAlgorithmInterface* sender,
     : sender_(sender),
       alarm_granularity_(alarm_granularity),
       initial_packet_burst_(initial_packet_burst),
+      recurring_packet_burst_(0),
       burst_tokens_(initial_packet_burst),
       last_delayed_packet_sent_time_(QuicTime::Zero()),
       ideal_next_packet_send_time_(QuicTime::Zero()),
@@ -60,11 +61,27 @@ bool PacingSender::OnPacketSent(
     // Add more burst tokens anytime the connection is leaving quiescence.
     burst_tokens_ = initial_packet_burst_;
   }
+  if (burst_tokens_ == 0 && recurring_packet_burst_ > 0 &&
+      ideal_next_packet_send_time_ <= sent_time) {
+    // The pacing schedule has caught up with the send time; release the
+    // next batch of packets back-to-back. This packet is the first of
+    // the batch.
+    burst_tokens_ = recurring_packet_burst_;
+  }
   if (burst_tokens_ > 0) {
     --burst_tokens_;
     was_last_send_delayed_ = false;
     last_delayed_packet_sent_time_ = QuicTime::Zero();
-    ideal_next_packet_send_time_ = QuicTime::Zero();
+    if (recurring_packet_burst_ == 0) {
+      ideal_next_packet_send_time_ = QuicTime::Zero();
+      return in_flight;
+    }
+    // When sending in recurring bursts, keep the pacing schedule
+    // advancing during the burst so that the average rate stays at the
+    // pacing rate.
+    ideal_next_packet_send_time_ =
+        QuicTime::Max(ideal_next_packet_send_time_, sent_time)
+            .Add(PacingRate().TransferTime(bytes));
     return in_flight;
   }
   // The next packet should be sent as soon as the current packets has been
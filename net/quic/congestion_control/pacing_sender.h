@@ -35,6 +35,17 @@ class NET_EXPORT_PRIVATE PacingSender : public SendAlgorithmInterface {
                uint32 initial_packet_burst);
   ~PacingSender() override;
 
+  // When |recurring_packet_burst| is positive, packets continue to be
+  // released in back-to-back bursts of that many packets once the
+  // initial burst is exhausted, instead of one at a time, whenever the
+  // pacing schedule has caught up with the send time. The average send
+  // rate still matches the underlying sender's pacing rate. Useful when
+  // the packet writer can hand several packets to the kernel in one
+  // call.
+  void set_recurring_packet_burst(uint32 recurring_packet_burst) {
+    recurring_packet_burst_ = recurring_packet_burst;
+  }
+
   // SendAlgorithmInterface methods.
   void SetFromConfig(const QuicConfig& config,
                      bool is_server,
@@ -74,6 +85,9 @@ class NET_EXPORT_PRIVATE PacingSender : public SendAlgorithmInterface {
   const QuicTime::Delta alarm_granularity_;
   // Configured size of the burst coming out of quiescence.
   const uint32 initial_packet_burst_;
+  // If positive, the size of the recurring bursts released once the
+  // pacing schedule has caught up. Zero paces packet-by-packet.
+  uint32 recurring_packet_burst_;
   // Number of unpaced packets to be sent before packets are delayed.
   uint32 burst_tokens_;
   // Send time of the last packet considered delayed.
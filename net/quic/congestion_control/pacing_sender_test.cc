@@ -323,6 +323,31 @@ TEST_F(PacingSenderTest, InitialBurstNoRttMeasurement) {
   CheckPacketIsDelayed(QuicTime::Delta::FromMilliseconds(2));
 }
 
+TEST_F(PacingSenderTest, RecurringBurst) {
+  // Configure pacing rate of 1 packet per 1 ms, no initial burst, and
+  // recurring bursts of 3 packets.
+  InitPacingRate(0, QuicBandwidth::FromBytesAndTimeDelta(
+                        kMaxPacketSize, QuicTime::Delta::FromMilliseconds(1)));
+  pacing_sender_->set_recurring_packet_burst(3);
+
+  // Now update the RTT and verify that packets are actually paced.
+  UpdateRtt();
+
+  // The first 3 packets are sent back-to-back, consuming 3ms of the pacing
+  // schedule, so the 4th packet is delayed by the full burst time.
+  CheckPacketIsSentImmediately();
+  CheckPacketIsSentImmediately();
+  CheckPacketIsSentImmediately();
+  CheckPacketIsDelayed(QuicTime::Delta::FromMilliseconds(3));
+
+  // Once the schedule catches up, the next burst is released back-to-back.
+  clock_.AdvanceTime(QuicTime::Delta::FromMilliseconds(3));
+  CheckPacketIsSentImmediately();
+  CheckPacketIsSentImmediately();
+  CheckPacketIsSentImmediately();
+  CheckPacketIsDelayed(QuicTime::Delta::FromMilliseconds(3));
+}
+
 TEST_F(PacingSenderTest, FastSending) {
   // Ensure the pacing sender paces, even when the inter-packet spacing is less
   // than the pacing granularity.
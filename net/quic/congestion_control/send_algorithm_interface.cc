@@ -11,6 +11,17 @@ namespace net {
 
 class RttStats;
 
+namespace {
+
+SendAlgorithmInterface::Factory* g_send_algorithm_factory = nullptr;
+
+}  // namespace
+
+// static
+void SendAlgorithmInterface::set_factory(Factory* factory) {
+  g_send_algorithm_factory = factory;
+}
+
 // Factory for send side congestion control algorithm.
 SendAlgorithmInterface* SendAlgorithmInterface::Create(
     const QuicClock* clock,
@@ -18,6 +29,13 @@ SendAlgorithmInterface* SendAlgorithmInterface::Create(
     CongestionControlType congestion_control_type,
     QuicConnectionStats* stats,
     QuicPacketCount initial_congestion_window) {
+  if (g_send_algorithm_factory != nullptr) {
+    SendAlgorithmInterface* algorithm = g_send_algorithm_factory->Create(
+        clock, rtt_stats, congestion_control_type, stats,
+        initial_congestion_window);
+    if (algorithm != nullptr)
+      return algorithm;
+  }
   switch (congestion_control_type) {
     case kCubic:
       return new TcpCubicSender(clock, rtt_stats, false /* don't use Reno */,
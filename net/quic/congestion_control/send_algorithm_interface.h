@@ -30,6 +30,29 @@ class NET_EXPORT_PRIVATE SendAlgorithmInterface {
   typedef std::vector<std::pair<QuicPacketSequenceNumber, TransmissionInfo>>
       CongestionVector;
 
+  // Interface for embedder-supplied send algorithm implementations. A
+  // registered factory is consulted by Create() before the built-in
+  // algorithms, so custom congestion control or pacing modules can be
+  // deployed without patching the built-in selection.
+  class NET_EXPORT_PRIVATE Factory {
+   public:
+    virtual ~Factory() {}
+
+    // Returns a new send algorithm for |congestion_control_type|, or
+    // nullptr to fall back to the built-in implementation.
+    virtual SendAlgorithmInterface* Create(
+        const QuicClock* clock,
+        const RttStats* rtt_stats,
+        CongestionControlType congestion_control_type,
+        QuicConnectionStats* stats,
+        QuicPacketCount initial_congestion_window) = 0;
+  };
+
+  // Registers the factory consulted by Create(). |factory| is not owned
+  // and must outlive all connections; pass nullptr to restore the
+  // built-in algorithms.
+  static void set_factory(Factory* factory);
+
   static SendAlgorithmInterface* Create(
       const QuicClock* clock,
       const RttStats* rtt_stats,
@@ -38,6 +38,11 @@ const int k0RttHandshakeTimeoutMs = 300;
 // IPv6 packets have an additional 20 bytes of overhead than IPv4 packets.
 const size_t kAdditionalOverheadForIPv6 = 20;
 
+// Number of datagrams requested per batch read from the socket. Sized to
+// drain a typical burst in one system call without tying up much memory
+// per session.
+const size_t kPacketsPerReadBatch = 16;
+
 // Histograms for tracking down the crashes from http://crbug.com/354669
 // Note: these values must be kept in sync with the corresponding values in:
 // tools/metrics/histograms/histograms.xml
@@ -162,7 +167,7 @@ QuicClientSession::QuicClientSession(
       require_confirmation_(false),
       stream_factory_(stream_factory),
       socket_(socket.Pass()),
-      read_buffer_(new IOBufferWithSize(kMaxPacketSize)),
+      read_buffers_(kPacketsPerReadBatch),
       transport_security_state_(transport_security_state),
       server_info_(server_info.Pass()),
       read_pending_(false),
@@ -173,6 +178,11 @@ QuicClientSession::QuicClientSession(
       num_packets_read_(0),
       going_away_(false),
       weak_factory_(this) {
+  for (size_t i = 0; i < read_buffers_.size(); ++i) {
+    read_buffers_[i].buffer = new IOBufferWithSize(kMaxPacketSize);
+    read_buffers_[i].buffer_length = kMaxPacketSize;
+    read_buffers_[i].bytes_read = 0;
+  }
   connection->set_debug_visitor(logger_);
   IPEndPoint address;
   if (socket && socket->GetLocalAddress(&address) == OK &&
@@ -758,17 +768,17 @@ void QuicClientSession::StartReading() {
     return;
   }
   read_pending_ = true;
-  int rv = socket_->Read(read_buffer_.get(),
-                         read_buffer_->size(),
-                         base::Bind(&QuicClientSession::OnReadComplete,
-                                    weak_factory_.GetWeakPtr()));
+  int rv = socket_->ReadMultiple(&read_buffers_,
+                                 base::Bind(&QuicClientSession::OnReadComplete,
+                                            weak_factory_.GetWeakPtr()));
   UMA_HISTOGRAM_BOOLEAN("Net.QuicSession.AsyncRead", rv == ERR_IO_PENDING);
   if (rv == ERR_IO_PENDING) {
     num_packets_read_ = 0;
     return;
   }
 
-  if (++num_packets_read_ > 32) {
+  num_packets_read_ += (rv > 0) ? rv : 1;
+  if (num_packets_read_ > 32) {
     num_packets_read_ = 0;
     // Data was read, process it.
     // Schedule the work through the message loop to 1) prevent infinite
@@ -867,29 +877,41 @@ void QuicClientSession::OnReadComplete(int result) {
     result = ERR_CONNECTION_CLOSED;
 
   if (result < 0) {
-    DVLOG(1) << "Closing session on read error: " << result;
-    UMA_HISTOGRAM_SPARSE_SLOWLY("Net.QuicSession.ReadError", -result);
-    NotifyFactoryOfSessionGoingAway();
-    CloseSessionOnErrorInner(result, QUIC_PACKET_READ_ERROR);
-    NotifyFactoryOfSessionClosedLater();
+    OnReadError(result);
     return;
   }
 
-  QuicEncryptedPacket packet(read_buffer_->data(), result);
   IPEndPoint local_address;
   IPEndPoint peer_address;
   socket_->GetLocalAddress(&local_address);
   socket_->GetPeerAddress(&peer_address);
-  // ProcessUdpPacket might result in |this| being deleted, so we
-  // use a weak pointer to be safe.
-  connection()->ProcessUdpPacket(local_address, peer_address, packet);
-  if (!connection()->connected()) {
-    NotifyFactoryOfSessionClosedLater();
-    return;
+  for (int i = 0; i < result; ++i) {
+    int bytes_read = read_buffers_[i].bytes_read;
+    if (bytes_read == 0) {
+      OnReadError(ERR_CONNECTION_CLOSED);
+      return;
+    }
+    QuicEncryptedPacket packet(read_buffers_[i].buffer->data(), bytes_read);
+    // ProcessUdpPacket might result in |this| being deleted, so we
+    // use a weak pointer to be safe.
+    connection()->ProcessUdpPacket(local_address, peer_address, packet);
+    if (!connection()->connected()) {
+      NotifyFactoryOfSessionClosedLater();
+      return;
+    }
   }
   StartReading();
 }
 
+void QuicClientSession::OnReadError(int result) {
+  DCHECK_LT(result, 0);
+  DVLOG(1) << "Closing session on read error: " << result;
+  UMA_HISTOGRAM_SPARSE_SLOWLY("Net.QuicSession.ReadError", -result);
+  NotifyFactoryOfSessionGoingAway();
+  CloseSessionOnErrorInner(result, QUIC_PACKET_READ_ERROR);
+  NotifyFactoryOfSessionClosedLater();
+}
+
 void QuicClientSession::NotifyFactoryOfSessionGoingAway() {
   going_away_ = true;
   if (stream_factory_)
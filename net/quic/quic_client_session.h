@@ -11,6 +11,7 @@
 #define NET_QUIC_QUIC_CLIENT_SESSION_H_
 
 #include <string>
+#include <vector>
 
 #include "base/basictypes.h"
 #include "base/containers/hash_tables.h"
@@ -23,6 +24,7 @@
 #include "net/quic/quic_crypto_client_stream.h"
 #include "net/quic/quic_protocol.h"
 #include "net/quic/quic_reliable_client_stream.h"
+#include "net/udp/datagram_socket.h"
 
 namespace net {
 
@@ -190,9 +192,13 @@ class NET_EXPORT_PRIVATE QuicClientSession : public QuicClientSessionBase {
   typedef std::list<StreamRequest*> StreamRequestQueue;
 
   QuicReliableClientStream* CreateOutgoingReliableStreamImpl();
-  // A completion callback invoked when a read completes.
+  // A completion callback invoked when a batch read completes. |result| is
+  // the number of packets read, or a net error code.
   void OnReadComplete(int result);
 
+  // Closes the session after a fatal read error.
+  void OnReadError(int result);
+
   void OnClosedStream();
 
   // A Session may be closed via any of three methods:
@@ -226,7 +232,7 @@ class NET_EXPORT_PRIVATE QuicClientSession : public QuicClientSessionBase {
   scoped_ptr<QuicCryptoClientStream> crypto_stream_;
   QuicStreamFactory* stream_factory_;
   scoped_ptr<DatagramClientSocket> socket_;
-  scoped_refptr<IOBufferWithSize> read_buffer_;
+  std::vector<DatagramReadBuffer> read_buffers_;
   TransportSecurityState* transport_security_state_;
   scoped_ptr<QuicServerInfo> server_info_;
   scoped_ptr<CertVerifyResult> cert_verify_result_;
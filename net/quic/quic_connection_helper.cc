@@ -4,6 +4,7 @@
 
 #include "net/quic/quic_connection_helper.h"
 
+#include "base/bind.h"
 #include "base/location.h"
 #include "base/logging.h"
 #include "base/metrics/sparse_histogram.h"
@@ -20,56 +21,31 @@ namespace {
 class QuicChromeAlarm : public QuicAlarm {
  public:
   QuicChromeAlarm(const QuicClock* clock,
-                  base::TaskRunner* task_runner,
+                  QuicConnectionHelper* helper,
                   QuicAlarm::Delegate* delegate)
-      : QuicAlarm(delegate),
-        clock_(clock),
-        task_runner_(task_runner),
-        task_deadline_(QuicTime::Zero()),
-        weak_factory_(this) {}
+      : QuicAlarm(delegate), clock_(clock), helper_(helper) {}
 
  protected:
   void SetImpl() override {
     DCHECK(deadline().IsInitialized());
-    if (task_deadline_.IsInitialized()) {
-      if (task_deadline_ <= deadline()) {
-        // Since tasks can not be un-posted, OnAlarm will be invoked which
-        // will notice that deadline has not yet been reached, and will set
-        // the alarm for the new deadline.
-        return;
-      }
-      // The scheduled task is after new deadline.  Invalidate the weak ptrs
-      // so that task does not execute when we're not expecting it.
-      weak_factory_.InvalidateWeakPtrs();
-    }
-
-    int64 delay_us = deadline().Subtract(clock_->Now()).ToMicroseconds();
-    if (delay_us < 0) {
-      delay_us = 0;
-    }
-    task_runner_->PostDelayedTask(
-        FROM_HERE,
-        base::Bind(&QuicChromeAlarm::OnAlarm, weak_factory_.GetWeakPtr()),
-        base::TimeDelta::FromMicroseconds(delay_us));
-    task_deadline_ = deadline();
+    helper_->ScheduleAlarmInWheel(
+        &wheel_timer_, deadline(),
+        base::Bind(&QuicChromeAlarm::OnAlarm, base::Unretained(this)));
   }
 
   void CancelImpl() override {
     DCHECK(!deadline().IsInitialized());
-    // Since tasks can not be un-posted, OnAlarm will be invoked which
-    // will notice that deadline is not Initialized and will do nothing.
+    // O(1): the timer is unlinked from the wheel immediately, unlike a
+    // delayed task, which would stay queued until it ran.
+    helper_->CancelAlarmInWheel(&wheel_timer_);
   }
 
  private:
   void OnAlarm() {
-    DCHECK(task_deadline_.IsInitialized());
-    task_deadline_ = QuicTime::Zero();
-    // The alarm may have been cancelled.
-    if (!deadline().IsInitialized()) {
-      return;
-    }
+    DCHECK(deadline().IsInitialized());
 
-    // The alarm may have been re-set to a later time.
+    // The wheel rounds deadlines up to its granularity; if that (or clock
+    // skew) got us here early, re-arm instead of firing.
     if (clock_->Now() < deadline()) {
       SetImpl();
       return;
@@ -79,14 +55,9 @@ class QuicChromeAlarm : public QuicAlarm {
   }
 
   const QuicClock* clock_;
-  base::TaskRunner* task_runner_;
-  // If a task has been posted to the message loop, this is the time it
-  // was scheduled to fire.  Tracking this allows us to avoid posting a
-  // new tast if the new deadline is in the future, but permits us to
-  // post a new task when the new deadline now earlier than when
-  // previously posted.
-  QuicTime task_deadline_;
-  base::WeakPtrFactory<QuicChromeAlarm> weak_factory_;
+  QuicConnectionHelper* helper_;  // Not owned; outlives the alarm.
+  // Cancels itself on destruction, so firing cannot touch a dead alarm.
+  base::TimingWheel::Timer wheel_timer_;
 };
 
 }  // namespace
@@ -97,6 +68,7 @@ QuicConnectionHelper::QuicConnectionHelper(base::TaskRunner* task_runner,
     : task_runner_(task_runner),
       clock_(clock),
       random_generator_(random_generator),
+      timing_wheel_(base::TimeDelta::FromMicroseconds(1)),
       weak_factory_(this) {
 }
 
@@ -112,7 +84,52 @@ QuicRandom* QuicConnectionHelper::GetRandomGenerator() {
 }
 
 QuicAlarm* QuicConnectionHelper::CreateAlarm(QuicAlarm::Delegate* delegate) {
-  return new QuicChromeAlarm(clock_, task_runner_, delegate);
+  return new QuicChromeAlarm(clock_, this, delegate);
+}
+
+void QuicConnectionHelper::ScheduleAlarmInWheel(
+    base::TimingWheel::Timer* timer,
+    QuicTime deadline,
+    const base::Closure& task) {
+  timing_wheel_.Schedule(timer, WheelTime(clock_->Now()), WheelTime(deadline),
+                         task);
+  ScheduleWheelWake();
+}
+
+void QuicConnectionHelper::CancelAlarmInWheel(base::TimingWheel::Timer* timer) {
+  timing_wheel_.Cancel(timer);
+}
+
+base::TimeTicks QuicConnectionHelper::WheelTime(QuicTime time) const {
+  return base::TimeTicks() + base::TimeDelta::FromMicroseconds(
+      time.Subtract(QuicTime::Zero()).ToMicroseconds());
+}
+
+void QuicConnectionHelper::OnWheelWake() {
+  wheel_wake_time_ = base::TimeTicks();
+  timing_wheel_.AdvanceTo(WheelTime(clock_->Now()));
+  ScheduleWheelWake();
+}
+
+void QuicConnectionHelper::ScheduleWheelWake() {
+  base::TimeTicks wake = timing_wheel_.NextWakeTime();
+  if (wake.is_null())
+    return;
+  if (!wheel_wake_time_.is_null() && wheel_wake_time_ <= wake) {
+    // An earlier wake is already on its way; it will re-post for |wake|.
+    return;
+  }
+
+  base::TimeDelta delay = wake - WheelTime(clock_->Now());
+  if (delay < base::TimeDelta()) {
+    delay = base::TimeDelta();
+  }
+  task_runner_->PostDelayedTask(
+      FROM_HERE,
+      base::Bind(&QuicConnectionHelper::OnWheelWake,
+                 weak_factory_.GetWeakPtr()),
+      delay);
+  wheel_wake_time_ = wake;
 }
 
 }  // namespace net
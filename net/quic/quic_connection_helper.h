@@ -13,7 +13,10 @@
 #include <set>
 
 #include "base/basictypes.h"
+#include "base/callback.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timing_wheel.h"
 #include "net/base/ip_endpoint.h"
 #include "net/quic/quic_protocol.h"
 #include "net/quic/quic_time.h"
@@ -41,10 +44,36 @@ class NET_EXPORT_PRIVATE QuicConnectionHelper
   QuicRandom* GetRandomGenerator() override;
   QuicAlarm* CreateAlarm(QuicAlarm::Delegate* delegate) override;
 
+  // Used by the alarms this helper creates. Every alarm shares the helper's
+  // timing wheel, so arming and cancelling are O(1) and the message loop
+  // carries at most one delayed task per wheel wake-up instead of one per
+  // alarm. QUIC re-arms several alarms per packet, which makes per-alarm
+  // delayed tasks expensive.
+  void ScheduleAlarmInWheel(base::TimingWheel::Timer* timer,
+                            QuicTime deadline,
+                            const base::Closure& task);
+  void CancelAlarmInWheel(base::TimingWheel::Timer* timer);
+
  private:
+  // Converts a QuicTime to the timebase the timing wheel runs on. The wheel
+  // is driven off |clock_| rather than base::TimeTicks so that tests using
+  // a mock clock see deterministic wake-ups.
+  base::TimeTicks WheelTime(QuicTime time) const;
+
+  // Services the timing wheel and re-posts the next wake-up.
+  void OnWheelWake();
+
+  // Posts a delayed task for the wheel's next wake time, unless an earlier
+  // wake is already pending. Pending wakes can not be un-posted; a stale
+  // wake simply finds nothing to do.
+  void ScheduleWheelWake();
+
   base::TaskRunner* task_runner_;
   const QuicClock* clock_;
   QuicRandom* random_generator_;
+  base::TimingWheel timing_wheel_;
+  // The earliest pending wheel wake-up, or null when none is pending.
+  base::TimeTicks wheel_wake_time_;
   base::WeakPtrFactory<QuicConnectionHelper> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(QuicConnectionHelper);
@@ -25,6 +25,11 @@ namespace net {
 // values less than or equal to 0.
 int32 FLAGS_quic_recent_min_rtt_window_s = 60;
 
+// Number of packets the pacing sender releases back-to-back once the pacing
+// schedule has caught up.  Values less than or equal to 0 pace packets one at
+// a time.
+int32 FLAGS_quic_pacing_burst_size = 0;
+
 namespace {
 static const int64 kDefaultRetransmissionTimeMs = 500;
 // TCP RFC calls for 1 second RTO however Linux differs from this default and
@@ -953,10 +958,14 @@ void QuicSentPacketManager::EnablePacing() {
   // Set up a pacing sender with a 1 millisecond alarm granularity, the same as
   // the default granularity of the Linux kernel's FQ qdisc.
   using_pacing_ = true;
-  send_algorithm_.reset(
+  PacingSender* pacing_sender =
       new PacingSender(send_algorithm_.release(),
                        QuicTime::Delta::FromMilliseconds(1),
-                       kInitialUnpacedBurst));
+                       kInitialUnpacedBurst);
+  if (FLAGS_quic_pacing_burst_size > 0) {
+    pacing_sender->set_recurring_packet_burst(FLAGS_quic_pacing_burst_size);
+  }
+  send_algorithm_.reset(pacing_sender);
 }
 
 }  // namespace net
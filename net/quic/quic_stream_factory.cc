@@ -567,6 +567,7 @@ QuicStreamFactory::QuicStreamFactory(
     int load_server_info_timeout,
     bool disable_loading_server_info_for_new_servers,
     float load_server_info_timeout_srtt_multiplier,
+    size_t preload_server_info_count,
     bool enable_truncated_connection_ids,
     const QuicTagVector& connection_options)
     : require_confirmation_(true),
@@ -590,6 +591,7 @@ QuicStreamFactory::QuicStreamFactory(
           disable_loading_server_info_for_new_servers),
       load_server_info_timeout_srtt_multiplier_(
           load_server_info_timeout_srtt_multiplier),
+      preload_server_info_count_(preload_server_info_count),
       enable_truncated_connection_ids_(enable_truncated_connection_ids),
       port_seed_(random_generator_->RandUint64()),
       check_persisted_supports_quic_(true),
@@ -617,6 +619,15 @@ QuicStreamFactory::~QuicStreamFactory() {
     all_sessions_.erase(all_sessions_.begin());
   }
   STLDeleteValues(&active_jobs_);
+  STLDeleteValues(&preloading_server_infos_);
+}
+
+void QuicStreamFactory::set_quic_server_info_factory(
+    QuicServerInfoFactory* quic_server_info_factory) {
+  DCHECK(!quic_server_info_factory_);
+  quic_server_info_factory_ = quic_server_info_factory;
+  if (preload_server_info_count_ > 0)
+    PreloadServerInfo();
 }
 
 void QuicStreamFactory::set_require_confirmation(bool require_confirmation) {
@@ -1171,6 +1182,65 @@ void QuicStreamFactory::InitializeCachedStateInCryptoConfig(
   }
 }
 
+void QuicStreamFactory::PreloadServerInfo() {
+  DCHECK(quic_server_info_factory_);
+  DCHECK(preloading_server_infos_.empty());
+  if (!http_server_properties_)
+    return;
+
+  // The alternate protocol map is in MRU order, so the first QUIC
+  // entries are the servers most recently used.
+  size_t preload_count = 0;
+  for (const std::pair<net::HostPortPair, net::AlternateProtocolInfo>&
+           key_value : http_server_properties_->alternate_protocol_map()) {
+    if (preload_count >= preload_server_info_count_)
+      break;
+    if (key_value.second.protocol != QUIC)
+      continue;
+    ++preload_count;
+
+    QuicServerId server_id(key_value.first, key_value.first.port() == 443,
+                           PRIVACY_MODE_DISABLED);
+    QuicCryptoClientConfig::CachedState* cached =
+        crypto_config_.LookupOrCreate(server_id);
+    DCHECK(cached);
+    if (!cached->IsEmpty())
+      continue;
+
+    // Issue all of the loads up front so that they overlap rather than
+    // being paid for one at a time by the first requests to each
+    // server.
+    scoped_ptr<QuicServerInfo> server_info(
+        quic_server_info_factory_->GetForServer(server_id));
+    server_info->Start();
+    int rv = server_info->WaitForDataReady(
+        base::Bind(&QuicStreamFactory::OnServerInfoPreloaded,
+                   weak_factory_.GetWeakPtr(), server_id));
+    if (rv == ERR_IO_PENDING) {
+      preloading_server_infos_[server_id] = server_info.release();
+    } else if (rv == OK) {
+      InitializeCachedStateInCryptoConfig(server_id, server_info);
+    }
+  }
+}
+
+void QuicStreamFactory::OnServerInfoPreloaded(const QuicServerId& server_id,
+                                              int rv) {
+  std::map<QuicServerId, QuicServerInfo*>::iterator it =
+      preloading_server_infos_.find(server_id);
+  DCHECK(it != preloading_server_infos_.end());
+  scoped_ptr<QuicServerInfo> server_info(it->second);
+  preloading_server_infos_.erase(it);
+
+  if (rv != OK)
+    return;
+
+  // Warm the in-memory cached state so that the first connection to
+  // |server_id| doesn't wait on the disk cache and can attempt a 0-RTT
+  // handshake right away.
+  InitializeCachedStateInCryptoConfig(server_id, server_info);
+}
+
 void QuicStreamFactory::ProcessGoingAwaySession(
     QuicClientSession* session,
     const QuicServerId& server_id,
@@ -107,6 +107,7 @@ class NET_EXPORT_PRIVATE QuicStreamFactory
       int load_server_info_timeout,
       bool disable_loading_server_info_for_new_servers,
       float load_server_info_timeout_srtt_multiplier,
+      size_t preload_server_info_count,
       bool enable_truncated_connection_ids,
       const QuicTagVector& connection_options);
   ~QuicStreamFactory() override;
@@ -173,11 +174,11 @@ class NET_EXPORT_PRIVATE QuicStreamFactory
     return quic_server_info_factory_ != NULL;
   }
 
+  // Sets the factory to use to create QuicServerInfos. If
+  // |preload_server_info_count_| is non-zero, also kicks off the
+  // preload of server info for recently-used QUIC servers.
   void set_quic_server_info_factory(
-      QuicServerInfoFactory* quic_server_info_factory) {
-    DCHECK(!quic_server_info_factory_);
-    quic_server_info_factory_ = quic_server_info_factory;
-  }
+      QuicServerInfoFactory* quic_server_info_factory);
 
  private:
   class Job;
@@ -240,6 +241,16 @@ class NET_EXPORT_PRIVATE QuicStreamFactory
       const QuicServerId& server_id,
       const scoped_ptr<QuicServerInfo>& server_info);
 
+  // Starts loading the QuicServerInfo for up to
+  // |preload_server_info_count_| of the most recently used QUIC servers
+  // in the alternate protocol map in one pass, so that the first
+  // connections to those servers don't block on a disk cache read.
+  void PreloadServerInfo();
+
+  // Called when the QuicServerInfo for |server_id| being preloaded by
+  // PreloadServerInfo() is ready.
+  void OnServerInfoPreloaded(const QuicServerId& server_id, int rv);
+
   void ProcessGoingAwaySession(QuicClientSession* session,
                                const QuicServerId& server_id,
                                bool was_session_active);
@@ -308,6 +319,14 @@ class NET_EXPORT_PRIVATE QuicStreamFactory
   // want to timeout, set |load_server_info_timeout_srtt_multiplier_| to 0.
   float load_server_info_timeout_srtt_multiplier_;
 
+  // Number of recently-used QUIC servers whose QuicServerInfo is loaded
+  // from disk cache when the QuicServerInfoFactory is set. Zero disables
+  // preloading.
+  size_t preload_server_info_count_;
+
+  // QuicServerInfo objects being preloaded, keyed by server. Owned.
+  std::map<QuicServerId, QuicServerInfo*> preloading_server_infos_;
+
   // Set this for setting config's BytesForConnectionIdToSend (TCID param) to 0.
   bool enable_truncated_connection_ids_;
 
@@ -11,6 +11,7 @@
 #include "net/dns/mock_host_resolver.h"
 #include "net/http/http_response_headers.h"
 #include "net/http/http_response_info.h"
+#include "net/http/http_server_properties_impl.h"
 #include "net/http/http_util.h"
 #include "net/http/transport_security_state.h"
 #include "net/quic/crypto/crypto_handshake.h"
@@ -165,6 +166,7 @@ class QuicStreamFactoryTest : public ::testing::TestWithParam<QuicVersion> {
                  /*load_server_info_timeout=*/0u,
                  /*disable_loading_server_info_for_new_servers=*/false,
                  /*load_server_info_timeout_srtt_multiplier=*/0.0f,
+                 /*preload_server_info_count=*/0u,
                  /*enable_truncated_connection_ids=*/true,
                  QuicTagVector()),
         host_port_pair_(kDefaultServerHostName, kDefaultServerPort),
@@ -1605,5 +1607,64 @@ TEST_P(QuicStreamFactoryTest, CancelWaitForDataReady) {
   EXPECT_TRUE(socket_data.at_write_eof());
 }
 
+namespace {
+
+// A QuicServerInfoFactory that records which servers have been asked
+// for.
+class CountingQuicServerInfoFactory : public QuicServerInfoFactory {
+ public:
+  CountingQuicServerInfoFactory() {}
+  ~CountingQuicServerInfoFactory() override {}
+
+  QuicServerInfo* GetForServer(const QuicServerId& server_id) override {
+    requested_servers_.push_back(server_id);
+    return new MockQuicServerInfo(server_id);
+  }
+
+  const std::vector<QuicServerId>& requested_servers() const {
+    return requested_servers_;
+  }
+
+ private:
+  std::vector<QuicServerId> requested_servers_;
+};
+
+}  // namespace
+
+TEST_P(QuicStreamFactoryTest, PreloadServerInfo) {
+  HttpServerPropertiesImpl http_server_properties;
+  HostPortPair quic_server1("www.example.org", 443);
+  HostPortPair quic_server2("mail.example.org", 443);
+  HostPortPair spdy_server("docs.example.org", 443);
+  http_server_properties.SetAlternateProtocol(quic_server1, 443, QUIC, 1);
+  http_server_properties.SetAlternateProtocol(spdy_server, 443,
+                                              NPN_SPDY_3_1, 1);
+  http_server_properties.SetAlternateProtocol(quic_server2, 443, QUIC, 1);
+
+  QuicStreamFactory factory(
+      &host_resolver_, &socket_factory_, http_server_properties.GetWeakPtr(),
+      cert_verifier_.get(), channel_id_service_.get(),
+      &transport_security_state_, &crypto_client_stream_factory_,
+      &random_generator_, new MockClock(), kDefaultMaxPacketSize, std::string(),
+      SupportedVersions(GetParam()),
+      /*enable_port_selection=*/true,
+      /*always_require_handshake_confirmation=*/false,
+      /*disable_connection_pooling=*/false,
+      /*load_server_info_timeout=*/0u,
+      /*disable_loading_server_info_for_new_servers=*/false,
+      /*load_server_info_timeout_srtt_multiplier=*/0.0f,
+      /*preload_server_info_count=*/1u,
+      /*enable_truncated_connection_ids=*/true, QuicTagVector());
+
+  // Setting the server info factory should trigger the preload of the
+  // single most recently used QUIC server, skipping the non-QUIC
+  // entry.
+  CountingQuicServerInfoFactory server_info_factory;
+  factory.set_quic_server_info_factory(&server_info_factory);
+  ASSERT_EQ(1u, server_info_factory.requested_servers().size());
+  EXPECT_TRUE(quic_server2.Equals(
+      server_info_factory.requested_servers()[0].host_port_pair()));
+}
+
 }  // namespace test
 }  // namespace net
@@ -183,6 +183,15 @@ base::TimeDelta TransportConnectJobHelper::HistogramDuration(
                                  100);
       break;
 
+    case CONNECTION_LATENCY_SAME_FAMILY_WINS_RACE:
+      UMA_HISTOGRAM_CUSTOM_TIMES(
+          "Net.TCP_Connection_Latency_SameFamily_Wins_Race",
+          connect_duration,
+          base::TimeDelta::FromMilliseconds(1),
+          base::TimeDelta::FromMinutes(10),
+          100);
+      break;
+
     default:
       NOTREACHED();
       break;
@@ -293,15 +302,19 @@ int TransportConnectJob::DoTransportConnect() {
 
   // If the list contains IPv6 and IPv4 addresses, the first address will
   // be IPv6, and the IPv4 addresses will be tried as fallback addresses,
-  // per "Happy Eyeballs" (RFC 6555).
+  // per "Happy Eyeballs" (RFC 6555). Lists with several addresses of the
+  // same family also get a staggered second attempt, leading with a
+  // different address, in case the first endpoint is dropping our SYNs.
   bool try_ipv6_connect_with_ipv4_fallback =
       helper_.addresses().front().GetFamily() == ADDRESS_FAMILY_IPV6 &&
       !AddressListOnlyContainsIPv6(helper_.addresses());
+  bool try_fallback_connect =
+      try_ipv6_connect_with_ipv4_fallback || helper_.addresses().size() > 1;
 
   // Enable TCP FastOpen if indicated by transport socket params.
   // Note: We currently do not turn on TCP FastOpen for destinations where
-  // we try a TCP connect over IPv6 with fallback to IPv4.
-  if (!try_ipv6_connect_with_ipv4_fallback &&
+  // a fallback connect may race the main one.
+  if (!try_fallback_connect &&
       helper_.params()->combine_connect_and_write() ==
           TransportSocketParams::COMBINE_CONNECT_AND_WRITE_DESIRED) {
     transport_socket_->EnableTCPFastOpenIfSupported();
@@ -319,7 +332,7 @@ int TransportConnectJob::DoTransportConnect() {
       FROM_HERE_WITH_EXPLICIT_FUNCTION(
           "436634 TransportConnectJob::DoTransportConnect3"));
 
-  if (rv == ERR_IO_PENDING && try_ipv6_connect_with_ipv4_fallback) {
+  if (rv == ERR_IO_PENDING && try_fallback_connect) {
     fallback_timer_.Start(
         FROM_HERE,
         base::TimeDelta::FromMilliseconds(
@@ -406,7 +419,17 @@ void TransportConnectJob::DoIPv6FallbackTransportConnect() {
   DCHECK(!fallback_addresses_.get());
 
   fallback_addresses_.reset(new AddressList(helper_.addresses()));
-  MakeAddressListStartWithIPv4(fallback_addresses_.get());
+  if (helper_.addresses().front().GetFamily() == ADDRESS_FAMILY_IPV6 &&
+      !AddressListOnlyContainsIPv6(helper_.addresses())) {
+    MakeAddressListStartWithIPv4(fallback_addresses_.get());
+  } else {
+    // Same-family race: lead with a different address than the main
+    // attempt so that a blackholed endpoint doesn't stall both connects.
+    DCHECK_GT(fallback_addresses_->size(), 1u);
+    std::rotate(fallback_addresses_->begin(),
+                fallback_addresses_->begin() + 1,
+                fallback_addresses_->end());
+  }
   fallback_transport_socket_ =
       helper_.client_socket_factory()->CreateTransportClientSocket(
           *fallback_addresses_, net_log().net_log(), net_log().source());
@@ -434,8 +457,14 @@ void TransportConnectJob::DoIPv6FallbackTransportConnectComplete(int result) {
   if (result == OK) {
     DCHECK(!fallback_connect_start_time_.is_null());
     connect_timing_.connect_start = fallback_connect_start_time_;
-    helper_.HistogramDuration(
-        TransportConnectJobHelper::CONNECTION_LATENCY_IPV4_WINS_RACE);
+    if (fallback_addresses_->front().GetFamily() == ADDRESS_FAMILY_IPV4 &&
+        helper_.addresses().front().GetFamily() == ADDRESS_FAMILY_IPV6) {
+      helper_.HistogramDuration(
+          TransportConnectJobHelper::CONNECTION_LATENCY_IPV4_WINS_RACE);
+    } else {
+      helper_.HistogramDuration(
+          TransportConnectJobHelper::CONNECTION_LATENCY_SAME_FAMILY_WINS_RACE);
+    }
     SetSocket(fallback_transport_socket_.Pass());
     helper_.set_next_state(TransportConnectJobHelper::STATE_NONE);
     transport_socket_.reset();
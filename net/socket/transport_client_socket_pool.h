@@ -96,6 +96,7 @@ class NET_EXPORT_PRIVATE TransportConnectJobHelper {
     CONNECTION_LATENCY_IPV4_NO_RACE,
     CONNECTION_LATENCY_IPV6_RACEABLE,
     CONNECTION_LATENCY_IPV6_SOLO,
+    CONNECTION_LATENCY_SAME_FAMILY_WINS_RACE,
   };
 
   TransportConnectJobHelper(const scoped_refptr<TransportSocketParams>& params,
@@ -154,7 +155,10 @@ class NET_EXPORT_PRIVATE TransportConnectJobHelper {
 // user wait 20s for the timeout to fire, we use a fallback timer
 // (kIPv6FallbackTimerInMs) and start a connect() to a IPv4 address if the timer
 // fires. Then we race the IPv4 connect() against the IPv6 connect() (which has
-// a headstart) and return the one that completes first to the socket pool.
+// a headstart) and return the one that completes first to the socket pool. The
+// same staggered race is run for multi-address lists of a single family, with
+// the fallback connect() leading with a different address, so that one
+// endpoint dropping SYNs does not stall the whole job.
 class NET_EXPORT_PRIVATE TransportConnectJob : public ConnectJob {
  public:
   TransportConnectJob(const std::string& group_name,
@@ -54,10 +54,33 @@ class SpdyBuffer::SharedFrameIOBuffer : public IOBuffer {
   DISALLOW_COPY_AND_ASSIGN(SharedFrameIOBuffer);
 };
 
+// Like SharedFrameIOBuffer, but for a SpdyBuffer sharing a slice of an
+// IOBuffer; keeps the underlying IOBuffer alive for as long as this
+// object is.
+class SpdyBuffer::SharedBufferIOBuffer : public IOBuffer {
+ public:
+  SharedBufferIOBuffer(const scoped_refptr<IOBuffer>& shared_buffer,
+                       const char* data)
+      : IOBuffer(const_cast<char*>(data)),
+        shared_buffer_(shared_buffer) {}
+
+ private:
+  ~SharedBufferIOBuffer() override {
+    // Prevent ~IOBuffer() from trying to delete |data_|.
+    data_ = NULL;
+  }
+
+  const scoped_refptr<IOBuffer> shared_buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(SharedBufferIOBuffer);
+};
+
 SpdyBuffer::SpdyBuffer(scoped_ptr<SpdyFrame> frame)
     : shared_frame_(new SharedFrame()),
       offset_(0) {
   shared_frame_->data = frame.Pass();
+  data_ = shared_frame_->data->data();
+  size_ = shared_frame_->data->size();
 }
 
 // The given data may not be strictly a SPDY frame; we (ab)use
@@ -68,6 +91,20 @@ SpdyBuffer::SpdyBuffer(const char* data, size_t size) :
   CHECK_GT(size, 0u);
   CHECK_LE(size, kMaxSpdyFrameSize);
   shared_frame_->data = MakeSpdyFrame(data, size);
+  data_ = shared_frame_->data->data();
+  size_ = size;
+}
+
+SpdyBuffer::SpdyBuffer(const scoped_refptr<IOBuffer>& buffer,
+                       size_t offset,
+                       size_t size)
+    : shared_buffer_(buffer),
+      offset_(0) {
+  CHECK(buffer.get());
+  CHECK_GT(size, 0u);
+  CHECK_LE(size, kMaxSpdyFrameSize);
+  data_ = buffer->data() + offset;
+  size_ = size;
 }
 
 SpdyBuffer::~SpdyBuffer() {
@@ -76,11 +113,11 @@ SpdyBuffer::~SpdyBuffer() {
 }
 
 const char* SpdyBuffer::GetRemainingData() const {
-  return shared_frame_->data->data() + offset_;
+  return data_ + offset_;
 }
 
 size_t SpdyBuffer::GetRemainingSize() const {
-  return shared_frame_->data->size() - offset_;
+  return size_ - offset_;
 }
 
 void SpdyBuffer::AddConsumeCallback(const ConsumeCallback& consume_callback) {
@@ -92,7 +129,9 @@ void SpdyBuffer::Consume(size_t consume_size) {
 };
 
 IOBuffer* SpdyBuffer::GetIOBufferForRemainingData() {
-  return new SharedFrameIOBuffer(shared_frame_, offset_);
+  if (shared_frame_.get())
+    return new SharedFrameIOBuffer(shared_frame_, offset_);
+  return new SharedBufferIOBuffer(shared_buffer_, GetRemainingData());
 }
 
 void SpdyBuffer::ConsumeHelper(size_t consume_size,
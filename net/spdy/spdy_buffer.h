@@ -53,6 +53,16 @@ class NET_EXPORT_PRIVATE SpdyBuffer {
   // non-NULL and |size| must be non-zero.
   SpdyBuffer(const char* data, size_t size);
 
+  // Construct with |size| bytes of |buffer| starting at |offset|. The
+  // bytes are shared with |buffer| rather than copied; |buffer| is kept
+  // alive (and must not be mutated) until this object and any IOBuffers
+  // obtained from it are destroyed. Used on the read path to hand
+  // received frame payloads to streams without copying them out of the
+  // session's read buffer.
+  SpdyBuffer(const scoped_refptr<IOBuffer>& buffer,
+             size_t offset,
+             size_t size);
+
   // If there are bytes remaining in the buffer, triggers a call to
   // any consume callbacks with a DISCARD source.
   ~SpdyBuffer();
@@ -91,8 +101,15 @@ class NET_EXPORT_PRIVATE SpdyBuffer {
   typedef base::RefCountedData<scoped_ptr<SpdyFrame> > SharedFrame;
 
   class SharedFrameIOBuffer;
+  class SharedBufferIOBuffer;
 
+  // Exactly one of |shared_frame_| and |shared_buffer_| is non-NULL,
+  // depending on which constructor was used. |data_| and |size_| cover
+  // the frame's data or the shared slice, respectively.
   const scoped_refptr<SharedFrame> shared_frame_;
+  const scoped_refptr<IOBuffer> shared_buffer_;
+  const char* data_;
+  size_t size_;
   std::vector<ConsumeCallback> consume_callbacks_;
   size_t offset_;
 
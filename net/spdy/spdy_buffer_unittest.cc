@@ -103,6 +103,48 @@ TEST_F(SpdyBufferTest, ConsumeOnDestruction) {
   EXPECT_EQ(kDataSize, x);
 }
 
+// Construct a SpdyBuffer from a slice of an IOBuffer and make sure it
+// shares the IOBuffer's data rather than copying it, and keeps the
+// IOBuffer alive.
+TEST_F(SpdyBufferTest, SharedSliceConstructor) {
+  scoped_refptr<IOBuffer> io_buffer(new IOBuffer(kDataSize + 2));
+  std::memcpy(io_buffer->data() + 1, kData, kDataSize);
+  const char* slice_start = io_buffer->data() + 1;
+
+  scoped_ptr<SpdyBuffer> buffer(new SpdyBuffer(io_buffer, 1, kDataSize));
+  EXPECT_EQ(slice_start, buffer->GetRemainingData());
+  EXPECT_EQ(kDataSize, buffer->GetRemainingSize());
+  EXPECT_EQ(std::string(kData, kDataSize), BufferToString(*buffer));
+
+  buffer->Consume(5);
+  EXPECT_EQ(slice_start + 5, buffer->GetRemainingData());
+  EXPECT_EQ(kDataSize - 5, buffer->GetRemainingSize());
+
+  // Dropping our reference shouldn't invalidate the slice.
+  io_buffer = NULL;
+  EXPECT_EQ(std::string(kData + 5, kDataSize - 5), BufferToString(*buffer));
+}
+
+// Make sure the IOBuffer returned by GetIOBufferForRemainingData() for
+// a shared-slice SpdyBuffer keeps the underlying IOBuffer alive past
+// the SpdyBuffer's lifetime.
+TEST_F(SpdyBufferTest, SharedSliceIOBufferOutlivesBuffer) {
+  scoped_refptr<IOBuffer> underlying_buffer(new IOBuffer(kDataSize));
+  std::memcpy(underlying_buffer->data(), kData, kDataSize);
+
+  scoped_ptr<SpdyBuffer> buffer(
+      new SpdyBuffer(underlying_buffer, 0, kDataSize));
+  underlying_buffer = NULL;
+
+  scoped_refptr<IOBuffer> io_buffer = buffer->GetIOBufferForRemainingData();
+  buffer.reset();
+
+  // This will cause a use-after-free error if |io_buffer| doesn't keep
+  // the underlying IOBuffer alive.
+  EXPECT_EQ(std::string(kData, kDataSize),
+            std::string(io_buffer->data(), kDataSize));
+}
+
 // Make sure the IOBuffer returned by GetIOBufferForRemainingData()
 // points to the buffer's remaining data and isn't updated by
 // Consume().
@@ -5,6 +5,7 @@
 #include "net/spdy/spdy_session.h"
 
 #include <algorithm>
+#include <cstring>
 #include <map>
 
 #include "base/basictypes.h"
@@ -52,6 +53,20 @@ namespace net {
 namespace {
 
 const int kReadBufferSize = 8 * 1024;
+
+// Minimum size of a received data frame payload that will be wrapped in
+// a zero-copy slice of the session's read buffer rather than copied out
+// of it. A slice keeps the whole (kReadBufferSize) read buffer alive
+// until it is consumed, so small chunks are cheaper to copy.
+const size_t kMinBufferSliceSize = 1024;
+
+// Limits on the number of frames and total bytes coalesced into a
+// single socket write when write batching is enabled. The byte limit
+// keeps the copy into the combined write buffer cheap relative to the
+// syscall it saves.
+const size_t kMaxWriteBatchFrames = 32;
+const size_t kMaxWriteBatchBytes = 16 * 1024;
+
 const int kDefaultConnectionAtRiskOfLossSeconds = 10;
 const int kHungIntervalSeconds = 10;
 
@@ -600,6 +615,16 @@ bool SpdySession::CanPool(TransportSecurityState* transport_security_state,
   return true;
 }
 
+SpdySession::BatchedWrite::BatchedWrite(SpdyFrameType frame_type,
+                                        SpdyBuffer* buffer,
+                                        const base::WeakPtr<SpdyStream>& stream)
+    : frame_type(frame_type),
+      frame_size(buffer->GetRemainingSize()),
+      buffer(buffer),
+      stream(stream) {}
+
+SpdySession::BatchedWrite::~BatchedWrite() {}
+
 SpdySession::SpdySession(
     const SpdySessionKey& spdy_session_key,
     const base::WeakPtr<HttpServerProperties>& http_server_properties,
@@ -607,6 +632,7 @@ SpdySession::SpdySession(
     bool verify_domain_authentication,
     bool enable_sending_initial_data,
     bool enable_compression,
+    bool enable_write_batching,
     bool enable_ping_based_connection_checking,
     NextProto default_protocol,
     size_t stream_initial_recv_window_size,
@@ -666,6 +692,7 @@ SpdySession::SpdySession(
       verify_domain_authentication_(verify_domain_authentication),
       enable_sending_initial_data_(enable_sending_initial_data),
       enable_compression_(enable_compression),
+      enable_write_batching_(enable_write_batching),
       enable_ping_based_connection_checking_(
           enable_ping_based_connection_checking),
       protocol_(default_protocol),
@@ -696,6 +723,8 @@ SpdySession::~SpdySession() {
   // With SPDY we can't recycle sockets.
   connection_->socket()->Disconnect();
 
+  ClearBatchedWrites();
+
   RecordHistograms();
 
   net_log_.EndEvent(NetLog::TYPE_SPDY_SESSION);
@@ -1417,6 +1446,11 @@ int SpdySession::DoRead() {
 
   CHECK(connection_);
   CHECK(connection_->socket());
+  // If zero-copy slices of |read_buffer_| handed out by
+  // OnStreamFrameData() are still alive, read into a fresh buffer; the
+  // old one is freed once the last slice is consumed.
+  if (!read_buffer_->HasOneRef())
+    read_buffer_ = new IOBuffer(kReadBufferSize);
   read_state_ = READ_STATE_DO_READ_COMPLETE;
   return connection_->socket()->Read(
       read_buffer_.get(),
@@ -1527,44 +1561,35 @@ int SpdySession::DoWrite() {
   } else {
     // Grab the next frame to send.
     SpdyFrameType frame_type = DATA;
-    scoped_ptr<SpdyBufferProducer> producer;
     base::WeakPtr<SpdyStream> stream;
-    if (!write_queue_.Dequeue(&frame_type, &producer, &stream)) {
+    in_flight_write_ = ProduceNextWrite(&frame_type, &stream);
+    if (!in_flight_write_) {
       write_state_ = WRITE_STATE_IDLE;
       return ERR_IO_PENDING;
     }
-
-    if (stream.get())
-      CHECK(!stream->IsClosed());
-
-    // Activate the stream only when sending the SYN_STREAM frame to
-    // guarantee monotonically-increasing stream IDs.
-    if (frame_type == SYN_STREAM) {
-      CHECK(stream.get());
-      CHECK_EQ(stream->stream_id(), 0u);
-      scoped_ptr<SpdyStream> owned_stream =
-          ActivateCreatedStream(stream.get());
-      InsertActivatedStream(owned_stream.Pass());
-
-      if (stream_hi_water_mark_ > kLastStreamId) {
-        CHECK_EQ(stream->stream_id(), kLastStreamId);
-        // We've exhausted the stream ID space, and no new streams may be
-        // created after this one.
-        MakeUnavailable();
-        StartGoingAway(kLastStreamId, ERR_ABORTED);
-      }
-    }
-
-    in_flight_write_ = producer->ProduceBuffer();
-    if (!in_flight_write_) {
-      NOTREACHED();
-      return ERR_UNEXPECTED;
-    }
     in_flight_write_frame_type_ = frame_type;
     in_flight_write_frame_size_ = in_flight_write_->GetRemainingSize();
     DCHECK_GE(in_flight_write_frame_size_,
               buffered_spdy_framer_->GetFrameMinimumSize());
     in_flight_write_stream_ = stream;
+
+    // In batching mode, drain more frames from the write queue (in
+    // priority order, since that's the order Dequeue() returns them
+    // in) so that they all go out in a single socket write.
+    if (enable_write_batching_) {
+      DCHECK(in_flight_batched_writes_.empty());
+      size_t batched_size = in_flight_write_frame_size_;
+      while (batched_size < kMaxWriteBatchBytes &&
+             in_flight_batched_writes_.size() + 1 < kMaxWriteBatchFrames &&
+             availability_state_ != STATE_DRAINING) {
+        scoped_ptr<SpdyBuffer> buffer = ProduceNextWrite(&frame_type, &stream);
+        if (!buffer)
+          break;
+        batched_size += buffer->GetRemainingSize();
+        in_flight_batched_writes_.push_back(
+            BatchedWrite(frame_type, buffer.release(), stream));
+      }
+    }
   }
 
   write_state_ = WRITE_STATE_DO_WRITE_COMPLETE;
@@ -1572,15 +1597,85 @@ int SpdySession::DoWrite() {
   // Explicitly store in a scoped_refptr<IOBuffer> to avoid problems
   // with Socket implementations that don't store their IOBuffer
   // argument in a scoped_refptr<IOBuffer> (see crbug.com/232345).
-  scoped_refptr<IOBuffer> write_io_buffer =
-      in_flight_write_->GetIOBufferForRemainingData();
+  scoped_refptr<IOBuffer> write_io_buffer;
+  size_t write_size = in_flight_write_->GetRemainingSize();
+  if (in_flight_batched_writes_.empty()) {
+    write_io_buffer = in_flight_write_->GetIOBufferForRemainingData();
+  } else {
+    // Copy the remaining data of the in-flight frame and every batched
+    // frame into one contiguous buffer. The constituent buffers are
+    // kept alive so that consume callbacks and frame completion
+    // notifications still fire per frame in DoWriteComplete().
+    for (std::deque<BatchedWrite>::const_iterator it =
+             in_flight_batched_writes_.begin();
+         it != in_flight_batched_writes_.end(); ++it) {
+      write_size += it->buffer->GetRemainingSize();
+    }
+    write_io_buffer = new IOBuffer(write_size);
+    char* dest = write_io_buffer->data();
+    std::memcpy(dest, in_flight_write_->GetRemainingData(),
+                in_flight_write_->GetRemainingSize());
+    dest += in_flight_write_->GetRemainingSize();
+    for (std::deque<BatchedWrite>::const_iterator it =
+             in_flight_batched_writes_.begin();
+         it != in_flight_batched_writes_.end(); ++it) {
+      std::memcpy(dest, it->buffer->GetRemainingData(),
+                  it->buffer->GetRemainingSize());
+      dest += it->buffer->GetRemainingSize();
+    }
+  }
   return connection_->socket()->Write(
       write_io_buffer.get(),
-      in_flight_write_->GetRemainingSize(),
+      write_size,
       base::Bind(&SpdySession::PumpWriteLoop,
                  weak_factory_.GetWeakPtr(), WRITE_STATE_DO_WRITE_COMPLETE));
 }
 
+scoped_ptr<SpdyBuffer> SpdySession::ProduceNextWrite(
+    SpdyFrameType* frame_type,
+    base::WeakPtr<SpdyStream>* stream) {
+  scoped_ptr<SpdyBufferProducer> producer;
+  if (!write_queue_.Dequeue(frame_type, &producer, stream))
+    return scoped_ptr<SpdyBuffer>();
+
+  if (stream->get())
+    CHECK(!(*stream)->IsClosed());
+
+  // Activate the stream only when sending the SYN_STREAM frame to
+  // guarantee monotonically-increasing stream IDs.
+  if (*frame_type == SYN_STREAM) {
+    CHECK(stream->get());
+    CHECK_EQ((*stream)->stream_id(), 0u);
+    scoped_ptr<SpdyStream> owned_stream =
+        ActivateCreatedStream(stream->get());
+    InsertActivatedStream(owned_stream.Pass());
+
+    if (stream_hi_water_mark_ > kLastStreamId) {
+      CHECK_EQ((*stream)->stream_id(), kLastStreamId);
+      // We've exhausted the stream ID space, and no new streams may be
+      // created after this one.
+      MakeUnavailable();
+      StartGoingAway(kLastStreamId, ERR_ABORTED);
+    }
+  }
+
+  scoped_ptr<SpdyBuffer> buffer = producer->ProduceBuffer();
+  if (!buffer) {
+    NOTREACHED();
+    return scoped_ptr<SpdyBuffer>();
+  }
+  return buffer.Pass();
+}
+
+void SpdySession::ClearBatchedWrites() {
+  for (std::deque<BatchedWrite>::const_iterator it =
+           in_flight_batched_writes_.begin();
+       it != in_flight_batched_writes_.end(); ++it) {
+    delete it->buffer;
+  }
+  in_flight_batched_writes_.clear();
+}
+
 int SpdySession::DoWriteComplete(int result) {
   CHECK(in_io_loop_);
   DCHECK_NE(result, ERR_IO_PENDING);
@@ -1594,38 +1689,53 @@ int SpdySession::DoWriteComplete(int result) {
     in_flight_write_frame_type_ = DATA;
     in_flight_write_frame_size_ = 0;
     in_flight_write_stream_.reset();
+    ClearBatchedWrites();
     write_state_ = WRITE_STATE_DO_WRITE;
     DoDrainSession(static_cast<Error>(result), "Write error");
     return OK;
   }
 
-  // It should not be possible to have written more bytes than our
-  // in_flight_write_.
-  DCHECK_LE(static_cast<size_t>(result),
-            in_flight_write_->GetRemainingSize());
-
-  if (result > 0) {
-    in_flight_write_->Consume(static_cast<size_t>(result));
+  while (result > 0) {
+    const size_t consumed = std::min(static_cast<size_t>(result),
+                                     in_flight_write_->GetRemainingSize());
+    in_flight_write_->Consume(consumed);
+    result -= static_cast<int>(consumed);
 
     // We only notify the stream when we've fully written the pending frame.
-    if (in_flight_write_->GetRemainingSize() == 0) {
-      // It is possible that the stream was cancelled while we were
-      // writing to the socket.
-      if (in_flight_write_stream_.get()) {
-        DCHECK_GT(in_flight_write_frame_size_, 0u);
-        in_flight_write_stream_->OnFrameWriteComplete(
-            in_flight_write_frame_type_,
-            in_flight_write_frame_size_);
-      }
+    if (in_flight_write_->GetRemainingSize() > 0)
+      break;
 
-      // Cleanup the write which just completed.
-      in_flight_write_.reset();
-      in_flight_write_frame_type_ = DATA;
-      in_flight_write_frame_size_ = 0;
-      in_flight_write_stream_.reset();
+    // It is possible that the stream was cancelled while we were
+    // writing to the socket.
+    if (in_flight_write_stream_.get()) {
+      DCHECK_GT(in_flight_write_frame_size_, 0u);
+      in_flight_write_stream_->OnFrameWriteComplete(
+          in_flight_write_frame_type_,
+          in_flight_write_frame_size_);
     }
+
+    // Cleanup the write which just completed.
+    in_flight_write_.reset();
+    in_flight_write_frame_type_ = DATA;
+    in_flight_write_frame_size_ = 0;
+    in_flight_write_stream_.reset();
+
+    // Promote the next batched frame, if any, so that further written
+    // bytes are accounted to it.
+    if (in_flight_batched_writes_.empty())
+      break;
+    const BatchedWrite& next = in_flight_batched_writes_.front();
+    in_flight_write_.reset(next.buffer);
+    in_flight_write_frame_type_ = next.frame_type;
+    in_flight_write_frame_size_ = next.frame_size;
+    in_flight_write_stream_ = next.stream;
+    in_flight_batched_writes_.pop_front();
   }
 
+  // It should not be possible to have written more bytes than our
+  // in-flight frames.
+  DCHECK(in_flight_write_ || result == 0);
+
   write_state_ = WRITE_STATE_DO_WRITE;
   return OK;
 }
@@ -2075,7 +2185,18 @@ void SpdySession::OnStreamFrameData(SpdyStreamId stream_id,
   if (data) {
     DCHECK_GT(len, 0u);
     CHECK_LE(len, static_cast<size_t>(kReadBufferSize));
-    buffer.reset(new SpdyBuffer(data, len));
+    // Large payloads that the framer handed to us straight out of
+    // |read_buffer_| are wrapped in a zero-copy slice of it; DoRead()
+    // switches to a fresh read buffer while slices are alive. Payloads
+    // from anywhere else (e.g. buffered by the framer) must be copied.
+    const char* read_buffer_start = read_buffer_->data();
+    if (len >= kMinBufferSliceSize && data >= read_buffer_start &&
+        data + len <= read_buffer_start + kReadBufferSize) {
+      buffer.reset(new SpdyBuffer(
+          read_buffer_, static_cast<size_t>(data - read_buffer_start), len));
+    } else {
+      buffer.reset(new SpdyBuffer(data, len));
+    }
 
     if (flow_control_state_ == FLOW_CONTROL_STREAM_AND_SESSION) {
       DecreaseRecvWindowSize(static_cast<int32>(len));
@@ -243,6 +243,7 @@ class NET_EXPORT SpdySession : public BufferedSpdyFramerVisitorInterface,
               bool verify_domain_authentication,
               bool enable_sending_initial_data,
               bool enable_compression,
+              bool enable_write_batching,
               bool enable_ping_based_connection_checking,
               NextProto default_protocol,
               size_t stream_initial_recv_window_size,
@@ -700,6 +701,15 @@ class NET_EXPORT SpdySession : public BufferedSpdyFramerVisitorInterface,
   int DoWrite();
   int DoWriteComplete(int result);
 
+  // Dequeues the next write from |write_queue_|, activating its stream
+  // if it is a SYN_STREAM write, and produces its frame buffer. Returns
+  // NULL if the write queue is empty. Called by DoWrite().
+  scoped_ptr<SpdyBuffer> ProduceNextWrite(SpdyFrameType* frame_type,
+                                          base::WeakPtr<SpdyStream>* stream);
+
+  // Deletes the buffers in |in_flight_batched_writes_| and clears it.
+  void ClearBatchedWrites();
+
   // TODO(akalin): Rename the Send* and Write* functions below to
   // Enqueue*.
 
@@ -1041,6 +1051,26 @@ class NET_EXPORT SpdySession : public BufferedSpdyFramerVisitorInterface,
   // the socket completely.
   base::WeakPtr<SpdyStream> in_flight_write_stream_;
 
+  // A frame coalesced into the current socket write behind
+  // |in_flight_write_|. Only used when write batching is enabled.
+  struct BatchedWrite {
+    BatchedWrite(SpdyFrameType frame_type,
+                 SpdyBuffer* buffer,
+                 const base::WeakPtr<SpdyStream>& stream);
+    ~BatchedWrite();
+
+    SpdyFrameType frame_type;
+    size_t frame_size;
+    // Owned; this has to be a raw pointer since we store this in an
+    // STL container.
+    SpdyBuffer* buffer;
+    base::WeakPtr<SpdyStream> stream;
+  };
+
+  // Frames coalesced into the current socket write behind
+  // |in_flight_write_|, in write order.
+  std::deque<BatchedWrite> in_flight_batched_writes_;
+
   // Flag if we're using an SSL connection for this SpdySession.
   bool is_secure_;
 
@@ -1138,6 +1168,7 @@ class NET_EXPORT SpdySession : public BufferedSpdyFramerVisitorInterface,
   bool verify_domain_authentication_;
   bool enable_sending_initial_data_;
   bool enable_compression_;
+  bool enable_write_batching_;
   bool enable_ping_based_connection_checking_;
 
   // The SPDY protocol used. Always between kProtoSPDYMinimumVersion and
@@ -34,6 +34,7 @@ SpdySessionPool::SpdySessionPool(
     TransportSecurityState* transport_security_state,
     bool force_single_domain,
     bool enable_compression,
+    bool enable_write_batching,
     bool enable_ping_based_connection_checking,
     NextProto default_protocol,
     size_t stream_initial_recv_window_size,
@@ -49,6 +50,7 @@ SpdySessionPool::SpdySessionPool(
       enable_sending_initial_data_(true),
       force_single_domain_(force_single_domain),
       enable_compression_(enable_compression),
+      enable_write_batching_(enable_write_batching),
       enable_ping_based_connection_checking_(
           enable_ping_based_connection_checking),
       // TODO(akalin): Force callers to have a valid value of
@@ -104,6 +106,7 @@ base::WeakPtr<SpdySession> SpdySessionPool::CreateAvailableSessionFromSocket(
                       verify_domain_authentication_,
                       enable_sending_initial_data_,
                       enable_compression_,
+                      enable_write_batching_,
                       enable_ping_based_connection_checking_,
                       default_protocol_,
                       stream_initial_recv_window_size_,
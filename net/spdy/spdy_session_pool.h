@@ -54,6 +54,7 @@ class NET_EXPORT SpdySessionPool
       TransportSecurityState* transport_security_state,
       bool force_single_domain,
       bool enable_compression,
+      bool enable_write_batching,
       bool enable_ping_based_connection_checking,
       NextProto default_protocol,
       size_t stream_initial_recv_window_size,
@@ -218,6 +219,7 @@ class NET_EXPORT SpdySessionPool
   bool enable_sending_initial_data_;
   bool force_single_domain_;
   bool enable_compression_;
+  bool enable_write_batching_;
   bool enable_ping_based_connection_checking_;
   const NextProto default_protocol_;
   size_t stream_initial_recv_window_size_;
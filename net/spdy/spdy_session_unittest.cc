@@ -1903,6 +1903,100 @@ TEST_P(SpdySessionTest, OutOfOrderSynStreams) {
   EXPECT_EQ(1u, delegate_highest.stream_id());
 }
 
+// With write batching enabled, queued frames should be coalesced into
+// a single socket write, in priority order.
+TEST_P(SpdySessionTest, BatchedWrites) {
+  session_deps_.enable_write_batching = true;
+
+  // Construct the request.
+  MockConnect connect_data(SYNCHRONOUS, OK);
+  scoped_ptr<SpdyFrame> req_highest(
+      spdy_util_.ConstructSpdyGet(NULL, 0, false, 1, HIGHEST, true));
+  scoped_ptr<SpdyFrame> req_lowest(
+      spdy_util_.ConstructSpdyGet(NULL, 0, false, 3, LOWEST, true));
+
+  // Both SYN_STREAMs should go out in one write.
+  const SpdyFrame* req_frames[2] = {
+    req_highest.get(),
+    req_lowest.get(),
+  };
+  char combined_reqs[1000];
+  int combined_reqs_len = CombineFrames(
+      req_frames, arraysize(req_frames),
+      combined_reqs, arraysize(combined_reqs));
+  MockWrite writes[] = {
+    MockWrite(ASYNC, combined_reqs, combined_reqs_len, 0),
+  };
+
+  scoped_ptr<SpdyFrame> resp_highest(
+      spdy_util_.ConstructSpdyGetSynReply(NULL, 0, 1));
+  scoped_ptr<SpdyFrame> body_highest(
+      spdy_util_.ConstructSpdyBodyFrame(1, true));
+  scoped_ptr<SpdyFrame> resp_lowest(
+      spdy_util_.ConstructSpdyGetSynReply(NULL, 0, 3));
+  scoped_ptr<SpdyFrame> body_lowest(
+      spdy_util_.ConstructSpdyBodyFrame(3, true));
+  MockRead reads[] = {
+    CreateMockRead(*resp_highest, 1),
+    CreateMockRead(*body_highest, 2),
+    CreateMockRead(*resp_lowest, 3),
+    CreateMockRead(*body_lowest, 4),
+    MockRead(ASYNC, 0, 5)  // EOF
+  };
+
+  session_deps_.host_resolver->set_synchronous_mode(true);
+
+  DeterministicSocketData data(reads, arraysize(reads),
+                               writes, arraysize(writes));
+  data.set_connect_data(connect_data);
+  session_deps_.deterministic_socket_factory->AddSocketDataProvider(&data);
+
+  CreateDeterministicNetworkSession();
+
+  base::WeakPtr<SpdySession> session =
+      CreateInsecureSpdySession(http_session_, key_, BoundNetLog());
+
+  GURL url(kDefaultURL);
+
+  base::WeakPtr<SpdyStream> spdy_stream_lowest =
+      CreateStreamSynchronously(SPDY_REQUEST_RESPONSE_STREAM,
+                                session, url, LOWEST, BoundNetLog());
+  ASSERT_TRUE(spdy_stream_lowest);
+  EXPECT_EQ(0u, spdy_stream_lowest->stream_id());
+  test::StreamDelegateDoNothing delegate_lowest(spdy_stream_lowest);
+  spdy_stream_lowest->SetDelegate(&delegate_lowest);
+
+  base::WeakPtr<SpdyStream> spdy_stream_highest =
+      CreateStreamSynchronously(SPDY_REQUEST_RESPONSE_STREAM,
+                                session, url, HIGHEST, BoundNetLog());
+  ASSERT_TRUE(spdy_stream_highest);
+  EXPECT_EQ(0u, spdy_stream_highest->stream_id());
+  test::StreamDelegateDoNothing delegate_highest(spdy_stream_highest);
+  spdy_stream_highest->SetDelegate(&delegate_highest);
+
+  // Queue the lower priority one first; the higher priority one
+  // should still come first in the combined write.
+
+  scoped_ptr<SpdyHeaderBlock> headers_lowest(
+      spdy_util_.ConstructGetHeaderBlock(url.spec()));
+  spdy_stream_lowest->SendRequestHeaders(
+      headers_lowest.Pass(), NO_MORE_DATA_TO_SEND);
+  EXPECT_TRUE(spdy_stream_lowest->HasUrlFromHeaders());
+
+  scoped_ptr<SpdyHeaderBlock> headers_highest(
+      spdy_util_.ConstructGetHeaderBlock(url.spec()));
+  spdy_stream_highest->SendRequestHeaders(
+      headers_highest.Pass(), NO_MORE_DATA_TO_SEND);
+  EXPECT_TRUE(spdy_stream_highest->HasUrlFromHeaders());
+
+  data.RunFor(6);
+
+  EXPECT_FALSE(spdy_stream_lowest);
+  EXPECT_FALSE(spdy_stream_highest);
+  EXPECT_EQ(3u, delegate_lowest.stream_id());
+  EXPECT_EQ(1u, delegate_highest.stream_id());
+}
+
 TEST_P(SpdySessionTest, CancelStream) {
   MockConnect connect_data(SYNCHRONOUS, OK);
   // Request 1, at HIGHEST priority, will be cancelled before it writes data.
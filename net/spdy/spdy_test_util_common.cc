@@ -364,6 +364,7 @@ SpdySessionDependencies::SpdySessionDependencies(NextProto protocol)
           HttpAuthHandlerFactory::CreateDefault(host_resolver.get())),
       enable_ip_pooling(true),
       enable_compression(false),
+      enable_write_batching(false),
       enable_ping(false),
       enable_user_alternate_protocol_ports(false),
       protocol(protocol),
@@ -398,6 +399,7 @@ SpdySessionDependencies::SpdySessionDependencies(NextProto protocol,
           HttpAuthHandlerFactory::CreateDefault(host_resolver.get())),
       enable_ip_pooling(true),
       enable_compression(false),
+      enable_write_batching(false),
       enable_ping(false),
       enable_user_alternate_protocol_ports(false),
       protocol(protocol),
@@ -454,6 +456,7 @@ net::HttpNetworkSession::Params SpdySessionDependencies::CreateSessionParams(
   params.http_server_properties =
       session_deps->http_server_properties.GetWeakPtr();
   params.enable_spdy_compression = session_deps->enable_compression;
+  params.enable_spdy_write_batching = session_deps->enable_write_batching;
   params.enable_spdy_ping_based_connection_checking = session_deps->enable_ping;
   params.enable_user_alternate_protocol_ports =
       session_deps->enable_user_alternate_protocol_ports;
@@ -212,6 +212,7 @@ struct SpdySessionDependencies {
   HttpServerPropertiesImpl http_server_properties;
   bool enable_ip_pooling;
   bool enable_compression;
+  bool enable_write_batching;
   bool enable_ping;
   bool enable_user_alternate_protocol_ports;
   NextProto protocol;
@@ -0,0 +1,44 @@
+// Copyright 2015 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/udp/datagram_client_socket.h"
+
+#include "base/bind.h"
+#include "base/logging.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+
+namespace net {
+
+namespace {
+
+// Adapts a single Read() completion to the packet count convention of
+// ReadMultiple().
+void DidReadOnePacket(std::vector<DatagramReadBuffer>* buffers,
+                      const CompletionCallback& callback,
+                      int result) {
+  if (result < 0) {
+    callback.Run(result);
+    return;
+  }
+  buffers->front().bytes_read = result;
+  callback.Run(1);
+}
+
+}  // namespace
+
+int DatagramClientSocket::ReadMultiple(
+    std::vector<DatagramReadBuffer>* buffers,
+    const CompletionCallback& callback) {
+  DCHECK(!buffers->empty());
+  DatagramReadBuffer* first = &buffers->front();
+  int rv = Read(first->buffer.get(), first->buffer_length,
+                base::Bind(&DidReadOnePacket, buffers, callback));
+  if (rv < 0)
+    return rv;
+  first->bytes_read = rv;
+  return 1;
+}
+
+}  // namespace net
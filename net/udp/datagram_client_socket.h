@@ -5,6 +5,8 @@
 #ifndef NET_UDP_DATAGRAM_CLIENT_SOCKET_H_
 #define NET_UDP_DATAGRAM_CLIENT_SOCKET_H_
 
+#include <vector>
+
 #include "net/socket/socket.h"
 #include "net/udp/datagram_socket.h"
 
@@ -20,6 +22,16 @@ class NET_EXPORT_PRIVATE DatagramClientSocket : public DatagramSocket,
   // Initialize this socket as a client socket to server at |address|.
   // Returns a network error code.
   virtual int Connect(const IPEndPoint& address) = 0;
+
+  // Reads as many datagrams as are ready, one per element of |buffers|,
+  // with a single system call where the platform supports it. Returns the
+  // number of packets read, a net error code, or ERR_IO_PENDING if no
+  // datagram is ready yet; the callback is later run with the same
+  // convention once at least one packet has been read. |buffers| must be
+  // kept alive by the caller until the operation completes. The default
+  // implementation reads a single packet with Read().
+  virtual int ReadMultiple(std::vector<DatagramReadBuffer>* buffers,
+                           const CompletionCallback& callback);
 };
 
 }  // namespace net
@@ -5,13 +5,23 @@
 #ifndef NET_UDP_DATAGRAM_SOCKET_H_
 #define NET_UDP_DATAGRAM_SOCKET_H_
 
+#include "base/memory/ref_counted.h"
 #include "net/base/net_export.h"
 
 namespace net {
 
 class BoundNetLog;
+class IOBuffer;
 class IPEndPoint;
 
+// A caller-owned buffer for one datagram in a batch read, and the size of
+// the packet read into it. See DatagramClientSocket::ReadMultiple().
+struct NET_EXPORT_PRIVATE DatagramReadBuffer {
+  scoped_refptr<IOBuffer> buffer;
+  int buffer_length;
+  int bytes_read;
+};
+
 // A datagram socket is an interface to a protocol which exchanges
 // datagrams, like UDP.
 class NET_EXPORT_PRIVATE DatagramSocket {
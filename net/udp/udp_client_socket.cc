@@ -32,6 +32,13 @@ int UDPClientSocket::Read(IOBuffer* buf,
   return socket_.Read(buf, buf_len, callback);
 }
 
+#if defined(OS_POSIX)
+int UDPClientSocket::ReadMultiple(std::vector<DatagramReadBuffer>* buffers,
+                                  const CompletionCallback& callback) {
+  return socket_.ReadMultiple(buffers, callback);
+}
+#endif
+
 int UDPClientSocket::Write(IOBuffer* buf,
                           int buf_len,
                           const CompletionCallback& callback) {
@@ -28,6 +28,10 @@ class NET_EXPORT_PRIVATE UDPClientSocket : public DatagramClientSocket {
   int Read(IOBuffer* buf,
            int buf_len,
            const CompletionCallback& callback) override;
+#if defined(OS_POSIX)
+  int ReadMultiple(std::vector<DatagramReadBuffer>* buffers,
+                   const CompletionCallback& callback) override;
+#endif
   int Write(IOBuffer* buf,
             int buf_len,
             const CompletionCallback& callback) override;
@@ -9,6 +9,7 @@
 #include <netdb.h>
 #include <net/if.h>
 #include <netinet/in.h>
+#include <string.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 
@@ -77,6 +78,7 @@ UDPSocketLibevent::UDPSocketLibevent(
           write_watcher_(this),
           read_buf_len_(0),
           recv_from_address_(NULL),
+          read_multiple_buffers_(NULL),
           write_buf_len_(0),
           net_log_(BoundNetLog::Make(net_log, NetLog::SOURCE_UDP_SOCKET)) {
   net_log_.BeginEvent(NetLog::TYPE_SOCKET_ALIVE,
@@ -117,6 +119,8 @@ void UDPSocketLibevent::Close() {
   read_buf_len_ = 0;
   read_callback_.Reset();
   recv_from_address_ = NULL;
+  read_multiple_buffers_ = NULL;
+  read_multiple_callback_.Reset();
   write_buf_ = NULL;
   write_buf_len_ = 0;
   write_callback_.Reset();
@@ -183,6 +187,33 @@ int UDPSocketLibevent::Read(IOBuffer* buf,
   return RecvFrom(buf, buf_len, NULL, callback);
 }
 
+int UDPSocketLibevent::ReadMultiple(std::vector<DatagramReadBuffer>* buffers,
+                                    const CompletionCallback& callback) {
+  DCHECK(CalledOnValidThread());
+  DCHECK_NE(kInvalidSocket, socket_);
+  CHECK(read_callback_.is_null());
+  CHECK(read_multiple_callback_.is_null());
+  DCHECK(!callback.is_null());  // Synchronous operation not supported
+  DCHECK(!buffers->empty());
+
+  int result = InternalReadMultiple(buffers);
+  if (result != ERR_IO_PENDING)
+    return result;
+
+  if (!base::MessageLoopForIO::current()->WatchFileDescriptor(
+          socket_, true, base::MessageLoopForIO::WATCH_READ,
+          &read_socket_watcher_, &read_watcher_)) {
+    PLOG(ERROR) << "WatchFileDescriptor failed on read";
+    int result = MapSystemError(errno);
+    LogRead(result, NULL, 0, NULL);
+    return result;
+  }
+
+  read_multiple_buffers_ = buffers;
+  read_multiple_callback_ = callback;
+  return ERR_IO_PENDING;
+}
+
 int UDPSocketLibevent::RecvFrom(IOBuffer* buf,
                                 int buf_len,
                                 IPEndPoint* address,
@@ -366,6 +397,8 @@ int UDPSocketLibevent::SetBroadcast(bool broadcast) {
 void UDPSocketLibevent::ReadWatcher::OnFileCanReadWithoutBlocking(int) {
   if (!socket_->read_callback_.is_null())
     socket_->DidCompleteRead();
+  else if (!socket_->read_multiple_callback_.is_null())
+    socket_->DidCompleteReadMultiple();
 }
 
 void UDPSocketLibevent::WriteWatcher::OnFileCanWriteWithoutBlocking(int) {
@@ -383,6 +416,17 @@ void UDPSocketLibevent::DoReadCallback(int rv) {
   c.Run(rv);
 }
 
+void UDPSocketLibevent::DoReadMultipleCallback(int rv) {
+  DCHECK_NE(rv, ERR_IO_PENDING);
+  DCHECK(!read_multiple_callback_.is_null());
+
+  // Since Run may result in ReadMultiple being called, clear
+  // read_multiple_callback_ up front.
+  CompletionCallback c = read_multiple_callback_;
+  read_multiple_callback_.Reset();
+  c.Run(rv);
+}
+
 void UDPSocketLibevent::DoWriteCallback(int rv) {
   DCHECK_NE(rv, ERR_IO_PENDING);
   DCHECK(!write_callback_.is_null());
@@ -406,6 +450,16 @@ void UDPSocketLibevent::DidCompleteRead() {
   }
 }
 
+void UDPSocketLibevent::DidCompleteReadMultiple() {
+  int result = InternalReadMultiple(read_multiple_buffers_);
+  if (result != ERR_IO_PENDING) {
+    read_multiple_buffers_ = NULL;
+    bool ok = read_socket_watcher_.StopWatchingFileDescriptor();
+    DCHECK(ok);
+    DoReadMultipleCallback(result);
+  }
+}
+
 void UDPSocketLibevent::LogRead(int result,
                                 const char* bytes,
                                 socklen_t addr_len,
@@ -492,6 +546,51 @@ int UDPSocketLibevent::InternalRecvFrom(IOBuffer* buf, int buf_len,
   return result;
 }
 
+int UDPSocketLibevent::InternalReadMultiple(
+    std::vector<DatagramReadBuffer>* buffers) {
+#if defined(OS_LINUX)
+  if (buffers->size() > 1) {
+    const size_t buffer_count = buffers->size();
+    std::vector<struct mmsghdr> msgs(buffer_count);
+    std::vector<struct iovec> iovs(buffer_count);
+    std::vector<SockaddrStorage> storages(buffer_count);
+    memset(&msgs[0], 0, buffer_count * sizeof(msgs[0]));
+    for (size_t i = 0; i < buffer_count; ++i) {
+      iovs[i].iov_base = (*buffers)[i].buffer->data();
+      iovs[i].iov_len = (*buffers)[i].buffer_length;
+      msgs[i].msg_hdr.msg_iov = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_hdr.msg_name = storages[i].addr;
+      msgs[i].msg_hdr.msg_namelen = storages[i].addr_len;
+    }
+
+    int packets_read =
+        HANDLE_EINTR(recvmmsg(socket_, &msgs[0], buffer_count, 0, NULL));
+    if (packets_read < 0) {
+      int result = MapSystemError(errno);
+      if (result != ERR_IO_PENDING)
+        LogRead(result, NULL, 0, NULL);
+      return result;
+    }
+    for (int i = 0; i < packets_read; ++i) {
+      (*buffers)[i].bytes_read = msgs[i].msg_len;
+      LogRead(msgs[i].msg_len, (*buffers)[i].buffer->data(),
+              msgs[i].msg_hdr.msg_namelen, storages[i].addr);
+    }
+    return packets_read;
+  }
+#endif  // defined(OS_LINUX)
+
+  // Platforms without a batch receive call read a single packet.
+  DatagramReadBuffer* first = &buffers->front();
+  int result =
+      InternalRecvFrom(first->buffer.get(), first->buffer_length, NULL);
+  if (result < 0)
+    return result;
+  first->bytes_read = result;
+  return 1;
+}
+
 int UDPSocketLibevent::InternalSendTo(IOBuffer* buf, int buf_len,
                                       const IPEndPoint* address) {
   SockaddrStorage storage;
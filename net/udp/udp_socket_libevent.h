@@ -5,6 +5,8 @@
 #ifndef NET_UDP_UDP_SOCKET_LIBEVENT_H_
 #define NET_UDP_UDP_SOCKET_LIBEVENT_H_
 
+#include <vector>
+
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
 #include "base/message_loop/message_loop.h"
@@ -63,6 +65,16 @@ class NET_EXPORT UDPSocketLibevent : public base::NonThreadSafe {
   // has been connected.
   int Read(IOBuffer* buf, int buf_len, const CompletionCallback& callback);
 
+  // Reads up to |buffers->size()| datagrams from the socket, one per
+  // element, with a single recvmmsg() call where available. Returns the
+  // number of packets read, a net error code, or ERR_IO_PENDING; the
+  // callback is then run with the same convention once at least one packet
+  // is ready. |buffers| must be kept alive until the operation completes.
+  // Only usable from the client-side of a UDP socket, after the socket
+  // has been connected.
+  int ReadMultiple(std::vector<DatagramReadBuffer>* buffers,
+                   const CompletionCallback& callback);
+
   // Writes to the socket.
   // Only usable from the client-side of a UDP socket, after the socket
   // has been connected.
@@ -214,8 +226,10 @@ class NET_EXPORT UDPSocketLibevent : public base::NonThreadSafe {
   };
 
   void DoReadCallback(int rv);
+  void DoReadMultipleCallback(int rv);
   void DoWriteCallback(int rv);
   void DidCompleteRead();
+  void DidCompleteReadMultiple();
   void DidCompleteWrite();
 
   // Handles stats and logging. |result| is the number of bytes transferred, on
@@ -236,6 +250,7 @@ class NET_EXPORT UDPSocketLibevent : public base::NonThreadSafe {
 
   int InternalConnect(const IPEndPoint& address);
   int InternalRecvFrom(IOBuffer* buf, int buf_len, IPEndPoint* address);
+  int InternalReadMultiple(std::vector<DatagramReadBuffer>* buffers);
   int InternalSendTo(IOBuffer* buf, int buf_len, const IPEndPoint* address);
 
   // Applies |socket_options_| to |socket_|. Should be called before
@@ -285,6 +300,9 @@ class NET_EXPORT UDPSocketLibevent : public base::NonThreadSafe {
   int read_buf_len_;
   IPEndPoint* recv_from_address_;
 
+  // The caller-owned buffers used to retry ReadMultiple() requests.
+  std::vector<DatagramReadBuffer>* read_multiple_buffers_;
+
   // The buffer used by InternalWrite() to retry Write requests
   scoped_refptr<IOBuffer> write_buf_;
   int write_buf_len_;
@@ -293,6 +311,9 @@ class NET_EXPORT UDPSocketLibevent : public base::NonThreadSafe {
   // External callback; called when read is complete.
   CompletionCallback read_callback_;
 
+  // External callback; called when a multiple packet read is complete.
+  CompletionCallback read_multiple_callback_;
+
   // External callback; called when write is complete.
   CompletionCallback write_callback_;
 
@@ -93,6 +93,9 @@ int TestURLFetcher::GetLoadFlags() const {
   return fake_load_flags_;
 }
 
+void TestURLFetcher::SetRequestPriority(RequestPriority priority) {
+}
+
 void TestURLFetcher::SetReferrer(const std::string& referrer) {
 }
 
@@ -167,6 +167,12 @@ class NET_EXPORT URLFetcher {
   // Returns the current load flags.
   virtual int GetLoadFlags() const = 0;
 
+  // Sets the priority of the underlying request relative to other requests
+  // in its context. Startup and other background traffic should use IDLE so
+  // that it does not compete with user-visible loads. Must be called before
+  // the request is started; defaults to DEFAULT_PRIORITY.
+  virtual void SetRequestPriority(RequestPriority priority) = 0;
+
   // The referrer URL for the request. Must be called before the request is
   // started.
   virtual void SetReferrer(const std::string& referrer) = 0;
@@ -79,6 +79,7 @@ URLFetcherCore::URLFetcherCore(URLFetcher* fetcher,
       delegate_(d),
       delegate_task_runner_(base::ThreadTaskRunnerHandle::Get()),
       load_flags_(LOAD_NORMAL),
+      request_priority_(DEFAULT_PRIORITY),
       response_code_(URLFetcher::RESPONSE_CODE_INVALID),
       buffer_(new IOBuffer(kBufferSize)),
       url_request_data_key_(NULL),
@@ -206,6 +207,10 @@ int URLFetcherCore::GetLoadFlags() const {
   return load_flags_;
 }
 
+void URLFetcherCore::SetRequestPriority(RequestPriority priority) {
+  request_priority_ = priority;
+}
+
 void URLFetcherCore::SetReferrer(const std::string& referrer) {
   referrer_ = referrer;
 }
@@ -558,7 +563,7 @@ void URLFetcherCore::StartURLRequest() {
   g_registry.Get().AddURLFetcherCore(this);
   current_response_bytes_ = 0;
   request_ = request_context_getter_->GetURLRequestContext()->CreateRequest(
-      original_url_, DEFAULT_PRIORITY, this, NULL);
+      original_url_, request_priority_, this, NULL);
   request_->set_stack_trace(stack_trace_);
   int flags = request_->load_flags() | load_flags_;
 
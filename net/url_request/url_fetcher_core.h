@@ -76,6 +76,7 @@ class URLFetcherCore
   // one or more of the LOAD_* flags defined in net/base/load_flags.h.
   void SetLoadFlags(int load_flags);
   int GetLoadFlags() const;
+  void SetRequestPriority(RequestPriority priority);
   void SetReferrer(const std::string& referrer);
   void SetReferrerPolicy(URLRequest::ReferrerPolicy referrer_policy);
   void SetExtraRequestHeaders(const std::string& extra_request_headers);
@@ -217,6 +218,7 @@ class URLFetcherCore
   scoped_refptr<base::TaskRunner> upload_file_task_runner_;
   scoped_ptr<URLRequest> request_;   // The actual request this wraps
   int load_flags_;                   // Flags for the load operation
+  RequestPriority request_priority_;  // Priority of the load operation
   int response_code_;                // HTTP status code for the request
   scoped_refptr<IOBuffer> buffer_;
                                      // Read buffer
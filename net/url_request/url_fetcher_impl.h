@@ -50,6 +50,7 @@ class NET_EXPORT_PRIVATE URLFetcherImpl : public URLFetcher {
                            bool is_last_chunk) override;
   void SetLoadFlags(int load_flags) override;
   int GetLoadFlags() const override;
+  void SetRequestPriority(RequestPriority priority) override;
   void SetReferrer(const std::string& referrer) override;
   void SetReferrerPolicy(URLRequest::ReferrerPolicy referrer_policy) override;
   void SetExtraRequestHeaders(
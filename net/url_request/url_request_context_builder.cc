@@ -17,6 +17,7 @@
 #include "net/base/network_delegate_impl.h"
 #include "net/cert/cert_verifier.h"
 #include "net/cookies/cookie_monster.h"
+#include "net/dns/host_cache.h"
 #include "net/dns/host_resolver.h"
 #include "net/ftp/ftp_network_layer.h"
 #include "net/http/http_auth_handler_factory.h"
@@ -254,6 +255,12 @@ URLRequestContext* URLRequestContextBuilder::Build() {
     host_resolver_ = net::HostResolver::CreateDefaultResolver(
         context->net_log());
   }
+  if (persisted_host_cache_) {
+    HostCache* host_cache = host_resolver_->GetHostCache();
+    if (host_cache)
+      host_cache->RestoreFromListValue(*persisted_host_cache_);
+    persisted_host_cache_.reset();
+  }
   storage->set_host_resolver(host_resolver_.Pass());
 
   if (!proxy_service_) {
@@ -21,6 +21,7 @@
 #include "base/files/file_path.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_ptr.h"
+#include "base/values.h"
 #include "build/build_config.h"
 #include "net/base/net_export.h"
 #include "net/base/network_delegate.h"
@@ -128,6 +129,14 @@ class NET_EXPORT URLRequestContextBuilder {
     host_resolver_.reset(host_resolver);
   }
 
+  // Seeds the host resolver's cache with entries previously written by
+  // HostCache::GetAsListValue(), so that the first requests of a session
+  // need not wait on DNS. Applied in Build(), before the context can issue
+  // any request; ignored if the resolver has no cache.
+  void set_persisted_host_cache(scoped_ptr<base::ListValue> host_cache) {
+    persisted_host_cache_ = host_cache.Pass();
+  }
+
   // Uses BasicNetworkDelegate by default. Note that calling Build will unset
   // any custom delegate in builder, so this must be called each time before
   // Build is called.
@@ -211,6 +220,7 @@ class NET_EXPORT URLRequestContextBuilder {
   base::FilePath transport_security_persister_path_;
   scoped_ptr<NetLog> net_log_;
   scoped_ptr<HostResolver> host_resolver_;
+  scoped_ptr<base::ListValue> persisted_host_cache_;
   scoped_ptr<ProxyConfigService> proxy_config_service_;
   scoped_ptr<ProxyService> proxy_service_;
   scoped_ptr<NetworkDelegate> network_delegate_;
@@ -4,7 +4,8 @@
 
 #include "net/url_request/url_request_job_factory_impl.h"
 
-#include "base/stl_util.h"
+#include <algorithm>
+
 #include "net/base/load_flags.h"
 #include "net/url_request/url_request_interceptor.h"
 #include "net/url_request/url_request_job_manager.h"
@@ -16,12 +17,22 @@ namespace {
 
 URLRequestInterceptor* g_interceptor_for_testing = NULL;
 
+// Orders the handler table by scheme for std::lower_bound.
+bool SchemeEntryLess(
+    const std::pair<std::string, URLRequestJobFactory::ProtocolHandler*>& entry,
+    const std::string& scheme) {
+  return entry.first < scheme;
+}
+
 }  // namespace
 
 URLRequestJobFactoryImpl::URLRequestJobFactoryImpl() {}
 
 URLRequestJobFactoryImpl::~URLRequestJobFactoryImpl() {
-  STLDeleteValues(&protocol_handler_map_);
+  for (ProtocolHandlerList::iterator it = protocol_handlers_.begin();
+       it != protocol_handlers_.end(); ++it) {
+    delete it->second;
+  }
 }
 
 bool URLRequestJobFactoryImpl::SetProtocolHandler(
@@ -29,22 +40,36 @@ bool URLRequestJobFactoryImpl::SetProtocolHandler(
     ProtocolHandler* protocol_handler) {
   DCHECK(CalledOnValidThread());
 
+  ProtocolHandlerList::iterator it =
+      std::lower_bound(protocol_handlers_.begin(), protocol_handlers_.end(),
+                       scheme, SchemeEntryLess);
+  bool found = it != protocol_handlers_.end() && it->first == scheme;
+
   if (!protocol_handler) {
-    ProtocolHandlerMap::iterator it = protocol_handler_map_.find(scheme);
-    if (it == protocol_handler_map_.end())
+    if (!found)
       return false;
 
     delete it->second;
-    protocol_handler_map_.erase(it);
+    protocol_handlers_.erase(it);
     return true;
   }
 
-  if (ContainsKey(protocol_handler_map_, scheme))
+  if (found)
     return false;
-  protocol_handler_map_[scheme] = protocol_handler;
+  protocol_handlers_.insert(it, SchemeAndHandler(scheme, protocol_handler));
   return true;
 }
 
+URLRequestJobFactory::ProtocolHandler*
+URLRequestJobFactoryImpl::FindProtocolHandler(const std::string& scheme) const {
+  ProtocolHandlerList::const_iterator it =
+      std::lower_bound(protocol_handlers_.begin(), protocol_handlers_.end(),
+                       scheme, SchemeEntryLess);
+  if (it == protocol_handlers_.end() || it->first != scheme)
+    return NULL;
+  return it->second;
+}
+
 URLRequestJob* URLRequestJobFactoryImpl::MaybeCreateJobWithProtocolHandler(
     const std::string& scheme,
     URLRequest* request,
@@ -57,10 +82,10 @@ URLRequestJob* URLRequestJobFactoryImpl::MaybeCreateJobWithProtocolHandler(
       return job;
   }
 
-  ProtocolHandlerMap::const_iterator it = protocol_handler_map_.find(scheme);
-  if (it == protocol_handler_map_.end())
+  ProtocolHandler* protocol_handler = FindProtocolHandler(scheme);
+  if (!protocol_handler)
     return NULL;
-  return it->second->MaybeCreateJob(request, network_delegate);
+  return protocol_handler->MaybeCreateJob(request, network_delegate);
 }
 
 URLRequestJob* URLRequestJobFactoryImpl::MaybeInterceptRedirect(
@@ -79,8 +104,8 @@ URLRequestJob* URLRequestJobFactoryImpl::MaybeInterceptResponse(
 bool URLRequestJobFactoryImpl::IsHandledProtocol(
     const std::string& scheme) const {
   DCHECK(CalledOnValidThread());
-  return ContainsKey(protocol_handler_map_, scheme) ||
-      URLRequestJobManager::GetInstance()->SupportsScheme(scheme);
+  return FindProtocolHandler(scheme) != NULL ||
+      URLRequestJobManager::SupportsScheme(scheme);
 }
 
 bool URLRequestJobFactoryImpl::IsHandledURL(const GURL& url) const {
@@ -98,13 +123,12 @@ bool URLRequestJobFactoryImpl::IsSafeRedirectTarget(
     // Error cases are safely handled.
     return true;
   }
-  ProtocolHandlerMap::const_iterator it = protocol_handler_map_.find(
-      location.scheme());
-  if (it == protocol_handler_map_.end()) {
+  ProtocolHandler* protocol_handler = FindProtocolHandler(location.scheme());
+  if (!protocol_handler) {
     // Unhandled cases are safely handled.
     return true;
   }
-  return it->second->IsSafeRedirectTarget(location);
+  return protocol_handler->IsSafeRedirectTarget(location);
 }
 
 // static
@@ -5,8 +5,9 @@
 #ifndef NET_URL_REQUEST_URL_REQUEST_JOB_FACTORY_IMPL_H_
 #define NET_URL_REQUEST_URL_REQUEST_JOB_FACTORY_IMPL_H_
 
-#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base/basictypes.h"
 #include "base/compiler_specific.h"
@@ -51,7 +52,15 @@ class NET_EXPORT URLRequestJobFactoryImpl : public URLRequestJobFactory {
   // For testing only.
   friend class URLRequestFilter;
 
-  typedef std::map<std::string, ProtocolHandler*> ProtocolHandlerMap;
+  // The registered handlers are kept in a flat array sorted by scheme.
+  // Registration only happens while the context is being set up, but the
+  // table is consulted for every request, so lookups are a binary search
+  // over contiguous entries rather than a walk of a node-based map.
+  typedef std::pair<std::string, ProtocolHandler*> SchemeAndHandler;
+  typedef std::vector<SchemeAndHandler> ProtocolHandlerList;
+
+  // Returns the handler registered for |scheme|, or NULL if there is none.
+  ProtocolHandler* FindProtocolHandler(const std::string& scheme) const;
 
   // Sets a global URLRequestInterceptor for testing purposes.  The interceptor
   // is given the chance to intercept any request before the corresponding
@@ -61,7 +70,7 @@ class NET_EXPORT URLRequestJobFactoryImpl : public URLRequestJobFactory {
   // setting a new one.
   static void SetInterceptorForTesting(URLRequestInterceptor* interceptor);
 
-  ProtocolHandlerMap protocol_handler_map_;
+  ProtocolHandlerList protocol_handlers_;
 
   DISALLOW_COPY_AND_ASSIGN(URLRequestJobFactoryImpl);
 };
@@ -5,11 +5,11 @@
 #ifndef NET_URL_REQUEST_URL_REQUEST_THROTTLER_MANAGER_H_
 #define NET_URL_REQUEST_URL_REQUEST_THROTTLER_MANAGER_H_
 
-#include <map>
 #include <set>
 #include <string>
 
 #include "base/basictypes.h"
+#include "base/containers/hash_tables.h"
 #include "base/memory/ref_counted.h"
 #include "base/threading/non_thread_safe.h"
 #include "base/threading/platform_thread.h"
@@ -113,8 +113,10 @@ class NET_EXPORT URLRequestThrottlerManager
 
  private:
   // From each URL we generate an ID composed of the scheme, host, port and path
-  // that allows us to uniquely map an entry to it.
-  typedef std::map<std::string, scoped_refptr<URLRequestThrottlerEntry> >
+  // that allows us to uniquely map an entry to it. The map is hashed since it
+  // is consulted for every request and the IDs have long common prefixes,
+  // which makes ordered comparisons needlessly expensive.
+  typedef base::hash_map<std::string, scoped_refptr<URLRequestThrottlerEntry> >
       UrlEntryMap;
 
   // We maintain a set of hosts that have opted out of exponential
@@ -312,10 +312,45 @@ int WebSocketDeflateStream::Inflate(ScopedVector<WebSocketFrame>* frames) {
       frames_to_output.push_back(frame.release());
     } else {
       DCHECK_EQ(reading_state_, READING_COMPRESSED_MESSAGE);
-      if (frame->data.get() &&
-          !inflater_.AddBytes(
-              frame->data->data(),
-              static_cast<size_t>(frame->header.payload_length))) {
+      const char* input = NULL;
+      size_t input_size = 0;
+      if (frame->data.get()) {
+        input = frame->data->data();
+        input_size = static_cast<size_t>(frame->header.payload_length);
+      }
+      // Coalesce the payloads of any immediately following continuation
+      // frames of the same message, up to kChunkSize bytes, so that the
+      // inflater is driven once per batch instead of once per frame.
+      std::string coalesced;
+      while (!frame->header.final && i + 1 < frames_passed.size()) {
+        WebSocketFrame* next = frames_passed[i + 1];
+        if (next->header.opcode != WebSocketFrameHeader::kOpCodeContinuation ||
+            next->header.reserved1) {
+          break;
+        }
+        const size_t next_size =
+            next->data.get()
+                ? static_cast<size_t>(next->header.payload_length)
+                : 0u;
+        if (input_size + next_size > kChunkSize)
+          break;
+        if (coalesced.empty() && input_size > 0)
+          coalesced.assign(input, input_size);
+        if (next_size > 0)
+          coalesced.append(next->data->data(), next_size);
+        input_size += next_size;
+        DVLOG(3) << "Coalesced continuation frame:"
+                 << " final=" << next->header.final
+                 << " payload_length=" << next_size;
+        frame.reset(next);
+        frames_passed[i + 1] = NULL;
+        ++i;
+      }
+      if (!coalesced.empty()) {
+        input = coalesced.data();
+        input_size = coalesced.size();
+      }
+      if (input_size > 0 && !inflater_.AddBytes(input, input_size)) {
         DVLOG(1) << "WebSocket protocol error. "
                  << "inflater_.AddBytes() returns an error.";
         return ERR_WS_PROTOCOL_ERROR;
@@ -4,7 +4,18 @@
 
 #include "net/websockets/websocket_frame.h"
 
+// Visual C++ defines _M_IX86_FP as 2 if the /arch:SSE2 compiler option is
+// specified.
+#if !defined(__SSE2__) && _M_IX86_FP == 2
+#define __SSE2__ 1
+#endif
+
 #include <algorithm>
+#if __SSE2__
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
 
 #include "base/basictypes.h"
 #include "base/big_endian.h"
@@ -218,9 +229,46 @@ void MaskWebSocketFramePayload(const WebSocketMaskingKey& masking_key,
            kMaskingKeyLength);
   }
 
-  // The main loop.
-  for (char* merged = aligned_begin; merged != aligned_end;
-       merged += kPackedMaskKeySize) {
+  char* merged = aligned_begin;
+#if __SSE2__
+  // Process 16 bytes per iteration with SSE2. Loads and stores are unaligned
+  // since |merged| is only guaranteed to be word-aligned. The register-wide
+  // mask repeats the word-wide mask, which is valid because the register size
+  // is a multiple of kMaskingKeyLength.
+  if (aligned_end - merged >= static_cast<ptrdiff_t>(sizeof(__m128i))) {
+    PackedMaskType wide_mask_block[sizeof(__m128i) / kPackedMaskKeySize];
+    for (size_t i = 0; i < arraysize(wide_mask_block); ++i)
+      wide_mask_block[i] = packed_mask_key;
+    const __m128i wide_mask =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(wide_mask_block));
+    char* const wide_end =
+        aligned_end - (aligned_end - merged) % sizeof(__m128i);
+    for (; merged != wide_end; merged += sizeof(__m128i)) {
+      const __m128i block =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(merged));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(merged),
+                       _mm_xor_si128(block, wide_mask));
+    }
+  }
+#elif defined(__ARM_NEON__)
+  // The NEON equivalent of the SSE2 loop above.
+  if (aligned_end - merged >= static_cast<ptrdiff_t>(sizeof(uint8x16_t))) {
+    PackedMaskType wide_mask_block[sizeof(uint8x16_t) / kPackedMaskKeySize];
+    for (size_t i = 0; i < arraysize(wide_mask_block); ++i)
+      wide_mask_block[i] = packed_mask_key;
+    const uint8x16_t wide_mask =
+        vld1q_u8(reinterpret_cast<const uint8_t*>(wide_mask_block));
+    char* const wide_end =
+        aligned_end - (aligned_end - merged) % sizeof(uint8x16_t);
+    for (; merged != wide_end; merged += sizeof(uint8x16_t)) {
+      uint8_t* const block = reinterpret_cast<uint8_t*>(merged);
+      vst1q_u8(block, veorq_u8(vld1q_u8(block), wide_mask));
+    }
+  }
+#endif
+  // The word-at-a-time loop, which also handles whatever the vectorised loop
+  // above left over.
+  for (; merged != aligned_end; merged += kPackedMaskKeySize) {
     // This is not quite standard-compliant C++. However, the standard-compliant
     // equivalent (using memcpy()) compiles to slower code using g++. In
     // practice, this will work for the compilers and architectures currently
@@ -132,6 +132,12 @@ const int kFindResultCooldownMs = 100;
 
 const double kMinZoom = 0.01;
 
+// Paint bands of at most this height. Without the limit, a full-viewport
+// invalidate (e.g. on zoom) flushes nothing to the screen until the whole
+// area is rendered; with it, finished bands are displayed while the rest of
+// the document renders.
+const int kMaxPaintBandHeight = 256;
+
 namespace {
 
 static const char kPPPPdfInterface[] = PPP_PDF_INTERFACE_1;
@@ -652,11 +658,28 @@ void OutOfProcessInstance::OnPaint(
 
   engine_->PrePaint();
 
+  // Split the invalid area into horizontal bands so that each band can be
+  // painted and flushed independently. The bands of one paint rect are
+  // top-to-bottom, so the top of a zoomed or newly shown document appears
+  // first.
+  std::vector<pp::Rect> banded_rects;
   for (size_t i = 0; i < paint_rects.size(); i++) {
+    pp::Rect remaining = paint_rects[i];
+    while (remaining.height() > kMaxPaintBandHeight) {
+      banded_rects.push_back(pp::Rect(remaining.x(), remaining.y(),
+                                      remaining.width(),
+                                      kMaxPaintBandHeight));
+      remaining.set_y(remaining.y() + kMaxPaintBandHeight);
+      remaining.set_height(remaining.height() - kMaxPaintBandHeight);
+    }
+    banded_rects.push_back(remaining);
+  }
+
+  for (size_t i = 0; i < banded_rects.size(); i++) {
     // Intersect with plugin area since there could be pending invalidates from
     // when the plugin area was larger.
     pp::Rect rect =
-        paint_rects[i].Intersect(pp::Rect(pp::Point(), plugin_size_));
+        banded_rects[i].Intersect(pp::Rect(pp::Point(), plugin_size_));
     if (rect.IsEmpty())
       continue;
 
@@ -689,6 +712,14 @@ void OutOfProcessInstance::OnPaint(
   }
 
   engine_->PostPaint();
+
+  // If some bands still need rendering, flush the ones that finished right
+  // away so they become visible, instead of holding them until the whole
+  // invalid area is done.
+  if (!pending->empty()) {
+    for (size_t i = 0; i < ready->size(); ++i)
+      (*ready)[i].flush_now = true;
+  }
 }
 
 void OutOfProcessInstance::DidOpen(int32_t result) {
@@ -80,7 +80,10 @@ bool KernelSupportsSeccompTsync() {
 }  // namespace
 
 SandboxBPF::SandboxBPF(bpf_dsl::Policy* policy)
-    : proc_task_fd_(), sandbox_has_started_(false), policy_(policy) {
+    : proc_task_fd_(),
+      sandbox_has_started_(false),
+      policy_(policy),
+      preassembled_program_() {
 }
 
 SandboxBPF::~SandboxBPF() {
@@ -200,6 +203,12 @@ scoped_ptr<CodeGen::Program> SandboxBPF::AssembleFilter(
   return program.Pass();
 }
 
+void SandboxBPF::SetPreassembledFilter(scoped_ptr<CodeGen::Program> program) {
+  DCHECK(program);
+  CHECK(!sandbox_has_started_);
+  preassembled_program_ = program.Pass();
+}
+
 void SandboxBPF::InstallFilter(bool must_sync_threads) {
   // We want to be very careful in not imposing any requirements on the
   // policies that are set with SetSandboxPolicy(). This means, as soon as
@@ -212,7 +221,9 @@ void SandboxBPF::InstallFilter(bool must_sync_threads) {
   // installed the BPF filter program in the kernel. Depending on the
   // system memory allocator that is in effect, these operators can result
   // in system calls to things like munmap() or brk().
-  CodeGen::Program* program = AssembleFilter(false).release();
+  CodeGen::Program* program = preassembled_program_
+                                  ? preassembled_program_.release()
+                                  : AssembleFilter(false).release();
 
   struct sock_filter bpf[program->size()];
   const struct sock_fprog prog = {static_cast<unsigned short>(program->size()),
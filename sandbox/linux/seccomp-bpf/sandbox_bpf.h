@@ -101,6 +101,14 @@ class SANDBOX_EXPORT SandboxBPF {
   // verifier is run unconditionally. This is useful for unittests.
   scoped_ptr<CodeGen::Program> AssembleFilter(bool force_verification);
 
+  // Hands the sandbox a filter program that was previously built with
+  // AssembleFilter() from a policy equivalent to the one passed to the
+  // constructor. StartSandbox() then installs |program| as-is instead of
+  // compiling the policy again. This is useful in a zygote, where the
+  // program can be assembled once before forking and is then inherited by
+  // every child.
+  void SetPreassembledFilter(scoped_ptr<CodeGen::Program> program);
+
  private:
   // Assembles and installs a filter based on the policy that has previously
   // been configured with SetSandboxPolicy().
@@ -109,6 +117,7 @@ class SANDBOX_EXPORT SandboxBPF {
   base::ScopedFD proc_task_fd_;
   bool sandbox_has_started_;
   scoped_ptr<bpf_dsl::Policy> policy_;
+  scoped_ptr<CodeGen::Program> preassembled_program_;
 
   DISALLOW_COPY_AND_ASSIGN(SandboxBPF);
 };
@@ -0,0 +1,378 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "skia/ext/convolver.h"
+#include "skia/ext/convolver_neon.h"
+
+#include <arm_neon.h>
+
+namespace skia {
+
+namespace {
+
+// |mask| will be used to decimate all extra filter coefficients that are
+// loaded by SIMD when |filter_length| is not divisible by 4.
+// mask[0] is not used in the following algorithm.
+const uint16_t kCoefficientMask[4][4] = {
+  { 0, 0, 0, 0 },
+  { 0xFFFF, 0, 0, 0 },
+  { 0xFFFF, 0xFFFF, 0, 0 },
+  { 0xFFFF, 0xFFFF, 0xFFFF, 0 },
+};
+
+inline int16x4_t MaskedCoefficients(
+    const ConvolutionFilter1D::Fixed* filter_values,
+    int remainder) {
+  // Note: filter_values must be padded to align_up(filter_offset, 8).
+  int16x4_t coeffs = vld1_s16(filter_values);
+  // Mask out extra filter taps.
+  return vreinterpret_s16_u16(vand_u16(vreinterpret_u16_s16(coeffs),
+                                       vld1_u16(kCoefficientMask[remainder])));
+}
+
+}  // namespace
+
+// Convolves horizontally along a single row. The row data is given in
+// |src_data| and continues for the num_values() of the filter.
+void ConvolveHorizontally_Neon(const unsigned char* src_data,
+                               const ConvolutionFilter1D& filter,
+                               unsigned char* out_row,
+                               bool /*has_alpha*/) {
+  int num_values = filter.num_values();
+
+  int filter_offset, filter_length;
+
+  // Output one pixel each iteration, calculating all channels (RGBA) together.
+  for (int out_x = 0; out_x < num_values; out_x++) {
+    const ConvolutionFilter1D::Fixed* filter_values =
+        filter.FilterForValue(out_x, &filter_offset, &filter_length);
+
+    // Compute the first pixel in this row that the filter affects. It will
+    // touch |filter_length| pixels (4 bytes each) after this.
+    const unsigned char* row_to_filter = &src_data[filter_offset << 2];
+
+    int32x4_t accum = vdupq_n_s32(0);
+
+    // We will load and accumulate with four coefficients per iteration.
+    for (int filter_x = 0; filter_x < filter_length >> 2; filter_x++) {
+      // Load 4 coefficients.
+      // [16] c3 c2 c1 c0
+      int16x4_t coeffs = vld1_s16(filter_values);
+
+      // Load four pixels => unpack to 16 bits => multiply-accumulate each
+      // pixel with its coefficient.
+      // [8] a3 b3 g3 r3 a2 b2 g2 r2 a1 b1 g1 r1 a0 b0 g0 r0
+      uint8x16_t src8 = vld1q_u8(row_to_filter);
+      // [16] a1 b1 g1 r1 a0 b0 g0 r0
+      int16x8_t src16_01 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(src8)));
+      // [16] a3 b3 g3 r3 a2 b2 g2 r2
+      int16x8_t src16_23 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(src8)));
+
+      // [32] a0*c0 b0*c0 g0*c0 r0*c0 ...
+      accum = vmlal_lane_s16(accum, vget_low_s16(src16_01), coeffs, 0);
+      accum = vmlal_lane_s16(accum, vget_high_s16(src16_01), coeffs, 1);
+      accum = vmlal_lane_s16(accum, vget_low_s16(src16_23), coeffs, 2);
+      accum = vmlal_lane_s16(accum, vget_high_s16(src16_23), coeffs, 3);
+
+      // Advance the pixel and coefficients pointers.
+      row_to_filter += 16;
+      filter_values += 4;
+    }
+
+    // When |filter_length| is not divisible by 4, we need to decimate some of
+    // the filter coefficients that were loaded incorrectly to zero; other than
+    // that the algorithm is the same as above, except that the 4th pixel will
+    // always be absent.
+    int r = filter_length & 3;
+    if (r) {
+      int16x4_t coeffs = MaskedCoefficients(filter_values, r);
+
+      // Note: the line buffer must be padded to align_up(filter_offset, 16).
+      // We resolve this by using the C version for the last horizontal lines.
+      uint8x16_t src8 = vld1q_u8(row_to_filter);
+      int16x8_t src16_01 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(src8)));
+      int16x8_t src16_23 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(src8)));
+
+      accum = vmlal_lane_s16(accum, vget_low_s16(src16_01), coeffs, 0);
+      accum = vmlal_lane_s16(accum, vget_high_s16(src16_01), coeffs, 1);
+      accum = vmlal_lane_s16(accum, vget_low_s16(src16_23), coeffs, 2);
+    }
+
+    // Shift right for fixed point implementation.
+    accum = vshrq_n_s32(accum, ConvolutionFilter1D::kShiftBits);
+
+    // Packing 32 bits |accum| to 16 bits per channel (signed saturation).
+    int16x4_t accum16 = vqmovn_s32(accum);
+    // Packing 16 bits |accum| to 8 bits per channel (unsigned saturation).
+    uint8x8_t accum8 = vqmovun_s16(vcombine_s16(accum16, accum16));
+
+    // Store the pixel value of 32 bits.
+    vst1_lane_u32(reinterpret_cast<uint32_t*>(out_row),
+                  vreinterpret_u32_u8(accum8), 0);
+    out_row += 4;
+  }
+}
+
+// Convolves horizontally along four rows. The row data is given in
+// |src_data| and continues for the num_values() of the filter.
+// The algorithm is almost the same as |ConvolveHorizontally_Neon|. Please
+// refer to that function for detailed comments.
+void Convolve4RowsHorizontally_Neon(const unsigned char* src_data[4],
+                                    const ConvolutionFilter1D& filter,
+                                    unsigned char* out_row[4]) {
+  int num_values = filter.num_values();
+
+  int filter_offset, filter_length;
+
+  // Output one pixel each iteration, calculating all channels (RGBA) together.
+  for (int out_x = 0; out_x < num_values; out_x++) {
+    const ConvolutionFilter1D::Fixed* filter_values =
+        filter.FilterForValue(out_x, &filter_offset, &filter_length);
+
+    // four pixels in a column per iteration.
+    int32x4_t accum0 = vdupq_n_s32(0);
+    int32x4_t accum1 = vdupq_n_s32(0);
+    int32x4_t accum2 = vdupq_n_s32(0);
+    int32x4_t accum3 = vdupq_n_s32(0);
+    int start = filter_offset << 2;
+
+    uint8x16_t src8;
+    int16x8_t src16_01;
+    int16x8_t src16_23;
+
+#define ITERATION(src, accum)                                              \
+    src8 = vld1q_u8(src);                                                  \
+    src16_01 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(src8)));         \
+    src16_23 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(src8)));        \
+    accum = vmlal_lane_s16(accum, vget_low_s16(src16_01), coeffs, 0);      \
+    accum = vmlal_lane_s16(accum, vget_high_s16(src16_01), coeffs, 1);     \
+    accum = vmlal_lane_s16(accum, vget_low_s16(src16_23), coeffs, 2);      \
+    accum = vmlal_lane_s16(accum, vget_high_s16(src16_23), coeffs, 3)
+
+    // We will load and accumulate with four coefficients per iteration.
+    for (int filter_x = 0; filter_x < (filter_length >> 2); filter_x++) {
+      // [16] c3 c2 c1 c0
+      int16x4_t coeffs = vld1_s16(filter_values);
+
+      ITERATION(src_data[0] + start, accum0);
+      ITERATION(src_data[1] + start, accum1);
+      ITERATION(src_data[2] + start, accum2);
+      ITERATION(src_data[3] + start, accum3);
+
+      start += 16;
+      filter_values += 4;
+    }
+
+    int r = filter_length & 3;
+    if (r) {
+      int16x4_t coeffs = MaskedCoefficients(filter_values, r);
+
+      ITERATION(src_data[0] + start, accum0);
+      ITERATION(src_data[1] + start, accum1);
+      ITERATION(src_data[2] + start, accum2);
+      ITERATION(src_data[3] + start, accum3);
+    }
+#undef ITERATION
+
+    int16x4_t accum16;
+    uint8x8_t accum8;
+
+#define PACK_RESULT(accum, out)                                            \
+    accum = vshrq_n_s32(accum, ConvolutionFilter1D::kShiftBits);           \
+    accum16 = vqmovn_s32(accum);                                           \
+    accum8 = vqmovun_s16(vcombine_s16(accum16, accum16));                  \
+    vst1_lane_u32(reinterpret_cast<uint32_t*>(out),                        \
+                  vreinterpret_u32_u8(accum8), 0)
+
+    PACK_RESULT(accum0, out_row[0]);
+    PACK_RESULT(accum1, out_row[1]);
+    PACK_RESULT(accum2, out_row[2]);
+    PACK_RESULT(accum3, out_row[3]);
+#undef PACK_RESULT
+
+    out_row[0] += 4;
+    out_row[1] += 4;
+    out_row[2] += 4;
+    out_row[3] += 4;
+  }
+}
+
+// Does vertical convolution to produce one output row. The filter values and
+// length are given in the first two parameters. These are applied to each
+// of the rows pointed to in the |source_data_rows| array, with each row
+// being |pixel_width| wide.
+//
+// The output must have room for |pixel_width * 4| bytes.
+template<bool has_alpha>
+void ConvolveVertically_Neon(const ConvolutionFilter1D::Fixed* filter_values,
+                             int filter_length,
+                             unsigned char* const* source_data_rows,
+                             int pixel_width,
+                             unsigned char* out_row) {
+  int width = pixel_width & ~3;
+
+  int32x4_t accum0, accum1, accum2, accum3;
+  int16x4_t coeff16;
+
+  // Output four pixels per iteration (16 bytes).
+  for (int out_x = 0; out_x < width; out_x += 4) {
+    // Accumulated result for each pixel. 32 bits per RGBA channel.
+    accum0 = vdupq_n_s32(0);
+    accum1 = vdupq_n_s32(0);
+    accum2 = vdupq_n_s32(0);
+    accum3 = vdupq_n_s32(0);
+
+    // Convolve with one filter coefficient per iteration.
+    for (int filter_y = 0; filter_y < filter_length; filter_y++) {
+      // Duplicate the filter coefficient 4 times.
+      // [16] cj cj cj cj
+      coeff16 = vdup_n_s16(filter_values[filter_y]);
+
+      // Load four pixels (16 bytes) together.
+      // [8] a3 b3 g3 r3 a2 b2 g2 r2 a1 b1 g1 r1 a0 b0 g0 r0
+      uint8x16_t src8 = vld1q_u8(&source_data_rows[filter_y][out_x << 2]);
+
+      // Unpack to 16 bits for each channel => multiply with the current
+      // coefficient => accumulate the result.
+      // [16] a1 b1 g1 r1 a0 b0 g0 r0
+      int16x8_t src16_01 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(src8)));
+      // [16] a3 b3 g3 r3 a2 b2 g2 r2
+      int16x8_t src16_23 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(src8)));
+
+      // [32] a0 b0 g0 r0
+      accum0 = vmlal_s16(accum0, vget_low_s16(src16_01), coeff16);
+      // [32] a1 b1 g1 r1
+      accum1 = vmlal_s16(accum1, vget_high_s16(src16_01), coeff16);
+      // [32] a2 b2 g2 r2
+      accum2 = vmlal_s16(accum2, vget_low_s16(src16_23), coeff16);
+      // [32] a3 b3 g3 r3
+      accum3 = vmlal_s16(accum3, vget_high_s16(src16_23), coeff16);
+    }
+
+    // Shift right for fixed point implementation.
+    accum0 = vshrq_n_s32(accum0, ConvolutionFilter1D::kShiftBits);
+    accum1 = vshrq_n_s32(accum1, ConvolutionFilter1D::kShiftBits);
+    accum2 = vshrq_n_s32(accum2, ConvolutionFilter1D::kShiftBits);
+    accum3 = vshrq_n_s32(accum3, ConvolutionFilter1D::kShiftBits);
+
+    // Packing 32 bits |accum| to 16 bits per channel (signed saturation).
+    // [16] a1 b1 g1 r1 a0 b0 g0 r0
+    int16x8_t accum16_0 = vcombine_s16(vqmovn_s32(accum0), vqmovn_s32(accum1));
+    // [16] a3 b3 g3 r3 a2 b2 g2 r2
+    int16x8_t accum16_1 = vcombine_s16(vqmovn_s32(accum2), vqmovn_s32(accum3));
+
+    // Packing 16 bits |accum| to 8 bits per channel (unsigned saturation).
+    // [8] a3 b3 g3 r3 a2 b2 g2 r2 a1 b1 g1 r1 a0 b0 g0 r0
+    uint8x16_t accum8 = vcombine_u8(vqmovun_s16(accum16_0),
+                                    vqmovun_s16(accum16_1));
+
+    if (has_alpha) {
+      // Compute the max(ri, gi, bi) for each pixel.
+      // [8] xx a3 b3 g3 xx a2 b2 g2 xx a1 b1 g1 xx a0 b0 g0
+      uint8x16_t a = vreinterpretq_u8_u32(
+          vshrq_n_u32(vreinterpretq_u32_u8(accum8), 8));
+      // [8] xx xx xx max3 xx xx xx max2 xx xx xx max1 xx xx xx max0
+      uint8x16_t b = vmaxq_u8(a, accum8);  // Max of r and g.
+      // [8] xx xx a3 b3 xx xx a2 b2 xx xx a1 b1 xx xx a0 b0
+      a = vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(accum8), 16));
+      // [8] xx xx xx max3 xx xx xx max2 xx xx xx max1 xx xx xx max0
+      b = vmaxq_u8(a, b);  // Max of r and g and b.
+      // [8] max3 00 00 00 max2 00 00 00 max1 00 00 00 max0 00 00 00
+      b = vreinterpretq_u8_u32(vshlq_n_u32(vreinterpretq_u32_u8(b), 24));
+
+      // Make sure the value of alpha channel is always larger than maximum
+      // value of color channels.
+      accum8 = vmaxq_u8(b, accum8);
+    } else {
+      // Set value of alpha channels to 0xFF.
+      accum8 = vreinterpretq_u8_u32(vorrq_u32(vreinterpretq_u32_u8(accum8),
+                                              vdupq_n_u32(0xff000000)));
+    }
+
+    // Store the convolution result (16 bytes) and advance the pixel pointers.
+    vst1q_u8(out_row, accum8);
+    out_row += 16;
+  }
+
+  // When the width of the output is not divisible by 4, we need to save one
+  // pixel (4 bytes) each time. And also the fourth pixel is always absent.
+  if (pixel_width & 3) {
+    accum0 = vdupq_n_s32(0);
+    accum1 = vdupq_n_s32(0);
+    accum2 = vdupq_n_s32(0);
+    for (int filter_y = 0; filter_y < filter_length; ++filter_y) {
+      coeff16 = vdup_n_s16(filter_values[filter_y]);
+      // [8] a3 b3 g3 r3 a2 b2 g2 r2 a1 b1 g1 r1 a0 b0 g0 r0
+      uint8x16_t src8 = vld1q_u8(&source_data_rows[filter_y][width << 2]);
+
+      int16x8_t src16_01 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(src8)));
+      int16x8_t src16_23 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(src8)));
+
+      // [32] a0 b0 g0 r0
+      accum0 = vmlal_s16(accum0, vget_low_s16(src16_01), coeff16);
+      // [32] a1 b1 g1 r1
+      accum1 = vmlal_s16(accum1, vget_high_s16(src16_01), coeff16);
+      // [32] a2 b2 g2 r2
+      accum2 = vmlal_s16(accum2, vget_low_s16(src16_23), coeff16);
+    }
+
+    accum0 = vshrq_n_s32(accum0, ConvolutionFilter1D::kShiftBits);
+    accum1 = vshrq_n_s32(accum1, ConvolutionFilter1D::kShiftBits);
+    accum2 = vshrq_n_s32(accum2, ConvolutionFilter1D::kShiftBits);
+    // [16] a1 b1 g1 r1 a0 b0 g0 r0
+    int16x8_t accum16_0 = vcombine_s16(vqmovn_s32(accum0), vqmovn_s32(accum1));
+    // [16] a3 b3 g3 r3 a2 b2 g2 r2
+    int16x8_t accum16_1 = vcombine_s16(vqmovn_s32(accum2), vdup_n_s16(0));
+    // [8] a3 b3 g3 r3 a2 b2 g2 r2 a1 b1 g1 r1 a0 b0 g0 r0
+    uint8x16_t accum8 = vcombine_u8(vqmovun_s16(accum16_0),
+                                    vqmovun_s16(accum16_1));
+    if (has_alpha) {
+      // [8] xx a3 b3 g3 xx a2 b2 g2 xx a1 b1 g1 xx a0 b0 g0
+      uint8x16_t a = vreinterpretq_u8_u32(
+          vshrq_n_u32(vreinterpretq_u32_u8(accum8), 8));
+      // [8] xx xx xx max3 xx xx xx max2 xx xx xx max1 xx xx xx max0
+      uint8x16_t b = vmaxq_u8(a, accum8);  // Max of r and g.
+      // [8] xx xx a3 b3 xx xx a2 b2 xx xx a1 b1 xx xx a0 b0
+      a = vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(accum8), 16));
+      // [8] xx xx xx max3 xx xx xx max2 xx xx xx max1 xx xx xx max0
+      b = vmaxq_u8(a, b);  // Max of r and g and b.
+      // [8] max3 00 00 00 max2 00 00 00 max1 00 00 00 max0 00 00 00
+      b = vreinterpretq_u8_u32(vshlq_n_u32(vreinterpretq_u32_u8(b), 24));
+      accum8 = vmaxq_u8(b, accum8);
+    } else {
+      accum8 = vreinterpretq_u8_u32(vorrq_u32(vreinterpretq_u32_u8(accum8),
+                                              vdupq_n_u32(0xff000000)));
+    }
+
+    for (int out_x = width; out_x < pixel_width; out_x++) {
+      vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row),
+                     vreinterpretq_u32_u8(accum8), 0);
+      accum8 = vextq_u8(accum8, accum8, 4);
+      out_row += 4;
+    }
+  }
+}
+
+void ConvolveVertically_Neon(const ConvolutionFilter1D::Fixed* filter_values,
+                             int filter_length,
+                             unsigned char* const* source_data_rows,
+                             int pixel_width,
+                             unsigned char* out_row,
+                             bool has_alpha) {
+  if (has_alpha) {
+    ConvolveVertically_Neon<true>(filter_values,
+                                  filter_length,
+                                  source_data_rows,
+                                  pixel_width,
+                                  out_row);
+  } else {
+    ConvolveVertically_Neon<false>(filter_values,
+                                   filter_length,
+                                   source_data_rows,
+                                   pixel_width,
+                                   out_row);
+  }
+}
+
+}  // namespace skia
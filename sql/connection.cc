@@ -8,6 +8,7 @@
 
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/format_macros.h"
 #include "base/lazy_instance.h"
 #include "base/logging.h"
 #include "base/metrics/histogram.h"
@@ -214,6 +215,7 @@ Connection::Connection()
     : db_(NULL),
       page_size_(0),
       cache_size_(0),
+      mmap_size_(0),
       exclusive_locking_(false),
       restrict_to_user_(false),
       transaction_nesting_(0),
@@ -267,6 +269,7 @@ void Connection::CloseInternal(bool forced) {
 
   // Release cached statements.
   statement_cache_.clear();
+  sql_statement_cache_.clear();
 
   // With cached statements released, in-use statements will remain.
   // Closing the database while statements are in use is an API
@@ -713,6 +716,22 @@ scoped_refptr<Connection::StatementRef> Connection::GetCachedStatement(
   return statement;
 }
 
+scoped_refptr<Connection::StatementRef> Connection::GetCachedStatement(
+    const std::string& sql) {
+  SQLStatementCacheMap::iterator i = sql_statement_cache_.find(sql);
+  if (i != sql_statement_cache_.end()) {
+    // See the note in the StatementID-keyed overload above.
+    DCHECK(i->second->is_valid());
+    sqlite3_reset(i->second->stmt());
+    return i->second;
+  }
+
+  scoped_refptr<StatementRef> statement = GetUniqueStatement(sql.c_str());
+  if (statement->is_valid())
+    sql_statement_cache_[sql] = statement;  // Only cache valid statements.
+  return statement;
+}
+
 scoped_refptr<Connection::StatementRef> Connection::GetUniqueStatement(
     const char* sql) {
   AssertIOAllowed();
@@ -1000,6 +1019,15 @@ bool Connection::OpenInternal(const std::string& file_name,
     ignore_result(ExecuteWithTimeout(sql.c_str(), kBusyTimeout));
   }
 
+  if (mmap_size_ > 0) {
+    // sqlite caps the value at SQLITE_MAX_MMAP_SIZE, so it is safe to pass
+    // the size through unchecked. Failure simply leaves the default VFS
+    // read path in place.
+    const std::string sql =
+        base::StringPrintf("PRAGMA mmap_size=%" PRId64, mmap_size_);
+    ignore_result(ExecuteWithTimeout(sql.c_str(), kBusyTimeout));
+  }
+
   if (!ExecuteWithTimeout("PRAGMA secure_delete=ON", kBusyTimeout)) {
     bool was_poisoned = poisoned_;
     Close();
@@ -105,6 +105,13 @@ class SQL_EXPORT Connection {
   // called before Open() to have an effect.
   void set_cache_size(int cache_size) { cache_size_ = cache_size; }
 
+  // Sets the maximum number of bytes of the database file that sqlite may
+  // memory-map for I/O. Reads served from the mapping avoid both a copy into
+  // the page cache and a read syscall per page. This must be called before
+  // Open() to have an effect. The default of zero leaves memory-mapped I/O
+  // disabled.
+  void set_mmap_size(int64 mmap_size) { mmap_size_ = mmap_size; }
+
   // Call to put the database in exclusive locking mode. There is no "back to
   // normal" flag because of some additional requirements sqlite puts on this
   // transaction (requires another access to the DB) and because we don't
@@ -348,6 +355,13 @@ class SQL_EXPORT Connection {
   scoped_refptr<StatementRef> GetCachedStatement(const StatementID& id,
                                                  const char* sql);
 
+  // As above, but keyed on the text of |sql| itself. Use this when the SQL is
+  // generated at runtime and so no static StatementID can describe it. The
+  // SQL text is copied into the cache key, so the caller need not keep it
+  // alive. High-frequency writers that rebuild the same statements should
+  // prefer this over GetUniqueStatement to amortize the prepare cost.
+  scoped_refptr<StatementRef> GetCachedStatement(const std::string& sql);
+
   // Used to check a |sql| statement for syntactic validity. If the statement is
   // valid SQL, returns true.
   bool IsSQLValid(const char* sql);
@@ -555,6 +569,7 @@ class SQL_EXPORT Connection {
   // use the default value.
   int page_size_;
   int cache_size_;
+  int64 mmap_size_;
   bool exclusive_locking_;
   bool restrict_to_user_;
 
@@ -564,6 +579,12 @@ class SQL_EXPORT Connection {
       CachedStatementMap;
   CachedStatementMap statement_cache_;
 
+  // Statements cached by the text of their SQL, for callers whose SQL is
+  // generated at runtime and cannot use a static StatementID.
+  typedef std::map<std::string, scoped_refptr<StatementRef> >
+      SQLStatementCacheMap;
+  SQLStatementCacheMap sql_statement_cache_;
+
   // A list of all StatementRefs we've given out. Each ref must register with
   // us when it's created or destroyed. This allows us to potentially close
   // any open statements when we encounter an error.
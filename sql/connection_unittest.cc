@@ -166,6 +166,37 @@ TEST_F(SQLConnectionTest, CachedStatement) {
   EXPECT_FALSE(db().HasCachedStatement(SQL_FROM_HERE));
 }
 
+TEST_F(SQLConnectionTest, SQLKeyedCachedStatement) {
+  ASSERT_TRUE(db().Execute("CREATE TABLE foo (a, b)"));
+  ASSERT_TRUE(db().Execute("INSERT INTO foo(a, b) VALUES (12, 13)"));
+
+  const std::string kSql("SELECT a FROM foo");
+
+  // Create a new cached statement.
+  {
+    sql::Statement s(db().GetCachedStatement(kSql));
+    ASSERT_TRUE(s.is_valid());
+
+    ASSERT_TRUE(s.Step());
+    EXPECT_EQ(12, s.ColumnInt(0));
+  }
+
+  // Requesting the same SQL again should reuse the cached statement.
+  {
+    sql::Statement s(db().GetCachedStatement(std::string(kSql)));
+    ASSERT_TRUE(s.is_valid());
+
+    ASSERT_TRUE(s.Step());
+    EXPECT_EQ(12, s.ColumnInt(0));
+  }
+
+  // Invalid SQL should return an inert statement and not be cached.
+  {
+    sql::Statement s(db().GetCachedStatement(std::string("something invalid(")));
+    EXPECT_FALSE(s.is_valid());
+  }
+}
+
 TEST_F(SQLConnectionTest, IsSQLValidTest) {
   ASSERT_TRUE(db().Execute("CREATE TABLE foo (a, b)"));
   ASSERT_TRUE(db().IsSQLValid("SELECT a FROM foo"));
@@ -141,8 +141,7 @@ void BlobStorageContext::AppendBlobDataItem(
   //    modification time.
   // 3) The FileSystem File item is denoted by the FileSystem URL, the range
   //    and the expected modification time.
-  // 4) The Blob items are expanded.
-  // TODO(michaeln): Would be nice to avoid copying Data items when expanding.
+  // 4) The Blob items are expanded, sharing the source's Data bytes.
 
   uint64 length = item.length();
   DCHECK_GT(length, 0u);
@@ -251,16 +250,18 @@ bool BlobStorageContext::ExpandStorageItems(
     }
   }
 
+  bool shared_bytes = false;
   for (; iter != src_blob_data->items().end() && length > 0; ++iter) {
     uint64 current_length = iter->length() - offset;
     uint64 new_length = current_length > length ? length : current_length;
     if (iter->type() == BlobData::Item::TYPE_BYTES) {
-      if (!AppendBytesItem(
-              target_blob_data,
-              iter->bytes() + static_cast<size_t>(iter->offset() + offset),
-              static_cast<int64>(new_length))) {
-        return false;  // exceeded memory
-      }
+      // Share the source's bytes rather than copying them; the source blob
+      // is attached below to keep the memory alive. Slicing a large blob
+      // this way costs no additional memory.
+      target_blob_data->AppendSharedData(
+          iter->bytes() + static_cast<size_t>(iter->offset() + offset),
+          static_cast<size_t>(new_length));
+      shared_bytes = true;
     } else if (iter->type() == BlobData::Item::TYPE_FILE) {
       AppendFileItem(target_blob_data,
                      iter->path(),
@@ -278,6 +279,8 @@ bool BlobStorageContext::ExpandStorageItems(
     length -= new_length;
     offset = 0;
   }
+  if (shared_bytes)
+    target_blob_data->AttachDependentBlob(src_blob_data);
   return true;
 }
 
@@ -90,8 +90,15 @@ void ClientUsageTracker::GetGlobalLimitedUsage(const UsageCallback& callback) {
     return;
   }
 
+  // The accumulator runs once per origin (plus the sentinel below), so the
+  // job count must tally origins, not hosts; otherwise a host with several
+  // non-cached origins reports before all of them have been added in.
+  size_t non_cached_origin_count = 0;
+  for (const auto& host_and_origins : non_cached_limited_origins_by_host_)
+    non_cached_origin_count += host_and_origins.second.size();
+
   AccumulateInfo* info = new AccumulateInfo;
-  info->pending_jobs = non_cached_limited_origins_by_host_.size() + 1;
+  info->pending_jobs = non_cached_origin_count + 1;
   UsageCallback accumulator = base::Bind(
       &ClientUsageTracker::AccumulateLimitedOriginUsage, AsWeakPtr(),
       base::Owned(info), callback);
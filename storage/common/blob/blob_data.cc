@@ -24,6 +24,12 @@ void BlobData::AppendData(const char* data, size_t length) {
   items_.back().SetToBytes(data, length);
 }
 
+void BlobData::AppendSharedData(const char* data, size_t length) {
+  DCHECK(length > 0);
+  items_.push_back(Item());
+  items_.back().SetToSharedBytes(data, length);
+}
+
 void BlobData::AppendFile(const base::FilePath& file_path,
                           uint64 offset, uint64 length,
                           const base::Time& expected_modification_time) {
@@ -54,7 +60,8 @@ int64 BlobData::GetMemoryUsage() const {
   int64 memory = 0;
   for (std::vector<Item>::const_iterator iter = items_.begin();
        iter != items_.end(); ++iter) {
-    if (iter->type() == Item::TYPE_BYTES)
+    // Shared bytes are charged to the blob that owns them.
+    if (iter->type() == Item::TYPE_BYTES && !iter->is_shared_bytes())
       memory += iter->length();
   }
   return memory;
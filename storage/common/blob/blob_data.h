@@ -34,6 +34,10 @@ class STORAGE_COMMON_EXPORT BlobData
 
   void AppendData(const char* data, size_t length);
 
+  // Appends bytes that stay owned by another blob. The caller must keep
+  // the owning blob alive via AttachDependentBlob().
+  void AppendSharedData(const char* data, size_t length);
+
   void AppendFile(const base::FilePath& file_path, uint64 offset, uint64 length,
                   const base::Time& expected_modification_time);
   void AppendBlob(const std::string& uuid, uint64 offset, uint64 length);
@@ -44,6 +48,12 @@ class STORAGE_COMMON_EXPORT BlobData
     shareable_files_.push_back(reference);
   }
 
+  // Keeps |blob|, whose memory items of this blob point into, alive for
+  // the lifetime of this blob.
+  void AttachDependentBlob(BlobData* blob) {
+    dependent_blobs_.push_back(blob);
+  }
+
   const std::string& uuid() const { return uuid_; }
   const std::vector<Item>& items() const { return items_; }
   const std::string& content_type() const { return content_type_; }
@@ -69,6 +79,7 @@ class STORAGE_COMMON_EXPORT BlobData
   std::string content_disposition_;
   std::vector<Item> items_;
   std::vector<scoped_refptr<ShareableFileReference> > shareable_files_;
+  std::vector<scoped_refptr<BlobData> > dependent_blobs_;
 
   DISALLOW_COPY_AND_ASSIGN(BlobData);
 };
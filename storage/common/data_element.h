@@ -34,6 +34,9 @@ class STORAGE_COMMON_EXPORT DataElement {
 
   Type type() const { return type_; }
   const char* bytes() const { return bytes_ ? bytes_ : &buf_[0]; }
+  // True for TYPE_BYTES elements whose bytes are owned elsewhere
+  // (see SetToSharedBytes).
+  bool is_shared_bytes() const { return bytes_ != NULL; }
   const base::FilePath& path() const { return path_; }
   const GURL& filesystem_url() const { return filesystem_url_; }
   const std::string& blob_uuid() const { return blob_uuid_; }
@@ -5,6 +5,7 @@
 #include "sync/engine/commit.h"
 
 #include "base/debug/trace_event.h"
+#include "base/time/time.h"
 #include "sync/engine/commit_contribution.h"
 #include "sync/engine/commit_processor.h"
 #include "sync/engine/commit_util.h"
@@ -108,10 +109,16 @@ SyncerError Commit::PostAndProcessResponse(
   session->SendProtocolEvent(request_event);
 
   TRACE_EVENT_BEGIN0("sync", "PostCommit");
+  const base::TimeTicks post_start_time = base::TimeTicks::Now();
   const SyncerError post_result = SyncerProtoUtil::PostClientToServerMessage(
       &message_, &response_, session);
   TRACE_EVENT_END0("sync", "PostCommit");
 
+  // Scale the next batch to the observed round trip time, so that slow
+  // connections post smaller, cheaper commit messages.
+  session->context()->AdjustCommitBatchSize(
+      base::TimeTicks::Now() - post_start_time);
+
   // TODO(rlarocque): Use result that includes errors captured later?
   CommitResponseEvent response_event(
       base::Time::Now(),
@@ -170,7 +170,7 @@ SyncerError Syncer::BuildAndPostCommits(ModelTypeSet requested_types,
         Commit::Init(
             requested_types,
             session->context()->GetEnabledTypes(),
-            session->context()->max_commit_batch_size(),
+            session->context()->commit_batch_size(),
             session->context()->account_name(),
             session->context()->directory()->cache_guid(),
             commit_processor,
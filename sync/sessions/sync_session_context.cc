@@ -4,12 +4,23 @@
 
 #include "sync/sessions/sync_session_context.h"
 
+#include <algorithm>
+
 #include "sync/sessions/debug_info_getter.h"
 #include "sync/util/extensions_activity.h"
 
 namespace syncer {
 namespace sessions {
 
+namespace {
+
+// Commit round trips slower than this halve the batch size; faster ones grow
+// it back additively.
+const int kSlowCommitRttSeconds = 10;
+const int kFastCommitRttSeconds = 2;
+
+}  // namespace
+
 SyncSessionContext::SyncSessionContext(
     ServerConnectionManager* connection_manager,
     syncable::Directory* directory,
@@ -25,6 +36,7 @@ SyncSessionContext::SyncSessionContext(
       extensions_activity_(extensions_activity),
       notifications_enabled_(false),
       max_commit_batch_size_(kDefaultMaxCommitBatchSize),
+      commit_batch_size_(kDefaultMaxCommitBatchSize),
       debug_info_getter_(debug_info_getter),
       model_type_registry_(model_type_registry),
       keystore_encryption_enabled_(keystore_encryption_enabled),
@@ -40,6 +52,22 @@ SyncSessionContext::SyncSessionContext(
 SyncSessionContext::~SyncSessionContext() {
 }
 
+int32 SyncSessionContext::commit_batch_size() const {
+  return std::min(commit_batch_size_, max_commit_batch_size_);
+}
+
+void SyncSessionContext::AdjustCommitBatchSize(
+    base::TimeDelta round_trip_time) {
+  if (round_trip_time > base::TimeDelta::FromSeconds(kSlowCommitRttSeconds)) {
+    commit_batch_size_ = std::max(commit_batch_size_ / 2, kMinCommitBatchSize);
+  } else if (round_trip_time <
+             base::TimeDelta::FromSeconds(kFastCommitRttSeconds)) {
+    commit_batch_size_ =
+        std::min(commit_batch_size_ + kMinCommitBatchSize,
+                 max_commit_batch_size_);
+  }
+}
+
 ModelTypeSet SyncSessionContext::GetEnabledTypes() const {
   return model_type_registry_->GetEnabledTypes();
 }
@@ -17,6 +17,7 @@
 
 #include <string>
 
+#include "base/time/time.h"
 #include "sync/base/sync_export.h"
 #include "sync/engine/sync_engine_event_listener.h"
 #include "sync/sessions/debug_info_getter.h"
@@ -35,6 +36,9 @@ class Directory;
 // Default number of items a client can commit in a single message.
 static const int kDefaultMaxCommitBatchSize = 25;
 
+// Lower bound for the adaptive commit batch size.
+static const int kMinCommitBatchSize = 5;
+
 namespace sessions {
 class TestScopedSessionEventListener;
 
@@ -90,6 +94,12 @@ class SYNC_EXPORT_PRIVATE SyncSessionContext {
   }
   int32 max_commit_batch_size() const { return max_commit_batch_size_; }
 
+  // Number of items to put in the next commit message.  Tracks the observed
+  // commit round-trip time so that constrained links post smaller, cheaper
+  // messages.  Never exceeds the server-imposed |max_commit_batch_size_|.
+  int32 commit_batch_size() const;
+  void AdjustCommitBatchSize(base::TimeDelta round_trip_time);
+
   ObserverList<SyncEngineEventListener>* listeners() {
     return &listeners_;
   }
@@ -148,6 +158,10 @@ class SYNC_EXPORT_PRIVATE SyncSessionContext {
   // The server limits the number of items a client can commit in one batch.
   int max_commit_batch_size_;
 
+  // Adaptive commit batch size, grown and shrunk in response to the observed
+  // commit round-trip time.  Capped by |max_commit_batch_size_|.
+  int commit_batch_size_;
+
   // We use this to get debug info to send to the server for debugging
   // client behavior on server side.
   DebugInfoGetter* const debug_info_getter_;
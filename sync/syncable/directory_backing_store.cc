@@ -11,6 +11,7 @@
 #include "base/base64.h"
 #include "base/debug/trace_event.h"
 #include "base/logging.h"
+#include "base/macros.h"
 #include "base/rand_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/time/time.h"
@@ -37,6 +38,12 @@ static const string::size_type kUpdateStatementBufferSize = 2048;
 // Increment this version whenever updating DB tables.
 const int32 kCurrentDBVersion = 89;
 
+// Checkpoint the write-ahead log once it grows past this many pages.  At the
+// 4KB page size used here this bounds each checkpoint to moving about 512KB
+// into the main database file, keeping individual flushes small instead of
+// letting the periodic save rewrite a large working set at once.
+static const int kWalAutoCheckpointPages = 128;
+
 // Iterate over the fields of |entry| and bind each to |statement| for
 // updating.  Returns the number of args bound.
 void BindFields(const EntryKernel& entry,
@@ -189,6 +196,27 @@ DirectoryBackingStore::DirectoryBackingStore(const string& dir_name,
 DirectoryBackingStore::~DirectoryBackingStore() {
 }
 
+bool DirectoryBackingStore::EnableWriteAheadLogging() {
+  DCHECK(CalledOnValidThread());
+  DCHECK(db_->is_open());
+
+  // sql::Connection configures a rollback journal at open time; switching to
+  // WAL must happen afterwards, on the open connection.  The pragma reports
+  // the journal mode actually in effect.
+  sql::Statement journal_mode(
+      db_->GetUniqueStatement("PRAGMA journal_mode=WAL"));
+  if (!journal_mode.Step() || journal_mode.ColumnString(0) != "wal")
+    return false;
+
+  // Checkpoint often enough that the log never accumulates more than
+  // |kWalAutoCheckpointPages| of data, so no single commit pays for a large
+  // transfer back into the main file.
+  ignore_result(db_->Execute(
+      base::StringPrintf("PRAGMA wal_autocheckpoint=%d",
+                         kWalAutoCheckpointPages).c_str()));
+  return true;
+}
+
 bool DirectoryBackingStore::DeleteEntries(EntryTable from,
                                           const MetahandleSet& handles) {
   if (handles.empty())
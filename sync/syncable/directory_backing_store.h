@@ -77,6 +77,13 @@ class SYNC_EXPORT_PRIVATE DirectoryBackingStore : public base::NonThreadSafe {
   bool InitializeTables();
   bool CreateTables();
 
+  // Switches the database to write-ahead logging so that SaveChanges appends
+  // dirty entries to the log instead of rewriting pages in place, and caps the
+  // log size so checkpoints transfer a bounded amount of data back into the
+  // main file.  Returns false if the journal mode could not be changed, in
+  // which case the connection keeps its default rollback journal.
+  bool EnableWriteAheadLogging();
+
   // Create 'share_info' or 'temp_share_info' depending on value of
   // is_temporary. Returns an sqlite
   bool CreateShareInfoTable(bool is_temporary);
@@ -5,6 +5,7 @@
 #include "sync/syncable/on_disk_directory_backing_store.h"
 
 #include "base/logging.h"
+#include "base/macros.h"
 #include "base/stl_util.h"
 #include "base/metrics/histogram.h"
 #include "sync/syncable/syncable-inl.h"
@@ -42,6 +43,11 @@ DirOpenResult OnDiskDirectoryBackingStore::TryLoad(
   if (!db_->is_open()) {
     if (!db_->Open(backing_filepath_))
       return FAILED_OPEN_DATABASE;
+    // Large databases make the periodic SaveChanges transaction expensive
+    // under the rollback journal, since every dirtied page is rewritten in
+    // place.  Appending to a size-capped write-ahead log keeps those flushes
+    // incremental.  If the switch fails we simply keep the default journal.
+    ignore_result(EnableWriteAheadLogging());
   }
 
   if (!InitializeTables())
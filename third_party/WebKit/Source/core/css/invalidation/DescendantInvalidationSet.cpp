@@ -75,10 +75,13 @@ bool DescendantInvalidationSet::invalidatesElement(Element& element) const
     }
 
     if (element.hasClass() && m_classes) {
+        // Probe the hash set with each of the element's classes instead of
+        // scanning the class list for each entry in the set, so the cost
+        // scales with the element rather than with the invalidation set.
         const SpaceSplitString& classNames = element.classNames();
-        for (const auto& className : *m_classes) {
-            if (classNames.contains(className)) {
-                TRACE_STYLE_INVALIDATOR_INVALIDATION_SELECTORPART_IF_ENABLED(element, InvalidationSetMatchedClass, *this, className);
+        for (size_t i = 0; i < classNames.size(); ++i) {
+            if (m_classes->contains(classNames[i])) {
+                TRACE_STYLE_INVALIDATOR_INVALIDATION_SELECTORPART_IF_ENABLED(element, InvalidationSetMatchedClass, *this, classNames[i]);
                 return true;
             }
         }
@@ -40,10 +40,11 @@ void StyleInvalidator::invalidate(Document& document)
     clearPendingInvalidations();
 }
 
-void StyleInvalidator::scheduleInvalidation(PassRefPtrWillBeRawPtr<DescendantInvalidationSet> invalidationSet, Element& element)
+void StyleInvalidator::scheduleInvalidation(PassRefPtrWillBeRawPtr<DescendantInvalidationSet> prpInvalidationSet, Element& element)
 {
     ASSERT(element.inActiveDocument());
     ASSERT(element.styleChangeType() < SubtreeStyleChange);
+    RefPtrWillBeRawPtr<DescendantInvalidationSet> invalidationSet = prpInvalidationSet;
     InvalidationList& list = ensurePendingInvalidationList(element);
     // If we're already going to invalidate the whole subtree we don't need to store any new sets.
     if (!list.isEmpty() && list.last()->wholeSubtreeInvalid())
@@ -51,7 +52,14 @@ void StyleInvalidator::scheduleInvalidation(PassRefPtrWillBeRawPtr<DescendantInv
     // If this set would invalidate the whole subtree we can discard all existing sets.
     if (invalidationSet->wholeSubtreeInvalid())
         list.clear();
-    list.append(invalidationSet);
+    // Several features changing on one element commonly map to the same set;
+    // storing it once is enough since every stored set is pushed when the
+    // invalidation reaches the element.
+    for (const auto& existingSet : list) {
+        if (existingSet.get() == invalidationSet.get())
+            return;
+    }
+    list.append(invalidationSet.release());
     element.setNeedsStyleInvalidation();
 }
 
@@ -52,6 +52,12 @@ static const size_t outstandingTokenLimit = 10000;
 // This was tuned in https://bugs.webkit.org/show_bug.cgi?id=110408.
 static const size_t pendingTokenLimit = 1000;
 
+// Chunk handoff has a fixed per-chunk cost (a main-thread task and an input
+// checkpoint). Once this many tokens are already queued ahead of the main
+// thread, larger chunks cannot add latency, so batches are allowed to grow
+// to cut that overhead on big documents.
+static const size_t deepSpeculationTokenCount = 4 * pendingTokenLimit;
+
 using namespace HTMLNames;
 
 #if ENABLE(ASSERT)
@@ -237,7 +243,11 @@ void BackgroundHTMLParser::pumpTokenizer()
 
         m_token->clear();
 
-        if (simulatedToken == HTMLTreeBuilderSimulator::ScriptEnd || m_pendingTokens->size() >= pendingTokenLimit) {
+        size_t tokenLimit = pendingTokenLimit;
+        if (m_input.totalCheckpointTokenCount() > deepSpeculationTokenCount)
+            tokenLimit = deepSpeculationTokenCount;
+
+        if (simulatedToken == HTMLTreeBuilderSimulator::ScriptEnd || m_pendingTokens->size() >= tokenLimit) {
             sendTokensToMainThread();
             // If we're far ahead of the main thread, yield for a bit to avoid consuming too much memory.
             if (m_input.totalCheckpointTokenCount() > outstandingTokenLimit)
@@ -1044,8 +1044,12 @@ void HTMLDocumentParser::appendBytes(const char* data, size_t length)
         if (!m_haveBackgroundParser)
             startBackgroundParser();
 
-        OwnPtr<Vector<char>> buffer = adoptPtr(new Vector<char>(length));
-        memcpy(buffer->data(), data, length);
+        // Append into an empty vector rather than constructing one of |length|
+        // elements; the sized constructor zero-fills the buffer, which would
+        // write every chunk twice.
+        OwnPtr<Vector<char>> buffer = adoptPtr(new Vector<char>);
+        buffer->reserveInitialCapacity(length);
+        buffer->append(data, length);
         TRACE_EVENT1("net", "HTMLDocumentParser::appendBytes", "size", (unsigned)length);
 
         HTMLParserThread::shared()->postTask(bind(&BackgroundHTMLParser::appendRawBytesFromMainThread, m_backgroundParser, buffer.release()));
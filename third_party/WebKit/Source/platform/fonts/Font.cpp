@@ -224,9 +224,11 @@ float Font::width(const TextRun& run, HashSet<const SimpleFontData*>* fallbackFo
     }
 
     bool hasWordSpacingOrLetterSpacing = fontDescription().wordSpacing() || fontDescription().letterSpacing();
-    bool isCacheable = codePathToUse == ComplexPath
-        && !hasWordSpacingOrLetterSpacing // Word spacing and letter spacing can change the width of a word.
-        && !run.allowTabs(); // If we allow tabs and a tab occurs inside a word, the width of the word varies based on its position on the line.
+    // Relayouts remeasure the same words over and over, so the cache applies
+    // to both code paths; entries whose content or style changed simply miss.
+    bool isCacheable = !hasWordSpacingOrLetterSpacing // Word spacing and letter spacing can change the width of a word.
+        && !run.allowTabs() // If we allow tabs and a tab occurs inside a word, the width of the word varies based on its position on the line.
+        && !run.expansion(); // Justification expansion changes the width but is not part of the cache key.
 
     WidthCacheEntry* cacheEntry = isCacheable
         ? m_fontFallbackList->widthCache().add(run, WidthCacheEntry())
@@ -242,8 +244,9 @@ float Font::width(const TextRun& run, HashSet<const SimpleFontData*>* fallbackFo
     if (codePathToUse == ComplexPath) {
         result = floatWidthForComplexText(run, fallbackFonts, &glyphBounds);
     } else {
-        ASSERT(!isCacheable);
-        result = floatWidthForSimpleText(run, fallbackFonts, glyphOverflow ? &glyphBounds : 0);
+        // Compute bounds for entries that will be cached so that a later
+        // cache hit can satisfy a caller that does observe glyph overflow.
+        result = floatWidthForSimpleText(run, fallbackFonts, (glyphOverflow || cacheEntry) ? &glyphBounds : 0);
     }
 
     if (cacheEntry && (!fallbackFonts || fallbackFonts->isEmpty())) {
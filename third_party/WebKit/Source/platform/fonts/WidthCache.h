@@ -55,16 +55,19 @@ private:
 
         SmallStringKey()
             : m_length(s_emptyValueLength)
+            , m_direction(LTR)
         {
         }
 
         SmallStringKey(WTF::HashTableDeletedValueType)
             : m_length(s_deletedValueLength)
+            , m_direction(LTR)
         {
         }
 
-        template<typename CharacterType> SmallStringKey(CharacterType* characters, unsigned short length)
+        template<typename CharacterType> SmallStringKey(CharacterType* characters, unsigned short length, TextDirection direction)
             : m_length(length)
+            , m_direction(direction)
         {
             ASSERT(length <= s_capacity);
 
@@ -86,11 +89,14 @@ private:
                 hasher.addCharacter(characters[i]);
             }
 
-            m_hash = hasher.hash();
+            // Direction affects the shaped width of a word, so keys for the
+            // two directions must not collide. hash() only uses the low bits.
+            m_hash = hasher.hash() ^ (direction == RTL ? 1u << 31 : 0);
         }
 
         const UChar* characters() const { return m_characters; }
         unsigned short length() const { return m_length; }
+        TextDirection direction() const { return static_cast<TextDirection>(m_direction); }
         unsigned hash() const { return m_hash; }
 
         bool isHashTableDeletedValue() const { return m_length == s_deletedValueLength; }
@@ -103,6 +109,7 @@ private:
 
         unsigned m_hash;
         unsigned short m_length;
+        unsigned short m_direction;
         UChar m_characters[s_capacity];
     };
 
@@ -154,15 +161,18 @@ private:
         bool isNewEntry;
         WidthCacheEntry *value;
         if (length == 1) {
-            SingleCharMap::AddResult addResult = m_singleCharMap.add(run[0], entry);
+            // The width of a mirrorable character depends on the direction
+            // it is shaped in, so it gets folded into the key.
+            uint32_t key = run[0] | (run.rtl() ? 1u << 16 : 0);
+            SingleCharMap::AddResult addResult = m_singleCharMap.add(key, entry);
             isNewEntry = addResult.isNewEntry;
             value = &addResult.storedValue->value;
         } else {
             SmallStringKey smallStringKey;
             if (run.is8Bit())
-                smallStringKey = SmallStringKey(run.characters8(), length);
+                smallStringKey = SmallStringKey(run.characters8(), length, run.direction());
             else
-                smallStringKey = SmallStringKey(run.characters16(), length);
+                smallStringKey = SmallStringKey(run.characters16(), length, run.direction());
 
             Map::AddResult addResult = m_map.add(smallStringKey, entry);
             isNewEntry = addResult.isNewEntry;
@@ -203,7 +213,7 @@ private:
 
 inline bool operator==(const WidthCache::SmallStringKey& a, const WidthCache::SmallStringKey& b)
 {
-    if (a.length() != b.length())
+    if (a.length() != b.length() || a.direction() != b.direction())
         return false;
     return WTF::equal(a.characters(), b.characters(), a.length());
 }
@@ -33,12 +33,15 @@
 
 #include "platform/ScriptForbiddenScope.h"
 #include "platform/TraceEvent.h"
+#include "platform/TraceLocation.h"
 #include "platform/heap/AddressSanitizer.h"
 #include "platform/heap/CallbackStack.h"
 #include "platform/heap/Handle.h"
 #include "platform/heap/Heap.h"
+#include "platform/scheduler/Scheduler.h"
 #include "public/platform/Platform.h"
 #include "public/platform/WebThread.h"
+#include "wtf/CurrentTime.h"
 #include "wtf/ThreadingPrimitives.h"
 #if ENABLE(GC_PROFILE_HEAP)
 #include "platform/TracedValue.h"
@@ -311,6 +314,7 @@ ThreadState::ThreadState()
     , m_atSafePoint(false)
     , m_interruptors()
     , m_didV8GCAfterLastGC(false)
+    , m_idleGCScheduled(false)
     , m_sweepForbidden(false)
     , m_noAllocationCount(0)
     , m_isTerminating(false)
@@ -760,10 +764,45 @@ void ThreadState::scheduleGCOrForceConservativeGCIfNeeded()
 
 void ThreadState::scheduleGC()
 {
-    if (isSweepingInProgress())
+    if (isSweepingInProgress()) {
         setGCState(SweepingAndNextGCScheduled);
-    else
+    } else {
         setGCState(GCScheduled);
+        scheduleIdleGC();
+    }
+}
+
+void ThreadState::scheduleIdleGC()
+{
+    checkThread();
+    // Idle tasks are only available on the main thread's scheduler; other
+    // threads keep running their scheduled GC at the next safepoint.
+    if (!isMainThread() || m_idleGCScheduled)
+        return;
+    m_idleGCScheduled = true;
+    Scheduler::shared()->postIdleTask(FROM_HERE, WTF::bind<double>(&ThreadState::performIdleGC, this));
+}
+
+void ThreadState::performIdleGC(double deadlineSeconds)
+{
+    checkThread();
+    m_idleGCScheduled = false;
+
+    if (gcState() != GCScheduled)
+        return;
+
+    // A precise GC without sweeping normally fits in a frame's idle
+    // allowance. If this idle period is mostly consumed already, wait for
+    // the next one instead of overrunning the frame; the safepoint path
+    // still collects if no idle time shows up at all.
+    const double estimatedCollectionTimeInSeconds = 0.01;
+    if (deadlineSeconds - monotonicallyIncreasingTime() < estimatedCollectionTimeInSeconds) {
+        scheduleIdleGC();
+        return;
+    }
+
+    TRACE_EVENT0("blink_gc", "ThreadState::performIdleGC");
+    Heap::collectGarbage(NoHeapPointersOnStack, GCWithoutSweep);
 }
 
 void ThreadState::setGCState(GCState gcState)
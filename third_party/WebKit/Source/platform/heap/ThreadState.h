@@ -314,6 +314,7 @@ public:
     void didV8GC();
 
     void scheduleGC();
+    void scheduleIdleGC();
     void scheduleGCOrForceConservativeGCIfNeeded();
     void setGCState(GCState);
     GCState gcState() const;
@@ -594,6 +595,7 @@ private:
     bool shouldGC();
     bool shouldForceConservativeGC();
     void runScheduledGC(StackState);
+    void performIdleGC(double deadlineSeconds);
 
     // When ThreadState is detaching from non-main thread its
     // heap is expected to be empty (because it is going away).
@@ -632,6 +634,7 @@ private:
     bool m_atSafePoint;
     Vector<Interruptor*> m_interruptors;
     bool m_didV8GCAfterLastGC;
+    bool m_idleGCScheduled;
     bool m_sweepForbidden;
     size_t m_noAllocationCount;
     size_t m_allocatedObjectSizeBeforeSweeping;
@@ -42,7 +42,9 @@ ArrayBufferBuilder::ArrayBufferBuilder()
     : m_bytesUsed(0)
     , m_variableCapacity(true)
 {
-    m_buffer = ArrayBuffer::create(defaultBufferCapacity, 1);
+    // Skip zero-initialization; only the [0, m_bytesUsed) range is ever
+    // exposed, and append() writes it before advancing m_bytesUsed.
+    m_buffer = ArrayBuffer::createUninitialized(defaultBufferCapacity, 1);
 }
 
 bool ArrayBufferBuilder::expandCapacity(unsigned sizeToIncrease)
@@ -63,8 +65,10 @@ bool ArrayBufferBuilder::expandCapacity(unsigned sizeToIncrease)
     if (exponentialGrowthNewBufferSize > newBufferSize)
         newBufferSize = exponentialGrowthNewBufferSize;
 
-    // Copy existing data in current buffer to new buffer.
-    RefPtr<ArrayBuffer> newBuffer = ArrayBuffer::create(newBufferSize, 1);
+    // Copy existing data in current buffer to new buffer. The buffer is
+    // created uninitialized, so that growing to a large response doesn't
+    // touch every page twice: once for the zero-fill and once for the data.
+    RefPtr<ArrayBuffer> newBuffer = ArrayBuffer::createUninitialized(newBufferSize, 1);
     if (!newBuffer)
         return false;
 
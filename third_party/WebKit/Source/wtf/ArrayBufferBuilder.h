@@ -53,7 +53,7 @@ public:
         : m_bytesUsed(0)
         , m_variableCapacity(true)
     {
-        m_buffer = ArrayBuffer::create(capacity, 1);
+        m_buffer = ArrayBuffer::createUninitialized(capacity, 1);
     }
 
     bool isValid() const
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2015 Google Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above
+ * copyright notice, this list of conditions and the following disclaimer
+ * in the documentation and/or other materials provided with the
+ * distribution.
+ *     * Neither the name of Google Inc. nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "wtf/SpinLock.h"
+
+#include "wtf/CPU.h"
+
+#if OS(WIN)
+#include <windows.h>
+#elif OS(POSIX)
+#include <sched.h>
+#endif
+
+// The YIELD_PROCESSOR macro wraps an architecture-specific instruction that
+// informs the processor that we're in a busy wait, so it can handle the branch
+// more intelligently, reduce power to our core, or give more resources to the
+// other hyper-thread on this core.
+#if COMPILER(MSVC)
+#define YIELD_PROCESSOR YieldProcessor()
+#elif CPU(X86) || CPU(X86_64)
+#define YIELD_PROCESSOR __asm__ __volatile__("pause")
+#elif CPU(ARM)
+#define YIELD_PROCESSOR __asm__ __volatile__("yield")
+#else
+#define YIELD_PROCESSOR ((void)0)
+#endif
+
+namespace WTF {
+
+void slowSpinLockLock(int volatile* lock)
+{
+    // The number of processor yields before backing off to the scheduler is
+    // roughly what TCMalloc and Windows critical sections use.
+    static const int kYieldProcessorTries = 1000;
+    do {
+        do {
+            for (int count = 0; count < kYieldProcessorTries; ++count) {
+                YIELD_PROCESSOR;
+                // Only try the atomic once the lock looks free, to avoid
+                // bouncing the cache line while the owner still holds it.
+                if (LIKELY(!*lock) && LIKELY(!atomicTestAndSetToOne(lock)))
+                    return;
+            }
+
+            // The owner has held the lock for a while; give the OS a chance
+            // to schedule something else on this core.
+#if OS(WIN)
+            SwitchToThread();
+#elif OS(POSIX)
+            sched_yield();
+#endif
+        } while (*lock);
+    } while (UNLIKELY(atomicTestAndSetToOne(lock)));
+}
+
+} // namespace WTF
@@ -37,14 +37,20 @@
 // a given memory address.
 
 #include "wtf/Atomics.h"
+#include "wtf/WTFExport.h"
 
 namespace WTF {
 
+// The contended path spins with a processor yield instruction and eventually
+// backs off to the scheduler; it lives out of line so this header does not
+// have to pull in the OS headers needed for yielding.
+WTF_EXPORT void slowSpinLockLock(int volatile* lock);
+
 ALWAYS_INLINE void spinLockLock(int volatile* lock)
 {
-    while (UNLIKELY(atomicTestAndSetToOne(lock))) {
-        while (*lock) { } // Spin without spamming locked instructions.
-    }
+    if (LIKELY(!atomicTestAndSetToOne(lock)))
+        return;
+    slowSpinLockLock(lock);
 }
 
 ALWAYS_INLINE void spinLockUnlock(int volatile* lock)
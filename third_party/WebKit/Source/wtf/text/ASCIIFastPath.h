@@ -28,7 +28,9 @@
 #include "wtf/unicode/Unicode.h"
 #include <stdint.h>
 
-#if OS(MACOSX) && (CPU(X86) || CPU(X86_64))
+#if CPU(X86) || CPU(X86_64)
+// SSE2 is part of the minimum x86 requirement for Chrome, so it can be used
+// without a runtime CPU check.
 #include <emmintrin.h>
 #endif
 
@@ -102,9 +104,58 @@ inline bool charactersAreAllASCII(const CharacterType* characters, size_t length
     return !(allCharBits & nonASCIIBitMask);
 }
 
+#if CPU(X86) || CPU(X86_64)
+// 16 bytes per iteration instead of one machine word. As above, these assume
+// the input is likely all ASCII and do not leave early if it is not.
+inline bool charactersAreAllASCII(const LChar* characters, size_t length)
+{
+    const LChar* end = characters + length;
+    if (length >= 16) {
+        __m128i allCharBits = _mm_setzero_si128();
+        const LChar* simdEnd = characters + (length & ~static_cast<size_t>(15));
+        do {
+            allCharBits = _mm_or_si128(allCharBits, _mm_loadu_si128(reinterpret_cast_ptr<const __m128i*>(characters)));
+            characters += 16;
+        } while (characters != simdEnd);
+        if (_mm_movemask_epi8(allCharBits))
+            return false;
+    }
+
+    LChar trailingCharBits = 0;
+    while (characters != end) {
+        trailingCharBits |= *characters;
+        ++characters;
+    }
+    return !(trailingCharBits & 0x80);
+}
+
+inline bool charactersAreAllASCII(const UChar* characters, size_t length)
+{
+    const UChar* end = characters + length;
+    if (length >= 8) {
+        __m128i allCharBits = _mm_setzero_si128();
+        const UChar* simdEnd = characters + (length & ~static_cast<size_t>(7));
+        do {
+            allCharBits = _mm_or_si128(allCharBits, _mm_loadu_si128(reinterpret_cast_ptr<const __m128i*>(characters)));
+            characters += 8;
+        } while (characters != simdEnd);
+        const __m128i nonASCIIMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(allCharBits, nonASCIIMask), _mm_setzero_si128())) != 0xFFFF)
+            return false;
+    }
+
+    UChar trailingCharBits = 0;
+    while (characters != end) {
+        trailingCharBits |= *characters;
+        ++characters;
+    }
+    return !(trailingCharBits & 0xFF80);
+}
+#endif
+
 inline void copyLCharsFromUCharSource(LChar* destination, const UChar* source, size_t length)
 {
-#if OS(MACOSX) && (CPU(X86) || CPU(X86_64))
+#if CPU(X86) || CPU(X86_64)
     const uintptr_t memoryAccessSize = 16; // Memory accesses on 16 byte (128 bit) alignment
     const uintptr_t memoryAccessMask = memoryAccessSize - 1;
 
@@ -763,6 +763,15 @@ CString String::utf8(UTF8ConversionMode mode) const
     if (!length)
         return CString("", 0);
 
+    // An all-ASCII 8-bit string is already valid UTF-8 in any conversion
+    // mode; copy it directly rather than going through the converter. This
+    // is the common case on the bindings boundary.
+    if (is8Bit()) {
+        const LChar* characters = this->characters8();
+        if (charactersAreAllASCII(characters, length))
+            return CString(reinterpret_cast<const char*>(characters), length);
+    }
+
     // Allocate a buffer big enough to hold all the characters
     // (an individual UTF-16 UChar can only expand to 3 UTF-8 bytes).
     // Optimization ideas, if we find this function is hot:
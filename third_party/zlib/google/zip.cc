@@ -4,15 +4,21 @@
 
 #include "third_party/zlib/google/zip.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 #include "base/bind.h"
 #include "base/files/file.h"
 #include "base/files/file_enumerator.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/hash.h"
 #include "base/logging.h"
+#include "base/memory/scoped_vector.h"
 #include "base/strings/string16.h"
 #include "base/strings/string_util.h"
+#include "base/sys_info.h"
+#include "base/threading/simple_thread.h"
 #include "third_party/zlib/google/zip_internal.h"
 #include "third_party/zlib/google/zip_reader.h"
 
@@ -88,35 +94,161 @@ bool ExcludeHiddenFilesFilter(const base::FilePath& file_path) {
   return file_path.BaseName().value()[0] != '.';
 }
 
+// The maximum number of worker threads used when extracting an archive in
+// parallel, and the number of entries below which fanning the extraction out
+// to worker threads is not worth the thread start-up cost.
+const int kMaxUnzipWorkers = 4;
+const int kMinEntriesForParallelUnzip = 16;
+
+// Extracts the current, already opened entry of |reader| into |dest_dir|.
+// Returns true on success.
+bool ExtractOpenedEntry(zip::ZipReader* reader,
+                        const base::FilePath& dest_dir) {
+  if (reader->current_entry_info()->is_unsafe()) {
+    DLOG(WARNING) << "Found an unsafe file in zip "
+                  << reader->current_entry_info()->file_path().value();
+    return false;
+  }
+  if (!reader->ExtractCurrentEntryIntoDirectory(dest_dir)) {
+    DLOG(WARNING) << "Failed to extract "
+                  << reader->current_entry_info()->file_path().value();
+    return false;
+  }
+  return true;
+}
+
+// Opens and extracts the current entry of |reader| into |dest_dir|. Returns
+// true on success.
+bool ExtractCurrentEntry(zip::ZipReader* reader,
+                         const base::FilePath& dest_dir) {
+  if (!reader->OpenCurrentEntryInZip()) {
+    DLOG(WARNING) << "Failed to open the current file in zip";
+    return false;
+  }
+  return ExtractOpenedEntry(reader, dest_dir);
+}
+
+// Extracts every entry of |reader| into |dest_dir|. Returns true on success.
+bool ExtractAllEntries(zip::ZipReader* reader,
+                       const base::FilePath& dest_dir) {
+  while (reader->HasMore()) {
+    if (!ExtractCurrentEntry(reader, dest_dir))
+      return false;
+    if (!reader->AdvanceToNextEntry()) {
+      DLOG(WARNING) << "Failed to advance to the next file";
+      return false;
+    }
+  }
+  return true;
+}
+
+// Extracts the subset of entries of a memory mapped archive whose output
+// path hashes to |worker_index|. Each worker opens its own ZipReader on the
+// shared mapping, so the workers can inflate disjoint entries concurrently.
+// Partitioning by output path (rather than by entry index) ensures that
+// duplicate entry names, which are legal in the zip format, are all written
+// by the same worker in archive order, so the last entry wins just as it
+// does on the serial path.
+class UnzipWorker : public base::DelegateSimpleThread::Delegate {
+ public:
+  UnzipWorker(const base::MemoryMappedFile& mapped_file,
+              const base::FilePath& dest_dir,
+              int worker_index,
+              int num_workers)
+      : mapped_file_(mapped_file),
+        dest_dir_(dest_dir),
+        worker_index_(worker_index),
+        num_workers_(num_workers),
+        success_(false) {}
+
+  // Valid after the worker has been joined.
+  bool success() const { return success_; }
+
+  void Run() override {
+    zip::ZipReader reader;
+    if (!reader.OpenFromMemory(
+            reinterpret_cast<const char*>(mapped_file_.data()),
+            mapped_file_.length())) {
+      return;
+    }
+    while (reader.HasMore()) {
+      if (!reader.OpenCurrentEntryInZip()) {
+        DLOG(WARNING) << "Failed to open the current file in zip";
+        return;
+      }
+      const uint32 path_hash =
+          base::Hash(reader.current_entry_info()->file_path().AsUTF8Unsafe());
+      if (path_hash % num_workers_ == static_cast<uint32>(worker_index_) &&
+          !ExtractOpenedEntry(&reader, dest_dir_)) {
+        return;
+      }
+      if (!reader.AdvanceToNextEntry()) {
+        DLOG(WARNING) << "Failed to advance to the next file";
+        return;
+      }
+    }
+    success_ = true;
+  }
+
+ private:
+  const base::MemoryMappedFile& mapped_file_;
+  const base::FilePath dest_dir_;
+  const int worker_index_;
+  const int num_workers_;
+  bool success_;
+
+  DISALLOW_COPY_AND_ASSIGN(UnzipWorker);
+};
+
 }  // namespace
 
 namespace zip {
 
 bool Unzip(const base::FilePath& src_file, const base::FilePath& dest_dir) {
+  // Map the archive into memory so that the central directory walk and the
+  // inflate input reads are served straight from the page cache, and so that
+  // several readers can decompress disjoint entries concurrently. Mapping can
+  // fail for empty files and exotic file systems; fall back to buffered
+  // reads in that case.
+  base::MemoryMappedFile mapped_file;
+  if (!mapped_file.Initialize(src_file)) {
+    ZipReader reader;
+    if (!reader.Open(src_file)) {
+      DLOG(WARNING) << "Failed to open " << src_file.value();
+      return false;
+    }
+    return ExtractAllEntries(&reader, dest_dir);
+  }
+
   ZipReader reader;
-  if (!reader.Open(src_file)) {
+  if (!reader.OpenFromMemory(
+          reinterpret_cast<const char*>(mapped_file.data()),
+          mapped_file.length())) {
     DLOG(WARNING) << "Failed to open " << src_file.value();
     return false;
   }
-  while (reader.HasMore()) {
-    if (!reader.OpenCurrentEntryInZip()) {
-      DLOG(WARNING) << "Failed to open the current file in zip";
-      return false;
-    }
-    if (reader.current_entry_info()->is_unsafe()) {
-      DLOG(WARNING) << "Found an unsafe file in zip "
-                    << reader.current_entry_info()->file_path().value();
-      return false;
-    }
-    if (!reader.ExtractCurrentEntryIntoDirectory(dest_dir)) {
-      DLOG(WARNING) << "Failed to extract "
-                    << reader.current_entry_info()->file_path().value();
-      return false;
-    }
-    if (!reader.AdvanceToNextEntry()) {
-      DLOG(WARNING) << "Failed to advance to the next file";
+
+  int num_workers = std::min(kMaxUnzipWorkers,
+                             base::SysInfo::NumberOfProcessors());
+  if (num_workers < 2 || reader.num_entries() < kMinEntriesForParallelUnzip)
+    return ExtractAllEntries(&reader, dest_dir);
+
+  // Fan the entries out to a pool of worker threads and wait for all of them
+  // to finish. Entry extraction is independent: minizip verifies each entry's
+  // CRC as it inflates, and directory creation tolerates races between
+  // workers extracting into the same subtree.
+  ScopedVector<UnzipWorker> workers;
+  base::DelegateSimpleThreadPool pool("zip_unzip", num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    workers.push_back(new UnzipWorker(mapped_file, dest_dir, i, num_workers));
+    pool.AddWork(workers[i]);
+  }
+  pool.Start();
+  pool.JoinAll();
+
+  for (int i = 0; i < num_workers; ++i) {
+    if (!workers[i]->success())
       return false;
-    }
   }
   return true;
 }
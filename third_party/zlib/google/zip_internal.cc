@@ -297,15 +297,15 @@ unzFile OpenHandleForUnzipping(HANDLE zip_handle) {
 #endif
 
 // static
-unzFile PrepareMemoryForUnzipping(const std::string& data) {
-  if (data.empty())
+unzFile PrepareMemoryForUnzipping(const char* data, size_t length) {
+  if (!data || length == 0)
     return NULL;
 
   ZipBuffer* buffer = static_cast<ZipBuffer*>(malloc(sizeof(ZipBuffer)));
   if (!buffer)
     return NULL;
-  buffer->data = data.data();
-  buffer->length = data.length();
+  buffer->data = data;
+  buffer->length = length;
   buffer->offset = 0;
 
   zlib_filefunc_def zip_functions;
@@ -320,6 +320,10 @@ unzFile PrepareMemoryForUnzipping(const std::string& data) {
   return unzOpen2(NULL, &zip_functions);
 }
 
+unzFile PrepareMemoryForUnzipping(const std::string& data) {
+  return PrepareMemoryForUnzipping(data.data(), data.length());
+}
+
 zipFile OpenForZipping(const std::string& file_name_utf8, int append_flag) {
   zlib_filefunc_def* zip_func_ptrs = NULL;
 #if defined(OS_WIN)
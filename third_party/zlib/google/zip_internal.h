@@ -42,6 +42,12 @@ unzFile OpenFdForUnzipping(int zip_fd);
 unzFile OpenHandleForUnzipping(HANDLE zip_handle);
 #endif
 
+// Creates a custom unzFile object which reads data from the specified memory
+// region. This custom unzFile object overrides the I/O API functions of zlib
+// so it can read data from the specified memory region. The memory region
+// must outlive the returned unzFile object.
+unzFile PrepareMemoryForUnzipping(const char* data, size_t length);
+
 // Creates a custom unzFile object which reads data from the specified string.
 // This custom unzFile object overrides the I/O API functions of zlib so it can
 // read data from the specified string.
@@ -113,6 +113,13 @@ bool ZipReader::OpenFromString(const std::string& data) {
   return OpenInternal();
 }
 
+bool ZipReader::OpenFromMemory(const char* data, size_t length) {
+  zip_file_ = internal::PrepareMemoryForUnzipping(data, length);
+  if (!zip_file_)
+    return false;
+  return OpenInternal();
+}
+
 void ZipReader::Close() {
   if (zip_file_) {
     unzClose(zip_file_);
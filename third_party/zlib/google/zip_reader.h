@@ -111,6 +111,14 @@ class ZipReader {
   // string until it finishes extracting files.
   bool OpenFromString(const std::string& data);
 
+  // Opens the zip data stored in the memory region starting at |data| of
+  // |length| bytes. This class uses a weak reference to the given region
+  // while extracting files, i.e. the caller should keep the region alive
+  // until it finishes extracting files. This is useful for reading from a
+  // memory mapped archive; several readers may be opened on the same region
+  // and used concurrently from different threads.
+  bool OpenFromMemory(const char* data, size_t length);
+
   // Closes the currently opened zip file. This function is called in the
   // destructor of the class, so you usually don't need to call this.
   void Close();
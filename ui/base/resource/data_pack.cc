@@ -66,7 +66,8 @@ namespace ui {
 DataPack::DataPack(ui::ScaleFactor scale_factor)
     : resource_count_(0),
       text_encoding_type_(BINARY),
-      scale_factor_(scale_factor) {
+      scale_factor_(scale_factor),
+      lookup_table_mask_(0) {
 }
 
 DataPack::~DataPack() {
@@ -167,12 +168,46 @@ bool DataPack::LoadImpl() {
     }
   }
 
+  BuildLookupTable();
+
   return true;
 }
 
+void DataPack::BuildLookupTable() {
+  // Size the table at twice the entry count, rounded up to a power of two.
+  uint32 size = 2;
+  while (size < 2 * resource_count_)
+    size <<= 1;
+  lookup_table_mask_ = size - 1;
+  lookup_table_.assign(size, 0);
+  for (size_t i = 0; i < resource_count_; ++i) {
+    const DataPackEntry* entry = reinterpret_cast<const DataPackEntry*>(
+        mmap_->data() + kHeaderLength + (i * sizeof(DataPackEntry)));
+    // Fibonacci-style multiplicative hash; ids are dense small integers, so
+    // this spreads them across the table well enough for short probes.
+    uint32 slot = (entry->resource_id * 2654435761u) & lookup_table_mask_;
+    while (lookup_table_[slot])
+      slot = (slot + 1) & lookup_table_mask_;
+    lookup_table_[slot] = static_cast<uint32>(i + 1);
+  }
+}
+
+const void* DataPack::FindEntryById(uint16 resource_id) const {
+  if (lookup_table_.empty())
+    return NULL;
+  uint32 slot = (resource_id * 2654435761u) & lookup_table_mask_;
+  while (uint32 index = lookup_table_[slot]) {
+    const DataPackEntry* entry = reinterpret_cast<const DataPackEntry*>(
+        mmap_->data() + kHeaderLength + ((index - 1) * sizeof(DataPackEntry)));
+    if (entry->resource_id == resource_id)
+      return entry;
+    slot = (slot + 1) & lookup_table_mask_;
+  }
+  return NULL;
+}
+
 bool DataPack::HasResource(uint16 resource_id) const {
-  return !!bsearch(&resource_id, mmap_->data() + kHeaderLength, resource_count_,
-                   sizeof(DataPackEntry), DataPackEntry::CompareById);
+  return !!FindEntryById(resource_id);
 }
 
 bool DataPack::GetStringPiece(uint16 resource_id,
@@ -188,9 +223,8 @@ bool DataPack::GetStringPiece(uint16 resource_id,
   #error DataPack assumes little endian
 #endif
 
-  const DataPackEntry* target = reinterpret_cast<const DataPackEntry*>(
-      bsearch(&resource_id, mmap_->data() + kHeaderLength, resource_count_,
-              sizeof(DataPackEntry), DataPackEntry::CompareById));
+  const DataPackEntry* target =
+      reinterpret_cast<const DataPackEntry*>(FindEntryById(resource_id));
   if (!target) {
     return false;
   }
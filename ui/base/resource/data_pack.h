@@ -10,6 +10,7 @@
 #define UI_BASE_RESOURCE_DATA_PACK_H_
 
 #include <map>
+#include <vector>
 
 #include "base/basictypes.h"
 #include "base/files/file.h"
@@ -63,6 +64,14 @@ class UI_BASE_EXPORT DataPack : public ResourceHandle {
   // Does the actual loading of a pack file. Called by Load and LoadFromFile.
   bool LoadImpl();
 
+  // Builds |lookup_table_| from the mmapped entry table so lookups are a
+  // hash probe instead of a binary search over the pak.
+  void BuildLookupTable();
+
+  // Probes |lookup_table_| for the entry with |resource_id|. Returns NULL if
+  // the id is not present in this pack.
+  const void* FindEntryById(uint16 resource_id) const;
+
   // The memory-mapped data.
   scoped_ptr<base::MemoryMappedFile> mmap_;
 
@@ -76,6 +85,13 @@ class UI_BASE_EXPORT DataPack : public ResourceHandle {
   // resource pak.
   ui::ScaleFactor scale_factor_;
 
+  // Open-addressed hash index over the pak's sorted entry table, built once
+  // at load time. Each slot holds 1 + the index of an entry, or 0 if empty;
+  // the table is sized to twice the resource count so lookups are a probe or
+  // two. Read-only after load, hence safe to share between threads.
+  std::vector<uint32> lookup_table_;
+  uint32 lookup_table_mask_;
+
   DISALLOW_COPY_AND_ASSIGN(DataPack);
 };
 
@@ -484,6 +484,84 @@ class ThreadedTransformTransition : public ThreadedLayerAnimationElement {
   DISALLOW_COPY_AND_ASSIGN(ThreadedTransformTransition);
 };
 
+// ThreadedBoundsTransition ----------------------------------------------------
+
+// Transitions to a target bounds rect by running an equivalent transform
+// animation on the compositor thread, then committing the bounds (and
+// restoring the transform) once the animation completes. The bounds property
+// itself holds its starting value while the animation is in flight.
+class ThreadedBoundsTransition : public ThreadedLayerAnimationElement {
+ public:
+  ThreadedBoundsTransition(const gfx::Rect& target, base::TimeDelta duration)
+      : ThreadedLayerAnimationElement(TRANSFORM | BOUNDS, duration),
+        target_(target) {
+  }
+  ~ThreadedBoundsTransition() override {}
+
+ protected:
+  void OnStart(LayerAnimationDelegate* delegate) override {
+    start_ = delegate->GetBoundsForAnimation();
+    start_transform_ = delegate->GetTransformForAnimation();
+    target_transform_ = TransformBetweenRects(start_, target_);
+  }
+
+  void OnAbort(LayerAnimationDelegate* delegate) override {
+    if (delegate && Started()) {
+      ThreadedLayerAnimationElement::OnAbort(delegate);
+      delegate->SetTransformFromAnimation(gfx::Tween::TransformValueBetween(
+          gfx::Tween::CalculateValue(tween_type(), last_progressed_fraction()),
+          start_transform_,
+          target_transform_));
+    }
+  }
+
+  void OnEnd(LayerAnimationDelegate* delegate) override {
+    delegate->SetBoundsFromAnimation(target_);
+    delegate->SetTransformFromAnimation(start_transform_);
+  }
+
+  scoped_ptr<cc::Animation> CreateCCAnimation() override {
+    scoped_ptr<cc::AnimationCurve> animation_curve(
+        new TransformAnimationCurveAdapter(tween_type(),
+                                           start_transform_,
+                                           target_transform_,
+                                           duration()));
+    scoped_ptr<cc::Animation> animation(
+        cc::Animation::Create(animation_curve.Pass(),
+                              animation_id(),
+                              animation_group_id(),
+                              cc::Animation::Transform));
+    return animation.Pass();
+  }
+
+  void OnGetTarget(TargetValue* target) const override {
+    // The transform ends where it started, so only the bounds target needs
+    // reporting.
+    target->bounds = target_;
+  }
+
+ private:
+  // Returns the transform that makes a layer with bounds |from| cover exactly
+  // |to| in its parent's coordinate space.
+  static gfx::Transform TransformBetweenRects(const gfx::Rect& from,
+                                              const gfx::Rect& to) {
+    gfx::Transform transform;
+    transform.Translate(to.x() - from.x(), to.y() - from.y());
+    if (!from.IsEmpty()) {
+      transform.Scale(static_cast<float>(to.width()) / from.width(),
+                      static_cast<float>(to.height()) / from.height());
+    }
+    return transform;
+  }
+
+  gfx::Rect start_;
+  const gfx::Rect target_;
+  gfx::Transform start_transform_;
+  gfx::Transform target_transform_;
+
+  DISALLOW_COPY_AND_ASSIGN(ThreadedBoundsTransition);
+};
+
 // InverseTransformTransision --------------------------------------------------
 
 class InverseTransformTransition : public ThreadedLayerAnimationElement {
@@ -803,6 +881,13 @@ LayerAnimationElement* LayerAnimationElement::CreateBoundsElement(
   return new BoundsTransition(bounds, duration);
 }
 
+// static
+LayerAnimationElement* LayerAnimationElement::CreateBoundsViaTransformElement(
+    const gfx::Rect& bounds,
+    base::TimeDelta duration) {
+  return new ThreadedBoundsTransition(bounds, duration);
+}
+
 // static
 LayerAnimationElement* LayerAnimationElement::CreateOpacityElement(
     float opacity,
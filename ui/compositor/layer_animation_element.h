@@ -102,6 +102,17 @@ class COMPOSITOR_EXPORT LayerAnimationElement {
       const gfx::Rect& bounds,
       base::TimeDelta duration);
 
+  // Creates an element that transitions to the given bounds by running an
+  // equivalent transform animation on the compositor thread and committing
+  // the bounds when the animation completes. Unlike CreateBoundsElement(),
+  // the animation keeps ticking while the UI thread is busy, but the bounds
+  // property holds its starting value until the end, so this is only
+  // appropriate when nothing observes the bounds mid-flight. The caller owns
+  // the return value.
+  static LayerAnimationElement* CreateBoundsViaTransformElement(
+      const gfx::Rect& bounds,
+      base::TimeDelta duration);
+
   // Creates an element that transitions to the given opacity. The caller owns
   // the return value.
   static LayerAnimationElement* CreateOpacityElement(
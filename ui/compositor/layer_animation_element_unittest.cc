@@ -165,6 +165,57 @@ TEST(LayerAnimationElementTest, BoundsElement) {
   CheckApproximatelyEqual(target, target_value.bounds);
 }
 
+// Check that the threaded bounds element holds the bounds at their starting
+// value while in flight, commits the target bounds and restores the transform
+// on completion, and can be reused after it completes.
+TEST(LayerAnimationElementTest, BoundsViaTransformElement) {
+  TestLayerAnimationDelegate delegate;
+  gfx::Rect start(-90, 0, 50, 50);
+  gfx::Rect target(90, 0, 100, 100);
+  gfx::Transform start_transform;
+  start_transform.Rotate(30.0);
+  base::TimeTicks start_time;
+  base::TimeTicks effective_start_time;
+  base::TimeDelta delta = base::TimeDelta::FromSeconds(1);
+
+  scoped_ptr<LayerAnimationElement> element(
+      LayerAnimationElement::CreateBoundsViaTransformElement(target, delta));
+  element->set_animation_group_id(1);
+
+  for (int i = 0; i < 2; ++i) {
+    start_time = effective_start_time + delta;
+    element->set_requested_start_time(start_time);
+    delegate.SetBoundsFromAnimation(start);
+    delegate.SetTransformFromAnimation(start_transform);
+    element->Start(&delegate, 1);
+    element->Progress(start_time, &delegate);
+    CheckApproximatelyEqual(start, delegate.GetBoundsForAnimation());
+    effective_start_time = start_time + delta;
+    element->set_effective_start_time(effective_start_time);
+    element->Progress(effective_start_time, &delegate);
+    EXPECT_FLOAT_EQ(0.0, element->last_progressed_fraction());
+    element->Progress(effective_start_time + delta/2, &delegate);
+    EXPECT_FLOAT_EQ(0.5, element->last_progressed_fraction());
+    // The bounds are not updated until the animation completes.
+    CheckApproximatelyEqual(start, delegate.GetBoundsForAnimation());
+
+    base::TimeDelta element_duration;
+    EXPECT_TRUE(element->IsFinished(effective_start_time + delta,
+                                    &element_duration));
+    EXPECT_EQ(2 * delta, element_duration);
+
+    element->Progress(effective_start_time + delta, &delegate);
+    EXPECT_FLOAT_EQ(1.0, element->last_progressed_fraction());
+    CheckApproximatelyEqual(target, delegate.GetBoundsForAnimation());
+    CheckApproximatelyEqual(start_transform,
+                            delegate.GetTransformForAnimation());
+  }
+
+  LayerAnimationElement::TargetValue target_value(&delegate);
+  element->GetTargetValue(&target_value);
+  CheckApproximatelyEqual(target, target_value.bounds);
+}
+
 // Check that the opacity element progresses the delegate as expected and
 // that the element can be reused after it completes.
 TEST(LayerAnimationElementTest, OpacityElement) {
@@ -662,12 +662,26 @@ SkBitmap SkBitmapOperations::UnPreMultiply(const SkBitmap& bitmap) {
   {
     SkAutoLockPixels bitmap_lock(bitmap);
     SkAutoLockPixels opaque_bitmap_lock(opaque_bitmap);
+    // Walk row pointers and index the scale table directly instead of
+    // calling PMColorToColor per pixel; translucent pixels cost one table
+    // load and opaque or fully transparent ones just get repacked.
+    const SkUnPreMultiply::Scale* scale_table = SkUnPreMultiply::GetScaleTable();
     for (int y = 0; y < opaque_bitmap.height(); y++) {
+      const uint32* src_row = bitmap.getAddr32(0, y);
+      uint32* dst_row = opaque_bitmap.getAddr32(0, y);
       for (int x = 0; x < opaque_bitmap.width(); x++) {
-        uint32 src_pixel = *bitmap.getAddr32(x, y);
-        uint32* dst_pixel = opaque_bitmap.getAddr32(x, y);
-        SkColor unmultiplied = SkUnPreMultiply::PMColorToColor(src_pixel);
-        *dst_pixel = unmultiplied;
+        uint32 src_pixel = src_row[x];
+        unsigned alpha = SkGetPackedA32(src_pixel);
+        unsigned r = SkGetPackedR32(src_pixel);
+        unsigned g = SkGetPackedG32(src_pixel);
+        unsigned b = SkGetPackedB32(src_pixel);
+        if (alpha != 255 && alpha != 0) {
+          SkUnPreMultiply::Scale scale = scale_table[alpha];
+          r = SkUnPreMultiply::ApplyScale(scale, r);
+          g = SkUnPreMultiply::ApplyScale(scale, g);
+          b = SkUnPreMultiply::ApplyScale(scale, b);
+        }
+        dst_row[x] = SkColorSetARGB(alpha, r, g, b);
       }
     }
   }
@@ -22,6 +22,7 @@ bool ValidFormat(unsigned internalformat, gfx::GpuMemoryBuffer::Format format) {
       switch (format) {
         case gfx::GpuMemoryBuffer::RGBX_8888:
           return true;
+        case gfx::GpuMemoryBuffer::RGBA_4444:
         case gfx::GpuMemoryBuffer::RGBA_8888:
         case gfx::GpuMemoryBuffer::BGRA_8888:
           return false;
@@ -32,6 +33,7 @@ bool ValidFormat(unsigned internalformat, gfx::GpuMemoryBuffer::Format format) {
       switch (format) {
         case gfx::GpuMemoryBuffer::BGRA_8888:
           return true;
+        case gfx::GpuMemoryBuffer::RGBA_4444:
         case gfx::GpuMemoryBuffer::RGBX_8888:
         case gfx::GpuMemoryBuffer::RGBA_8888:
           return false;
@@ -49,6 +51,7 @@ EGLint FourCC(gfx::GpuMemoryBuffer::Format format) {
       return DRM_FORMAT_ARGB8888;
     case gfx::GpuMemoryBuffer::RGBX_8888:
       return DRM_FORMAT_XRGB8888;
+    case gfx::GpuMemoryBuffer::RGBA_4444:
     case gfx::GpuMemoryBuffer::RGBA_8888:
       NOTREACHED();
       return 0;
@@ -28,6 +28,7 @@ bool ValidInternalFormat(unsigned internalformat) {
 
 bool ValidFormat(gfx::GpuMemoryBuffer::Format format) {
   switch (format) {
+    case gfx::GpuMemoryBuffer::RGBA_4444:
     case gfx::GpuMemoryBuffer::RGBA_8888:
     case gfx::GpuMemoryBuffer::BGRA_8888:
       return true;
@@ -41,6 +42,7 @@ bool ValidFormat(gfx::GpuMemoryBuffer::Format format) {
 
 GLenum TextureFormat(gfx::GpuMemoryBuffer::Format format) {
   switch (format) {
+    case gfx::GpuMemoryBuffer::RGBA_4444:
     case gfx::GpuMemoryBuffer::RGBA_8888:
       return GL_RGBA;
     case gfx::GpuMemoryBuffer::BGRA_8888:
@@ -60,6 +62,8 @@ GLenum DataFormat(gfx::GpuMemoryBuffer::Format format) {
 
 GLenum DataType(gfx::GpuMemoryBuffer::Format format) {
   switch (format) {
+    case gfx::GpuMemoryBuffer::RGBA_4444:
+      return GL_UNSIGNED_SHORT_4_4_4_4;
     case gfx::GpuMemoryBuffer::RGBA_8888:
     case gfx::GpuMemoryBuffer::BGRA_8888:
       return GL_UNSIGNED_BYTE;
@@ -81,7 +85,8 @@ GLImageMemory::GLImageMemory(const gfx::Size& size, unsigned internalformat)
       format_(gfx::GpuMemoryBuffer::RGBA_8888),
       in_use_(false),
       target_(0),
-      need_do_bind_tex_image_(false)
+      need_do_bind_tex_image_(false),
+      defined_texture_id_(0u)
 #if defined(OS_WIN) || defined(USE_X11) || defined(OS_ANDROID) || \
     defined(USE_OZONE)
       ,
@@ -102,6 +107,8 @@ GLImageMemory::~GLImageMemory() {
 // static
 size_t GLImageMemory::BytesPerPixel(gfx::GpuMemoryBuffer::Format format) {
   switch (format) {
+    case gfx::GpuMemoryBuffer::RGBA_4444:
+      return 2;
     case gfx::GpuMemoryBuffer::RGBA_8888:
     case gfx::GpuMemoryBuffer::BGRA_8888:
       return 4;
@@ -147,6 +154,7 @@ void GLImageMemory::Destroy(bool have_context) {
     egl_texture_id_ = 0u;
   }
 #endif
+  defined_texture_id_ = 0u;
   memory_ = NULL;
 }
 
@@ -275,6 +283,23 @@ void GLImageMemory::DoBindTexImage(unsigned target) {
 #endif
 
   DCHECK_NE(static_cast<GLenum>(GL_TEXTURE_EXTERNAL_OES), target);
+  GLint texture_id = 0;
+  if (target == GL_TEXTURE_2D)
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &texture_id);
+  if (texture_id && static_cast<unsigned>(texture_id) == defined_texture_id_) {
+    // The image level of this texture was defined by a previous bind; upload
+    // into it instead of re-specifying the level from scratch.
+    glTexSubImage2D(target,
+                    0,  // mip level
+                    0,  // x-offset
+                    0,  // y-offset
+                    size_.width(),
+                    size_.height(),
+                    DataFormat(format_),
+                    DataType(format_),
+                    memory_);
+    return;
+  }
   glTexImage2D(target,
                0,  // mip level
                TextureFormat(format_),
@@ -284,6 +309,7 @@ void GLImageMemory::DoBindTexImage(unsigned target) {
                DataFormat(format_),
                DataType(format_),
                memory_);
+  defined_texture_id_ = texture_id;
 }
 
 }  // namespace gfx
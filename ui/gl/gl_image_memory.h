@@ -55,6 +55,10 @@ class GL_EXPORT GLImageMemory : public GLImage {
   bool in_use_;
   unsigned target_;
   bool need_do_bind_tex_image_;
+  // Texture whose image level was last defined by this image. Rebinding to
+  // the same texture can upload with glTexSubImage2D instead of re-specifying
+  // the level.
+  unsigned defined_texture_id_;
 #if defined(OS_WIN) || defined(USE_X11) || defined(OS_ANDROID) || \
     defined(USE_OZONE)
   unsigned egl_texture_id_;
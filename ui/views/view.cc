@@ -100,6 +100,7 @@ View::View()
       notify_enter_exit_on_child_(false),
       registered_for_visible_bounds_notification_(false),
       root_bounds_dirty_(true),
+      descendants_root_bounds_dirty_(true),
       clip_insets_(0, 0, 0, 0),
       needs_layout_(true),
       snap_layer_to_pixel_boundary_(false),
@@ -412,8 +413,11 @@ void View::SetVisible(bool visible) {
     PropagateVisibilityNotifications(this, visible_);
     UpdateLayerVisibility();
 
-    // If we are newly visible, schedule paint.
+    // If we are newly visible, schedule paint. Our bounds (and those of our
+    // children) were dropped from the BoundsTree when we were hidden, so
+    // dirty them for reinsertion.
     if (visible_) {
+      SetRootBoundsDirty(true);
       SchedulePaint();
     } else {
       // We're never painted when hidden, so no need to be in the BoundsTree.
@@ -2000,6 +2004,16 @@ void View::SetLayerBounds(const gfx::Rect& bounds) {
 void View::SetRootBoundsDirty(bool origin_changed) {
   root_bounds_dirty_ = true;
 
+  // Let every ancestor up to the paint root know that this branch needs a
+  // bounds update. We can stop as soon as we hit an ancestor that already
+  // knows, since it will have informed its own ancestors in turn.
+  for (View* v = parent_; v && !v->descendants_root_bounds_dirty_;
+       v = v->parent_) {
+    v->descendants_root_bounds_dirty_ = true;
+    if (v->IsPaintRoot())
+      break;
+  }
+
   if (origin_changed) {
     // Inform our children that their root bounds are dirty, as their relative
     // coordinates in paint root space have changed since ours have changed.
@@ -2017,10 +2031,11 @@ void View::UpdateRootBounds(BoundsTree* tree, const gfx::Vector2d& offset) {
   if (!visible_)
     return;
 
-  if (!root_bounds_dirty_ && children_.empty())
+  // No need to recompute bounds if neither we nor any view in our subtree
+  // has been flagged as dirty.
+  if (!root_bounds_dirty_ && !descendants_root_bounds_dirty_)
     return;
 
-  // No need to recompute bounds if we haven't flagged ours as dirty.
   TRACE_EVENT1("views", "View::UpdateRootBounds", "class", GetClassName());
 
   // Add our own offset to the provided offset, for our own bounds update and
@@ -2035,12 +2050,16 @@ void View::UpdateRootBounds(BoundsTree* tree, const gfx::Vector2d& offset) {
     tree->Insert(bounds, reinterpret_cast<intptr_t>(this));
   }
 
-  // Update our children's bounds if needed.
-  for (Views::const_iterator i(children_.begin()); i != children_.end(); ++i) {
-    // We don't descend in to layer views for bounds recomputation, as they
-    // manage their own RTree as paint roots.
-    if (!(*i)->IsPaintRoot())
-      (*i)->UpdateRootBounds(tree, view_offset);
+  // Update our children's bounds if any of them have been flagged as dirty.
+  if (descendants_root_bounds_dirty_) {
+    descendants_root_bounds_dirty_ = false;
+    for (Views::const_iterator i(children_.begin()); i != children_.end();
+         ++i) {
+      // We don't descend in to layer views for bounds recomputation, as they
+      // manage their own RTree as paint roots.
+      if (!(*i)->IsPaintRoot())
+        (*i)->UpdateRootBounds(tree, view_offset);
+    }
   }
 }
 
@@ -2048,6 +2067,7 @@ void View::RemoveRootBounds(BoundsTree* tree) {
   tree->Remove(reinterpret_cast<intptr_t>(this));
 
   root_bounds_dirty_ = true;
+  descendants_root_bounds_dirty_ = true;
 
   for (Views::const_iterator i(children_.begin()); i != children_.end(); ++i) {
     if (!(*i)->IsPaintRoot())
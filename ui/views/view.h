@@ -1317,7 +1317,9 @@ class VIEWS_EXPORT View : public ui::LayerDelegate,
 
   // Sets the bit indicating that the cached bounds for this object within the
   // root view bounds tree are no longer valid. If |origin_changed| is true sets
-  // the same bit for all of our children as well.
+  // the same bit for all of our children as well. Also marks the path from
+  // here up to the paint root as having dirty descendants, so that the next
+  // bounds update only descends into branches that actually changed.
   void SetRootBoundsDirty(bool origin_changed);
 
   // If needed, updates the bounds rectangle in paint root coordinate space
@@ -1514,6 +1516,11 @@ class VIEWS_EXPORT View : public ui::LayerDelegate,
   // paint root view constructed the spatial database.
   bool root_bounds_dirty_;
 
+  // True if any view in our subtree may have dirty root bounds. Lets
+  // UpdateRootBounds() skip descending into subtrees that haven't changed
+  // since the last paint.
+  bool descendants_root_bounds_dirty_;
+
   // If this View IsPaintRoot() then this will be a pointer to a spatial data
   // structure where we will keep the bounding boxes of all our children, for
   // efficient paint damage rectangle intersection.
@@ -284,8 +284,22 @@ bool DoPartialPath(const CHAR* spec,
           // This character should be escaped.
           AppendEscapedChar(out_ch, output);
         }
+      } else if (sizeof(CHAR) == sizeof(char)) {
+        // Nothing special about this character. For 8-bit input the table
+        // covers the whole character range, so we can scan ahead and copy the
+        // entire run of plain characters at once rather than byte-by-byte.
+        // Already-canonical paths, the common case, are handled almost
+        // entirely by this branch.
+        int run_begin = i;
+        while (i + 1 < end &&
+               !(kPathCharLookup[static_cast<unsigned char>(spec[i + 1])] &
+                 SPECIAL)) {
+          i++;
+        }
+        output->Append(reinterpret_cast<const char*>(spec) + run_begin,
+                       i - run_begin + 1);
       } else {
-        // Nothing special about this character, just append it.
+        // Plain character in wide input, just append it.
         output->push_back(out_ch);
       }
     }
@@ -1059,6 +1059,8 @@ TEST(URLCanonTest, Path) {
     {"/%7Ffp3%3Eju%3Dduvgw%3Dd", L"/%7Ffp3%3Eju%3Dduvgw%3Dd", "/%7Ffp3%3Eju%3Dduvgw%3Dd", Component(0, 24), true},
       // @ should be passed through unchanged (escaped or unescaped).
     {"/@asdf%40", L"/@asdf%40", "/@asdf%40", Component(0, 9), true},
+      // Long runs of unexceptional characters should be copied unchanged.
+    {"/abcdefghijklmnopqrstuvwxyz0123456789/x.html", L"/abcdefghijklmnopqrstuvwxyz0123456789/x.html", "/abcdefghijklmnopqrstuvwxyz0123456789/x.html", Component(0, 44), true},
 
     // ----- encoding tests -----
       // Basic conversions